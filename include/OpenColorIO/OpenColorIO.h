@@ -135,6 +135,16 @@ public:
  */
 extern OCIOEXPORT void ClearAllCaches();
 
+/**
+ * \brief Get the memory held by the global caches i.e. one entry for the cache of the LUT file
+ * contents and one for the cache of the optimized op lists.
+ *
+ * \note
+ *   Like ClearAllCaches, it does not include the instance-specific caches (refer to
+ *   Config::getProcessorCacheMemoryUsage).
+ */
+extern OCIOEXPORT ConstMemoryUsageRcPtr GetCachesMemoryUsage();
+
 /**
  * \brief Get the version number for the library, as a dot-delimited string 
  *     (e.g., "1.0.0").
@@ -186,6 +196,23 @@ extern OCIOEXPORT void LogMessage(LoggingLevel level, const char * message);
 extern OCIOEXPORT void SetComputeHashFunction(ComputeHashFunction hashFunction);
 extern OCIOEXPORT void ResetComputeHashFunction();
 
+/**
+ * \brief Set the function called each time a trace span completes.
+ *
+ * The spans measure the expensive steps of the processor creation i.e. the config loading, the
+ * LUT file reading, the op optimization and the CPU & GPU renderer finalization. The events
+ * of the spans which are nested are sent before the enclosing one. The function could be
+ * called from any thread using the library. The \ref OCIO_TRACE_FILE_ENVVAR environment
+ * variable writes the same events to a Chrome trace-event JSON file.
+ *
+ * \note
+ *     The spans are not recorded when the library is built with OCIO_ENABLE_TRACING=OFF.
+ */
+extern OCIOEXPORT void SetTraceFunction(TraceFunction traceFunction);
+extern OCIOEXPORT void ResetTraceFunction();
+/// Return true if the trace spans are recorded i.e. a trace function or file is active.
+extern OCIOEXPORT bool IsTracingEnabled();
+
 //
 // Note that the following environment variable access methods are not thread safe.
 //
@@ -1596,6 +1623,12 @@ public:
      */
     void clearProcessorCache() noexcept;
 
+    /**
+     * \brief Get the memory held by this config's cache of Processor instances, with one entry
+     * per cached processor (see Processor::getMemoryUsage).
+     */
+    ConstMemoryUsageRcPtr getProcessorCacheMemoryUsage() const;
+
     /// Set the ConfigIOProxy object used to provision the config and LUTs from somewhere other
     /// than the file system.  (This is set on the config's embedded Context object.)
     void setConfigIOProxy(ConfigIOProxyRcPtr ciop);
@@ -2212,6 +2245,7 @@ private:
     static void deleter(ColorSpace* c);
 
     class Impl;
+    friend class ColorSpaceLazyTransforms;
     Impl * m_impl;
     Impl * getImpl() { return m_impl; }
     const Impl * getImpl() const { return m_impl; }
@@ -2659,6 +2693,18 @@ public:
      */
     ConstProcessorMetadataRcPtr getProcessorMetadata() const;
 
+    /**
+     * The OptimizationReport describes how the ops were optimized. It is only filled for a
+     * processor returned by getOptimizedProcessor() with the OPTIMIZATION_REPORT flag.
+     */
+    ConstOptimizationReportRcPtr getOptimizationReport() const;
+
+    /**
+     * Get the memory held by the ops (e.g. the LUT values), with one entry per op. The CPU,
+     * GPU and optimized processors cached by this instance are not included.
+     */
+    ConstMemoryUsageRcPtr getMemoryUsage() const;
+
     /**
      * Get a FormatMetadata containing the top level metadata
      * for the processor.  For a processor from a CLF file, this corresponds to
@@ -2686,6 +2732,33 @@ public:
      */
     GroupTransformRcPtr createGroupTransform() const;
 
+    /**
+     * \brief Write the processor into a versioned binary format.
+     *
+     * The binary format stores the ops of the processor (including the raw LUT arrays), the
+     * processor cache ID and a dependency fingerprint so that the processor could later be
+     * recreated using \ref Processor::CreateFromSerializedFile without parsing the config or
+     * any LUT file. Call it on an optimized processor (see \ref getOptimizedProcessor) so the
+     * recreated processor does not need to be optimized again. The stream must be opened in
+     * binary mode and be positioned at the start of the file.
+     *
+     * \param os The output stream.
+     * \param fingerprint Identifies the dependencies of the processor (e.g. the config cache ID
+     * for the context in use) and could be null.
+     */
+    void serialize(std::ostream & os, const char * fingerprint) const;
+
+    /**
+     * \brief Create a processor from a file written by \ref Processor::serialize.
+     *
+     * The file is memory mapped to limit copies. Throws if the file does not exist, is not
+     * valid, was written by an incompatible library version, or if the fingerprint is not null
+     * or empty and does not match the one of the file. The returned processor keeps the cache
+     * ID of the serialized one.
+     */
+    static ConstProcessorRcPtr CreateFromSerializedFile(const char * filePath,
+                                                        const char * fingerprint);
+
     /**
      * The returned pointer may be used to set the default value of any dynamic
      * properties of the requested type.  Throws if the requested property is not found.  Note
@@ -2779,6 +2852,34 @@ public:
                                                     BitDepth outBitDepth,
                                                     OptimizationFlags oFlags) const;
 
+    /**
+     * \brief Get an optimized CPUProcessor instance where the whole color processing could be
+     * baked into LUTs.
+     *
+     * The color processing is sampled into a Lut1D when there is no channel crosstalk, otherwise
+     * into a Lut3D with an optional log shaper. The shaper and the Lut3D size (up to 65) are
+     * automatically selected: the cheapest candidate whose max error against the exact color
+     * processing is within bakeTolerance is used. If none is accurate enough (or bakeTolerance
+     * is not positive), this returns the same CPUProcessor as the method without tolerance. The
+     * error is the absolute difference for pixel values up to 1, and is relative to the largest
+     * RGB component of the pixel above.
+     *
+     * \note
+     *    The error is measured over the [0, 1] domain for integer input bit-depths, and over
+     *    the [0, 256] domain for float input bit-depths. For float input bit-depths, some
+     *    values outside of this domain (negative, larger or NaN) are also checked: as the baked
+     *    LUTs clamp them (and map NaNs to 0), the color processing is only baked if it handles
+     *    them the same way within bakeTolerance.
+     *
+     * \note
+     *    The color processing is not baked if it has dynamic properties unless
+     *    OPTIMIZATION_NO_DYNAMIC_PROPERTIES is used.
+     */
+    ConstCPUProcessorRcPtr getOptimizedCPUProcessor(BitDepth inBitDepth,
+                                                    BitDepth outBitDepth,
+                                                    OptimizationFlags oFlags,
+                                                    float bakeTolerance) const;
+
     Processor(const Processor &) = delete;
     Processor & operator= (const Processor &) = delete;
     /// Do not use (needed only for pybind11).
@@ -2839,6 +2940,19 @@ public:
     /// True if at least one dynamic property of any type exists and is dynamic.
     bool isDynamic() const noexcept;
 
+    /**
+     * The OptimizationReport describes how the ops were optimized and the time spent to
+     * create the CPU renderer of each of the remaining ops. It is only filled when the
+     * processor is created with the OPTIMIZATION_REPORT flag.
+     */
+    ConstOptimizationReportRcPtr getOptimizationReport() const;
+
+    /**
+     * Get the memory held by the CPU renderers (e.g. the optimized LUT tables), with one entry
+     * per optimized op named after its type (e.g. "LUT3D"). It is computed on each call.
+     */
+    ConstMemoryUsageRcPtr getMemoryUsage() const;
+
     /**
      * \brief Apply to an image with any kind of channel ordering while
      * respecting the input and output bit-depths.
@@ -2858,6 +2972,27 @@ public:
     void applyRGB(float * pixel) const;
     void applyRGBA(float * pixel) const;
 
+    /**
+     * Apply to an array of pixels (e.g. the colors of a color picker or of a point cloud)
+     * respecting that the input and output bit-depths be 32-bit float. Each pixel is packed
+     * RGB/RGBA and pixelStrideBytes is the number of bytes from one pixel to the next one (i.e.
+     * the pixels could be members of an array of structures), or AutoStride if the pixels are
+     * contiguous.
+     *
+     * \note
+     *    The pixels are processed by batches so it is much faster than processing each pixel
+     *    with the single pixel methods above.
+     */
+    void applyRGB(float * pixels, long numPixels, ptrdiff_t pixelStrideBytes) const;
+    void applyRGBA(float * pixels, long numPixels, ptrdiff_t pixelStrideBytes) const;
+
+    /**
+     * Apply to an array of pixels stored as one array per channel (i.e. a structure of arrays)
+     * respecting that the input and output bit-depths be 32-bit float.
+     */
+    void applyRGB(float * red, float * green, float * blue, long numPixels) const;
+    void applyRGBA(float * red, float * green, float * blue, float * alpha, long numPixels) const;
+
     CPUProcessor(const CPUProcessor &) = delete;
     CPUProcessor& operator= (const CPUProcessor &) = delete;
     /// Do not use (needed only for pybind11).
@@ -2894,6 +3029,12 @@ public:
 
     /// Extract the shader information using a custom GpuShaderCreator class.
     void extractGpuShaderInfo(GpuShaderCreatorRcPtr & shaderCreator) const;
+
+    /**
+     * Get the memory held by the optimized ops, with one entry per op, and by the shader
+     * information (i.e. shader text and textures) cached by extractGpuShaderInfo().
+     */
+    ConstMemoryUsageRcPtr getMemoryUsage() const;
     
     GPUProcessor(const GPUProcessor &) = delete;
     GPUProcessor& operator= (const GPUProcessor &) = delete;
@@ -2951,6 +3092,114 @@ private:
     const Impl * getImpl() const { return m_impl; }
 };
 
+/**
+ * \brief
+ *
+ * This class contains information about the optimization of a processor i.e. the number
+ * of optimization passes, how many times each optimization rule changed the ops and the time
+ * spent in it, the ops before and after the optimization and, for a CPU processor, the time
+ * spent to create the renderer of each op. It helps to find the color transformations that
+ * are expensive to prepare.  The results of these functions do not impact the pixel
+ * processing. The report is only filled when the OPTIMIZATION_REPORT flag is set.
+ *
+ * \note All the times are in milliseconds.
+ */
+class OCIOEXPORT OptimizationReport
+{
+public:
+    /// Number of passes of the main optimization loop.
+    int getNumPasses() const;
+
+    /// True if the optimized ops were found in the cache of optimized op lists.
+    bool isFromCache() const;
+
+    /// Total time spent to optimize the ops.
+    double getOptimizationTime() const;
+
+    /**
+     * Optimization rules, in the order they were first applied. The count is the number of
+     * changes made by the rule (e.g. the number of removed ops).
+     */
+    int getNumRules() const;
+    const char * getRuleName(int index) const;
+    int getRuleCount(int index) const;
+    double getRuleTime(int index) const;
+
+    /// Type of each op (e.g. "<MatrixOffsetOp>") before the optimization.
+    int getNumOpsBefore() const;
+    const char * getOpBefore(int index) const;
+
+    /// Type of each op after the optimization.
+    int getNumOpsAfter() const;
+    const char * getOpAfter(int index) const;
+
+    /// CPU renderers (i.e. only for a CPUProcessor) and the time to create each of them.
+    int getNumRenderers() const;
+    const char * getRendererName(int index) const;
+    double getRendererTime(int index) const;
+
+    OptimizationReport(const OptimizationReport &) = delete;
+    OptimizationReport& operator= (const OptimizationReport &) = delete;
+    /// Do not use (needed only for pybind11).
+    ~OptimizationReport();
+
+private:
+    OptimizationReport();
+
+    static OptimizationReportRcPtr Create();
+
+    static void deleter(OptimizationReport* c);
+
+    class Impl;
+    friend class OptimizationReportBuilder;
+    Impl * m_impl;
+    Impl * getImpl() { return m_impl; }
+    const Impl * getImpl() const { return m_impl; }
+};
+
+extern OCIOEXPORT std::ostream & operator<< (std::ostream &, const OptimizationReport &);
+
+
+/**
+ * \brief
+ *
+ * This class describes the memory held by a processor or by a cache as a list of named
+ * entries (e.g. one per op). The sizes, in bytes, are estimates of the memory allocated for
+ * the large data only, i.e. the op parameters such as the LUT values and the tables built to
+ * apply them. Note that some data could be shared (e.g. the values of a LUT file used by
+ * several processors) so the sizes of different reports may not add up.
+ */
+class OCIOEXPORT MemoryUsage
+{
+public:
+    static MemoryUsageRcPtr Create();
+
+    /// Sum of the entry sizes.
+    size_t getTotalSize() const;
+
+    int getNumEntries() const;
+    const char * getEntryName(int index) const;
+    size_t getEntrySize(int index) const;
+    void addEntry(const char * name, size_t size);
+
+    MemoryUsage(const MemoryUsage &) = delete;
+    MemoryUsage& operator= (const MemoryUsage &) = delete;
+    /// Do not use (needed only for pybind11).
+    ~MemoryUsage();
+
+private:
+    MemoryUsage();
+
+    static void deleter(MemoryUsage* c);
+
+    class Impl;
+    Impl * m_impl;
+    Impl * getImpl() { return m_impl; }
+    const Impl * getImpl() const { return m_impl; }
+};
+
+extern OCIOEXPORT std::ostream & operator<< (std::ostream &, const MemoryUsage &);
+
 
 
 /**
@@ -3422,6 +3671,32 @@ public:
     virtual void setAllowTexture1D(bool allowed) = 0;
     virtual bool getAllowTexture1D() const = 0;
 
+    /**
+     * Bit-depth of the texture values to upload to the GPU. The default, BIT_DEPTH_F32, keeps
+     * the 32-bit float values. BIT_DEPTH_F16 requests half-float values (i.e. a relative
+     * precision of 2^-11 and values clamped to +/-65504) which halves the texture memory.
+     * BIT_DEPTH_UINT16 requests 16-bit normalized integers for the textures whose values are
+     * all within [0, 1], the other textures then use half-float values.
+     *
+     * \note The packed values are available using GpuShaderDesc::getTextureData() and
+     * GpuShaderDesc::get3DTextureData(). The shader code is identical for all the bit-depths
+     * as the GPU always returns float values when sampling these textures.
+     */
+    void setTextureBitDepth(BitDepth bitDepth);
+    BitDepth getTextureBitDepth() const noexcept;
+
+    /**
+     * Declare all the uniforms (i.e. the dynamic properties) as the members of one uniform block
+     * using the std140 layout instead of individual uniforms. The client application then
+     * updates all the dynamic properties with a single buffer upload, refer to
+     * GpuShaderDesc::fillUniformBuffer(). The uniform block is named "<function name>_Parameters".
+     *
+     * \note Only supported by GPU_LANGUAGE_GLSL_4_0 and GPU_LANGUAGE_GLSL_ES_3_0, the other
+     * languages ignore it. GPU_LANGUAGE_GLSL_VK_4_6 always uses a uniform block.
+     */
+    void setUseUniformBlock(bool use);
+    bool getUseUniformBlock() const noexcept;
+
     /**
      * To avoid global texture sampler and uniform name clashes always append an increasing index
      * to the resource name.
@@ -3777,6 +4052,17 @@ public:
     **/
     virtual std::size_t getUniformBufferSize() const noexcept = 0;
 
+    /**
+     * Fill the buffer with the current values of all the uniforms using their m_bufferOffset,
+     * i.e. the std140 layout of the uniform block. Doubles are written as 32-bit floats,
+     * booleans as 32-bit integers and the array elements use a 16-byte stride. The padding
+     * bytes are set to zero.
+     *
+     * \param buffer The buffer to fill.
+     * \param bufferSize Size of the buffer in bytes, must be at least getUniformBufferSize().
+     */
+    void fillUniformBuffer(void * buffer, std::size_t bufferSize) const;
+
     /**
      * The getTexture methods are used to access Lut1D arrays to upload to the GPU as textures.
      * Please note that the index used here is based on the total number of Lut1Ds used by 
@@ -3795,6 +4081,26 @@ public:
     virtual void getTextureValues(unsigned index, const float *& values) const = 0;
     /// Get the index used to declare the texture in the shader for languages such as Vulkan.
     virtual unsigned getTextureShaderBindingIndex(unsigned index) const = 0;
+    /**
+     * Get a hash of the texture content (i.e. its size, channels and values). Textures having
+     * the same cache ID hold identical values, even across shaders from different processors,
+     * so a client application may upload such a texture only once and share it. Identical
+     * textures also share the buffer returned by getTextureValues().
+     *
+     * The default implementation returns an empty string, meaning that the texture content is
+     * unknown and must not be shared.
+     */
+    virtual const char * getTextureCacheID(unsigned index) const;
+    /**
+     * Get the texture values using the bit-depth requested with setTextureBitDepth(). The
+     * bitDepth is BIT_DEPTH_F32 (i.e. the float values from getTextureValues()), BIT_DEPTH_F16
+     * (i.e. half-float values) or BIT_DEPTH_UINT16 (i.e. unsigned short values where 65535
+     * represents 1.0).
+     *
+     * The default implementation returns the getTextureValues() float values and ignores the
+     * requested bit-depth.
+     */
+    virtual void getTextureData(unsigned index, BitDepth & bitDepth, const void *& data) const;
 
     /**
      * The get3DTexture methods are used to access Lut3D arrays to upload to the GPU as textures.
@@ -3811,6 +4117,10 @@ public:
     virtual void get3DTextureValues(unsigned index, const float *& values) const = 0;
     /// Get the index used to declare the texture in the shader for languages such as Vulkan.
     virtual unsigned get3DTextureShaderBindingIndex(unsigned index) const = 0;
+    /// Get a hash of the 3D texture content (refer to getTextureCacheID()).
+    virtual const char * get3DTextureCacheID(unsigned index) const;
+    /// Get the 3D texture values using the requested bit-depth (refer to getTextureData()).
+    virtual void get3DTextureData(unsigned index, BitDepth & bitDepth, const void *& data) const;
 
     /// Get the complete OCIO shader program.
     const char * getShaderText() const noexcept;
@@ -80,6 +80,14 @@ class OCIOEXPORT ProcessorMetadata;
 typedef OCIO_SHARED_PTR<const ProcessorMetadata> ConstProcessorMetadataRcPtr;
 typedef OCIO_SHARED_PTR<ProcessorMetadata> ProcessorMetadataRcPtr;
 
+class OCIOEXPORT OptimizationReport;
+typedef OCIO_SHARED_PTR<const OptimizationReport> ConstOptimizationReportRcPtr;
+typedef OCIO_SHARED_PTR<OptimizationReport> OptimizationReportRcPtr;
+
+class OCIOEXPORT MemoryUsage;
+typedef OCIO_SHARED_PTR<const MemoryUsage> ConstMemoryUsageRcPtr;
+typedef OCIO_SHARED_PTR<MemoryUsage> MemoryUsageRcPtr;
+
 class OCIOEXPORT Baker;
 typedef OCIO_SHARED_PTR<const Baker> ConstBakerRcPtr;
 typedef OCIO_SHARED_PTR<Baker> BakerRcPtr;
@@ -299,6 +307,26 @@ enum LoggingLevel
 /// Define Compute Hash function signature.
 using ComputeHashFunction = std::function<std::string(const std::string &)>;
 
+/**
+ * \brief Describe a completed trace span (see \ref SetTraceFunction).
+ *
+ * The times are in microseconds from an arbitrary process-wide origin. The strings are only
+ * valid during the call of the trace function.
+ */
+struct TraceEvent
+{
+    const char * name = "";          ///< Name of the span e.g. "OpRcPtrVec::optimize".
+    const char * category = "";      ///< Category of the span e.g. "config", "file", "cpu".
+    const char * detail = "";        ///< Optional detail e.g. the path of a LUT file.
+    double start = 0.;               ///< Start time in microseconds.
+    double duration = 0.;            ///< Duration in microseconds.
+    unsigned long long threadID = 0; ///< Identifier of the thread, starting at 1.
+    unsigned depth = 0;              ///< Nesting level of the span in its thread.
+};
+
+/// Define the trace function signature.
+using TraceFunction = std::function<void(const TraceEvent &)>;
+
 /**
  * OCIO does not mandate the image state of the main reference space and it is not
  * required to be scene-referred.  This enum is used in connection with the display color space
@@ -686,8 +714,17 @@ enum OptimizationFlags : unsigned long
      */
     OPTIMIZATION_NO_DYNAMIC_PROPERTIES           = 0x10000000,
 
-    /// Apply all possible optimizations.
-    OPTIMIZATION_ALL                             = 0xFFFFFFFF,
+    /**
+     * Fill the OptimizationReport of the optimized processors. It does not change the color
+     * processing, it only adds the cost of collecting the report to the processor creation.
+     *
+     * \note It is not an optimization so it is not part of OPTIMIZATION_ALL (nor of the other
+     * groupings below) i.e. it always has to be explicitly requested.
+     */
+    OPTIMIZATION_REPORT                          = 0x20000000,
+
+    /// Apply all possible optimizations (i.e. all the flags except OPTIMIZATION_REPORT).
+    OPTIMIZATION_ALL                             = 0xDFFFFFFF,
 
     // The following groupings of flags are provided as a convenient way to select an overall
     // optimization level.
@@ -828,6 +865,7 @@ extern OCIOEXPORT const char * OCIO_INACTIVE_COLORSPACES_ENVVAR;
  * Remove the variable or set the value to empty to not use it. Set the value of the variable
  * to the desired optimization level as either an integer or hexadecimal value.
  * Ex: OCIO_OPTIMIZATION_FLAGS="144457667" or "0x89c3fc3" for OPTIMIZATION_LOSSLESS.
+ * The variable does not change whether the OPTIMIZATION_REPORT flag is set.
  */
 extern OCIOEXPORT const char * OCIO_OPTIMIZATION_FLAGS_ENVVAR;
 
@@ -842,6 +880,51 @@ extern OCIOEXPORT const char * OCIO_OPTIMIZATION_FLAGS_ENVVAR;
  */
 extern OCIOEXPORT const char * OCIO_USER_CATEGORIES_ENVVAR;
 
+/**
+ * The envvar 'OCIO_LAZY_TRANSFORMS' enables the lazy loading of the color space transforms
+ * when reading a config file. When present, only the color space catalog data (e.g. names,
+ * aliases, families, categories) is loaded and the to/from reference transforms are only
+ * created on first access. This reduces the load time and memory of very large configs when
+ * an application only uses a few color spaces. Note that errors in a lazily loaded transform
+ * are only reported when the transform is used or when the config is validated.
+ */
+extern OCIOEXPORT const char * OCIO_LAZY_TRANSFORMS_ENVVAR;
+
+/**
+ * The envvar 'OCIO_SEARCH_PATH_INDEX' enables an index of the directories used to resolve the
+ * relative file references (e.g. the search paths). Each directory is listed once and a file
+ * which is not listed is then known to be missing without checking the file system. That's
+ * useful on network file systems where each check is expensive. The value is the time to live
+ * in seconds of a directory listing, an empty value or '0' meaning that the listings are kept
+ * until \ref ClearAllCaches is called.
+ */
+extern OCIOEXPORT const char * OCIO_SEARCH_PATH_INDEX_ENVVAR;
+
+/**
+ * The envvar 'OCIO_TRACE_FILE' is the path of a Chrome trace-event JSON file where the library
+ * writes the duration of the config loading, LUT file reading, op optimization and renderer
+ * finalization steps (see \ref SetTraceFunction). The file is completed when the application
+ * exits and could be opened with chrome://tracing or https://ui.perfetto.dev.
+ */
+extern OCIOEXPORT const char * OCIO_TRACE_FILE_ENVVAR;
+
+/**
+ * The envvar 'OCIO_CPU_SIMD' limits the instruction sets used by the CPU renderers to 'none',
+ * 'sse2', 'avx', 'avx2' or 'avx512' (i.e. all the ones supported by the processor, which is
+ * the default). The value is read once, at the first CPU processor creation. That's useful to
+ * compare the performance or the results of the renderers on the same machine.
+ */
+extern OCIOEXPORT const char * OCIO_CPU_SIMD_ENVVAR;
+
+/**
+ * The envvar 'OCIO_NUM_THREADS' is the maximum number of threads the library uses for the
+ * expensive one-time computations (e.g. the inversion of a 3D LUT) done while creating a
+ * processor. By default, all the hardware threads are used for large enough jobs. Applications
+ * calling OCIO from their own thread pool could set it to '1' to only use the calling thread.
+ * The value is read once.
+ */
+extern OCIOEXPORT const char * OCIO_NUM_THREADS_ENVVAR;
+
 // TODO: Move to .rst
 /*!rst::
 Roles
@@ -115,6 +115,13 @@ ocio_handle_dependency(  minizip-ng REQUIRED ALLOW_INSTALL
                          RECOMMENDED_VERSION 4.0.10
                          RECOMMENDED_VERSION_REASON "Latest version tested with OCIO")
 
+###############################################################################
+
+# Threads
+# Some one-time computations (e.g. building the exact inverse of a Lut3D) use worker threads.
+set(THREADS_PREFER_PTHREAD_FLAG ON)
+ocio_handle_dependency(Threads REQUIRED)
+
 ###############################################################################
 ##
 ## Optional dependencies
@@ -9,6 +9,7 @@
 #if OCIO_USE_AVX2
 
 #include <immintrin.h>
+#include <limits>
 
 #include <OpenColorIO/OpenColorIO.h>
 #include "BitDepthUtils.h"
@@ -65,6 +66,82 @@ inline void avx2RGBATranspose_4x4_4x4(__m256 row0, __m256 row1, __m256 row2, __m
 
 }
 
+// log2 function in AVX2
+//
+// Same argument reduction and Chebyshev polynomial as sseLog2() (i.e. see SSE.h) but on
+// eight values at once and with fused multiply-adds.
+inline __m256 avx2Log2(__m256 x)
+{
+    // y = log2( x ) = log2( 2^exponent * mantissa )
+    //               = exponent + log2( mantissa )
+
+    const __m256i emask = _mm256_set1_epi32(0x7F800000);
+
+    const __m256 mantissa
+        = _mm256_or_ps(_mm256_andnot_ps(_mm256_castsi256_ps(emask), x), _mm256_set1_ps(1.0f));
+
+    __m256 log2 = _mm256_set1_ps((float)+4.487361286440374006195e-2);
+    log2 = _mm256_fmadd_ps(log2, mantissa, _mm256_set1_ps((float)-4.165637071209677112635e-1));
+    log2 = _mm256_fmadd_ps(log2, mantissa, _mm256_set1_ps((float)+1.631148826119436277100));
+    log2 = _mm256_fmadd_ps(log2, mantissa, _mm256_set1_ps((float)-3.550793018041176193407));
+    log2 = _mm256_fmadd_ps(log2, mantissa, _mm256_set1_ps((float)+5.091710879305474367557));
+    log2 = _mm256_fmadd_ps(log2, mantissa, _mm256_set1_ps((float)-2.800364054395965731506));
+
+    const __m256i exponent
+        = _mm256_sub_epi32(_mm256_srli_epi32(_mm256_and_si256(_mm256_castps_si256(x), emask), 23),
+                           _mm256_set1_epi32(127));
+
+    return _mm256_add_ps(log2, _mm256_cvtepi32_ps(exponent));
+}
+
+// exp2 function in AVX2
+//
+// Same argument reduction and Chebyshev polynomial as sseExp2() (i.e. see SSE.h) but on
+// eight values at once and with fused multiply-adds. The results underflow to zero below
+// -126 and overflow to infinity from 128.
+inline __m256 avx2Exp2(__m256 x)
+{
+    // y = exp2( x ) = exp2(integer + fraction)
+    //               = exp2(integer) * exp2(fraction)
+
+    // Note that the integer part is wrong for NaN and for values outside of the int range but
+    // the polynomial then returns NaN or the checks at the bottom fix the result.
+    const __m256 floor_x = _mm256_floor_ps(x);
+    const __m256 fraction = _mm256_sub_ps(x, floor_x);
+
+    // Compute exp2(floor_x) by moving floor_x to the exponent bits of the floating-point number.
+    const __m256 zf
+        = _mm256_castsi256_ps(
+            _mm256_slli_epi32(_mm256_add_epi32(_mm256_cvttps_epi32(floor_x),
+                                               _mm256_set1_epi32(127)),
+                              23));
+
+    __m256 mexp = _mm256_set1_ps((float)1.353416792833547468620e-2);
+    mexp = _mm256_fmadd_ps(mexp, fraction, _mm256_set1_ps((float)5.201146058412685018921e-2));
+    mexp = _mm256_fmadd_ps(mexp, fraction, _mm256_set1_ps((float)2.414427569091865207710e-1));
+    mexp = _mm256_fmadd_ps(mexp, fraction, _mm256_set1_ps((float)6.930038344665415134202e-1));
+    mexp = _mm256_fmadd_ps(mexp, fraction, _mm256_set1_ps((float)1.000002593370603213644));
+
+    __m256 exp2 = _mm256_mul_ps(zf, mexp);
+
+    // Handle the underflow and the overflow.
+    exp2 = _mm256_andnot_ps(_mm256_cmp_ps(x, _mm256_set1_ps(-126.0f), _CMP_LT_OQ), exp2);
+    exp2 = _mm256_blendv_ps(exp2,
+                            _mm256_set1_ps(std::numeric_limits<float>::infinity()),
+                            _mm256_cmp_ps(x, _mm256_set1_ps(128.0f), _CMP_GE_OQ));
+
+    return exp2;
+}
+
+// Power function in AVX2 i.e. pow( x, exp ) = exp2( exp * log2( x ) ).
+//
+// Results from base values smaller or equal to zero (and NaN) are mapped to zero.
+inline __m256 avx2Power(__m256 x, __m256 exp)
+{
+    const __m256 values = avx2Exp2(_mm256_mul_ps(exp, avx2Log2(x)));
+    return _mm256_and_ps(values, _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_GT_OQ));
+}
+
 // Note Packing functions perform no 0.0 - 1.0 normalization
 // but perform 0 - max value clamping for integer formats
 template<BitDepth BD> struct AVX2RGBAPack {};
@@ -9,6 +9,7 @@
 #if OCIO_USE_AVX512
 
 #include <immintrin.h>
+#include <limits>
 
 #include <OpenColorIO/OpenColorIO.h>
 #include "BitDepthUtils.h"
@@ -74,6 +75,87 @@ inline void avx512RGBATranspose_4x4_4x4_4x4_4x4(__m512 row0,   __m512 row1,   __
 
 }
 
+// log2 function in AVX-512
+//
+// Same argument reduction and Chebyshev polynomial as sseLog2() (i.e. see SSE.h) but on
+// sixteen values at once and with fused multiply-adds. Note that only the AVX-512F
+// instructions are available i.e. the bit-wise operations use the integer instructions.
+inline __m512 avx512Log2(__m512 x)
+{
+    // y = log2( x ) = log2( 2^exponent * mantissa )
+    //               = exponent + log2( mantissa )
+
+    const __m512i emask = _mm512_set1_epi32(0x7F800000);
+    const __m512i xi = _mm512_castps_si512(x);
+
+    const __m512 mantissa
+        = _mm512_castsi512_ps(_mm512_or_si512(_mm512_andnot_si512(emask, xi),
+                                              _mm512_castps_si512(_mm512_set1_ps(1.0f))));
+
+    __m512 log2 = _mm512_set1_ps((float)+4.487361286440374006195e-2);
+    log2 = _mm512_fmadd_ps(log2, mantissa, _mm512_set1_ps((float)-4.165637071209677112635e-1));
+    log2 = _mm512_fmadd_ps(log2, mantissa, _mm512_set1_ps((float)+1.631148826119436277100));
+    log2 = _mm512_fmadd_ps(log2, mantissa, _mm512_set1_ps((float)-3.550793018041176193407));
+    log2 = _mm512_fmadd_ps(log2, mantissa, _mm512_set1_ps((float)+5.091710879305474367557));
+    log2 = _mm512_fmadd_ps(log2, mantissa, _mm512_set1_ps((float)-2.800364054395965731506));
+
+    const __m512i exponent
+        = _mm512_sub_epi32(_mm512_srli_epi32(_mm512_and_si512(xi, emask), 23),
+                           _mm512_set1_epi32(127));
+
+    return _mm512_add_ps(log2, _mm512_cvtepi32_ps(exponent));
+}
+
+// exp2 function in AVX-512
+//
+// Same argument reduction and Chebyshev polynomial as sseExp2() (i.e. see SSE.h) but on
+// sixteen values at once and with fused multiply-adds. The results underflow to zero below
+// -126 and overflow to infinity from 128.
+inline __m512 avx512Exp2(__m512 x)
+{
+    // y = exp2( x ) = exp2(integer + fraction)
+    //               = exp2(integer) * exp2(fraction)
+
+    // Note that the integer part is wrong for NaN and for values outside of the int range but
+    // the polynomial then returns NaN or the checks at the bottom fix the result.
+    const __m512 floor_x = _mm512_roundscale_ps(x, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+    const __m512 fraction = _mm512_sub_ps(x, floor_x);
+
+    // Compute exp2(floor_x) by moving floor_x to the exponent bits of the floating-point number.
+    const __m512 zf
+        = _mm512_castsi512_ps(
+            _mm512_slli_epi32(_mm512_add_epi32(_mm512_cvttps_epi32(floor_x),
+                                               _mm512_set1_epi32(127)),
+                              23));
+
+    __m512 mexp = _mm512_set1_ps((float)1.353416792833547468620e-2);
+    mexp = _mm512_fmadd_ps(mexp, fraction, _mm512_set1_ps((float)5.201146058412685018921e-2));
+    mexp = _mm512_fmadd_ps(mexp, fraction, _mm512_set1_ps((float)2.414427569091865207710e-1));
+    mexp = _mm512_fmadd_ps(mexp, fraction, _mm512_set1_ps((float)6.930038344665415134202e-1));
+    mexp = _mm512_fmadd_ps(mexp, fraction, _mm512_set1_ps((float)1.000002593370603213644));
+
+    __m512 exp2 = _mm512_mul_ps(zf, mexp);
+
+    // Handle the underflow and the overflow.
+    exp2 = _mm512_mask_mov_ps(exp2,
+                              _mm512_cmp_ps_mask(x, _mm512_set1_ps(-126.0f), _CMP_LT_OQ),
+                              _mm512_setzero_ps());
+    exp2 = _mm512_mask_mov_ps(exp2,
+                              _mm512_cmp_ps_mask(x, _mm512_set1_ps(128.0f), _CMP_GE_OQ),
+                              _mm512_set1_ps(std::numeric_limits<float>::infinity()));
+
+    return exp2;
+}
+
+// Power function in AVX-512 i.e. pow( x, exp ) = exp2( exp * log2( x ) ).
+//
+// Results from base values smaller or equal to zero (and NaN) are mapped to zero.
+inline __m512 avx512Power(__m512 x, __m512 exp)
+{
+    const __m512 values = avx512Exp2(_mm512_mul_ps(exp, avx512Log2(x)));
+    return _mm512_maskz_mov_ps(_mm512_cmp_ps_mask(x, _mm512_setzero_ps(), _CMP_GT_OQ), values);
+}
+
 
 // Note Packing functions perform no 0.0 - 1.0 normalization
 // but perform 0 - max value clamping for integer formats
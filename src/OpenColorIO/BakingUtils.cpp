@@ -1,7 +1,18 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
 #include "BakingUtils.h"
+#include "MathUtils.h"
+#include "ops/lut1d/Lut1DOp.h"
+#include "ops/lut1d/Lut1DOpData.h"
+#include "ops/lut3d/Lut3DOp.h"
+#include "ops/lut3d/Lut3DOpData.h"
 
 namespace OCIO_NAMESPACE
 {
@@ -130,4 +141,275 @@ void GetTargetRange(const Baker & baker, float& start, float& end)
     return GetSrcRange(baker, baker.getTargetSpace(), start, end);
 }
 
+namespace
+{
+    // The Lut3D sizes to try, from the cheapest one.
+    constexpr unsigned long BAKE_LUT3D_SIZES[] { 17, 33, 65 };
+
+    constexpr long BAKE_NUM_TEST_VALUES = 16384;
+
+    // The shaper for float inputs is linear from 0 to 2^BAKE_FLOAT_DOMAIN_MIN_STOPS (using the
+    // output range of one stop) and then logarithmic up to 2^BAKE_FLOAT_DOMAIN_MAX_STOPS.
+    constexpr float BAKE_SHAPER_NUM_STOPS
+        = float(BAKE_FLOAT_DOMAIN_MAX_STOPS - BAKE_FLOAT_DOMAIN_MIN_STOPS);
+    constexpr float BAKE_SHAPER_LINEAR_RANGE = 1.0f / (BAKE_SHAPER_NUM_STOPS + 1.0f);
+
+    float ShaperForward(float in)
+    {
+        const float linearEnd = std::ldexp(1.0f, BAKE_FLOAT_DOMAIN_MIN_STOPS);
+
+        // Note that NaNs are mapped to 0.
+        if (!(in > 0.0f))
+        {
+            return 0.0f;
+        }
+        else if (in < linearEnd)
+        {
+            return in / linearEnd * BAKE_SHAPER_LINEAR_RANGE;
+        }
+
+        const float stops = std::log2(in) - float(BAKE_FLOAT_DOMAIN_MIN_STOPS);
+        return std::min(1.0f, BAKE_SHAPER_LINEAR_RANGE
+                              + (1.0f - BAKE_SHAPER_LINEAR_RANGE) * stops / BAKE_SHAPER_NUM_STOPS);
+    }
+
+    float ShaperInverse(float in)
+    {
+        if (in < BAKE_SHAPER_LINEAR_RANGE)
+        {
+            return in / BAKE_SHAPER_LINEAR_RANGE
+                   * std::ldexp(1.0f, BAKE_FLOAT_DOMAIN_MIN_STOPS);
+        }
+
+        const float stops
+            = (in - BAKE_SHAPER_LINEAR_RANGE) / (1.0f - BAKE_SHAPER_LINEAR_RANGE) * BAKE_SHAPER_NUM_STOPS;
+        return std::exp2(float(BAKE_FLOAT_DOMAIN_MIN_STOPS) + stops);
+    }
+
+    // Generate RGBA test values covering the input domain. A fixed seed is used so that the
+    // selected candidate does not change from one call to the other.
+    std::vector<float> GenerateTestValues(bool floatInput)
+    {
+        std::vector<float> values(BAKE_NUM_TEST_VALUES * 4);
+
+        uint32_t seed = 1234567u;
+        auto random = [&seed]() -> float
+        {
+            seed = 1664525u * seed + 1013904223u;
+            return float(seed >> 8) / float(1u << 24);
+        };
+
+        for (long idx = 0; idx < BAKE_NUM_TEST_VALUES; ++idx)
+        {
+            float * pixel = &values[4 * idx];
+            for (long channel = 0; channel < 3; ++channel)
+            {
+                // For float inputs, a quarter of the values are in [0, 1] and the others are
+                // evenly distributed in stops over the whole domain.
+                if (floatInput && (idx % 4) != 0)
+                {
+                    pixel[channel] = std::exp2(float(BAKE_FLOAT_DOMAIN_MIN_STOPS)
+                                               + random() * BAKE_SHAPER_NUM_STOPS);
+                }
+                else
+                {
+                    pixel[channel] = random();
+                }
+            }
+            pixel[3] = random();
+        }
+
+        // Add the bounds of the domain.
+        const float maxValue = floatInput ? std::ldexp(1.0f, BAKE_FLOAT_DOMAIN_MAX_STOPS) : 1.0f;
+        std::fill(values.begin(), values.begin() + 4, 0.0f);
+        std::fill(values.begin() + 4, values.begin() + 7, maxValue);
+        values[7] = 1.0f;
+
+        // Add float values outside of the domain, for all the color components and then only
+        // for the red one. The LUTs clamp them (and map the NaNs to zero) so such a bake is
+        // refused unless the color processing does the same.
+        if (floatInput)
+        {
+            const float outsideValues[] { -maxValue,
+                                          -1.0f,
+                                          -std::ldexp(1.0f, BAKE_FLOAT_DOMAIN_MIN_STOPS),
+                                          std::numeric_limits<float>::quiet_NaN(),
+                                          2.0f * maxValue,
+                                          64.0f * maxValue };
+
+            long pxl = 2;
+            for (const float value : outsideValues)
+            {
+                float * pixel = &values[4 * pxl++];
+                std::fill(pixel, pixel + 3, value);
+
+                pixel = &values[4 * pxl++];
+                pixel[0] = value;
+            }
+        }
+
+        return values;
+    }
+
+    // The error is absolute for values up to 1 and relative to the largest color component of
+    // the pixel above (so that a component close to zero with a large pixel value does not make
+    // the error explode).
+    float ComputeMaxError(const OpRcPtrVec & ops,
+                          const std::vector<float> & testValues,
+                          const std::vector<float> & refValues)
+    {
+        std::vector<float> values(testValues);
+        for (ConstOpRcPtr op : ops)
+        {
+            op->getCPUOp(false)->apply(values.data(), values.data(), BAKE_NUM_TEST_VALUES);
+        }
+
+        float maxError = 0.0f;
+        for (long pxl = 0; pxl < BAKE_NUM_TEST_VALUES; ++pxl)
+        {
+            const float * ref = &refValues[4 * pxl];
+            const float * val = &values[4 * pxl];
+
+            const float scale
+                = std::max({ 1.0f, std::abs(ref[0]), std::abs(ref[1]), std::abs(ref[2]) });
+
+            for (long channel = 0; channel < 4; ++channel)
+            {
+                if (ref[channel] == val[channel] || (IsNan(ref[channel]) && IsNan(val[channel])))
+                {
+                    continue;
+                }
+
+                const float error = std::abs(val[channel] - ref[channel])
+                                    / (channel < 3 ? scale : 1.0f);
+
+                // Non-finite values are never accurate enough.
+                if (!std::isfinite(error))
+                {
+                    return std::numeric_limits<float>::infinity();
+                }
+                maxError = std::max(maxError, error);
+            }
+        }
+
+        return maxError;
+    }
+
+    Lut1DOpDataRcPtr BakeLut1D(const ConstCPUProcessorRcPtr & cpu, bool floatInput)
+    {
+        // A half-domain LUT samples all the half float values, otherwise [0, 1] is sampled
+        // with enough values for any integer bit-depth.
+        Lut1DOpDataRcPtr lut
+            = floatInput ? std::make_shared<Lut1DOpData>(Lut1DOpData::LUT_INPUT_HALF_CODE,
+                                                         65536, true)
+                         : std::make_shared<Lut1DOpData>(65536);
+
+        Array::Values & values = lut->getArray().getValues();
+        PackedImageDesc img(values.data(), lut->getArray().getLength(), 1, 3);
+        cpu->apply(img);
+
+        return lut;
+    }
+
+    Lut1DOpDataRcPtr CreateShaperLut1D()
+    {
+        Lut1DOpDataRcPtr lut
+            = std::make_shared<Lut1DOpData>(Lut1DOpData::LUT_INPUT_HALF_CODE, 65536, true);
+
+        for (float & value : lut->getArray().getValues())
+        {
+            value = ShaperForward(value);
+        }
+
+        return lut;
+    }
+
+    Lut3DOpDataRcPtr BakeLut3D(const ConstCPUProcessorRcPtr & cpu,
+                               unsigned long gridSize,
+                               bool useShaper)
+    {
+        Lut3DOpDataRcPtr lut = std::make_shared<Lut3DOpData>(INTERP_TETRAHEDRAL, gridSize);
+
+        Array::Values & values = lut->getArray().getValues();
+        GenerateIdentityLut3D(values.data(), (int)gridSize, 3, LUT3DORDER_FAST_BLUE);
+
+        if (useShaper)
+        {
+            for (float & value : values)
+            {
+                value = ShaperInverse(value);
+            }
+        }
+
+        PackedImageDesc img(values.data(), gridSize * gridSize * gridSize, 1, 3);
+        cpu->apply(img);
+
+        return lut;
+    }
+} // Anonymous namespace
+
+bool BakeProcessorOps(OpRcPtrVec & bakedOps,
+                      float & maxError,
+                      const ConstCPUProcessorRcPtr & cpu,
+                      bool floatInput,
+                      float tolerance)
+{
+    const std::vector<float> testValues = GenerateTestValues(floatInput);
+
+    std::vector<float> refValues(testValues);
+    PackedImageDesc refImg(refValues.data(), BAKE_NUM_TEST_VALUES, 1, 4);
+    cpu->apply(refImg);
+
+    auto isAccurate = [&](OpRcPtrVec & ops) -> bool
+    {
+        ops.finalize();
+
+        const float error = ComputeMaxError(ops, testValues, refValues);
+        if (error <= tolerance)
+        {
+            bakedOps = ops;
+            maxError = error;
+            return true;
+        }
+        return false;
+    };
+
+    if (!cpu->hasChannelCrosstalk())
+    {
+        OpRcPtrVec ops;
+        Lut1DOpDataRcPtr lut = BakeLut1D(cpu, floatInput);
+        CreateLut1DOp(ops, lut, TRANSFORM_DIR_FORWARD);
+        return isAccurate(ops);
+    }
+
+    // Without a shaper, the Lut3D only covers [0, 1] so it is only accurate enough for float
+    // inputs if the color processing clamps the values.
+    Lut1DOpDataRcPtr shaper = floatInput ? CreateShaperLut1D() : Lut1DOpDataRcPtr();
+
+    for (const unsigned long gridSize : BAKE_LUT3D_SIZES)
+    {
+        OpRcPtrVec ops;
+        Lut3DOpDataRcPtr lut = BakeLut3D(cpu, gridSize, false);
+        CreateLut3DOp(ops, lut, TRANSFORM_DIR_FORWARD);
+        if (isAccurate(ops))
+        {
+            return true;
+        }
+
+        if (shaper)
+        {
+            OpRcPtrVec shaperOps;
+            CreateLut1DOp(shaperOps, shaper, TRANSFORM_DIR_FORWARD);
+            Lut3DOpDataRcPtr shapedLut = BakeLut3D(cpu, gridSize, true);
+            CreateLut3DOp(shaperOps, shapedLut, TRANSFORM_DIR_FORWARD);
+            if (isAccurate(shaperOps))
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
 } // namespace OCIO_NAMESPACE
@@ -7,6 +7,8 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "Op.h"
+
 
 namespace OCIO_NAMESPACE
 {
@@ -23,6 +25,22 @@ void GetShaperRange(const Baker & baker, float& start, float& end);
 
 void GetTargetRange(const Baker & baker, float& start, float& end);
 
+static constexpr int BAKE_FLOAT_DOMAIN_MIN_STOPS = -12;
+static constexpr int BAKE_FLOAT_DOMAIN_MAX_STOPS = 8;
+
+// Bake the color processing of an F32 CPU processor into LUT ops i.e. a Lut1D when there is no
+// channel crosstalk, otherwise an optional shaper Lut1D followed by a Lut3D. The shaper and the
+// Lut3D size of the smallest candidate whose max error (measured against the CPU processor over
+// a set of test values) is within the tolerance are selected. The test values are in [0, 1] for
+// integer input bit-depths and in [0, 2^BAKE_FLOAT_DOMAIN_MAX_STOPS] for float ones, which also
+// include negative, NaN and larger values so that the LUTs are only selected if the color
+// processing handles them the same way. Returns false if no candidate is accurate enough.
+bool BakeProcessorOps(OpRcPtrVec & bakedOps,
+                      float & maxError,
+                      const ConstCPUProcessorRcPtr & cpu,
+                      bool floatInput,
+                      float tolerance);
+
 
 } // namespace OCIO_NAMESPACE
 
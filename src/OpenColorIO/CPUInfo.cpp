@@ -3,6 +3,7 @@
 
 
 #include "CPUInfo.h"
+#include <stdlib.h>
 #include <string.h>
 
 #if _WIN32
@@ -223,9 +224,58 @@ CPUInfo::CPUInfo() // Unknown Processor
 
 #endif
 
+namespace
+{
+
+// Limit the instruction sets used by the CPU renderers to the one named by the OCIO_CPU_SIMD
+// environment variable (i.e. OCIO_CPU_SIMD_ENVVAR, which is not used here as ociocpuinfo
+// builds this file without the library). That's useful to benchmark or debug the renderers
+// of each instruction set on the same machine.
+void ApplySIMDLimit(unsigned int & flags)
+{
+    const char * value = getenv("OCIO_CPU_SIMD");
+    if (!value || !*value)
+    {
+        return;
+    }
+
+    static constexpr unsigned int SSE2Flags
+        = X86_CPU_FLAG_SSE2 | X86_CPU_FLAG_SSE2_SLOW | X86_CPU_FLAG_SSE3 | X86_CPU_FLAG_SSE3_SLOW
+        | X86_CPU_FLAG_SSSE3 | X86_CPU_FLAG_SSSE3_SLOW | X86_CPU_FLAG_SSE4 | X86_CPU_FLAG_SSE42;
+    static constexpr unsigned int AVXFlags
+        = SSE2Flags | X86_CPU_FLAG_AVX | X86_CPU_FLAG_AVX_SLOW | X86_CPU_FLAG_F16C;
+    static constexpr unsigned int AVX2Flags
+        = AVXFlags | X86_CPU_FLAG_AVX2 | X86_CPU_FLAG_AVX2_SLOWGATHER;
+
+    if (strcmp(value, "none") == 0)
+    {
+        flags = 0;
+    }
+    else if (strcmp(value, "sse2") == 0)
+    {
+        flags &= SSE2Flags;
+    }
+    else if (strcmp(value, "avx") == 0)
+    {
+        flags &= AVXFlags;
+    }
+    else if (strcmp(value, "avx2") == 0)
+    {
+        flags &= AVX2Flags;
+    }
+    // Otherwise (e.g. 'avx512'), all the supported instruction sets are used.
+}
+
+} // anonymous namespace
+
 CPUInfo& CPUInfo::instance()
 {
-    static CPUInfo singleton = CPUInfo();
+    static CPUInfo singleton = []()
+    {
+        CPUInfo info;
+        ApplySIMDLimit(info.flags);
+        return info;
+    }();
     return singleton;
 }
 
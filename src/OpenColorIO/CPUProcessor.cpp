@@ -1,6 +1,10 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
+#include <chrono>
+#include <initializer_list>
+#include <sstream>
 #include <string.h>
 
 #include <OpenColorIO/OpenColorIO.h>
@@ -12,6 +16,7 @@
 #include "ops/matrix/MatrixOp.h"
 #include "ops/range/RangeOpCPU.h"
 #include "ScanlineHelper.h"
+#include "Trace.h"
 
 
 namespace OCIO_NAMESPACE
@@ -128,8 +133,14 @@ void CreateCPUEngine(const OpRcPtrVec & ops,
                      // The remaining CPU Ops.
                      ConstOpCPURcPtrVec & cpuOps,
                      // The bit-depth 'cast' or the last CPU Op.
-                     ConstOpCPURcPtr & outBitDepthOp)
+                     ConstOpCPURcPtr & outBitDepthOp,
+                     // Collects the time to create each renderer, if not null.
+                     OptimizationReport * report,
+                     // The type of each op and the end of its renderers.
+                     OpRenderers & opRenderers)
 {
+    OCIO_TRACE_SCOPE("cpu", "CreateCPUEngine");
+
     const size_t maxOps = ops.size();
     const bool fastLogExpPow = HasFlag(oFlags, OPTIMIZATION_FAST_LOG_EXP_POW);
     for(size_t idx=0; idx<maxOps; ++idx)
@@ -137,6 +148,8 @@ void CreateCPUEngine(const OpRcPtrVec & ops,
         ConstOpRcPtr op = ops[idx];
         ConstOpDataRcPtr opData = op->data();
 
+        const auto start = std::chrono::steady_clock::now();
+
         if(idx==0)
         {
             if(opData->getType()==OpData::Lut1DType)
@@ -180,6 +193,18 @@ void CreateCPUEngine(const OpRcPtrVec & ops,
         {
             cpuOps.push_back(op->getCPUOp(fastLogExpPow));
         }
+
+        if (report)
+        {
+            const std::chrono::duration<double, std::milli> elapsed
+                = std::chrono::steady_clock::now() - start;
+            OptimizationReportBuilder::AddRenderer(*report, op->getInfo().c_str(),
+                                                   elapsed.count());
+        }
+
+        // The renderers are indexed as the in bit-depth op, the CPU ops and the out bit-depth op.
+        const size_t end = (idx == maxOps - 1) ? cpuOps.size() + 2 : cpuOps.size() + 1;
+        opRenderers.emplace_back(opData->getType(), end);
     }
 }
 
@@ -239,6 +264,33 @@ case in:                                              \
     throw Exception("Unsupported bit-depths");
 }
 
+ConstMemoryUsageRcPtr CPUProcessor::Impl::getMemoryUsage() const
+{
+    auto GetRendererMemoryUsage = [this](size_t idx) -> size_t
+    {
+        const ConstOpCPURcPtr & renderer
+            = (idx == 0) ? m_inBitDepthOp
+                         : (idx <= m_cpuOps.size() ? m_cpuOps[idx - 1] : m_outBitDepthOp);
+        return renderer ? renderer->getMemoryUsage() : 0;
+    };
+
+    MemoryUsageRcPtr memoryUsage = MemoryUsage::Create();
+
+    size_t begin = 0;
+    for (const auto & op : m_opRenderers)
+    {
+        size_t size = 0;
+        for (size_t idx = begin; idx < op.second; ++idx)
+        {
+            size += GetRendererMemoryUsage(idx);
+        }
+        memoryUsage->addEntry(GetTypeName(op.first), size);
+        begin = op.second;
+    }
+
+    return memoryUsage;
+}
+
 bool CPUProcessor::Impl::isDynamic() const noexcept
 {
     if (m_inBitDepthOp->isDynamic())
@@ -310,18 +362,36 @@ DynamicPropertyRcPtr CPUProcessor::Impl::getDynamicProperty(DynamicPropertyType
 
 void FinalizeOpsForCPU(OpRcPtrVec & ops, const OpRcPtrVec & rawOps,
                        BitDepth in, BitDepth out,
-                       OptimizationFlags oFlags)
+                       OptimizationFlags oFlags,
+                       OptimizationReport * report)
 {
     ops = rawOps;
 
+    if (report)
+    {
+        for (const auto & op : ops)
+        {
+            OptimizationReportBuilder::AddOpBefore(*report, op->getInfo().c_str());
+        }
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+
     if(!ops.empty())
     {
         // Finalize of all ops.
         ops.finalize();
 
         // Optimize the ops.
-        ops.optimize(oFlags);
-        ops.optimizeForBitdepth(in, out, oFlags);
+        ops.optimize(oFlags, report);
+        ops.optimizeForBitdepth(in, out, oFlags, report);
+    }
+
+    if (report)
+    {
+        const std::chrono::duration<double, std::milli> elapsed
+            = std::chrono::steady_clock::now() - start;
+        OptimizationReportBuilder::SetOptimizationTime(*report, elapsed.count());
     }
 
     // The previous code could change the list of ops so an explicit check to empty is still needed.
@@ -346,8 +416,24 @@ void CPUProcessor::Impl::finalize(const OpRcPtrVec & rawOps,
 
     // Get the ops of the color transformation without the bit-depth adjustments.
 
+    // The report is only collected on request as it costs the op descriptions & timings.
+    OptimizationReportRcPtr report;
+    if (HasFlag(oFlags, OPTIMIZATION_REPORT))
+    {
+        report = OptimizationReportBuilder::Create();
+        oFlags = OptimizationFlags(oFlags & ~OPTIMIZATION_REPORT);
+    }
+
     OpRcPtrVec ops;
-    FinalizeOpsForCPU(ops, rawOps, in, out, oFlags);
+    FinalizeOpsForCPU(ops, rawOps, in, out, oFlags, report.get());
+
+    if (report)
+    {
+        for (const auto & op : ops)
+        {
+            OptimizationReportBuilder::AddOpAfter(*report, op->getInfo().c_str());
+        }
+    }
 
     m_inBitDepth  = in;
     m_outBitDepth = out;
@@ -363,7 +449,15 @@ void CPUProcessor::Impl::finalize(const OpRcPtrVec & rawOps,
     m_cpuOps.clear();
     m_inBitDepthOp = nullptr;
     m_outBitDepthOp = nullptr;
-    CreateCPUEngine(ops, in, out, oFlags, m_inBitDepthOp, m_cpuOps, m_outBitDepthOp);
+    {
+        AutoMutex helpersLock(m_scanlineHelpersMutex);
+        m_scanlineHelpers.clear();
+    }
+    m_opRenderers.clear();
+    CreateCPUEngine(ops, in, out, oFlags, m_inBitDepthOp, m_cpuOps, m_outBitDepthOp,
+                    report.get(), m_opRenderers);
+
+    m_optimizationReport = report ? report : OptimizationReportBuilder::GetEmpty();
 
     // Compute the cache id.
 
@@ -376,12 +470,40 @@ void CPUProcessor::Impl::finalize(const OpRcPtrVec & rawOps,
     m_cacheID = ss.str();
 }
 
+std::unique_ptr<ScanlineHelper> CPUProcessor::Impl::acquireScanlineHelper() const
+{
+    {
+        AutoMutex lock(m_scanlineHelpersMutex);
+        if (!m_scanlineHelpers.empty())
+        {
+            std::unique_ptr<ScanlineHelper> helper = std::move(m_scanlineHelpers.back());
+            m_scanlineHelpers.pop_back();
+            return helper;
+        }
+    }
+
+    return std::unique_ptr<ScanlineHelper>(CreateScanlineHelper(m_inBitDepth, m_inBitDepthOp,
+                                                                m_outBitDepth, m_outBitDepthOp));
+}
+
+void CPUProcessor::Impl::releaseScanlineHelper(std::unique_ptr<ScanlineHelper> helper) const noexcept
+{
+    try
+    {
+        AutoMutex lock(m_scanlineHelpersMutex);
+        m_scanlineHelpers.push_back(std::move(helper));
+    }
+    catch (...)
+    {
+        // The helper is only lost for the next calls.
+    }
+}
+
 void CPUProcessor::Impl::apply(const ImageDesc & imgDesc) const
 {   
-    // Get the ScanlineHelper for this thread (no significant performance impact).
-    std::unique_ptr<ScanlineHelper> 
-        scanlineBuilder(CreateScanlineHelper(m_inBitDepth, m_inBitDepthOp,
-                                             m_outBitDepth, m_outBitDepthOp));
+    // Get a ScanlineHelper for this thread. It is given back to the pool at the end so the next
+    // calls reuse its buffers.
+    std::unique_ptr<ScanlineHelper> scanlineBuilder = acquireScanlineHelper();
 
     // Prepare the processing.
     scanlineBuilder->init(imgDesc);
@@ -402,14 +524,15 @@ void CPUProcessor::Impl::apply(const ImageDesc & imgDesc) const
 
         scanlineBuilder->finishRGBAScanline();
     }
+
+    releaseScanlineHelper(std::move(scanlineBuilder));
 }
 
 void CPUProcessor::Impl::apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc) const
 {
-    // Get the ScanlineHelper for this thread (no significant performance impact).
-    std::unique_ptr<ScanlineHelper> 
-        scanlineBuilder(CreateScanlineHelper(m_inBitDepth, m_inBitDepthOp,
-                                             m_outBitDepth, m_outBitDepthOp));
+    // Get a ScanlineHelper for this thread. It is given back to the pool at the end so the next
+    // calls reuse its buffers.
+    std::unique_ptr<ScanlineHelper> scanlineBuilder = acquireScanlineHelper();
 
     // Prepare the processing.
     scanlineBuilder->init(srcImgDesc, dstImgDesc);
@@ -430,6 +553,8 @@ void CPUProcessor::Impl::apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgD
 
         scanlineBuilder->finishRGBAScanline();
     }
+
+    releaseScanlineHelper(std::move(scanlineBuilder));
 }
 
 void CPUProcessor::Impl::applyRGB(float * pixel) const
@@ -464,6 +589,208 @@ void CPUProcessor::Impl::applyRGBA(float * pixel) const
     m_outBitDepthOp->apply(pixel, pixel, 1);
 }
 
+namespace
+{
+
+// Number of pixels copied at once in the buffer of the pixel array methods i.e. large enough
+// for the ops to use their vectorized paths but small enough to stay in the L1 cache.
+constexpr long PixelBatchSize = 256;
+
+// Validate the arguments of the pixel array methods and return the pixel stride in floats.
+ptrdiff_t GetPixelStride(const float * pixels, long numPixels,
+                         ptrdiff_t pixelStrideBytes, long numChannels)
+{
+    if (numPixels < 0)
+    {
+        throw Exception("CPUProcessor: the number of pixels must not be negative.");
+    }
+
+    if (numPixels > 0 && !pixels)
+    {
+        throw Exception("CPUProcessor: the pixel array must not be null.");
+    }
+
+    if (pixelStrideBytes == AutoStride)
+    {
+        return numChannels;
+    }
+
+    const ptrdiff_t pixelBytes = numChannels * ptrdiff_t(sizeof(float));
+    if (pixelStrideBytes % ptrdiff_t(sizeof(float)) != 0
+        || (pixelStrideBytes < pixelBytes && pixelStrideBytes > -pixelBytes))
+    {
+        std::ostringstream oss;
+        oss << "CPUProcessor: the pixel stride of " << pixelStrideBytes
+            << " bytes must be a multiple of " << sizeof(float)
+            << " bytes and must not be smaller than the pixel size of "
+            << pixelBytes << " bytes.";
+        throw Exception(oss.str().c_str());
+    }
+
+    return pixelStrideBytes / ptrdiff_t(sizeof(float));
+}
+
+void CheckChannels(long numPixels, std::initializer_list<const float *> channels)
+{
+    if (numPixels < 0)
+    {
+        throw Exception("CPUProcessor: the number of pixels must not be negative.");
+    }
+
+    if (numPixels > 0)
+    {
+        for (const float * channel : channels)
+        {
+            if (!channel)
+            {
+                throw Exception("CPUProcessor: the channel arrays must not be null.");
+            }
+        }
+    }
+}
+
+} // anon.
+
+void CPUProcessor::Impl::applyBuffer(float * rgbaBuffer, long numPixels) const
+{
+    m_inBitDepthOp->apply(rgbaBuffer, rgbaBuffer, numPixels);
+
+    const size_t numOps = m_cpuOps.size();
+    for(size_t i = 0; i<numOps; ++i)
+    {
+        m_cpuOps[i]->apply(rgbaBuffer, rgbaBuffer, numPixels);
+    }
+
+    m_outBitDepthOp->apply(rgbaBuffer, rgbaBuffer, numPixels);
+}
+
+void CPUProcessor::Impl::applyRGB(float * pixels, long numPixels, ptrdiff_t pixelStrideBytes) const
+{
+    const ptrdiff_t stride = GetPixelStride(pixels, numPixels, pixelStrideBytes, 3);
+
+    float buffer[4 * PixelBatchSize];
+
+    for (long first = 0; first < numPixels; first += PixelBatchSize)
+    {
+        const long count = std::min(PixelBatchSize, numPixels - first);
+
+        float * pxl = pixels + first * stride;
+        for (long idx = 0; idx < count; ++idx, pxl += stride)
+        {
+            buffer[4 * idx + 0] = pxl[0];
+            buffer[4 * idx + 1] = pxl[1];
+            buffer[4 * idx + 2] = pxl[2];
+            buffer[4 * idx + 3] = 0.0f;
+        }
+
+        applyBuffer(buffer, count);
+
+        pxl = pixels + first * stride;
+        for (long idx = 0; idx < count; ++idx, pxl += stride)
+        {
+            pxl[0] = buffer[4 * idx + 0];
+            pxl[1] = buffer[4 * idx + 1];
+            pxl[2] = buffer[4 * idx + 2];
+        }
+    }
+}
+
+void CPUProcessor::Impl::applyRGBA(float * pixels, long numPixels, ptrdiff_t pixelStrideBytes) const
+{
+    const ptrdiff_t stride = GetPixelStride(pixels, numPixels, pixelStrideBytes, 4);
+
+    if (stride == 4)
+    {
+        // The pixels are already in the layout of the ops.
+        if (numPixels > 0)
+        {
+            applyBuffer(pixels, numPixels);
+        }
+        return;
+    }
+
+    float buffer[4 * PixelBatchSize];
+
+    for (long first = 0; first < numPixels; first += PixelBatchSize)
+    {
+        const long count = std::min(PixelBatchSize, numPixels - first);
+
+        float * pxl = pixels + first * stride;
+        for (long idx = 0; idx < count; ++idx, pxl += stride)
+        {
+            memcpy(&buffer[4 * idx], pxl, 4 * sizeof(float));
+        }
+
+        applyBuffer(buffer, count);
+
+        pxl = pixels + first * stride;
+        for (long idx = 0; idx < count; ++idx, pxl += stride)
+        {
+            memcpy(pxl, &buffer[4 * idx], 4 * sizeof(float));
+        }
+    }
+}
+
+void CPUProcessor::Impl::applyRGB(float * red, float * green, float * blue, long numPixels) const
+{
+    CheckChannels(numPixels, { red, green, blue });
+
+    float buffer[4 * PixelBatchSize];
+
+    for (long first = 0; first < numPixels; first += PixelBatchSize)
+    {
+        const long count = std::min(PixelBatchSize, numPixels - first);
+
+        for (long idx = 0; idx < count; ++idx)
+        {
+            buffer[4 * idx + 0] = red[first + idx];
+            buffer[4 * idx + 1] = green[first + idx];
+            buffer[4 * idx + 2] = blue[first + idx];
+            buffer[4 * idx + 3] = 0.0f;
+        }
+
+        applyBuffer(buffer, count);
+
+        for (long idx = 0; idx < count; ++idx)
+        {
+            red[first + idx]   = buffer[4 * idx + 0];
+            green[first + idx] = buffer[4 * idx + 1];
+            blue[first + idx]  = buffer[4 * idx + 2];
+        }
+    }
+}
+
+void CPUProcessor::Impl::applyRGBA(float * red, float * green, float * blue, float * alpha,
+                                   long numPixels) const
+{
+    CheckChannels(numPixels, { red, green, blue, alpha });
+
+    float buffer[4 * PixelBatchSize];
+
+    for (long first = 0; first < numPixels; first += PixelBatchSize)
+    {
+        const long count = std::min(PixelBatchSize, numPixels - first);
+
+        for (long idx = 0; idx < count; ++idx)
+        {
+            buffer[4 * idx + 0] = red[first + idx];
+            buffer[4 * idx + 1] = green[first + idx];
+            buffer[4 * idx + 2] = blue[first + idx];
+            buffer[4 * idx + 3] = alpha[first + idx];
+        }
+
+        applyBuffer(buffer, count);
+
+        for (long idx = 0; idx < count; ++idx)
+        {
+            red[first + idx]   = buffer[4 * idx + 0];
+            green[first + idx] = buffer[4 * idx + 1];
+            blue[first + idx]  = buffer[4 * idx + 2];
+            alpha[first + idx] = buffer[4 * idx + 3];
+        }
+    }
+}
+
 
 
 
@@ -523,6 +850,16 @@ bool CPUProcessor::isDynamic() const noexcept
     return getImpl()->isDynamic();
 }
 
+ConstOptimizationReportRcPtr CPUProcessor::getOptimizationReport() const
+{
+    return getImpl()->getOptimizationReport();
+}
+
+ConstMemoryUsageRcPtr CPUProcessor::getMemoryUsage() const
+{
+    return getImpl()->getMemoryUsage();
+}
+
 bool CPUProcessor::hasDynamicProperty(DynamicPropertyType type) const noexcept
 {
     return getImpl()->hasDynamicProperty(type);
@@ -553,4 +890,25 @@ void CPUProcessor::applyRGBA(float * pixel) const
     getImpl()->applyRGBA(pixel);
 }
 
+void CPUProcessor::applyRGB(float * pixels, long numPixels, ptrdiff_t pixelStrideBytes) const
+{
+    getImpl()->applyRGB(pixels, numPixels, pixelStrideBytes);
+}
+
+void CPUProcessor::applyRGBA(float * pixels, long numPixels, ptrdiff_t pixelStrideBytes) const
+{
+    getImpl()->applyRGBA(pixels, numPixels, pixelStrideBytes);
+}
+
+void CPUProcessor::applyRGB(float * red, float * green, float * blue, long numPixels) const
+{
+    getImpl()->applyRGB(red, green, blue, numPixels);
+}
+
+void CPUProcessor::applyRGBA(float * red, float * green, float * blue, float * alpha,
+                             long numPixels) const
+{
+    getImpl()->applyRGBA(red, green, blue, alpha, numPixels);
+}
+
 } // namespace OCIO_NAMESPACE
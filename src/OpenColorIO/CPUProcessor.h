@@ -9,12 +9,16 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "Op.h"
+#include "ScanlineHelper.h"
 
 
 namespace OCIO_NAMESPACE
 {
 
-class ScanlineHelper;
+// The type of each op and the end of its renderers, where the renderers are indexed as the in
+// bit-depth op, the CPU ops and the out bit-depth op. The memory usage of a CPU processor is only
+// computed on request from these.
+typedef std::vector<std::pair<OpData::Type, size_t>> OpRenderers;
 
 class CPUProcessor::Impl
 {
@@ -43,6 +47,10 @@ public:
     bool hasDynamicProperty(DynamicPropertyType type) const noexcept;
     DynamicPropertyRcPtr getDynamicProperty(DynamicPropertyType type) const;
 
+    ConstOptimizationReportRcPtr getOptimizationReport() const noexcept { return m_optimizationReport; }
+
+    ConstMemoryUsageRcPtr getMemoryUsage() const;
+
     void apply(const ImageDesc & imgDesc) const;
     void apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc) const;
 
@@ -51,6 +59,12 @@ public:
     // Note that the method only accepts one packed RGBA and 32-bit float pixel.
     void applyRGBA(float * pixel) const;
 
+    // Note that the methods only accept arrays of RGB or RGBA and 32-bit float pixels.
+    void applyRGB(float * pixels, long numPixels, ptrdiff_t pixelStrideBytes) const;
+    void applyRGBA(float * pixels, long numPixels, ptrdiff_t pixelStrideBytes) const;
+    void applyRGB(float * red, float * green, float * blue, long numPixels) const;
+    void applyRGBA(float * red, float * green, float * blue, float * alpha, long numPixels) const;
+
     ////////////////////////////////////////////
     //
     // Functions not exposed to the OCIO public API.
@@ -58,6 +72,14 @@ public:
     void finalize(const OpRcPtrVec & rawOps, BitDepth in, BitDepth out, OptimizationFlags oFlags);
 
 private:
+    // Get a scanline helper from the pool, or a new one if all of them are in use.
+    std::unique_ptr<ScanlineHelper> acquireScanlineHelper() const;
+    // Give back the scanline helper to the pool for the next apply calls.
+    void releaseScanlineHelper(std::unique_ptr<ScanlineHelper> helper) const noexcept;
+
+    // Apply all the ops to a buffer of packed RGBA and 32-bit float pixels.
+    void applyBuffer(float * rgbaBuffer, long numPixels) const;
+
     ConstOpCPURcPtr    m_inBitDepthOp; // Converts from in to F32. It could be done by the first op.
     ConstOpCPURcPtrVec m_cpuOps;       // It could be empty if the OpVec only contains a 1D LUT op
                                        // (e.g. the 1D LUT CPUOp instance would be in the m_inBitDepthOp).
@@ -69,7 +91,14 @@ private:
     bool               m_isIdentity = false;
     bool               m_hasChannelCrosstalk = true;
     std::string        m_cacheID;
+    ConstOptimizationReportRcPtr m_optimizationReport;
+    OpRenderers        m_opRenderers;
     Mutex              m_mutex;
+
+    // The scanline helpers not in use, with their buffers, so that each apply call (e.g. on
+    // small tiles) does not allocate and initialize a new one.
+    mutable std::vector<std::unique_ptr<ScanlineHelper>> m_scanlineHelpers;
+    mutable Mutex      m_scanlineHelpersMutex;
 };
 
 } // namespace OCIO_NAMESPACE
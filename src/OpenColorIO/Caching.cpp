@@ -5,6 +5,7 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "Caching.h"
+#include "Op.h"
 #include "transforms/CDLTransform.h"
 #include "PathUtils.h"
 #include "transforms/FileTransform.h"
@@ -25,5 +26,14 @@ void ClearAllCaches()
 {
     ClearPathCaches();
     ClearFileTransformCaches();
+    ClearOptimizedOpsCache();
+}
+
+ConstMemoryUsageRcPtr GetCachesMemoryUsage()
+{
+    MemoryUsageRcPtr memoryUsage = MemoryUsage::Create();
+    memoryUsage->addEntry("File cache", GetFileTransformCachesMemoryUsage());
+    memoryUsage->addEntry("Optimized ops cache", GetOptimizedOpsCacheMemoryUsage());
+    return memoryUsage;
 }
 } // namespace OCIO_NAMESPACE
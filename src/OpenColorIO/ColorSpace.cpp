@@ -8,6 +8,7 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "LazyTransform.h"
 #include "TokensManager.h"
 #include "Platform.h"
 #include "PrivateTypes.h"
@@ -44,8 +45,8 @@ public:
     Allocation m_allocation{ ALLOCATION_UNIFORM };
     std::vector<float> m_allocationVars;
 
-    TransformRcPtr m_toRefTransform;
-    TransformRcPtr m_fromRefTransform;
+    LazyTransform m_toRefTransform;
+    LazyTransform m_fromRefTransform;
 
     bool m_toRefSpecified{ false };
     bool m_fromRefSpecified{ false };
@@ -80,13 +81,8 @@ public:
             m_allocation = rhs.m_allocation;
             m_allocationVars = rhs.m_allocationVars;
 
-            m_toRefTransform = rhs.m_toRefTransform?
-                rhs.m_toRefTransform->createEditableCopy()
-                : rhs.m_toRefTransform;
-
-            m_fromRefTransform = rhs.m_fromRefTransform?
-                rhs.m_fromRefTransform->createEditableCopy()
-                : rhs.m_fromRefTransform;
+            m_toRefTransform = rhs.m_toRefTransform;
+            m_fromRefTransform = rhs.m_fromRefTransform;
 
             m_toRefSpecified = rhs.m_toRefSpecified;
             m_fromRefSpecified = rhs.m_fromRefSpecified;
@@ -466,9 +462,9 @@ ConstTransformRcPtr ColorSpace::getTransform(ColorSpaceDirection dir) const noex
     switch (dir)
     {
     case COLORSPACE_DIR_TO_REFERENCE:
-        return getImpl()->m_toRefTransform;
+        return getImpl()->m_toRefTransform.get();
     case COLORSPACE_DIR_FROM_REFERENCE:
-        return getImpl()->m_fromRefTransform;
+        return getImpl()->m_fromRefTransform.get();
     }
     return ConstTransformRcPtr();
 }
@@ -482,14 +478,51 @@ void ColorSpace::setTransform(const ConstTransformRcPtr & transform,
     switch (dir)
     {
     case COLORSPACE_DIR_TO_REFERENCE:
-        getImpl()->m_toRefTransform = transformCopy;
+        getImpl()->m_toRefTransform.set(transformCopy);
+        break;
+    case COLORSPACE_DIR_FROM_REFERENCE:
+        getImpl()->m_fromRefTransform.set(transformCopy);
+        break;
+    }
+}
+
+void ColorSpaceLazyTransforms::SetLoader(ColorSpace & cs,
+                                         ColorSpaceDirection dir,
+                                         const LazyTransform::Loader & loader)
+{
+    switch (dir)
+    {
+    case COLORSPACE_DIR_TO_REFERENCE:
+        cs.getImpl()->m_toRefTransform.setLoader(loader);
         break;
     case COLORSPACE_DIR_FROM_REFERENCE:
-        getImpl()->m_fromRefTransform = transformCopy;
+        cs.getImpl()->m_fromRefTransform.setLoader(loader);
         break;
     }
 }
 
+void ColorSpaceLazyTransforms::Materialize(const ColorSpace & cs)
+{
+    try
+    {
+        cs.getImpl()->m_toRefTransform.materialize();
+        cs.getImpl()->m_fromRefTransform.materialize();
+    }
+    catch (const Exception & e)
+    {
+        std::ostringstream oss;
+        oss << "The transform of the color space '" << cs.getName()
+            << "' could not be loaded: " << e.what();
+        throw Exception(oss.str().c_str());
+    }
+}
+
+bool ColorSpaceLazyTransforms::IsPending(const ColorSpace & cs) noexcept
+{
+    return cs.getImpl()->m_toRefTransform.isPending()
+           || cs.getImpl()->m_fromRefTransform.isPending();
+}
+
 std::ostream & operator<< (std::ostream & os, const ColorSpace & cs)
 {
     const int numVars(cs.getAllocationNumVars());
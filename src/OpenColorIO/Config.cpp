@@ -7,6 +7,8 @@
 #include <set>
 #include <sstream>
 #include <fstream>
+#include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 #include <regex>
@@ -23,6 +25,7 @@
 #include "fileformats/FileFormatICC.h"
 #include "FileRules.h"
 #include "HashUtils.h"
+#include "LazyTransform.h"
 #include "Logging.h"
 #include "LookParse.h"
 #include "MathUtils.h"
@@ -36,6 +39,7 @@
 #include "Platform.h"
 #include "PrivateTypes.h"
 #include "Processor.h"
+#include "Trace.h"
 #include "transforms/FileTransform.h"
 #include "utils/StringUtils.h"
 #include "ViewingRules.h"
@@ -50,6 +54,11 @@ const char * OCIO_ACTIVE_VIEWS_ENVVAR         = "OCIO_ACTIVE_VIEWS";
 const char * OCIO_INACTIVE_COLORSPACES_ENVVAR = "OCIO_INACTIVE_COLORSPACES";
 const char * OCIO_OPTIMIZATION_FLAGS_ENVVAR   = "OCIO_OPTIMIZATION_FLAGS";
 const char * OCIO_USER_CATEGORIES_ENVVAR      = "OCIO_USER_CATEGORIES";
+const char * OCIO_LAZY_TRANSFORMS_ENVVAR      = "OCIO_LAZY_TRANSFORMS";
+const char * OCIO_SEARCH_PATH_INDEX_ENVVAR    = "OCIO_SEARCH_PATH_INDEX";
+const char * OCIO_TRACE_FILE_ENVVAR           = "OCIO_TRACE_FILE";
+const char * OCIO_CPU_SIMD_ENVVAR             = "OCIO_CPU_SIMD";
+const char * OCIO_NUM_THREADS_ENVVAR          = "OCIO_NUM_THREADS";
 
 // Default filename (with extension) of a config and archived config.
 const char * OCIO_CONFIG_DEFAULT_NAME         = "config";
@@ -332,6 +341,28 @@ public:
     mutable ProcessorCacheFlags m_cacheFlags { PROCESSOR_CACHE_DEFAULT };
     mutable ProcessorCache<std::size_t, ProcessorRcPtr> m_processorCache;
 
+    // The name based getProcessor() requests already served. Their keys are computed from the
+    // request arguments only so a repeated request neither collects the context variables nor
+    // serializes the transform (i.e. m_processorCache key computation), and does not allocate.
+    // Access is protected by the m_processorCache mutex.
+    enum ProcessorRequestType
+    {
+        PROCESSOR_REQUEST_COLORSPACES = 0,
+        PROCESSOR_REQUEST_DISPLAY_VIEW,
+        PROCESSOR_REQUEST_NAMED_TRANSFORM
+    };
+
+    struct ProcessorRequest
+    {
+        ProcessorRequestType m_type;
+        std::string m_contextID;
+        std::string m_names[3];
+        TransformDirection m_direction;
+        ConstProcessorRcPtr m_processor;
+    };
+
+    mutable std::unordered_multimap<std::size_t, ProcessorRequest> m_processorRequests;
+
     Impl() :
         m_majorVersion(LastSupportedMajorVersion),
         m_minorVersion(LastSupportedMinorVersion[LastSupportedMajorVersion - 1]),
@@ -452,10 +483,100 @@ public:
 
             m_processorCache.clear();
             m_processorCache.enable((m_cacheFlags & PROCESSOR_CACHE_ENABLED) == PROCESSOR_CACHE_ENABLED);
+            clearProcessorRequests();
         }
         return *this;
     }
 
+    void clearProcessorRequests() const noexcept
+    {
+        AutoMutex guard(m_processorCache.lock());
+        m_processorRequests.clear();
+    }
+
+    // Return the processor of a request previously served by the name based getProcessor()
+    // methods, or call createProcessor and remember its result. Names could be null.
+    template<typename CreateProcessorFn>
+    ConstProcessorRcPtr getRequestedProcessor(const ConstContextRcPtr & context,
+                                              ProcessorRequestType type,
+                                              const char * name0,
+                                              const char * name1,
+                                              const char * name2,
+                                              TransformDirection direction,
+                                              CreateProcessorFn createProcessor) const
+    {
+        if (!context || !m_processorCache.isEnabled())
+        {
+            return createProcessor();
+        }
+
+        const std::string_view contextID{ context->getCacheID() };
+        const std::string_view names[3]{ name0 ? name0 : "",
+                                         name1 ? name1 : "",
+                                         name2 ? name2 : "" };
+
+        const auto combine = [](std::size_t & seed, std::size_t value)
+        {
+            seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        };
+
+        std::size_t key = std::hash<std::string_view>{}(contextID);
+        combine(key, static_cast<std::size_t>(type));
+        for (const auto & name : names)
+        {
+            combine(key, std::hash<std::string_view>{}(name));
+        }
+        combine(key, static_cast<std::size_t>(direction));
+
+        const auto findRequest = [&]() -> ConstProcessorRcPtr
+        {
+            const auto range = m_processorRequests.equal_range(key);
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                const ProcessorRequest & request = it->second;
+                if (request.m_type == type && request.m_direction == direction
+                    && request.m_contextID == contextID
+                    && request.m_names[0] == names[0]
+                    && request.m_names[1] == names[1]
+                    && request.m_names[2] == names[2])
+                {
+                    return request.m_processor;
+                }
+            }
+            return ConstProcessorRcPtr();
+        };
+
+        {
+            AutoMutex guard(m_processorCache.lock());
+            ConstProcessorRcPtr processor = findRequest();
+            if (processor)
+            {
+                return processor;
+            }
+        }
+
+        // The processor creation locks the processor cache so it must be done outside the lock.
+        ConstProcessorRcPtr processor = createProcessor();
+
+        AutoMutex guard(m_processorCache.lock());
+        ConstProcessorRcPtr existing = findRequest();
+        if (existing)
+        {
+            return existing;
+        }
+
+        ProcessorRequest request{ type,
+                                  std::string(contextID),
+                                  { std::string(names[0]),
+                                    std::string(names[1]),
+                                    std::string(names[2]) },
+                                  direction,
+                                  processor };
+        m_processorRequests.emplace(key, std::move(request));
+
+        return processor;
+    }
+
     ConstColorSpaceRcPtr getColorSpace(const char * name) const
     {
         // Check to see if the name is a color space.
@@ -582,8 +703,11 @@ public:
     void resetCacheIDs();
 
     // Get all internal transforms (to generate cacheIDs, validation, etc).
-    // This currently crawls colorspaces + looks + view transforms.
-    void getAllInternalTransforms(ConstTransformVec & transformVec) const;
+    // This currently crawls colorspaces + looks + view transforms. The color spaces having
+    // not yet loaded transforms (see OCIO_LAZY_TRANSFORMS_ENVVAR) could be skipped to avoid
+    // creating all of them.
+    void getAllInternalTransforms(ConstTransformVec & transformVec,
+                                  bool skipPendingColorSpaces = false) const;
 
     static ConstConfigRcPtr Read(std::istream & istream, const char * filename);
     static ConstConfigRcPtr Read(std::istream & istream, ConfigIOProxyRcPtr ciop);
@@ -779,7 +903,7 @@ public:
     }
 
     void checkVersionConsistency(ConstTransformRcPtr & transform) const;
-    void checkVersionConsistency() const;
+    void checkVersionConsistency(bool skipPendingColorSpaces = false) const;
 
     const View * getView(const char * display, const char * view) const
     {
@@ -1158,6 +1282,8 @@ ConstConfigRcPtr Config::CreateFromFile(const char * filename)
         throw ExceptionMissingFile ("The config filepath is missing.");
     }
 
+    OCIO_TRACE_SCOPE_DETAIL("config", "Config::CreateFromFile", filename);
+
     // Check for URI Pattern: ocio://<config name>
     static const std::regex uriPattern(R"(ocio:\/\/([^\s]+))");
     std::smatch match;
@@ -1427,6 +1553,19 @@ void Config::validate() const
         const char * name = cs->getName();
         // Name is not empty and unique (checked by addColorSpace ).
 
+        // Create the transforms not yet loaded (see OCIO_LAZY_TRANSFORMS_ENVVAR).
+        try
+        {
+            ColorSpaceLazyTransforms::Materialize(*cs);
+        }
+        catch (const Exception & e)
+        {
+            std::ostringstream os;
+            os << "Config failed color space validation. " << e.what();
+            getImpl()->m_validationtext = os.str();
+            throw Exception(getImpl()->m_validationtext.c_str());
+        }
+
         // Retest that name does not contain reserved characters (vesion might have change).
         if (getMajorVersion() >= 2 && ContainsContextVariableToken(name))
         {
@@ -4697,10 +4836,7 @@ ConstProcessorRcPtr Config::getProcessor(const ConstContextRcPtr & context,
         throw Exception("Config::GetProcessor failed. Destination color space is null.");
     }
 
-    ColorSpaceTransformRcPtr transform = ColorSpaceTransform::Create();
-    transform->setSrc(src->getName());
-    transform->setDst(dst->getName());
-    return getProcessor(context, transform, TRANSFORM_DIR_FORWARD);
+    return getProcessor(context, src->getName(), dst->getName());
 }
 
 ConstProcessorRcPtr Config::getProcessor(const char * srcName, const char * dstName) const
@@ -4714,10 +4850,16 @@ ConstProcessorRcPtr Config::getProcessor(const ConstContextRcPtr & context,
                                          const char * srcName,
                                          const char * dstName) const
 {
-    auto csTransform = ColorSpaceTransform::Create();
-    csTransform->setSrc(srcName);
-    csTransform->setDst(dstName);
-    return getProcessor(context, csTransform, TRANSFORM_DIR_FORWARD);
+    return getImpl()->getRequestedProcessor(
+        context, Impl::PROCESSOR_REQUEST_COLORSPACES, srcName, dstName, nullptr,
+        TRANSFORM_DIR_FORWARD,
+        [&]()
+        {
+            auto csTransform = ColorSpaceTransform::Create();
+            csTransform->setSrc(srcName);
+            csTransform->setDst(dstName);
+            return getProcessor(context, csTransform, TRANSFORM_DIR_FORWARD);
+        });
 }
 
 
@@ -4736,12 +4878,18 @@ ConstProcessorRcPtr Config::getProcessor(const ConstContextRcPtr & context,
                                          const char * view,
                                          TransformDirection direction) const
 {
-    auto dt = DisplayViewTransform::Create();
-    dt->setSrc(srcColorSpaceName);
-    dt->setDisplay(display);
-    dt->setView(view);
-    dt->validate();
-    return getProcessor(context, dt, direction);
+    return getImpl()->getRequestedProcessor(
+        context, Impl::PROCESSOR_REQUEST_DISPLAY_VIEW, srcColorSpaceName, display, view,
+        direction,
+        [&]()
+        {
+            auto dt = DisplayViewTransform::Create();
+            dt->setSrc(srcColorSpaceName);
+            dt->setDisplay(display);
+            dt->setView(view);
+            dt->validate();
+            return getProcessor(context, dt, direction);
+        });
 }
 
 ConstProcessorRcPtr Config::getProcessor(const ConstNamedTransformRcPtr & namedTransform,
@@ -4772,8 +4920,14 @@ ConstProcessorRcPtr Config::getProcessor(const ConstContextRcPtr & context,
                                          const char * namedTransformName,
                                          TransformDirection direction) const
 {
-    ConstNamedTransformRcPtr namedTransform = getNamedTransform(namedTransformName);
-    return getProcessor(context, namedTransform, direction);
+    return getImpl()->getRequestedProcessor(
+        context, Impl::PROCESSOR_REQUEST_NAMED_TRANSFORM, namedTransformName, nullptr, nullptr,
+        direction,
+        [&]()
+        {
+            ConstNamedTransformRcPtr namedTransform = getNamedTransform(namedTransformName);
+            return getProcessor(context, namedTransform, direction);
+        });
 }
 
 ConstProcessorRcPtr Config::getProcessor(const ConstTransformRcPtr & transform) const
@@ -4802,6 +4956,7 @@ ConstProcessorRcPtr Config::getProcessor(const ConstContextRcPtr & context,
         throw Exception("Config::GetProcessor failed. Transform is null.");
     }
 
+    OCIO_TRACE_SCOPE("processor", "Config::getProcessor");
 
     // The goal of the usedContext is to only contain the context vars that are actually used for
     // this transform.  This allows the cache to be more efficient. However, there are still some
@@ -5343,6 +5498,24 @@ void Config::setProcessorCacheFlags(ProcessorCacheFlags flags) const noexcept
 void Config::clearProcessorCache() noexcept
 {
     getImpl()->m_processorCache.clear();
+    getImpl()->clearProcessorRequests();
+}
+
+ConstMemoryUsageRcPtr Config::getProcessorCacheMemoryUsage() const
+{
+    MemoryUsageRcPtr memoryUsage = MemoryUsage::Create();
+
+    AutoMutex guard(getImpl()->m_processorCache.lock());
+    for (const auto & entry : getImpl()->m_processorCache)
+    {
+        if (entry.second)
+        {
+            memoryUsage->addEntry(entry.second->getCacheID(),
+                                  entry.second->getMemoryUsage()->getTotalSize());
+        }
+    }
+
+    return memoryUsage;
 }
 
 ///////////////////////////////////////////////////////////////////////////
@@ -5471,22 +5644,29 @@ void Config::Impl::resetCacheIDs()
     // As any changes could impact the cache keys, it's better to always flush the cache
     // of processors to not keep in memory useless instances.
     m_processorCache.clear();
+    clearProcessorRequests();
 }
 
-void Config::Impl::getAllInternalTransforms(ConstTransformVec & transformVec) const
+void Config::Impl::getAllInternalTransforms(ConstTransformVec & transformVec,
+                                            bool skipPendingColorSpaces) const
 {
     // Grab all transforms from the ColorSpaces.
 
     for (int i = 0; i < m_allColorSpaces->getNumColorSpaces(); ++i)
     {
-        ConstTransformRcPtr tr
-            = m_allColorSpaces->getColorSpaceByIndex(i)->getTransform(COLORSPACE_DIR_TO_REFERENCE);
+        ConstColorSpaceRcPtr cs = m_allColorSpaces->getColorSpaceByIndex(i);
+        if (skipPendingColorSpaces && ColorSpaceLazyTransforms::IsPending(*cs))
+        {
+            continue;
+        }
+
+        ConstTransformRcPtr tr = cs->getTransform(COLORSPACE_DIR_TO_REFERENCE);
         if (tr)
         {
             transformVec.push_back(tr);
         }
 
-        tr = m_allColorSpaces->getColorSpaceByIndex(i)->getTransform(COLORSPACE_DIR_FROM_REFERENCE);
+        tr = cs->getTransform(COLORSPACE_DIR_FROM_REFERENCE);
         if (tr)
         {
             transformVec.push_back(tr);
@@ -5547,10 +5727,13 @@ void Config::Impl::getAllInternalTransforms(ConstTransformVec & transformVec) co
 
 ConstConfigRcPtr Config::Impl::Read(std::istream & istream, const char * filename)
 {
+    OCIO_TRACE_SCOPE("config", "Config::Read");
+
     ConfigRcPtr config = Config::Create();
     OCIOYaml::Read(istream, config, filename);
 
-    config->getImpl()->checkVersionConsistency();
+    // Lazily loaded color space transforms are checked when the config is validated.
+    config->getImpl()->checkVersionConsistency(true);
 
     // An API request always supersedes the env. variable. As the OCIOYaml helper methods
     // use the Config public API, the variable reset highlights that only the
@@ -5563,13 +5746,15 @@ ConstConfigRcPtr Config::Impl::Read(std::istream & istream, const char * filenam
 
 ConstConfigRcPtr Config::Impl::Read(std::istream & istream, ConfigIOProxyRcPtr ciop)
 {
+    OCIO_TRACE_SCOPE("config", "Config::Read");
+
     ConfigRcPtr config = Config::Create();
     // Passing special string for the file path to enable the parser to provide a more
     // meaningful error message if a problem is encountered.  (The working directory is not
     // set to this string.)
     OCIOYaml::Read(istream, config, "from Archive/ConfigIOProxy");
 
-    config->getImpl()->checkVersionConsistency();
+    config->getImpl()->checkVersionConsistency(true);
 
     // An API request always supersedes the env. variable. As the OCIOYaml helper methods
     // use the Config public API, the variable reset highlights that only the
@@ -5831,14 +6016,14 @@ void Config::Impl::checkVersionConsistency(ConstTransformRcPtr & transform) cons
     }
 }
 
-void Config::Impl::checkVersionConsistency() const
+void Config::Impl::checkVersionConsistency(bool skipPendingColorSpaces) const
 {
     unsigned int hexVersion = (m_majorVersion << 24) | (m_minorVersion << 16);
 
     // Check for the Transforms.
 
     ConstTransformVec transforms;
-    getAllInternalTransforms(transforms);
+    getAllInternalTransforms(transforms, skipPendingColorSpaces);
 
     for (auto & transform : transforms)
     {
@@ -489,7 +489,11 @@ const char * Context::resolveFileLocation(const char * filename, ContextRcPtr &
     {
         // Make an attempt to find the LUT in one of the search paths.
         const std::string resolvedfullpath = pystring::os::path::join(searchpaths[i], resolvedFilename);
-        if (!ContainsContextVariables(resolvedfullpath) && FileExists(resolvedfullpath, *this))
+        // Note that the directory index (if enabled) avoids to check the file system for the
+        // search paths not containing the file.
+        if (!ContainsContextVariables(resolvedfullpath)
+            && IsFileListed(resolvedfullpath, *this)
+            && FileExists(resolvedfullpath, *this))
         {
             // Collect all the used context variables.
             if (usedContextVars)
@@ -2,6 +2,8 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 
+#include <algorithm>
+
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "ContextVariableUtils.h"
@@ -124,51 +126,144 @@ void LoadEnvironment(EnvMap & map, bool update)
     }
 }
 
-static std::string ResolveContextVariablesImpl(const std::string & str, const EnvMap & map,
-                                               UsedEnvs & used, int depth)
+namespace
 {
-    // Guard against infinite recursion from cyclic variable references.
-    if (depth > 32) return str;
 
-    // Early exit if no reserved tokens are found.
-    if (!ContainsContextVariables(str))
+// Find the longest key of the map starting at the position of the string.
+EnvMap::const_iterator FindLongestKey(std::string_view str, const EnvMap & map)
+{
+    // The map is ordered by the length of the keys (long -> short).
+    const size_t maxLength = std::min(map.begin()->first.size(), str.size());
+    const size_t minLength = std::max(map.rbegin()->first.size(), size_t(1));
+
+    for (size_t length = maxLength; length >= minLength; --length)
     {
-        return str;
+        EnvMap::const_iterator iter = map.find(str.substr(0, length));
+        if (iter != map.end())
+        {
+            return iter;
+        }
     }
 
-    std::string orig = str;
-    std::string newstr = str;
+    return map.end();
+}
 
-    // This walks through the envmap in key order,
-    // from longest to shortest to handle envvars which are
-    // substrings.
-    // ie. '$TEST_$TESTING_$TE' will expand in this order '2 1 3'
+// Find the key of a ${VAR} or %VAR% token.
+EnvMap::const_iterator FindKey(std::string_view name, const EnvMap & map)
+{
+    return name.empty() ? map.end() : map.find(name);
+}
+
+// Replace all the context variables found while scanning the string once. The replaced values
+// are not scanned i.e. the caller is in charge of the recursive expansion.
+bool ResolveContextVariablesOnce(const std::string & str, const EnvMap & map,
+                                 UsedEnvs & used, std::string & result)
+{
+    const std::string_view view(str);
+
+    result.clear();
+    result.reserve(str.size());
+
+    bool replaced = false;
 
-    for (const auto & entry : map)
+    size_t pos = 0;
+    while (pos < view.size())
     {
-        if (StringUtils::ReplaceInPlace(newstr, ("${"+ entry.first + "}"), entry.second))
+        const size_t token = view.find_first_of("$%", pos);
+        if (token == std::string_view::npos)
         {
-            used[entry.first] = entry.second;
+            result.append(view.substr(pos));
+            break;
         }
 
-        if (StringUtils::ReplaceInPlace(newstr, ("$" + entry.first),       entry.second))
+        result.append(view.substr(pos, token - pos));
+
+        EnvMap::const_iterator entry = map.end();
+        size_t next = token + 1;
+
+        if (view[token] == '$')
+        {
+            // ${VAR}
+            if (next < view.size() && view[next] == '{')
+            {
+                const size_t end = view.find('}', next + 1);
+                if (end != std::string_view::npos)
+                {
+                    entry = FindKey(view.substr(next + 1, end - next - 1), map);
+                    if (entry != map.end())
+                    {
+                        next = end + 1;
+                    }
+                }
+            }
+
+            // $VAR
+            if (entry == map.end())
+            {
+                entry = FindLongestKey(view.substr(next), map);
+                if (entry != map.end())
+                {
+                    next += entry->first.size();
+                }
+            }
+        }
+        else
         {
-            used[entry.first] = entry.second;
+            // %VAR%
+            const size_t end = view.find('%', next);
+            if (end != std::string_view::npos)
+            {
+                entry = FindKey(view.substr(next, end - next), map);
+                if (entry != map.end())
+                {
+                    next = end + 1;
+                }
+            }
         }
 
-        if (StringUtils::ReplaceInPlace(newstr, ("%" + entry.first + "%"), entry.second))
+        if (entry != map.end())
         {
-            used[entry.first] = entry.second;
+            result += entry->second;
+            used[entry->first] = entry->second;
+            replaced = true;
+
+            pos = next;
         }
+        else
+        {
+            // Not a known context variable, keep the reserved token.
+            result += view[token];
+            pos = token + 1;
+        }
+    }
+
+    return replaced;
+}
+
+} // anon.
+
+static std::string ResolveContextVariablesImpl(const std::string & str, const EnvMap & map,
+                                               UsedEnvs & used, int depth)
+{
+    // Guard against infinite recursion from cyclic variable references.
+    if (depth > 32) return str;
+
+    // Early exit if no reserved tokens are found.
+    if (map.empty() || !ContainsContextVariables(str))
+    {
+        return str;
     }
 
-    // recursively call till string doesn't expand anymore
-    if(newstr != orig)
+    // Recursively call till string doesn't expand anymore i.e. the values could also contain
+    // context variables, and a replacement could form a new context variable (for example
+    // '${FOO_${TEST}}').
+    std::string newstr;
+    if (ResolveContextVariablesOnce(str, map, used, newstr) && newstr != str)
     {
         return ResolveContextVariablesImpl(newstr, map, used, depth + 1);
     }
 
-    return orig;
+    return str;
 }
 
 std::string ResolveContextVariables(const std::string & str, const EnvMap & map, UsedEnvs & used)
@@ -9,6 +9,7 @@
 #include <functional>
 #include <map>
 #include <string>
+#include <string_view>
 
 #include <OpenColorIO/OpenColorIO.h>
 
@@ -28,7 +29,10 @@ bool ContainsContextVariables(const std::string & str);
 template <class T>
 struct EnvMapKey
 {
-    bool operator() (const T & x, const T & y) const
+    // Allow to search a key from a std::string_view i.e. without a string allocation.
+    using is_transparent = void;
+
+    bool operator() (std::string_view x, std::string_view y) const
     {
         // If the lengths are unequal, sort by length.
         if(x.length() != y.length())
@@ -49,6 +53,9 @@ void LoadEnvironment(EnvMap & map, bool update = false);
 
 // Resolve a string with $VAR, ${VAR}, or %VAR% using the keys passed in EnvMap.
 // Any entries in EnvMap that are used are added to UsedEnvs.
+// The string is scanned once per expansion level and each token is searched in the EnvMap
+// (the longest key wins for the $VAR syntax) i.e. the cost is not proportional to the number
+// of context variables.
 typedef std::map<std::string, std::string> UsedEnvs;
 // TODO: Keep the resolution order?
 std::string ResolveContextVariables(const std::string & str, const EnvMap & map, UsedEnvs & envs);
@@ -0,0 +1,39 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <tuple>
+
+#include "FastLogExpPowCPU.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+FastLogExpPowFunc * GetFastLogExpPowFunc(FastLogExpPowKernel kernel)
+{
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        return AVX512GetFastLogExpPowFunc(kernel);
+    }
+#endif
+
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        return AVX2GetFastLogExpPowFunc(kernel);
+    }
+#endif
+
+#if OCIO_USE_SSE2
+    if (CPUInfo::instance().hasSSE2())
+    {
+        return SSE2GetFastLogExpPowFunc(kernel);
+    }
+#endif
+
+    std::ignore = kernel;
+    return nullptr;
+}
+
+} // namespace OCIO_NAMESPACE
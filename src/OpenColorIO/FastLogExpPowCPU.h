@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_FASTLOGEXPPOWCPU_H
+#define INCLUDED_OCIO_FASTLOGEXPPOWCPU_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+//
+// Fast log, exp and power kernels shared by the CPU renderers of the ops (i.e. Log, Gamma,
+// ExposureContrast) when OPTIMIZATION_FAST_LOG_EXP_POW is on. The kernels process packed RGBA
+// 32-bit float pixels, several pixels at once for the widest instruction set of the CPU.
+//
+// All the instruction sets use the same polynomial approximations (i.e. see sseLog2() and
+// sseExp2() in SSE.h) so the results only differ by the rounding of the fused multiply-adds
+// (AVX2 and AVX-512). The error bounds are:
+//   log2(x):      absolute error below 2e-5,
+//   exp2(x):      relative error below 3e-6 for x in ]-126, 128[,
+//   pow(x, y):    relative error below 5e-5 * (1 + |y * log2(x)|).
+//
+// There is no AVX (i.e. AVX1) version: the exponent and mantissa manipulations of log2 and
+// exp2 need 256-bit integer instructions which only come with AVX2, so an AVX version would
+// split each vector into two SSE2 halves for most of its work and not be faster than SSE2.
+//
+
+// Parameters of the kernels. Each array holds the red, green, blue and alpha values.
+struct FastLogExpPowParams
+{
+    float m_inScale[4]   { 1.f, 1.f, 1.f, 1.f };
+    float m_inOffset[4]  { 0.f, 0.f, 0.f, 0.f };
+    float m_exponent[4]  { 1.f, 1.f, 1.f, 1.f }; // Only used by the power kernels.
+    float m_outScale[4]  { 1.f, 1.f, 1.f, 1.f };
+    float m_outOffset[4] { 0.f, 0.f, 0.f, 0.f };
+
+    // Copy the input alpha to the output (i.e. the alpha parameters are then ignored).
+    bool m_keepAlpha = true;
+};
+
+// With t = in * inScale + inOffset, the kernels compute:
+enum FastLogExpPowKernel
+{
+    FAST_LOG2 = 0,        // out = log2( max(t, FLT_MIN) ) * outScale + outOffset
+    FAST_EXP2,            // out = exp2( t ) * outScale + outOffset
+    FAST_POWER,           // out = pow( max(t, 0), exponent ) * outScale + outOffset
+    FAST_POWER_MIRROR,    // out = sign(t) * pow( |t|, exponent ) * outScale + outOffset
+    FAST_POWER_PASS_THRU  // out = t > 0 ? pow( t, exponent ) * outScale + outOffset : t
+};
+
+typedef void (FastLogExpPowFunc)(const FastLogExpPowParams & params,
+                                 const float * in, float * out, long numPixels);
+
+// Return the kernel for the widest instruction set of the CPU (i.e. AVX-512, AVX2 or SSE2)
+// or null if no SIMD instruction set is available. Note that 'in' and 'out' could be the
+// same buffer.
+FastLogExpPowFunc * GetFastLogExpPowFunc(FastLogExpPowKernel kernel);
+
+#if OCIO_USE_SSE2
+FastLogExpPowFunc * SSE2GetFastLogExpPowFunc(FastLogExpPowKernel kernel);
+#endif
+
+#if OCIO_USE_AVX2
+FastLogExpPowFunc * AVX2GetFastLogExpPowFunc(FastLogExpPowKernel kernel);
+#endif
+
+#if OCIO_USE_AVX512
+FastLogExpPowFunc * AVX512GetFastLogExpPowFunc(FastLogExpPowKernel kernel);
+#endif
+
+} // namespace OCIO_NAMESPACE
+
+#endif // INCLUDED_OCIO_FASTLOGEXPPOWCPU_H
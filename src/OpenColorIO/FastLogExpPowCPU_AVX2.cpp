@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "FastLogExpPowCPU.h"
+#if OCIO_USE_AVX2
+
+#include <immintrin.h>
+
+#include "AVX2.h"
+#include "FastLogExpPowCPU_Kernels.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+// Two pixels per register.
+struct AVX2Traits
+{
+    typedef __m256 Vec;
+
+    static constexpr long NumPixels = 2;
+
+    // Only the first pixel is loaded or stored (i.e. there is at most one leftover pixel).
+    static inline __m256i PartialMask()
+    {
+        return _mm256_setr_epi32(-1, -1, -1, -1, 0, 0, 0, 0);
+    }
+
+    static inline Vec Load(const float * in) { return _mm256_loadu_ps(in); }
+    static inline Vec LoadPartial(const float * in, long /* numPixels */)
+    {
+        return _mm256_maskload_ps(in, PartialMask());
+    }
+    static inline void Store(float * out, Vec v) { _mm256_storeu_ps(out, v); }
+    static inline void StorePartial(float * out, Vec v, long /* numPixels */)
+    {
+        _mm256_maskstore_ps(out, PartialMask(), v);
+    }
+
+    static inline Vec LoadParams(const float (&params)[4])
+    {
+        return _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(params));
+    }
+    static inline Vec Set1(float v) { return _mm256_set1_ps(v); }
+
+    static inline Vec MulAdd(Vec a, Vec b, Vec c) { return _mm256_fmadd_ps(a, b, c); }
+    static inline Vec Max(Vec a, Vec b) { return _mm256_max_ps(a, b); }
+
+    static inline Vec Abs(Vec v)
+    {
+        return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), v);
+    }
+
+    static inline Vec CopySign(Vec magnitude, Vec sign)
+    {
+        const __m256 signMask = _mm256_set1_ps(-0.0f);
+        return _mm256_or_ps(_mm256_andnot_ps(signMask, magnitude), _mm256_and_ps(sign, signMask));
+    }
+
+    static inline Vec SelectPositive(Vec v, Vec a, Vec b)
+    {
+        return _mm256_blendv_ps(b, a, _mm256_cmp_ps(v, _mm256_setzero_ps(), _CMP_GT_OQ));
+    }
+
+    static inline Vec KeepAlpha(Vec v, Vec in) { return _mm256_blend_ps(v, in, 0x88); }
+
+    static inline Vec Log2(Vec v) { return avx2Log2(v); }
+    static inline Vec Exp2(Vec v) { return avx2Exp2(v); }
+    static inline Vec Power(Vec v, Vec exponent) { return avx2Power(v, exponent); }
+};
+
+} // anon.
+
+FastLogExpPowFunc * AVX2GetFastLogExpPowFunc(FastLogExpPowKernel kernel)
+{
+    return FastLogExpPowGetFunc<AVX2Traits>(kernel);
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
@@ -0,0 +1,85 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "FastLogExpPowCPU.h"
+#if OCIO_USE_AVX512
+
+#include <immintrin.h>
+
+#include "AVX512.h"
+#include "FastLogExpPowCPU_Kernels.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+// Four pixels per register.
+struct AVX512Traits
+{
+    typedef __m512 Vec;
+
+    static constexpr long NumPixels = 4;
+
+    // Note that the bit-wise float instructions are not in AVX-512F.
+    static inline __m512i SignMask() { return _mm512_set1_epi32(0x80000000); }
+
+    static inline __mmask16 PartialMask(long numPixels)
+    {
+        return (__mmask16)((1u << (4 * numPixels)) - 1u);
+    }
+
+    static inline Vec Load(const float * in) { return _mm512_loadu_ps(in); }
+    static inline Vec LoadPartial(const float * in, long numPixels)
+    {
+        return _mm512_maskz_loadu_ps(PartialMask(numPixels), in);
+    }
+    static inline void Store(float * out, Vec v) { _mm512_storeu_ps(out, v); }
+    static inline void StorePartial(float * out, Vec v, long numPixels)
+    {
+        _mm512_mask_storeu_ps(out, PartialMask(numPixels), v);
+    }
+
+    static inline Vec LoadParams(const float (&params)[4])
+    {
+        return _mm512_broadcast_f32x4(_mm_loadu_ps(params));
+    }
+    static inline Vec Set1(float v) { return _mm512_set1_ps(v); }
+
+    static inline Vec MulAdd(Vec a, Vec b, Vec c) { return _mm512_fmadd_ps(a, b, c); }
+    static inline Vec Max(Vec a, Vec b) { return _mm512_max_ps(a, b); }
+
+    static inline Vec Abs(Vec v)
+    {
+        return _mm512_castsi512_ps(_mm512_andnot_si512(SignMask(), _mm512_castps_si512(v)));
+    }
+
+    static inline Vec CopySign(Vec magnitude, Vec sign)
+    {
+        return _mm512_castsi512_ps(
+            _mm512_or_si512(_mm512_andnot_si512(SignMask(), _mm512_castps_si512(magnitude)),
+                            _mm512_and_si512(SignMask(), _mm512_castps_si512(sign))));
+    }
+
+    static inline Vec SelectPositive(Vec v, Vec a, Vec b)
+    {
+        return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(v, _mm512_setzero_ps(), _CMP_GT_OQ), b, a);
+    }
+
+    static inline Vec KeepAlpha(Vec v, Vec in) { return _mm512_mask_blend_ps(0x8888, v, in); }
+
+    static inline Vec Log2(Vec v) { return avx512Log2(v); }
+    static inline Vec Exp2(Vec v) { return avx512Exp2(v); }
+    static inline Vec Power(Vec v, Vec exponent) { return avx512Power(v, exponent); }
+};
+
+} // anon.
+
+FastLogExpPowFunc * AVX512GetFastLogExpPowFunc(FastLogExpPowKernel kernel)
+{
+    return FastLogExpPowGetFunc<AVX512Traits>(kernel);
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
@@ -0,0 +1,218 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_FASTLOGEXPPOWCPU_KERNELS_H
+#define INCLUDED_OCIO_FASTLOGEXPPOWCPU_KERNELS_H
+
+#include <limits>
+
+#include "FastLogExpPowCPU.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+//
+// The kernels are written once for all the instruction sets. Each FastLogExpPowCPU_<ISA>.cpp
+// file instantiates them with its own traits class (in an anonymous namespace, to not mix up
+// the instantiations compiled with different instruction sets) which provides:
+//
+//   typedef ... Vec;                     // The SIMD register type.
+//   static constexpr long NumPixels;     // Number of RGBA pixels in a register.
+//   Vec Load(const float * in);
+//   Vec LoadPartial(const float * in, long numPixels);
+//   void Store(float * out, Vec v);
+//   void StorePartial(float * out, Vec v, long numPixels);
+//   Vec LoadParams(const float (&params)[4]);   // Repeat the RGBA values for all the pixels.
+//   Vec Set1(float v);
+//   Vec MulAdd(Vec a, Vec b, Vec c);     // a * b + c
+//   Vec Max(Vec a, Vec b);
+//   Vec Abs(Vec v);
+//   Vec CopySign(Vec magnitude, Vec sign);
+//   Vec SelectPositive(Vec v, Vec a, Vec b);   // v > 0 ? a : b
+//   Vec KeepAlpha(Vec v, Vec in);        // The RGB channels of v and the alpha of in.
+//   Vec Log2(Vec v);
+//   Vec Exp2(Vec v);
+//   Vec Power(Vec v, Vec exponent);      // Maps the values smaller or equal to zero to zero.
+//
+
+template<typename T>
+struct FastLogExpPowVecParams
+{
+    explicit FastLogExpPowVecParams(const FastLogExpPowParams & params)
+        :   m_inScale(T::LoadParams(params.m_inScale))
+        ,   m_inOffset(T::LoadParams(params.m_inOffset))
+        ,   m_exponent(T::LoadParams(params.m_exponent))
+        ,   m_outScale(T::LoadParams(params.m_outScale))
+        ,   m_outOffset(T::LoadParams(params.m_outOffset))
+        ,   m_minValue(T::Set1(std::numeric_limits<float>::min()))
+    {
+    }
+
+    typename T::Vec m_inScale;
+    typename T::Vec m_inOffset;
+    typename T::Vec m_exponent;
+    typename T::Vec m_outScale;
+    typename T::Vec m_outOffset;
+    typename T::Vec m_minValue;
+};
+
+// The input and output affine steps are skipped at compile time when they are identities
+// (e.g. a plain gamma), so that the kernels are as fast as a loop only computing the function.
+template<typename T, FastLogExpPowKernel kernel, bool inAffine, bool outAffine>
+inline typename T::Vec FastLogExpPowEvaluate(const FastLogExpPowVecParams<T> & p,
+                                             typename T::Vec v)
+{
+    if constexpr (inAffine)
+    {
+        v = T::MulAdd(v, p.m_inScale, p.m_inOffset);
+    }
+
+    if constexpr (kernel == FAST_LOG2)
+    {
+        v = T::Log2(T::Max(v, p.m_minValue));
+    }
+    else if constexpr (kernel == FAST_EXP2)
+    {
+        v = T::Exp2(v);
+    }
+    else if constexpr (kernel == FAST_POWER)
+    {
+        v = T::Power(v, p.m_exponent);
+    }
+    else if constexpr (kernel == FAST_POWER_MIRROR)
+    {
+        v = T::CopySign(T::Power(T::Abs(v), p.m_exponent), v);
+    }
+    else if constexpr (kernel == FAST_POWER_PASS_THRU)
+    {
+        typename T::Vec res = T::Power(v, p.m_exponent);
+        if constexpr (outAffine)
+        {
+            res = T::MulAdd(res, p.m_outScale, p.m_outOffset);
+        }
+        return T::SelectPositive(v, res, v);
+    }
+
+    if constexpr (outAffine)
+    {
+        v = T::MulAdd(v, p.m_outScale, p.m_outOffset);
+    }
+    return v;
+}
+
+template<typename T, FastLogExpPowKernel kernel, bool keepAlpha, bool inAffine, bool outAffine>
+void FastLogExpPowApply(const FastLogExpPowParams & params,
+                        const float * in, float * out, long numPixels)
+{
+    const FastLogExpPowVecParams<T> p(params);
+
+    long idx = 0;
+    for (; idx + T::NumPixels <= numPixels; idx += T::NumPixels)
+    {
+        const typename T::Vec pixels = T::Load(in);
+
+        typename T::Vec res = FastLogExpPowEvaluate<T, kernel, inAffine, outAffine>(p, pixels);
+        if constexpr (keepAlpha)
+        {
+            res = T::KeepAlpha(res, pixels);
+        }
+
+        T::Store(out, res);
+
+        in  += 4 * T::NumPixels;
+        out += 4 * T::NumPixels;
+    }
+
+    // Process the leftover pixels.
+    if (idx < numPixels)
+    {
+        const long leftover = numPixels - idx;
+
+        const typename T::Vec pixels = T::LoadPartial(in, leftover);
+
+        typename T::Vec res = FastLogExpPowEvaluate<T, kernel, inAffine, outAffine>(p, pixels);
+        if constexpr (keepAlpha)
+        {
+            res = T::KeepAlpha(res, pixels);
+        }
+
+        T::StorePartial(out, res, leftover);
+    }
+}
+
+// True if the scale & offset do not change the channels (only RGB when the alpha is kept).
+inline bool IsFastLogExpPowIdentity(const float (&scale)[4], const float (&offset)[4],
+                                    bool keepAlpha)
+{
+    const int numChannels = keepAlpha ? 3 : 4;
+    for (int c = 0; c < numChannels; ++c)
+    {
+        if (scale[c] != 1.0f || offset[c] != 0.0f)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename T, FastLogExpPowKernel kernel, bool keepAlpha>
+void FastLogExpPowApply(const FastLogExpPowParams & params,
+                        const float * in, float * out, long numPixels)
+{
+    const bool inAffine  = !IsFastLogExpPowIdentity(params.m_inScale, params.m_inOffset, keepAlpha);
+    const bool outAffine = !IsFastLogExpPowIdentity(params.m_outScale, params.m_outOffset, keepAlpha);
+
+    if (inAffine && outAffine)
+    {
+        FastLogExpPowApply<T, kernel, keepAlpha, true, true>(params, in, out, numPixels);
+    }
+    else if (inAffine)
+    {
+        FastLogExpPowApply<T, kernel, keepAlpha, true, false>(params, in, out, numPixels);
+    }
+    else if (outAffine)
+    {
+        FastLogExpPowApply<T, kernel, keepAlpha, false, true>(params, in, out, numPixels);
+    }
+    else
+    {
+        FastLogExpPowApply<T, kernel, keepAlpha, false, false>(params, in, out, numPixels);
+    }
+}
+
+// The parameters are checked on each call as they could change (e.g. the dynamic properties
+// of the ExposureContrast op).
+template<typename T, FastLogExpPowKernel kernel>
+void FastLogExpPowApply(const FastLogExpPowParams & params,
+                        const float * in, float * out, long numPixels)
+{
+    if (params.m_keepAlpha)
+    {
+        FastLogExpPowApply<T, kernel, true>(params, in, out, numPixels);
+    }
+    else
+    {
+        FastLogExpPowApply<T, kernel, false>(params, in, out, numPixels);
+    }
+}
+
+template<typename T>
+FastLogExpPowFunc * FastLogExpPowGetFunc(FastLogExpPowKernel kernel)
+{
+    switch (kernel)
+    {
+        case FAST_LOG2:            return FastLogExpPowApply<T, FAST_LOG2>;
+        case FAST_EXP2:            return FastLogExpPowApply<T, FAST_EXP2>;
+        case FAST_POWER:           return FastLogExpPowApply<T, FAST_POWER>;
+        case FAST_POWER_MIRROR:    return FastLogExpPowApply<T, FAST_POWER_MIRROR>;
+        case FAST_POWER_PASS_THRU: return FastLogExpPowApply<T, FAST_POWER_PASS_THRU>;
+    }
+
+    return nullptr;
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // INCLUDED_OCIO_FASTLOGEXPPOWCPU_KERNELS_H
@@ -0,0 +1,63 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "FastLogExpPowCPU.h"
+#if OCIO_USE_SSE2
+
+#include "FastLogExpPowCPU_Kernels.h"
+#include "SSE.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+// One pixel per register.
+struct SSE2Traits
+{
+    typedef __m128 Vec;
+
+    static constexpr long NumPixels = 1;
+
+    static inline Vec Load(const float * in) { return _mm_loadu_ps(in); }
+    static inline Vec LoadPartial(const float * in, long /* numPixels */) { return _mm_loadu_ps(in); }
+    static inline void Store(float * out, Vec v) { _mm_storeu_ps(out, v); }
+    static inline void StorePartial(float * out, Vec v, long /* numPixels */) { _mm_storeu_ps(out, v); }
+
+    static inline Vec LoadParams(const float (&params)[4]) { return _mm_loadu_ps(params); }
+    static inline Vec Set1(float v) { return _mm_set1_ps(v); }
+
+    static inline Vec MulAdd(Vec a, Vec b, Vec c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+    static inline Vec Max(Vec a, Vec b) { return _mm_max_ps(a, b); }
+    static inline Vec Abs(Vec v) { return _mm_and_ps(v, EABS_MASK); }
+
+    static inline Vec CopySign(Vec magnitude, Vec sign)
+    {
+        return _mm_or_ps(_mm_and_ps(magnitude, EABS_MASK), _mm_and_ps(sign, ESIGN_MASK));
+    }
+
+    static inline Vec SelectPositive(Vec v, Vec a, Vec b)
+    {
+        return sseSelect(_mm_cmpgt_ps(v, EZERO), a, b);
+    }
+
+    static inline Vec KeepAlpha(Vec v, Vec in)
+    {
+        return sseSelect(_mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0)), in, v);
+    }
+
+    static inline Vec Log2(Vec v) { return sseLog2(v); }
+    static inline Vec Exp2(Vec v) { return sseExp2(v); }
+    static inline Vec Power(Vec v, Vec exponent) { return ssePower(v, exponent); }
+};
+
+} // anon.
+
+FastLogExpPowFunc * SSE2GetFastLogExpPowFunc(FastLogExpPowKernel kernel)
+{
+    return FastLogExpPowGetFunc<SSE2Traits>(kernel);
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_SSE2
@@ -16,6 +16,7 @@
 #include "ops/allocation/AllocationOp.h"
 #include "ops/lut3d/Lut3DOp.h"
 #include "ops/noop/NoOps.h"
+#include "Trace.h"
 
 
 namespace OCIO_NAMESPACE
@@ -67,6 +68,65 @@ void WriteShaderFooter(GpuShaderCreatorRcPtr & shaderCreator)
     shaderCreator->addToFunctionFooterShaderCode(ss.string().c_str());
 }
 
+std::string GetShaderCacheKey(const GenericGpuShaderDesc & shaderDesc)
+{
+    std::ostringstream oss;
+    oss << shaderDesc.getCacheID() << " "
+        << shaderDesc.getUniqueID() << " "
+        << shaderDesc.getTextureMaxWidth() << " "
+        << shaderDesc.getAllowTexture1D();
+    return oss.str();
+}
+
+// Maximum number of different shader description settings cached by a GPU processor.
+constexpr size_t MaxShaderCacheSize = 16;
+
+// Size (in bytes) of the shader text and of the texture values of a shader description.
+size_t GetShaderDescMemoryUsage(const GpuShaderDesc & shaderDesc)
+{
+    size_t size = std::strlen(shaderDesc.getShaderText());
+
+    const auto addTexture = [&size](size_t numValues, BitDepth bitDepth)
+    {
+        size += numValues * sizeof(float);
+        if (bitDepth != BIT_DEPTH_F32)
+        {
+            // The values packed as half-floats or as 16-bit integers.
+            size += numValues * sizeof(uint16_t);
+        }
+    };
+
+    const char * textureName = nullptr;
+    const char * samplerName = nullptr;
+    Interpolation interpolation = INTERP_LINEAR;
+    const void * data = nullptr;
+    BitDepth bitDepth = BIT_DEPTH_F32;
+
+    for (unsigned idx = 0; idx < shaderDesc.getNumTextures(); ++idx)
+    {
+        unsigned width = 0;
+        unsigned height = 0;
+        GpuShaderDesc::TextureType channel = GpuShaderDesc::TEXTURE_RGB_CHANNEL;
+        GpuShaderDesc::TextureDimensions dimensions = GpuShaderDesc::TEXTURE_2D;
+        shaderDesc.getTexture(idx, textureName, samplerName, width, height,
+                              channel, dimensions, interpolation);
+        shaderDesc.getTextureData(idx, bitDepth, data);
+
+        const size_t numChannels = (channel == GpuShaderDesc::TEXTURE_RED_CHANNEL) ? 1 : 3;
+        addTexture(static_cast<size_t>(width) * height * numChannels, bitDepth);
+    }
+
+    for (unsigned idx = 0; idx < shaderDesc.getNum3DTextures(); ++idx)
+    {
+        unsigned edgelen = 0;
+        shaderDesc.get3DTexture(idx, textureName, samplerName, edgelen, interpolation);
+        shaderDesc.get3DTextureData(idx, bitDepth, data);
+
+        addTexture(static_cast<size_t>(edgelen) * edgelen * edgelen * 3, bitDepth);
+    }
+
+    return size;
+}
 
 }
 
@@ -99,8 +159,30 @@ void GPUProcessor::Impl::finalize(const OpRcPtrVec & rawOps, OptimizationFlags o
 
 void GPUProcessor::Impl::extractGpuShaderInfo(GpuShaderCreatorRcPtr & shaderCreator) const
 {
+    OCIO_TRACE_SCOPE("gpu", "GPUProcessor::extractGpuShaderInfo");
+
     AutoMutex lock(m_mutex);
 
+    // The shader information only depends on the ops and on the shader description settings
+    // so, when an empty shader description is used, the result of a previous call with the
+    // same settings is reused. That avoids generating again the shader code and the textures.
+    // Note that the uniforms and the dynamic properties are bound to the ops of this processor.
+
+    GenericGpuShaderDesc * shaderDesc = dynamic_cast<GenericGpuShaderDesc *>(shaderCreator.get());
+
+    std::string key;
+    if (shaderDesc && shaderDesc->isEmpty())
+    {
+        key = GetShaderCacheKey(*shaderDesc);
+
+        const auto entry = m_shaderCache.find(key);
+        if (entry != m_shaderCache.end())
+        {
+            shaderDesc->copyShaderInfo(static_cast<const GenericGpuShaderDesc &>(*entry->second));
+            return;
+        }
+    }
+
     // Create the shader program information.
     for(const auto & op : m_ops)
     {
@@ -111,6 +193,38 @@ void GPUProcessor::Impl::extractGpuShaderInfo(GpuShaderCreatorRcPtr & shaderCrea
     WriteShaderFooter(shaderCreator);
 
     shaderCreator->finalize();
+
+    if (!key.empty())
+    {
+        if (m_shaderCache.size() >= MaxShaderCacheSize)
+        {
+            m_shaderCache.clear();
+        }
+
+        GpuShaderDescRcPtr cachedDesc = GenericGpuShaderDesc::Create();
+        static_cast<GenericGpuShaderDesc &>(*cachedDesc).copyShaderInfo(*shaderDesc);
+        m_shaderCache[key] = cachedDesc;
+    }
+}
+
+ConstMemoryUsageRcPtr GPUProcessor::Impl::getMemoryUsage() const
+{
+    AutoMutex lock(m_mutex);
+
+    MemoryUsageRcPtr memoryUsage = MemoryUsage::Create();
+    for (const auto & op : m_ops)
+    {
+        memoryUsage->addEntry(op->getInfo().c_str(), GetMemoryUsage(op));
+    }
+
+    size_t shaderCacheSize = 0;
+    for (const auto & entry : m_shaderCache)
+    {
+        shaderCacheSize += GetShaderDescMemoryUsage(*entry.second);
+    }
+    memoryUsage->addEntry("Shader cache", shaderCacheSize);
+
+    return memoryUsage;
 }
 
 
@@ -205,5 +319,10 @@ void GPUProcessor::extractGpuShaderInfo(GpuShaderCreatorRcPtr & shaderCreator) c
     shaderCreator->end();
 }
 
+ConstMemoryUsageRcPtr GPUProcessor::getMemoryUsage() const
+{
+    return getImpl()->getMemoryUsage();
+}
+
 
 } // namespace OCIO_NAMESPACE
@@ -6,6 +6,9 @@
 #define INCLUDED_OCIO_GPUPROCESSOR_H
 
 
+#include <map>
+#include <string>
+
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "Op.h"
@@ -31,6 +34,8 @@ public:
     void extractGpuShaderInfo(GpuShaderDescRcPtr & shaderDesc) const;
     void extractGpuShaderInfo(GpuShaderCreatorRcPtr & shaderCreator) const;
 
+    ConstMemoryUsageRcPtr getMemoryUsage() const;
+
     ////////////////////////////////////////////
     //
     // Builder functions, Not exposed
@@ -43,6 +48,10 @@ private:
     bool          m_hasChannelCrosstalk = true;
     std::string   m_cacheID;
     mutable Mutex m_mutex;
+
+    // Shader information already extracted by the processor, indexed by the shader description
+    // settings (i.e. language, function name, resource prefix, texture limits, etc.).
+    mutable std::map<std::string, GpuShaderDescRcPtr> m_shaderCache;
 };
 
 
@@ -2,16 +2,24 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 #include <algorithm>
+#include <cmath>
 #include <cstring>
+#include <iterator>
+#include <memory>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+#include <Imath/half.h>
+
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "DynamicProperty.h"
 #include "GpuShader.h"
+#include "HashUtils.h"
 #include "LutLimits.h"
+#include "Mutex.h"
 #include "Platform.h"
 
 namespace OCIO_NAMESPACE
@@ -20,20 +28,111 @@ namespace OCIO_NAMESPACE
 namespace
 {
 
-static void  CreateArray(const float * buf,
-                         unsigned w, unsigned h, unsigned d,
-                         GpuShaderDesc::TextureType type,
-                         std::vector<float> & res)
+// Process-wide registry of the texture values.  GPU shaders built from processors which
+// share the same LUT (e.g. a show LUT used by several display/view processors) then share a
+// single copy of the values, identified by a hash of the texture content.
+template<typename T>
+class TextureValuesRegistry
 {
-    if(buf==nullptr)
+public:
+    typedef std::shared_ptr<const std::vector<T>> ValuesRcPtr;
+
+    TextureValuesRegistry() = default;
+    TextureValuesRegistry(const TextureValuesRegistry &) = delete;
+    TextureValuesRegistry & operator=(const TextureValuesRegistry &) = delete;
+
+    ValuesRcPtr getValues(const std::string & cacheID, const T * buf, size_t size)
     {
-        throw Exception("The buffer is invalid");
+        AutoMutex guard(m_mutex);
+
+        auto it = m_values.find(cacheID);
+        if (it != m_values.end())
+        {
+            ValuesRcPtr values = it->second.lock();
+            // Do not trust the hash alone.
+            if (values && values->size() == size
+                && std::memcmp(values->data(), buf, size * sizeof(T)) == 0)
+            {
+                return values;
+            }
+        }
+
+        ValuesRcPtr values = std::make_shared<const std::vector<T>>(buf, buf + size);
+        m_values[cacheID] = values;
+
+        // Forget about the textures no longer used by any shader.
+        if (m_values.size() > m_purgeSize)
+        {
+            for (auto entry = m_values.begin(); entry != m_values.end(); )
+            {
+                entry = entry->second.expired() ? m_values.erase(entry) : std::next(entry);
+            }
+            m_purgeSize = std::max(size_t(64), 2 * m_values.size());
+        }
+
+        return values;
     }
 
-    const size_t size
-        = w * h * d * (type==GpuShaderDesc::TEXTURE_RGB_CHANNEL ? 3 : 1);
-    res.resize(size);
-    std::memcpy(&res[0], buf, size * sizeof(float));
+private:
+    Mutex m_mutex;
+    std::unordered_map<std::string, std::weak_ptr<const std::vector<T>>> m_values;
+    size_t m_purgeSize = 64;
+};
+
+TextureValuesRegistry<float> & GetTextureValuesRegistry()
+{
+    static TextureValuesRegistry<float> registry;
+    return registry;
+}
+
+TextureValuesRegistry<uint16_t> & GetPackedTextureValuesRegistry()
+{
+    static TextureValuesRegistry<uint16_t> registry;
+    return registry;
+}
+
+// Convert the texture values to the requested texture bit-depth and return the bit-depth
+// really used.
+BitDepth PackTextureValues(const std::vector<float> & values,
+                           BitDepth bitDepth,
+                           std::vector<uint16_t> & packed)
+{
+    packed.resize(values.size());
+
+    if (bitDepth == BIT_DEPTH_UINT16)
+    {
+        // Normalized integers are only possible when all the values are within [0, 1]
+        // (note that NaNs are excluded), otherwise fall back to half-floats.
+        if (std::all_of(values.begin(), values.end(),
+                        [](float v) { return v >= 0.0f && v <= 1.0f; }))
+        {
+            for (size_t idx = 0; idx < values.size(); ++idx)
+            {
+                packed[idx] = static_cast<uint16_t>(values[idx] * 65535.0f + 0.5f);
+            }
+            return BIT_DEPTH_UINT16;
+        }
+    }
+
+    for (size_t idx = 0; idx < values.size(); ++idx)
+    {
+        // Avoid turning large values into infinities.
+        const float v = values[idx];
+        const half h(std::isnan(v) ? v : std::min(std::max(v, -HALF_MAX), HALF_MAX));
+        packed[idx] = h.bits();
+    }
+    return BIT_DEPTH_F16;
+}
+
+std::string ComputeTextureCacheID(const float * buf, size_t size,
+                                  unsigned w, unsigned h, unsigned d,
+                                  GpuShaderDesc::TextureType type)
+{
+    std::ostringstream oss;
+    oss << w << "x" << h << "x" << d
+        << (type==GpuShaderDesc::TEXTURE_RGB_CHANNEL ? "_rgb_" : "_red_")
+        << CacheIDHash(reinterpret_cast<const char *>(buf), size * sizeof(float));
+    return oss.str();
 }
 
 std::size_t alignOffset(std::size_t offset, std::size_t alignment)
@@ -71,6 +170,7 @@ public:
                 unsigned dimensions,
                 Interpolation interpolation,
                 unsigned textureShaderBindingIndex,
+                BitDepth bitDepth,
                 const float * v)
             :   m_textureName(textureName)
             ,   m_samplerName(samplerName)
@@ -101,10 +201,35 @@ public:
                 throw Exception(ss.str().c_str());
             }
 
-            // An unfortunate copy is mandatory to allow the creation of a GPU shader cache.
-            // The cache needs a decoupling of the processor and shader instances forbidding
-            // shared naked pointer usage.
-            CreateArray(v, m_width, m_height, m_depth, m_type, m_values);
+            if (v==nullptr)
+            {
+                throw Exception("The buffer is invalid");
+            }
+
+            // A copy is mandatory to allow the creation of a GPU shader cache. The cache needs
+            // a decoupling of the processor and shader instances forbidding shared naked
+            // pointer usage. However, identical textures share the same copy.
+            const size_t size
+                = w * h * d * (m_type==GpuShaderDesc::TEXTURE_RGB_CHANNEL ? 3 : 1);
+            m_cacheID = ComputeTextureCacheID(v, size, w, h, d, m_type);
+            m_values  = GetTextureValuesRegistry().getValues(m_cacheID, v, size);
+
+            if (bitDepth != BIT_DEPTH_F32)
+            {
+                std::vector<uint16_t> packed;
+                m_bitDepth = PackTextureValues(*m_values, bitDepth, packed);
+
+                const std::string packedID = m_cacheID + "_" + BitDepthToString(m_bitDepth);
+                m_packedValues = GetPackedTextureValuesRegistry().getValues(packedID,
+                                                                            packed.data(),
+                                                                            packed.size());
+            }
+        }
+
+        const void * getData() const
+        {
+            return m_bitDepth == BIT_DEPTH_F32 ? static_cast<const void *>(m_values->data())
+                                               : static_cast<const void *>(m_packedValues->data());
         }
 
         std::string m_textureName;
@@ -117,7 +242,12 @@ public:
         Interpolation m_interp;
         unsigned m_textureShaderBindingIndex;
 
-        std::vector<float> m_values;
+        std::string m_cacheID;
+        std::shared_ptr<const std::vector<float>> m_values;
+
+        // Only used when the values are packed in a smaller bit-depth.
+        BitDepth m_bitDepth = BIT_DEPTH_F32;
+        std::shared_ptr<const std::vector<uint16_t>> m_packedValues;
 
         Texture() = delete;
     };
@@ -208,6 +338,7 @@ public:
                         GpuShaderDesc::TextureType channel,
                         GpuShaderDesc::TextureDimensions dimensions,
                         Interpolation interpolation,
+                        BitDepth bitDepth,
                         const float * values)
     {
         if(width > get1dLutMaxWidth())
@@ -221,7 +352,7 @@ public:
                                            + static_cast<unsigned>(m_textures3D.size());
         unsigned numDimensions = static_cast<unsigned>(dimensions);
         Texture t(textureName, samplerName, width, height, 1, channel, numDimensions, interpolation,
-                  textureShaderBindingIndex, values);
+                  textureShaderBindingIndex, bitDepth, values);
         m_textures.push_back(t);
         return textureShaderBindingIndex;
     }
@@ -270,7 +401,35 @@ public:
         }
 
         const Texture & t = m_textures[index];
-        values   = &t.m_values[0];
+        values   = t.m_values->data();
+    }
+
+    const char * getTextureCacheID(unsigned index) const
+    {
+        if(index >= m_textures.size())
+        {
+            std::ostringstream ss;
+            ss << "1D LUT access error: index = " << index
+               << " where size = " << m_textures.size();
+            throw Exception(ss.str().c_str());
+        }
+
+        return m_textures[index].m_cacheID.c_str();
+    }
+
+    void getTextureData(unsigned index, BitDepth & bitDepth, const void *& data) const
+    {
+        if(index >= m_textures.size())
+        {
+            std::ostringstream ss;
+            ss << "1D LUT access error: index = " << index
+               << " where size = " << m_textures.size();
+            throw Exception(ss.str().c_str());
+        }
+
+        const Texture & t = m_textures[index];
+        bitDepth = t.m_bitDepth;
+        data     = t.getData();
     }
 
     unsigned getTextureShaderBindingIndex(unsigned index) const
@@ -291,6 +450,7 @@ public:
                           const char * samplerName,
                           unsigned edgelen,
                           Interpolation interpolation,
+                          BitDepth bitDepth,
                           const float * values)
     {
         if(edgelen > get3dLutMaxLength())
@@ -305,7 +465,7 @@ public:
                                            + static_cast<unsigned>(m_textures3D.size());
         Texture t(textureName, samplerName, edgelen, edgelen, edgelen,
                   GpuShaderDesc::TEXTURE_RGB_CHANNEL, 3,
-                  interpolation, textureShaderBindingIndex, values);
+                  interpolation, textureShaderBindingIndex, bitDepth, values);
         m_textures3D.push_back(t);
         return textureShaderBindingIndex;
     }
@@ -342,7 +502,35 @@ public:
         }
 
         const Texture & t = m_textures3D[index];
-        values = &t.m_values[0];
+        values = t.m_values->data();
+    }
+
+    const char * get3DTextureCacheID(unsigned index) const
+    {
+        if(index >= m_textures3D.size())
+        {
+            std::ostringstream ss;
+            ss << "3D LUT access error: index = " << index
+               << " where size = " << m_textures3D.size();
+            throw Exception(ss.str().c_str());
+        }
+
+        return m_textures3D[index].m_cacheID.c_str();
+    }
+
+    void get3DTextureData(unsigned index, BitDepth & bitDepth, const void *& data) const
+    {
+        if(index >= m_textures3D.size())
+        {
+            std::ostringstream ss;
+            ss << "3D LUT access error: index = " << index
+               << " where size = " << m_textures3D.size();
+            throw Exception(ss.str().c_str());
+        }
+
+        const Texture & t = m_textures3D[index];
+        bitDepth = t.m_bitDepth;
+        data     = t.getData();
     }
 
     unsigned get3DTextureShaderBindingIndex(unsigned index) const
@@ -452,6 +640,29 @@ public:
     {
         return m_uniformBufferSize;
     }
+
+    bool isEmpty() const
+    {
+        return m_textures.empty() && m_textures3D.empty() && m_uniforms.empty();
+    }
+
+    void copyFrom(const PrivateImpl & rhs)
+    {
+        m_textures   = rhs.m_textures;
+        m_textures3D = rhs.m_textures3D;
+
+        // Note: Uniform is not assignable.
+        m_uniforms.clear();
+        m_uniforms.reserve(rhs.m_uniforms.size());
+        for (const auto & uniform : rhs.m_uniforms)
+        {
+            m_uniforms.push_back(uniform);
+        }
+
+        m_max1DLUTWidth     = rhs.m_max1DLUTWidth;
+        m_allowTexture1D    = rhs.m_allowTexture1D;
+        m_uniformBufferSize = rhs.m_uniformBufferSize;
+    }
     Textures m_textures;
     Textures m_textures3D;
     Uniforms m_uniforms;
@@ -579,7 +790,7 @@ unsigned GenericGpuShaderDesc::addTexture(const char * textureName,
                                           const float * values)
 {
     return getImplGeneric()->addTexture(textureName, samplerName, width, height, channel, 
-                                        dimensions, interpolation, values)
+                                        dimensions, interpolation, getTextureBitDepth(), values)
                              + getTextureBindingStart();
 }
 
@@ -605,6 +816,18 @@ unsigned GenericGpuShaderDesc::getTextureShaderBindingIndex(unsigned index) cons
     return getImplGeneric()->getTextureShaderBindingIndex(index) + getTextureBindingStart();
 }
 
+const char * GenericGpuShaderDesc::getTextureCacheID(unsigned index) const
+{
+    return getImplGeneric()->getTextureCacheID(index);
+}
+
+void GenericGpuShaderDesc::getTextureData(unsigned index,
+                                          BitDepth & bitDepth,
+                                          const void *& data) const
+{
+    getImplGeneric()->getTextureData(index, bitDepth, data);
+}
+
 unsigned GenericGpuShaderDesc::getNum3DTextures() const noexcept
 {
     return unsigned(getImplGeneric()->m_textures3D.size());
@@ -616,7 +839,8 @@ unsigned GenericGpuShaderDesc::add3DTexture(const char * textureName,
                                             Interpolation interpolation,
                                             const float * values)
 {
-    return getImplGeneric()->add3DTexture(textureName, samplerName, edgelen, interpolation, values)
+    return getImplGeneric()->add3DTexture(textureName, samplerName, edgelen, interpolation,
+                                          getTextureBitDepth(), values)
            + getTextureBindingStart();
 }
 
@@ -639,6 +863,32 @@ unsigned GenericGpuShaderDesc::get3DTextureShaderBindingIndex(unsigned index) co
     return getImplGeneric()->get3DTextureShaderBindingIndex(index) + getTextureBindingStart();
 }
 
+const char * GenericGpuShaderDesc::get3DTextureCacheID(unsigned index) const
+{
+    return getImplGeneric()->get3DTextureCacheID(index);
+}
+
+void GenericGpuShaderDesc::get3DTextureData(unsigned index,
+                                            BitDepth & bitDepth,
+                                            const void *& data) const
+{
+    getImplGeneric()->get3DTextureData(index, bitDepth, data);
+}
+
+bool GenericGpuShaderDesc::isEmpty() const
+{
+    return isCreatorEmpty() && getImplGeneric()->isEmpty();
+}
+
+void GenericGpuShaderDesc::copyShaderInfo(const GenericGpuShaderDesc & rhs)
+{
+    if (this != &rhs)
+    {
+        copyCreatorInfo(rhs);
+        getImplGeneric()->copyFrom(*rhs.getImplGeneric());
+    }
+}
+
 void GenericGpuShaderDesc::Deleter(GenericGpuShaderDesc* c)
 {
     delete c;
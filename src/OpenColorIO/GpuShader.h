@@ -68,6 +68,8 @@ public:
                     Interpolation & interpolation) const override;
     void getTextureValues(unsigned index, const float *& values) const override;
     unsigned getTextureShaderBindingIndex(unsigned index) const override;
+    const char * getTextureCacheID(unsigned index) const override;
+    void getTextureData(unsigned index, BitDepth & bitDepth, const void *& data) const override;
 
     // Accessors to the 3D textures built from 3D LUT
     //
@@ -84,6 +86,17 @@ public:
                       Interpolation & interpolation) const override;
     void get3DTextureValues(unsigned index, const float *& value) const override;
     unsigned get3DTextureShaderBindingIndex(unsigned index) const override;
+    const char * get3DTextureCacheID(unsigned index) const override;
+    void get3DTextureData(unsigned index, BitDepth & bitDepth, const void *& data) const override;
+
+    // Helpers used to cache the shader information
+    //
+
+    // Return true if nothing was added yet to the shader description.
+    bool isEmpty() const;
+    // Copy the complete shader information i.e. settings, shader code, textures, uniforms and
+    // dynamic properties. Note that the texture values and the dynamic properties are shared.
+    void copyShaderInfo(const GenericGpuShaderDesc & rhs);
 
 private:
 
@@ -95,6 +108,10 @@ private:
 
     static void Deleter(GenericGpuShaderDesc* c);
 
+    // The parts accessing the GpuShaderCreator data are in GpuShaderDesc.cpp.
+    bool isCreatorEmpty() const;
+    void copyCreatorInfo(const GenericGpuShaderDesc & rhs);
+
     class ImplGeneric;
     ImplGeneric * m_implGeneric;
 
@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <cstring>
 #include <sstream>
 #include <memory>
 
@@ -49,6 +50,10 @@ public:
     unsigned m_descriptorSetIndex = 0;
     unsigned m_textureBindingStart = 1;
 
+    BitDepth m_textureBitDepth = BIT_DEPTH_F32;
+
+    bool m_useUniformBlock = false;
+
     Impl()
         :   m_functionName("OCIOMain")
         ,   m_resourcePrefix("ocio")
@@ -85,6 +90,9 @@ public:
             m_descriptorSetIndex = rhs.m_descriptorSetIndex;
             m_textureBindingStart = rhs.m_textureBindingStart;
 
+            m_textureBitDepth = rhs.m_textureBitDepth;
+            m_useUniformBlock = rhs.m_useUniformBlock;
+
             m_shaderCode.clear();
             m_shaderCodeID.clear();
         }
@@ -197,6 +205,37 @@ unsigned GpuShaderCreator::getTextureBindingStart() const noexcept
     return getImpl()->m_textureBindingStart;
 }
 
+void GpuShaderCreator::setTextureBitDepth(BitDepth bitDepth)
+{
+    if (bitDepth != BIT_DEPTH_F32 && bitDepth != BIT_DEPTH_F16 && bitDepth != BIT_DEPTH_UINT16)
+    {
+        std::ostringstream oss;
+        oss << "Unsupported texture bit-depth: " << BitDepthToString(bitDepth) << ".";
+        throw Exception(oss.str().c_str());
+    }
+
+    AutoMutex lock(getImpl()->m_cacheIDMutex);
+    getImpl()->m_textureBitDepth = bitDepth;
+    getImpl()->m_cacheID.clear();
+}
+
+BitDepth GpuShaderCreator::getTextureBitDepth() const noexcept
+{
+    return getImpl()->m_textureBitDepth;
+}
+
+void GpuShaderCreator::setUseUniformBlock(bool use)
+{
+    AutoMutex lock(getImpl()->m_cacheIDMutex);
+    getImpl()->m_useUniformBlock = use;
+    getImpl()->m_cacheID.clear();
+}
+
+bool GpuShaderCreator::getUseUniformBlock() const noexcept
+{
+    return getImpl()->m_useUniformBlock;
+}
+
 bool GpuShaderCreator::hasDynamicProperty(DynamicPropertyType type) const
 {
     for (const auto & dp : getImpl()->m_dynamicProperties)
@@ -274,6 +313,14 @@ const char * GpuShaderCreator::getCacheID() const noexcept
         os << getImpl()->m_numResources << " ";
         os << getImpl()->m_descriptorSetIndex << " ";
         os << getImpl()->m_textureBindingStart << " ";
+        if (getImpl()->m_textureBitDepth != BIT_DEPTH_F32)
+        {
+            os << BitDepthToString(getImpl()->m_textureBitDepth) << " ";
+        }
+        if (getImpl()->m_useUniformBlock)
+        {
+            os << "uniform_block ";
+        }
         os << getImpl()->m_shaderCodeID;
         getImpl()->m_cacheID = os.str();
     }
@@ -334,14 +381,25 @@ void GpuShaderCreator::createShaderText(const char * shaderParameterDeclarations
 
     getImpl()->m_shaderCode.clear();
 
-    if (getImpl()->m_language == GPU_LANGUAGE_GLSL_VK_4_6 && (shaderParameterDeclarations && *shaderParameterDeclarations))
+    const bool uniformBlock = UseUniformBlock(*this)
+                              && (shaderParameterDeclarations && *shaderParameterDeclarations);
+
+    if (uniformBlock)
     {
-        getImpl()->m_shaderCode += "layout (set = "+std::to_string(getImpl()->m_descriptorSetIndex) +
-                                   ", binding = 0) uniform " +
-                                   getImpl()->m_functionName + "_Parameters\n{\n";
+        if (getImpl()->m_language == GPU_LANGUAGE_GLSL_VK_4_6)
+        {
+            getImpl()->m_shaderCode += "layout (set = "+std::to_string(getImpl()->m_descriptorSetIndex) +
+                                       ", binding = 0) uniform " +
+                                       getImpl()->m_functionName + "_Parameters\n{\n";
+        }
+        else
+        {
+            getImpl()->m_shaderCode += "layout (std140) uniform " +
+                                       getImpl()->m_functionName + "_Parameters\n{\n";
+        }
     }
     getImpl()->m_shaderCode += (shaderParameterDeclarations && *shaderParameterDeclarations) ? shaderParameterDeclarations : "";
-    if (getImpl()->m_language == GPU_LANGUAGE_GLSL_VK_4_6 && (shaderParameterDeclarations && *shaderParameterDeclarations))
+    if (uniformBlock)
     {
         getImpl()->m_shaderCode += "\n};\n";
     }
@@ -402,6 +460,38 @@ void GpuShaderCreator::finalize()
 
 
 
+bool GenericGpuShaderDesc::isCreatorEmpty() const
+{
+    const Impl * impl = getImpl();
+
+    return impl->m_numResources == 0
+        && impl->m_parameterDeclarations.empty()
+        && impl->m_textureDeclarations.empty()
+        && impl->m_helperMethods.empty()
+        && impl->m_functionHeader.empty()
+        && impl->m_functionBody.empty()
+        && impl->m_functionFooter.empty()
+        && impl->m_shaderCode.empty()
+        && impl->m_dynamicProperties.empty();
+}
+
+void GenericGpuShaderDesc::copyCreatorInfo(const GenericGpuShaderDesc & rhs)
+{
+    Impl * impl = getImpl();
+    const Impl * rhsImpl = rhs.getImpl();
+
+    *impl = *rhsImpl;
+
+    AutoMutex lock(impl->m_cacheIDMutex);
+
+    // The assignment only copies the settings and the shader code parts.
+    impl->m_shaderCode        = rhsImpl->m_shaderCode;
+    impl->m_shaderCodeID      = rhsImpl->m_shaderCodeID;
+    impl->m_dynamicProperties = rhsImpl->m_dynamicProperties;
+    impl->m_cacheID.clear();
+}
+
+
 GpuShaderDescRcPtr GpuShaderDesc::CreateShaderDesc()
 {
     return GenericGpuShaderDesc::Create();
@@ -424,9 +514,130 @@ GpuShaderCreatorRcPtr GpuShaderDesc::clone() const
     return DynamicPtrCast<GpuShaderCreator>(gpuDesc);
 }
 
+const char * GpuShaderDesc::getTextureCacheID(unsigned /*index*/) const
+{
+    return "";
+}
+
+const char * GpuShaderDesc::get3DTextureCacheID(unsigned /*index*/) const
+{
+    return "";
+}
+
+void GpuShaderDesc::getTextureData(unsigned index, BitDepth & bitDepth, const void *& data) const
+{
+    const float * values = nullptr;
+    getTextureValues(index, values);
+
+    bitDepth = BIT_DEPTH_F32;
+    data     = values;
+}
+
+void GpuShaderDesc::get3DTextureData(unsigned index, BitDepth & bitDepth, const void *& data) const
+{
+    const float * values = nullptr;
+    get3DTextureValues(index, values);
+
+    bitDepth = BIT_DEPTH_F32;
+    data     = values;
+}
+
 const char * GpuShaderDesc::getShaderText() const noexcept
 {
     return getImpl()->m_shaderCode.c_str();
 }
 
+void GpuShaderDesc::fillUniformBuffer(void * buffer, std::size_t bufferSize) const
+{
+    if (!buffer)
+    {
+        throw Exception("The uniform buffer is null.");
+    }
+
+    if (bufferSize < getUniformBufferSize())
+    {
+        std::ostringstream oss;
+        oss << "The uniform buffer size " << bufferSize
+            << " is smaller than the expected size " << getUniformBufferSize() << ".";
+        throw Exception(oss.str().c_str());
+    }
+
+    char * data = static_cast<char *>(buffer);
+    std::memset(data, 0, getUniformBufferSize());
+
+    // Array elements are padded to 16 bytes with the std140 layout.
+    static constexpr std::size_t ArrayStride = 16;
+
+    const unsigned numUniforms = getNumUniforms();
+    for (unsigned idx = 0; idx < numUniforms; ++idx)
+    {
+        UniformData uniform;
+        const char * name = getUniform(idx, uniform);
+
+        char * dst = data + uniform.m_bufferOffset;
+
+        switch (uniform.m_type)
+        {
+            case UNIFORM_DOUBLE:
+            {
+                const float value = (float)uniform.m_getDouble();
+                std::memcpy(dst, &value, sizeof(float));
+                break;
+            }
+            case UNIFORM_BOOL:
+            {
+                const int value = uniform.m_getBool() ? 1 : 0;
+                std::memcpy(dst, &value, sizeof(int));
+                break;
+            }
+            case UNIFORM_FLOAT3:
+            {
+                const Float3 & values = uniform.m_getFloat3();
+                std::memcpy(dst, values.data(), 3 * sizeof(float));
+                break;
+            }
+            case UNIFORM_VECTOR_FLOAT:
+            {
+                const int size = uniform.m_vectorFloat.m_getSize();
+                const float * values = uniform.m_vectorFloat.m_getVector();
+                if (size > 0
+                    && uniform.m_bufferOffset + (size - 1) * ArrayStride + sizeof(float) > bufferSize)
+                {
+                    std::ostringstream oss;
+                    oss << "The uniform '" << name << "' does not fit in the uniform buffer.";
+                    throw Exception(oss.str().c_str());
+                }
+                for (int i = 0; i < size; ++i)
+                {
+                    std::memcpy(dst + i * ArrayStride, values + i, sizeof(float));
+                }
+                break;
+            }
+            case UNIFORM_VECTOR_INT:
+            {
+                const int size = uniform.m_vectorInt.m_getSize();
+                const int * values = uniform.m_vectorInt.m_getVector();
+                if (size > 0
+                    && uniform.m_bufferOffset + (size - 1) * ArrayStride + sizeof(int) > bufferSize)
+                {
+                    std::ostringstream oss;
+                    oss << "The uniform '" << name << "' does not fit in the uniform buffer.";
+                    throw Exception(oss.str().c_str());
+                }
+                for (int i = 0; i < size; ++i)
+                {
+                    std::memcpy(dst + i * ArrayStride, values + i, sizeof(int));
+                }
+                break;
+            }
+            case UNIFORM_UNKNOWN:
+            {
+                std::ostringstream oss;
+                oss << "The uniform '" << name << "' has an unknown type.";
+                throw Exception(oss.str().c_str());
+            }
+        }
+    }
+}
+
 } // namespace OCIO_NAMESPACE
@@ -297,8 +297,9 @@ GpuShaderText::GpuShaderLine& GpuShaderText::GpuShaderLine::operator=(const GpuS
     return *this;
 }
 
-GpuShaderText::GpuShaderText(GpuLanguage lang)
+GpuShaderText::GpuShaderText(GpuLanguage lang, bool uniformBlock)
     :   m_lang(lang)
+    ,   m_uniformBlock(uniformBlock)
     ,   m_indent(0)
 {
     m_ossText.precision(16);
@@ -923,7 +924,7 @@ std::string GpuShaderText::sampleTex3D(const std::string& textureName,
 void GpuShaderText::declareUniformFloat(const std::string & uniformName)
 {
     std::string uniformDeclString("uniform ");
-    if (m_lang == GPU_LANGUAGE_MSL_2_0 || m_lang == GPU_LANGUAGE_GLSL_VK_4_6)
+    if (m_uniformBlock || m_lang == GPU_LANGUAGE_MSL_2_0 || m_lang == GPU_LANGUAGE_GLSL_VK_4_6)
     {
         uniformDeclString = "";
     }
@@ -934,11 +935,12 @@ void GpuShaderText::declareUniformBool(const std::string & uniformName)
 {
     std::string uniformDeclString("uniform ");
     std::string boolKeyword("bool");
-    if (m_lang == GPU_LANGUAGE_MSL_2_0)
+    if (m_uniformBlock || m_lang == GPU_LANGUAGE_MSL_2_0)
     {
         uniformDeclString = "";
     }
-    else if (m_lang == GPU_LANGUAGE_GLSL_VK_4_6)
+
+    if (m_lang == GPU_LANGUAGE_GLSL_VK_4_6)
     {
         uniformDeclString = "";
         boolKeyword = "int";
@@ -949,7 +951,7 @@ void GpuShaderText::declareUniformBool(const std::string & uniformName)
 void GpuShaderText::declareUniformFloat3(const std::string & uniformName)
 {
     std::string uniformDeclString("uniform ");
-    if (m_lang == GPU_LANGUAGE_MSL_2_0 || m_lang == GPU_LANGUAGE_GLSL_VK_4_6)
+    if (m_uniformBlock || m_lang == GPU_LANGUAGE_MSL_2_0 || m_lang == GPU_LANGUAGE_GLSL_VK_4_6)
     {
         uniformDeclString = "";
     }
@@ -959,7 +961,7 @@ void GpuShaderText::declareUniformFloat3(const std::string & uniformName)
 void GpuShaderText::declareUniformArrayFloat(const std::string & uniformName, unsigned int size)
 {
     std::string uniformDeclString("uniform ");
-    if (m_lang == GPU_LANGUAGE_MSL_2_0 || m_lang == GPU_LANGUAGE_GLSL_VK_4_6)
+    if (m_uniformBlock || m_lang == GPU_LANGUAGE_MSL_2_0 || m_lang == GPU_LANGUAGE_GLSL_VK_4_6)
     {
         uniformDeclString = "";
     }
@@ -969,7 +971,7 @@ void GpuShaderText::declareUniformArrayFloat(const std::string & uniformName, un
 void GpuShaderText::declareUniformArrayInt(const std::string & uniformName, unsigned int size)
 {
     std::string uniformDeclString("uniform ");
-    if (m_lang == GPU_LANGUAGE_MSL_2_0 || m_lang == GPU_LANGUAGE_GLSL_VK_4_6)
+    if (m_uniformBlock || m_lang == GPU_LANGUAGE_MSL_2_0 || m_lang == GPU_LANGUAGE_GLSL_VK_4_6)
     {
         uniformDeclString = "";
     }
@@ -1389,6 +1391,37 @@ std::string GpuShaderText::castToBool(const std::string& v) const
 }
 
 
+bool UseUniformBlock(const GpuShaderCreator & shaderCreator)
+{
+    bool useUniformBlock = false;
+
+    switch (shaderCreator.getLanguage())
+    {
+        case GPU_LANGUAGE_GLSL_VK_4_6:
+        {
+            // Vulkan only supports uniform blocks.
+            useUniformBlock = true;
+            break;
+        }
+        case GPU_LANGUAGE_GLSL_4_0:
+        case GPU_LANGUAGE_GLSL_ES_3_0:
+        {
+            useUniformBlock = shaderCreator.getUseUniformBlock();
+            break;
+        }
+        case GPU_LANGUAGE_CG:
+        case GPU_LANGUAGE_GLSL_1_2:
+        case GPU_LANGUAGE_GLSL_1_3:
+        case GPU_LANGUAGE_GLSL_ES_1_0:
+        case GPU_LANGUAGE_HLSL_SM_5_0:
+        case GPU_LANGUAGE_MSL_2_0:
+        case LANGUAGE_OSL_1:
+            break;
+    }
+
+    return useUniformBlock;
+}
+
 std::string BuildResourceName(GpuShaderCreatorRcPtr & shaderCreator, const std::string & prefix,
                               const std::string & base)
 {
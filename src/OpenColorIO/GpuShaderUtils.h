@@ -47,7 +47,9 @@ public:
 public:
 
     GpuShaderText() = delete;
-    explicit GpuShaderText(GpuLanguage lang);
+    // When uniformBlock is true, the uniform helpers declare the uniforms as the members of a
+    // uniform block (i.e. refer to UseUniformBlock()).
+    explicit GpuShaderText(GpuLanguage lang, bool uniformBlock = false);
 
     // Create a new GpuShaderLine instance and associate it with the GpuShaderText object.
     GpuShaderLine newLine();
@@ -249,6 +251,8 @@ private:
 private:
     // Shader language to use in the various shader text builder methods.
     GpuLanguage m_lang; 
+    // Declare the uniforms as the members of a uniform block.
+    bool m_uniformBlock;
     // String stream containing the current shader text.
     std::ostringstream m_ossText;
 
@@ -265,6 +269,10 @@ private:
     unsigned m_indent;
 };
 
+// Return true if the uniforms are declared as the members of a single uniform block using the
+// std140 layout (i.e. refer to GpuShaderCreator::setUseUniformBlock()).
+bool UseUniformBlock(const GpuShaderCreator & shaderCreator);
+
 // Create a resource name prepending the prefix of the shaderCreator to base.
 std::string BuildResourceName(GpuShaderCreatorRcPtr & shaderCreator, const std::string & prefix,
                               const std::string & base);
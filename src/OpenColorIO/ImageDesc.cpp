@@ -111,6 +111,11 @@ bool GenericImageDesc::isFloat() const
     return m_isFloat;
 }
 
+bool GenericImageDesc::hasContiguousLines() const
+{
+    return m_height == 1 || m_yStrideBytes == m_xStrideBytes * m_width;
+}
+
 
 ///////////////////////////////////////////////////////////////////////////
 
@@ -44,6 +44,9 @@ struct GenericImageDesc
     bool isRGBAPacked() const;
     // Is the image buffer a 32-bit float image buffer?
     bool isFloat() const;
+    // Does each line immediately follow the previous one (i.e. the pixels could be processed
+    // across the lines)?
+    bool hasContiguousLines() const;
 };
 
 template<typename Type>
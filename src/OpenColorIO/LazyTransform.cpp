@@ -0,0 +1,118 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <sstream>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "LazyTransform.h"
+#include "Logging.h"
+#include "Mutex.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+namespace
+{
+// The loaders of a config share the same YAML document, so only one transform is created at
+// a time. The lock is only taken while a transform is pending or when copying.
+Mutex g_lazyTransformMutex;
+}
+
+LazyTransform::LazyTransform(const LazyTransform & rhs)
+{
+    *this = rhs;
+}
+
+LazyTransform & LazyTransform::operator=(const LazyTransform & rhs)
+{
+    if (this != &rhs)
+    {
+        AutoMutex lock(g_lazyTransformMutex);
+
+        // A pending transform stays pending in the copy i.e. the loader is shared.
+        m_transform = rhs.m_transform ? rhs.m_transform->createEditableCopy() : TransformRcPtr();
+        m_loader    = rhs.m_loader;
+        m_error     = rhs.m_error;
+        m_pending.store(rhs.m_pending.load(std::memory_order_acquire), std::memory_order_release);
+    }
+    return *this;
+}
+
+ConstTransformRcPtr LazyTransform::get() const noexcept
+{
+    if (isPending())
+    {
+        load();
+    }
+    return m_transform;
+}
+
+void LazyTransform::set(const TransformRcPtr & transform) noexcept
+{
+    AutoMutex lock(g_lazyTransformMutex);
+
+    m_transform = transform;
+    m_loader    = nullptr;
+    m_error.clear();
+    m_pending.store(false, std::memory_order_release);
+}
+
+void LazyTransform::setLoader(const Loader & loader)
+{
+    AutoMutex lock(g_lazyTransformMutex);
+
+    m_transform.reset();
+    m_loader = loader;
+    m_error.clear();
+    m_pending.store(static_cast<bool>(loader), std::memory_order_release);
+}
+
+void LazyTransform::materialize() const
+{
+    get();
+
+    if (!m_error.empty())
+    {
+        throw Exception(m_error.c_str());
+    }
+}
+
+void LazyTransform::load() const noexcept
+{
+    AutoMutex lock(g_lazyTransformMutex);
+
+    // Another thread could have created the transform in the meantime.
+    if (!m_pending.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    try
+    {
+        m_transform = m_loader();
+    }
+    catch (const std::exception & e)
+    {
+        m_transform.reset();
+        m_error = e.what();
+
+        std::ostringstream oss;
+        oss << "Lazy transform loading failed: " << m_error;
+        LogError(oss.str());
+    }
+    catch (...)
+    {
+        m_transform.reset();
+        m_error = "Lazy transform loading failed: unknown error.";
+        LogError(m_error);
+    }
+
+    // Release the parsed data.
+    m_loader = nullptr;
+    m_pending.store(false, std::memory_order_release);
+}
+
+} // namespace OCIO_NAMESPACE
@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_LAZYTRANSFORM_H
+#define INCLUDED_OCIO_LAZYTRANSFORM_H
+
+#include <atomic>
+#include <functional>
+#include <string>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+
+namespace OCIO_NAMESPACE
+{
+
+// Holds a transform which could be created on first access. The config reader uses it to defer
+// the creation of the color space transforms (see OCIO_LAZY_TRANSFORMS_ENVVAR) i.e. the loader
+// keeps the parsed YAML node until the transform is requested.
+//
+// Note that a loader failure is not thrown by get() (the public getters are noexcept) but is
+// logged and kept so that config validation and processor creation can report it.
+class LazyTransform
+{
+public:
+    typedef std::function<TransformRcPtr()> Loader;
+
+    LazyTransform() = default;
+    LazyTransform(const LazyTransform & rhs);
+    LazyTransform & operator=(const LazyTransform & rhs);
+    ~LazyTransform() = default;
+
+    // Return the transform, creating it if needed. Return null if the loader failed.
+    ConstTransformRcPtr get() const noexcept;
+
+    // Set an already created transform (i.e. discard any pending loader or previous error).
+    void set(const TransformRcPtr & transform) noexcept;
+
+    // Defer the transform creation to the first access.
+    void setLoader(const Loader & loader);
+
+    // Create the transform if needed and throw if the loader failed.
+    void materialize() const;
+
+    // True if the transform is not created yet.
+    bool isPending() const noexcept { return m_pending.load(std::memory_order_acquire); }
+
+private:
+    void load() const noexcept;
+
+    mutable TransformRcPtr m_transform;
+    mutable Loader m_loader;
+    mutable std::string m_error;
+    mutable std::atomic<bool> m_pending{ false };
+};
+
+// Gives access to the lazy transforms of a color space (used by the config reader & validation).
+class ColorSpaceLazyTransforms
+{
+public:
+    static void SetLoader(ColorSpace & cs, ColorSpaceDirection dir,
+                          const LazyTransform::Loader & loader);
+
+    // Create the pending transforms of the color space, throw if one of them fails.
+    static void Materialize(const ColorSpace & cs);
+
+    // True if at least one of the transforms of the color space is not created yet.
+    static bool IsPending(const ColorSpace & cs) noexcept;
+};
+
+} // namespace OCIO_NAMESPACE
+
+#endif // INCLUDED_OCIO_LAZYTRANSFORM_H
@@ -10,6 +10,7 @@
 
 #include "Display.h"
 #include "FileRules.h"
+#include "LazyTransform.h"
 #include "Logging.h"
 #include "MathUtils.h"
 #include "OCIOYaml.h"
@@ -22,6 +23,7 @@
 #include "ParseUtils.h"
 #include "PathUtils.h"
 #include "Platform.h"
+#include "Trace.h"
 #include "utils/StringUtils.h"
 #include "ViewingRules.h"
 #include "yaml-cpp/yaml.h"
@@ -3421,7 +3423,34 @@ void save(YAML::Emitter& out, ConstTransformRcPtr t, unsigned int majorVersion)
 
 // ColorSpace
 
-inline void load(const YAML::Node& node, ColorSpaceRcPtr& cs, unsigned int majorVersion)
+// Set a color space transform either immediately or, in lazy mode, through a loader keeping
+// the YAML node of the transform until its first access.
+inline void loadColorSpaceTransform(const YAML::Node & node,
+                                    ColorSpaceRcPtr & cs,
+                                    ColorSpaceDirection dir,
+                                    bool lazyTransforms)
+{
+    if (lazyTransforms)
+    {
+        ColorSpaceLazyTransforms::SetLoader(*cs, dir, [node]()
+        {
+            TransformRcPtr val;
+            load(node, val);
+            return val;
+        });
+    }
+    else
+    {
+        TransformRcPtr val;
+        load(node, val);
+        cs->setTransform(val, dir);
+    }
+}
+
+inline void load(const YAML::Node& node,
+                 ColorSpaceRcPtr& cs,
+                 unsigned int majorVersion,
+                 bool lazyTransforms)
 {
     if(node.Tag() != "ColorSpace")
         return; // not a !<ColorSpace> tag
@@ -3527,9 +3556,8 @@ inline void load(const YAML::Node& node, ColorSpaceRcPtr& cs, unsigned int major
                 throwError(node, "'to_reference' or 'to_scene_reference' cannot be used for a "
                                  "display color space.");
             }
-            TransformRcPtr val;
-            load(iter->second, val);
-            cs->setTransform(val, COLORSPACE_DIR_TO_REFERENCE);
+            loadColorSpaceTransform(iter->second, cs, COLORSPACE_DIR_TO_REFERENCE,
+                                    lazyTransforms);
         }
         else if (key == "to_display_reference")
         {
@@ -3538,9 +3566,8 @@ inline void load(const YAML::Node& node, ColorSpaceRcPtr& cs, unsigned int major
                 throwError(node, "'to_display_reference' cannot be used for a "
                                  "non-display color space.");
             }
-            TransformRcPtr val;
-            load(iter->second, val);
-            cs->setTransform(val, COLORSPACE_DIR_TO_REFERENCE);
+            loadColorSpaceTransform(iter->second, cs, COLORSPACE_DIR_TO_REFERENCE,
+                                    lazyTransforms);
         }
         else if(key == "from_reference" || (majorVersion >= 2 && key == "from_scene_reference"))
         {
@@ -3549,9 +3576,8 @@ inline void load(const YAML::Node& node, ColorSpaceRcPtr& cs, unsigned int major
                 throwError(node, "'from_reference' or 'from_scene_reference' cannot be used for "
                                  "a display color space.");
             }
-            TransformRcPtr val;
-            load(iter->second, val);
-            cs->setTransform(val, COLORSPACE_DIR_FROM_REFERENCE);
+            loadColorSpaceTransform(iter->second, cs, COLORSPACE_DIR_FROM_REFERENCE,
+                                    lazyTransforms);
         }
         else if (key == "from_display_reference")
         {
@@ -3560,9 +3586,8 @@ inline void load(const YAML::Node& node, ColorSpaceRcPtr& cs, unsigned int major
                 throwError(node, "'from_display_reference' cannot be used for a "
                                  "non-display color space.");
             }
-            TransformRcPtr val;
-            load(iter->second, val);
-            cs->setTransform(val, COLORSPACE_DIR_FROM_REFERENCE);
+            loadColorSpaceTransform(iter->second, cs, COLORSPACE_DIR_FROM_REFERENCE,
+                                    lazyTransforms);
         }
         else
         {
@@ -4484,6 +4509,9 @@ inline void load(const YAML::Node& node, ConfigRcPtr & config, const char* filen
     bool boolval = false;
     EnvironmentMode mode = ENV_ENVIRONMENT_LOAD_ALL;
 
+    // The color space transforms could be created on first access.
+    const bool lazyTransforms = Platform::isEnvPresent(OCIO_LAZY_TRANSFORMS_ENVVAR);
+
     for (Iterator iter = node.begin(); iter != node.end(); ++iter)
     {
         const std::string & key = iter->first.as<std::string>();
@@ -4789,7 +4817,7 @@ inline void load(const YAML::Node& node, ConfigRcPtr & config, const char* filen
                 if(val.Tag() == "ColorSpace")
                 {
                     ColorSpaceRcPtr cs = ColorSpace::Create(REFERENCE_SPACE_SCENE);
-                    load(val, cs, config->getMajorVersion());
+                    load(val, cs, config->getMajorVersion(), lazyTransforms);
                     for(int ii = 0; ii < config->getNumColorSpaces(); ++ii)
                     {
                         if(strcmp(config->getColorSpaceNameByIndex(ii), cs->getName()) == 0)
@@ -4825,7 +4853,7 @@ inline void load(const YAML::Node& node, ConfigRcPtr & config, const char* filen
                 if (val.Tag() == "ColorSpace")
                 {
                     ColorSpaceRcPtr cs = ColorSpace::Create(REFERENCE_SPACE_DISPLAY);
-                    load(val, cs, config->getMajorVersion());
+                    load(val, cs, config->getMajorVersion(), lazyTransforms);
                     for (int ii = 0; ii < config->getNumColorSpaces(); ++ii)
                     {
                         if (strcmp(config->getColorSpaceNameByIndex(ii), cs->getName()) == 0)
@@ -5421,7 +5449,13 @@ void OCIOYaml::Read(std::istream & istream, ConfigRcPtr & config, const char * f
 {
     try
     {
-        YAML::Node node = YAML::Load(istream);
+        YAML::Node node;
+        {
+            OCIO_TRACE_SCOPE("config", "YAML::Load");
+            node = YAML::Load(istream);
+        }
+
+        OCIO_TRACE_SCOPE("config", "OCIOYaml::load");
         load(node, config, filename);
     }
     catch(const std::exception & e)
@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
 #include <sstream>
 #include <fstream>
 #include <vector>
@@ -387,12 +388,14 @@ void ExtractOCIOZArchive(const char * archivePath, const char * destination)
     mz_zip_reader_delete(&extracter);
 }
 
+// Maximum size of a file inside an OCIOZ archive. 256 MB is well above any realistic individual
+// OCIO config or LUT file size.
+static constexpr size_t MAX_ENTRY_SIZE = 256 * 1024 * 1024;
+
 std::vector<uint8_t> readEntryBuffer(void * reader)
 {
     int32_t buf_size = (int32_t)mz_zip_reader_entry_save_buffer_length(reader);
     // Reject negative values (minizip error codes) and implausibly large entries.
-    // 256 MB is well above any realistic individual OCIO config or LUT file size.
-    static constexpr size_t MAX_ENTRY_SIZE = 256 * 1024 * 1024;
     if (buf_size <= 0 || (size_t)buf_size > MAX_ENTRY_SIZE)
     {
         throw Exception("OCIOZ archive entry size is invalid or exceeds maximum allowed size.");
@@ -583,6 +586,71 @@ void getEntriesMappingFromArchiveFile(const std::string & archivePath,
 // Implementation of CIOPOciozArchive class.
 //////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+
+// The key of the archive index ignores the case and the slash differences between platforms
+// (like mz_path_compare_wc() with ignore_case).
+std::string GetEntryKey(const std::string & filepath)
+{
+    std::string key = StringUtils::Lower(pystring::os::path::normpath(filepath));
+    std::replace(key.begin(), key.end(), '\\', '/');
+    return key;
+}
+
+inline uint16_t ReadUInt16(const uint8_t * data)
+{
+    return uint16_t(data[0] | (data[1] << 8));
+}
+
+inline uint32_t ReadUInt32(const uint8_t * data)
+{
+    return uint32_t(data[0])         | (uint32_t(data[1]) << 8)
+         | (uint32_t(data[2]) << 16) | (uint32_t(data[3]) << 24);
+}
+
+// Return the data of an uncompressed file from the mapped archive, or null if the file is
+// compressed (or encrypted) or if its local header is not valid.
+const uint8_t * GetStoredData(const Platform::MappedFile & archive, const mz_zip_file & info)
+{
+    if (info.compression_method != MZ_COMPRESS_METHOD_STORE
+        || (info.flag & MZ_ZIP_FLAG_ENCRYPTED)
+        || info.disk_number != 0
+        || info.compressed_size != info.uncompressed_size
+        || info.disk_offset < 0)
+    {
+        return nullptr;
+    }
+
+    // Local file header: signature (4 bytes), 22 bytes of information, filename length
+    // (2 bytes), extra field length (2 bytes) then the filename and the extra field.
+    static constexpr size_t LOCAL_HEADER_SIZE = 30;
+    static constexpr uint32_t LOCAL_HEADER_SIGNATURE = 0x04034b50;
+
+    const size_t offset = (size_t)info.disk_offset;
+    if (offset + LOCAL_HEADER_SIZE > archive.size())
+    {
+        return nullptr;
+    }
+
+    const uint8_t * header = archive.data() + offset;
+    if (ReadUInt32(header) != LOCAL_HEADER_SIGNATURE)
+    {
+        return nullptr;
+    }
+
+    const size_t dataOffset = offset + LOCAL_HEADER_SIZE
+                            + ReadUInt16(header + 26) + ReadUInt16(header + 28);
+    if (dataOffset + (size_t)info.uncompressed_size > archive.size())
+    {
+        return nullptr;
+    }
+
+    return archive.data() + dataOffset;
+}
+
+} // anon.
+
 std::vector<uint8_t> CIOPOciozArchive::getLutData(const char * filepath) const
 {
     // In order to ease the implementation and to facilitate a future Python binding, this method
@@ -595,9 +663,14 @@ std::vector<uint8_t> CIOPOciozArchive::getLutData(const char * filepath) const
     // instead of a std::istream (max 5%). But the following iterations are just as fast due to
     // the FileTransform cache.
 
-    std::vector<uint8_t> buffer;
-    buffer = getFileBufferFromArchive(pystring::os::path::normpath(filepath), m_archiveAbsPath);
-    return buffer;
+    if (!m_archive)
+    {
+        // The index is not built, fall back to scanning the archive.
+        return getFileBufferFromArchive(pystring::os::path::normpath(filepath), m_archiveAbsPath);
+    }
+
+    const Entry * entry = findEntry(filepath);
+    return entry ? readEntry(*entry) : std::vector<uint8_t>();
 }
 
 std::string CIOPOciozArchive::getConfigData() const
@@ -610,7 +683,7 @@ std::string CIOPOciozArchive::getConfigData() const
     std::string configData = "";
     std::string configFilename = std::string(OCIO_CONFIG_DEFAULT_NAME) +
                                  std::string(OCIO_CONFIG_DEFAULT_FILE_EXT);
-    std::vector<uint8_t> configBuffer = getFileBufferFromArchive(configFilename, m_archiveAbsPath);
+    std::vector<uint8_t> configBuffer = getLutData(configFilename.c_str());
     if (configBuffer.size() > 0)
     {
         configData = std::string(configBuffer.begin(), configBuffer.end());
@@ -621,21 +694,10 @@ std::string CIOPOciozArchive::getConfigData() const
 
 std::string CIOPOciozArchive::getFastLutFileHash(const char * filepath) const
 {
-    std::string hash = "";
-    // Check into the map to check if the file exists in the archive.
-    // The key is the full path of the file inside the archive and the value is the hash.
-    // Normalize filepath and find it in the std::map.
-    std::string fpath = pystring::os::path::normpath(filepath);
-    for (auto it = m_entries.begin(); it != m_entries.end(); ++it)
-    {
-        // Verify that the key and the specfied filepath matches while ignoring the slashes
-        // differences in platforms.
-        if (mz_path_compare_wc(it->first.c_str(), fpath.c_str(), 1) == MZ_OK)
-        {
-            hash = std::string(it->second);
-        }
-    }
-    return hash;
+    // The index key is the normalized full path of the file inside the archive and the value
+    // holds the hash.
+    const Entry * entry = findEntry(filepath);
+    return entry ? entry->m_hash : "";
 }
 
 void CIOPOciozArchive::setArchiveAbsPath(const std::string & absPath)
@@ -656,8 +718,131 @@ void CIOPOciozArchive::buildEntries()
         os << "Error could not read OCIOZ archive: " << m_archiveAbsPath;
         throw Exception (os.str().c_str());
     }
+    ociozStream.close();
+
+    // Open the archive only once, all the following reads use the mapped archive.
+    auto archive = std::make_shared<Platform::MappedFile>(m_archiveAbsPath);
+    if (archive->size() > (size_t)std::numeric_limits<int32_t>::max())
+    {
+        std::ostringstream os;
+        os << "OCIOZ archive is too large: " << m_archiveAbsPath;
+        throw Exception (os.str().c_str());
+    }
 
-    getEntriesMappingFromArchiveFile(m_archiveAbsPath, m_entries);
+    void * reader = nullptr;
+#if MZ_VERSION_BUILD >= 040000
+    reader = mz_zip_reader_create();
+#else
+    mz_zip_reader_create(&reader);
+#endif
+
+    MinizipNgHandlerGuard extracterGuard(reader, false, false);
+
+    if (mz_zip_reader_open_buffer(reader, const_cast<uint8_t *>(archive->data()),
+                                  (int32_t)archive->size(), 0) != MZ_OK)
+    {
+        std::ostringstream os;
+        os << "Could not open " << m_archiveAbsPath << " in order to get the entries.";
+        throw Exception(os.str().c_str());
+    }
+
+    void * zip = nullptr;
+    mz_zip_reader_get_zip_handle(reader, &zip);
+
+    m_entries.clear();
+
+    // A single pass over the central directory builds the complete index.
+    if (mz_zip_reader_goto_first_entry(reader) == MZ_OK)
+    {
+        do
+        {
+            mz_zip_file * file_info = nullptr;
+            if (mz_zip_reader_entry_get_info(reader, &file_info) == MZ_OK)
+            {
+                Entry entry;
+                entry.m_hash       = std::string(file_info->filename) + std::to_string(file_info->crc);
+                entry.m_cdPos      = mz_zip_get_entry(zip);
+                entry.m_size       = (size_t)std::max<int64_t>(0, file_info->uncompressed_size);
+                entry.m_storedData = GetStoredData(*archive, *file_info);
+
+                // Like the sequential scan, the first matching file wins.
+                m_entries.emplace(GetEntryKey(file_info->filename), entry);
+            }
+        } while (mz_zip_reader_goto_next_entry(reader) == MZ_OK);
+    }
+
+    m_archive = archive;
+}
+
+const CIOPOciozArchive::Entry * CIOPOciozArchive::findEntry(const std::string & filepath) const
+{
+    const auto it = m_entries.find(GetEntryKey(filepath));
+    return it != m_entries.end() ? &it->second : nullptr;
+}
+
+std::vector<uint8_t> CIOPOciozArchive::readEntry(const Entry & entry) const
+{
+    if (entry.m_size > MAX_ENTRY_SIZE)
+    {
+        throw Exception("OCIOZ archive entry size is invalid or exceeds maximum allowed size.");
+    }
+
+    if (entry.m_storedData)
+    {
+        // Stored files are copied straight from the mapped archive.
+        return std::vector<uint8_t>(entry.m_storedData, entry.m_storedData + entry.m_size);
+    }
+
+    std::vector<uint8_t> buffer(entry.m_size);
+    if (buffer.empty())
+    {
+        return buffer;
+    }
+
+    // Each read uses its own reader on the mapped archive (i.e. without reading the file again)
+    // so that concurrent reads do not need any synchronization.
+    void * reader = nullptr;
+#if MZ_VERSION_BUILD >= 040000
+    reader = mz_zip_reader_create();
+#else
+    mz_zip_reader_create(&reader);
+#endif
+
+    MinizipNgHandlerGuard extracterGuard(reader, false, false);
+
+    void * zip = nullptr;
+    if (mz_zip_reader_open_buffer(reader, const_cast<uint8_t *>(m_archive->data()),
+                                  (int32_t)m_archive->size(), 0) != MZ_OK
+        || mz_zip_reader_get_zip_handle(reader, &zip) != MZ_OK
+        || mz_zip_goto_entry(zip, entry.m_cdPos) != MZ_OK
+        || mz_zip_entry_read_open(zip, 0, nullptr) != MZ_OK)
+    {
+        std::ostringstream os;
+        os << "Could not read " << entry.m_hash << " from " << m_archiveAbsPath << ".";
+        throw Exception(os.str().c_str());
+    }
+
+    size_t total = 0;
+    while (total < buffer.size())
+    {
+        const int32_t read = mz_zip_entry_read(zip, &buffer[total],
+                                               (int32_t)(buffer.size() - total));
+        if (read <= 0)
+        {
+            break;
+        }
+        total += (size_t)read;
+    }
+    mz_zip_entry_close(zip);
+
+    if (total != buffer.size())
+    {
+        std::ostringstream os;
+        os << "Could not read " << entry.m_hash << " from " << m_archiveAbsPath << ".";
+        throw Exception(os.str().c_str());
+    }
+
+    return buffer;
 }
 
 } // namespace OCIO_NAMESPACE
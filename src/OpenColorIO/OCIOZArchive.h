@@ -9,12 +9,20 @@
 #include <fstream>
 #include <vector>
 #include <map>
+#include <memory>
 #include <string>
+#include <unordered_map>
 
 #include <OpenColorIO/OpenColorIO.h>
 
 namespace OCIO_NAMESPACE
 {
+
+namespace Platform
+{
+class MappedFile;
+}
+
 /**
  * \brief Archive a config into an OCIOZ file.
  * 
@@ -95,15 +103,31 @@ public:
     void setArchiveAbsPath(const std::string & absPath);
 
     /**
-     * \brief Build a map of the zip file table of contents for the files in the archive.
+     * \brief Build an index of the zip file table of contents for the files in the archive.
      * 
-     * The structure is a std::map with the key as the full path of the file and the value as a 
-     * calculated hash.
+     * The archive is opened only once and mapped in memory. The index maps the normalized path
+     * of each file (ignoring the case and the slash differences between platforms) to its
+     * location in the archive so that reading a file does not scan the archive entries.
+     * Uncompressed (i.e. stored) files are directly copied from the mapped archive while the
+     * compressed ones are decompressed on the fly. Concurrent reads do not lock.
      */
     void buildEntries();
+
 private:
+    struct Entry
+    {
+        std::string m_hash;                     // Full path of the file + CRC32.
+        int64_t m_cdPos = 0;                    // Position in the central directory.
+        size_t m_size = 0;                      // Uncompressed size in bytes.
+        const uint8_t * m_storedData = nullptr; // Data of a stored file in the mapped archive.
+    };
+
+    const Entry * findEntry(const std::string & filepath) const;
+    std::vector<uint8_t> readEntry(const Entry & entry) const;
+
     std::string m_archiveAbsPath;
-    std::map<std::string, std::string> m_entries;
+    std::shared_ptr<const Platform::MappedFile> m_archive;
+    std::unordered_map<std::string, Entry> m_entries;
 };
 
 } // namespace OCIO_NAMESPACE
@@ -48,6 +48,10 @@ public:
     virtual bool isDynamic() const;
     virtual bool hasDynamicProperty(DynamicPropertyType type) const;
     virtual DynamicPropertyRcPtr getDynamicProperty(DynamicPropertyType type) const;
+
+    // Estimate of the memory (in bytes) allocated for the tables built by the renderer
+    // (e.g. the optimized LUT of the 3D LUT renderer).
+    virtual size_t getMemoryUsage() const { return 0; }
 };
 
 class OpData;
@@ -159,6 +163,10 @@ public:
     // This should yield a string of not unreasonable length.
     virtual std::string getCacheID() const = 0;
 
+    // Estimate of the memory (in bytes) allocated for the op parameters (e.g. the LUT values).
+    // Note that the values could be shared with other op data instances.
+    virtual size_t getMemoryUsage() const { return 0; }
+
     // FormatMetadata.
     FormatMetadataImpl & getFormatMetadata() { return m_metadata;  }
     const FormatMetadataImpl & getFormatMetadata() const { return m_metadata; }
@@ -400,17 +408,32 @@ public:
     // already inverted (i.e. no inv matrices are present in the OpVec when reaching the
     // optimization step).
     //
-    void optimize(OptimizationFlags oFlags);
+    // Note: The results (i.e. the whole optimized list, the LUT compositions and the inverse LUT
+    // replacements) are memoized in a process-wide cache keyed by the op cache IDs and the
+    // optimization flags, so the returned ops could be shared with other lists. Ops with
+    // dynamic properties are never shared.
+    //
+    // Note: When a report is provided, the passes, the changes made by each optimization rule
+    // and the time spent in it are added to the report.
+    //
+    void optimize(OptimizationFlags oFlags, OptimizationReport * report = nullptr);
 
     // Only OptimizationFlags related to bitdepth optimization are used.
     void optimizeForBitdepth(const BitDepth & inBitDepth,
                              const BitDepth & outBitDepth,
-                             OptimizationFlags oFlags);
+                             OptimizationFlags oFlags,
+                             OptimizationReport * report = nullptr);
 
 };
 
 std::string SerializeOpVec(const OpRcPtrVec & ops, int indent=0);
 
+// Clear the process-wide cache of the optimized op sequences (see OpRcPtrVec::optimize()).
+void ClearOptimizedOpsCache();
+
+// Estimate of the memory (in bytes) held by the cache of the optimized op sequences.
+size_t GetOptimizedOpsCacheMemoryUsage();
+
 void CreateOpVecFromOpData(OpRcPtrVec & ops,
                             const ConstOpDataRcPtr & opData,
                             TransformDirection dir);
@@ -420,6 +443,37 @@ inline bool HasFlag(OptimizationFlags flags, OptimizationFlags queryFlag)
     return (flags & queryFlag) == queryFlag;
 }
 
+// Fills the optimization reports, whose mutators are not part of the public API (used by the
+// op optimizations and the processor finalizations when OPTIMIZATION_REPORT is set).
+class OptimizationReportBuilder
+{
+public:
+    static OptimizationReportRcPtr Create();
+
+    // Empty report of the processors created without OPTIMIZATION_REPORT.
+    static ConstOptimizationReportRcPtr GetEmpty();
+
+    static void SetNumPasses(OptimizationReport & report, int numPasses);
+    static void SetFromCache(OptimizationReport & report, bool fromCache);
+    static void SetOptimizationTime(OptimizationReport & report, double time);
+    // Add the count & time to an existing rule or add a new rule.
+    static void AddRule(OptimizationReport & report, const char * name, int count, double time);
+    static void AddOpBefore(OptimizationReport & report, const char * opType);
+    static void AddOpAfter(OptimizationReport & report, const char * opType);
+    static void AddRenderer(OptimizationReport & report, const char * name, double time);
+};
+
+// Estimate of the memory (in bytes) allocated for the op data, which could be null.
+inline size_t GetMemoryUsage(const ConstOpDataRcPtr & data)
+{
+    return data ? data->getMemoryUsage() : 0;
+}
+
+inline size_t GetMemoryUsage(const ConstOpRcPtr & op)
+{
+    return GetMemoryUsage(op->data());
+}
+
 } // namespace OCIO_NAMESPACE
 
 #endif
@@ -2,17 +2,25 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 #include <algorithm>
+#include <chrono>
 #include <iterator>
+#include <list>
 #include <sstream>
+#include <unordered_map>
 
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "Caching.h"
+#include "HashUtils.h"
 #include "Logging.h"
+#include "Mutex.h"
 #include "Op.h"
 #include "ops/lut1d/Lut1DOp.h"
 #include "ops/lut3d/Lut3DOp.h"
 #include "ops/range/RangeOp.h"
+#include "Platform.h"
+#include "Trace.h"
 
 namespace OCIO_NAMESPACE
 {
@@ -20,6 +28,26 @@ namespace OCIO_NAMESPACE
 namespace
 {
 
+// Run an optimization rule and, when a report is requested, add to the report the number of
+// changes made by the rule and the time spent in it.
+template<typename Rule>
+int ApplyRule(OptimizationReport * report, const char * name, Rule && rule)
+{
+    if (!report)
+    {
+        return rule();
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    const int count = rule();
+    const std::chrono::duration<double, std::milli> elapsed
+        = std::chrono::steady_clock::now() - start;
+
+    OptimizationReportBuilder::AddRule(*report, name, count, elapsed.count());
+
+    return count;
+}
+
 bool IsPairInverseEnabled(OpData::Type type, OptimizationFlags flags)
 {
     switch (type)
@@ -71,6 +99,190 @@ bool IsCombineEnabled(OpData::Type type, OptimizationFlags flags)
 
 constexpr int MAX_OPTIMIZATION_PASSES = 80;
 
+// Process-wide cache of the optimization results. Many processors share long op sequences (e.g.
+// the same display/view transform from different input color spaces) so the entries are keyed
+// by the op cache IDs (and the optimization flags) rather than by processor. The least recently
+// used entries are discarded when the cache is full. The cache is disabled by the same
+// environment variables as the processor caches.
+class OptimizedOpsCache
+{
+public:
+    static constexpr size_t MAX_ENTRIES = 256;
+
+    OptimizedOpsCache()
+        :   m_enabled(!Platform::isEnvPresent(OCIO_DISABLE_ALL_CACHES)
+                      && !Platform::isEnvPresent(OCIO_DISABLE_PROCESSOR_CACHES))
+    {
+    }
+
+    OptimizedOpsCache(const OptimizedOpsCache &) = delete;
+    OptimizedOpsCache & operator=(const OptimizedOpsCache &) = delete;
+
+    bool isEnabled() const noexcept { return m_enabled; }
+
+    bool get(const std::string & key, OpRcPtrVec & ops)
+    {
+        AutoMutex lock(m_mutex);
+
+        auto it = m_entries.find(key);
+        if (it == m_entries.end())
+        {
+            return false;
+        }
+
+        m_lru.splice(m_lru.begin(), m_lru, it->second.m_lruPos);
+        ops = it->second.m_ops;
+        return true;
+    }
+
+    void add(const std::string & key, const OpRcPtrVec & ops)
+    {
+        AutoMutex lock(m_mutex);
+
+        // Another thread could have computed the same result.
+        if (m_entries.find(key) != m_entries.end())
+        {
+            return;
+        }
+
+        auto it = m_entries.emplace(key, Entry()).first;
+        it->second.m_ops = ops;
+        m_lru.push_front(&it->first);
+        it->second.m_lruPos = m_lru.begin();
+
+        if (m_entries.size() > MAX_ENTRIES)
+        {
+            m_entries.erase(*m_lru.back());
+            m_lru.pop_back();
+        }
+    }
+
+    void clear() noexcept
+    {
+        AutoMutex lock(m_mutex);
+        m_entries.clear();
+        m_lru.clear();
+    }
+
+    size_t size() noexcept
+    {
+        AutoMutex lock(m_mutex);
+        return m_entries.size();
+    }
+
+    size_t getMemoryUsage() noexcept
+    {
+        AutoMutex lock(m_mutex);
+
+        size_t memoryUsage = 0;
+        for (const auto & entry : m_entries)
+        {
+            for (const auto & op : entry.second.m_ops)
+            {
+                memoryUsage += GetMemoryUsage(op);
+            }
+        }
+        return memoryUsage;
+    }
+
+private:
+    // The keys, from the most to the least recently used one.
+    using Keys = std::list<const std::string *>;
+
+    struct Entry
+    {
+        OpRcPtrVec m_ops;
+        Keys::iterator m_lruPos;
+    };
+
+    const bool m_enabled;
+    Mutex m_mutex;
+    std::unordered_map<std::string, Entry> m_entries;
+    Keys m_lru;
+};
+
+OptimizedOpsCache & GetOptimizedOpsCache()
+{
+    static OptimizedOpsCache cache;
+    return cache;
+}
+
+// Write the metadata (e.g. the name and the descriptions read from a file) into the key. The
+// strings are prefixed by their length so that any content is unambiguous.
+void WriteMetadataKey(std::ostream & os, const FormatMetadataImpl & metadata)
+{
+    const std::string name  = metadata.getElementName();
+    const std::string value = metadata.getElementValue();
+    os << name.size() << ":" << name << value.size() << ":" << value;
+
+    const FormatMetadataImpl::Attributes & attributes = metadata.getAttributes();
+    os << "a" << attributes.size();
+    for (const auto & attribute : attributes)
+    {
+        os << attribute.first.size() << ":" << attribute.first
+           << attribute.second.size() << ":" << attribute.second;
+    }
+
+    const FormatMetadataImpl::Elements & elements = metadata.getChildrenElements();
+    os << "e" << elements.size();
+    for (const auto & element : elements)
+    {
+        WriteMetadataKey(os, element);
+    }
+}
+
+// Get the key of an op sequence for a given optimization step. The key is empty if the sequence
+// cannot be cached i.e. an op has dynamic properties (a processor must own them) or the cache
+// is disabled.
+std::string GetOptimizedOpsKey(const char * step,
+                               OpRcPtrVec::const_iterator first,
+                               OpRcPtrVec::const_iterator last,
+                               OptimizationFlags oFlags)
+{
+    if (!GetOptimizedOpsCache().isEnabled())
+    {
+        return "";
+    }
+
+    std::ostringstream oss;
+    oss << step << " " << oFlags;
+
+    for (auto it = first; it != last; ++it)
+    {
+        ConstOpRcPtr op = *it;
+        if (op->isDynamic())
+        {
+            return "";
+        }
+
+        const std::string id = op->getCacheID();
+        if (id.empty())
+        {
+            return "";
+        }
+        oss << " " << id;
+
+        // The cache ID does not include the metadata but the cached ops are returned with their
+        // metadata, which is written out when a processor is exported (e.g. to a CLF file).
+        const FormatMetadataImpl & metadata = op->data()->getFormatMetadata();
+        if (metadata.getNumAttributes() > 0 || metadata.getNumChildrenElements() > 0
+            || *metadata.getElementValue())
+        {
+            std::ostringstream metadataKey;
+            WriteMetadataKey(metadataKey, metadata);
+            const std::string str = metadataKey.str();
+            oss << " " << CacheIDHash(str.c_str(), str.size());
+        }
+    }
+
+    return oss.str();
+}
+
+bool IsLutType(OpData::Type type)
+{
+    return type == OpData::Lut1DType || type == OpData::Lut3DType;
+}
+
 int RemoveNoOpTypes(OpRcPtrVec & opVec)
 {
     int count = 0;
@@ -314,9 +526,26 @@ int CombineOps(OpRcPtrVec & opVec, OptimizationFlags oFlags)
 
         if (IsCombineEnabled(type1, oFlags) && op1->canCombineWith(op2))
         {
+            // Composing LUTs means resampling them so the result is memoized.
+            const std::string key
+                = IsLutType(type1) || IsLutType(op2->data()->getType())
+                    ? GetOptimizedOpsKey("combine",
+                                         opVec.begin() + firstindex,
+                                         opVec.begin() + firstindex + 2,
+                                         OPTIMIZATION_NONE)
+                    : std::string();
+
             tmpops.clear();
-            op1->combineWith(tmpops, op2);
-            FinalizeOps(tmpops);
+            if (key.empty() || !GetOptimizedOpsCache().get(key, tmpops))
+            {
+                op1->combineWith(tmpops, op2);
+                FinalizeOps(tmpops);
+
+                if (!key.empty())
+                {
+                    GetOptimizedOpsCache().add(key, tmpops);
+                }
+            }
 
             // The tmpops may have any number of ops in it: (0, 1, 2, ...).
             // (Size 0 would occur only if the combination results in a no-op,
@@ -376,17 +605,27 @@ int ReplaceInverseLuts(OpRcPtrVec & opVec)
         ConstOpRcPtr op = opVec[i];
         auto opData = op->data();
         const auto type = opData->getType();
+
+        OpRcPtrVec tmpops;
         if (type == OpData::Lut1DType)
         {
             auto lutData = OCIO_DYNAMIC_POINTER_CAST<const Lut1DOpData>(opData);
             if (lutData->getDirection() == TRANSFORM_DIR_INVERSE)
             {
-                auto invLutData = MakeFastLut1DFromInverse(lutData);
-                OpRcPtrVec tmpops;
-                CreateLut1DOp(tmpops, invLutData, TRANSFORM_DIR_FORWARD);
-                FinalizeOps(tmpops);
-                opVec[i] = tmpops[0];
-                ++count;
+                const std::string key
+                    = GetOptimizedOpsKey("invert", opVec.begin() + i, opVec.begin() + i + 1,
+                                         OPTIMIZATION_LUT_INV_FAST);
+                if (key.empty() || !GetOptimizedOpsCache().get(key, tmpops))
+                {
+                    auto invLutData = MakeFastLut1DFromInverse(lutData);
+                    CreateLut1DOp(tmpops, invLutData, TRANSFORM_DIR_FORWARD);
+                    FinalizeOps(tmpops);
+
+                    if (!key.empty())
+                    {
+                        GetOptimizedOpsCache().add(key, tmpops);
+                    }
+                }
             }
         }
         else if (type == OpData::Lut3DType)
@@ -394,14 +633,28 @@ int ReplaceInverseLuts(OpRcPtrVec & opVec)
             auto lutData = OCIO_DYNAMIC_POINTER_CAST<const Lut3DOpData>(opData);
             if (lutData->getDirection() == TRANSFORM_DIR_INVERSE)
             {
-                auto invLutData = MakeFastLut3DFromInverse(lutData);
-                OpRcPtrVec tmpops;
-                CreateLut3DOp(tmpops, invLutData, TRANSFORM_DIR_FORWARD);
-                FinalizeOps(tmpops);
-                opVec[i] = tmpops[0];
-                ++count;
+                const std::string key
+                    = GetOptimizedOpsKey("invert", opVec.begin() + i, opVec.begin() + i + 1,
+                                         OPTIMIZATION_LUT_INV_FAST);
+                if (key.empty() || !GetOptimizedOpsCache().get(key, tmpops))
+                {
+                    auto invLutData = MakeFastLut3DFromInverse(lutData);
+                    CreateLut3DOp(tmpops, invLutData, TRANSFORM_DIR_FORWARD);
+                    FinalizeOps(tmpops);
+
+                    if (!key.empty())
+                    {
+                        GetOptimizedOpsCache().add(key, tmpops);
+                    }
+                }
             }
         }
+
+        if (!tmpops.empty())
+        {
+            opVec[i] = tmpops[0];
+            ++count;
+        }
     }
     return count;
 
@@ -550,24 +803,25 @@ unsigned FindSeparablePrefix(const OpRcPtrVec & ops)
 
 // Use functional composition to replace a string of separable ops at the head of
 // the op list with a single 1D LUT that is built to do a look-up for the input bit-depth.
-void OptimizeSeparablePrefix(OpRcPtrVec & ops, BitDepth in)
+// Return the number of replaced ops.
+int OptimizeSeparablePrefix(OpRcPtrVec & ops, BitDepth in)
 {
     if (ops.empty())
     {
-        return;
+        return 0;
     }
 
     // TODO: Investigate whether even the F32 case could be sped up via interpolating 
     //       in a half-domain Lut1D (e.g. replacing a string of exponent, log, etc.).
     if (in == BIT_DEPTH_F32 || in == BIT_DEPTH_UINT32)
     {
-        return;
+        return 0;
     }
 
     const unsigned prefixLen = FindSeparablePrefix(ops);
     if (prefixLen == 0)
     {
-        return; // Nothing to do.
+        return 0; // Nothing to do.
     }
 
     OpRcPtrVec prefixOps;
@@ -592,9 +846,21 @@ void OptimizeSeparablePrefix(OpRcPtrVec & ops, BitDepth in)
     FinalizeOps(lutOps);
 
     ops.insert(ops.begin(), lutOps.begin(), lutOps.end());
+
+    return static_cast<int>(prefixLen);
 }
 } // namespace
 
+void ClearOptimizedOpsCache()
+{
+    GetOptimizedOpsCache().clear();
+}
+
+size_t GetOptimizedOpsCacheMemoryUsage()
+{
+    return GetOptimizedOpsCache().getMemoryUsage();
+}
+
 void OpRcPtrVec::finalize()
 {
     if (m_ops.empty())
@@ -608,13 +874,18 @@ void OpRcPtrVec::finalize()
     FinalizeOps(*this);
 }
 
-void OpRcPtrVec::optimize(OptimizationFlags oFlags)
+void OpRcPtrVec::optimize(OptimizationFlags oFlags, OptimizationReport * report)
 {
     if (m_ops.empty())
     {
         return;
     }
 
+    OCIO_TRACE_SCOPE("optimizer", "OpRcPtrVec::optimize");
+
+    // The report flag does not change the optimization (nor the cached results).
+    oFlags = OptimizationFlags(oFlags & ~OPTIMIZATION_REPORT);
+
     if (IsDebugLoggingEnabled())
     {
         std::ostringstream oss;
@@ -629,7 +900,8 @@ void OpRcPtrVec::optimize(OptimizationFlags oFlags)
     const auto originalSize = size();
 
     // NoOpType can be removed (facilitates conversion to a CPU/GPUProcessor).
-    const int total_nooptype = RemoveNoOpTypes(*this);
+    const int total_nooptype
+        = ApplyRule(report, "RemoveNoOpTypes", [this]() { return RemoveNoOpTypes(*this); });
 
     if (oFlags == OPTIMIZATION_NONE)
     {
@@ -657,6 +929,34 @@ void OpRcPtrVec::optimize(OptimizationFlags oFlags)
         RemoveDynamicProperties(*this);
     }
 
+    // Reuse the result of an identical op list optimized by another processor.
+    const std::string cacheKey = GetOptimizedOpsKey("optimize", begin(), end(), oFlags);
+    if (!cacheKey.empty())
+    {
+        OpRcPtrVec optimizedOps;
+        if (GetOptimizedOpsCache().get(cacheKey, optimizedOps))
+        {
+            m_ops.assign(optimizedOps.begin(), optimizedOps.end());
+
+            if (report)
+            {
+                OptimizationReportBuilder::SetFromCache(*report, true);
+            }
+
+            if (IsDebugLoggingEnabled())
+            {
+                std::ostringstream os;
+                os << "**" << std::endl;
+                os << "Optimized ";
+                os << originalSize << "->" << size() << ", found in the cache\n";
+                os << SerializeOpVec(*this, 4);
+                LogDebug(os.str());
+            }
+
+            return;
+        }
+    }
+
     // As the input and output bit-depths represent the color processing
     // request and they may be altered by the following optimizations,
     // preserve their values.
@@ -677,21 +977,28 @@ void OpRcPtrVec::optimize(OptimizationFlags oFlags)
     while (passes <= MAX_OPTIMIZATION_PASSES)
     {
         // Remove all ops for which isNoOp is true, including identity matrices.
-        int noops = optimizeIdentity ? RemoveNoOps(*this) : 0;
+        int noops = optimizeIdentity
+            ? ApplyRule(report, "RemoveNoOps", [this]() { return RemoveNoOps(*this); })
+            : 0;
 
         // Replace all complex ops with simpler ops (e.g., a CDL which only scales with a matrix).
         // Note this might increase the number of ops.
-        int replacedOps = replaceOps ? ReplaceOps(*this) : 0;
+        int replacedOps = replaceOps
+            ? ApplyRule(report, "ReplaceOps", [this]() { return ReplaceOps(*this); })
+            : 0;
 
         // Replace all complex identities with simpler ops (e.g., an identity Lut1D with a range).
-        int identityops = ReplaceIdentityOps(*this, oFlags);
+        int identityops = ApplyRule(report, "ReplaceIdentityOps",
+                                    [this, oFlags]() { return ReplaceIdentityOps(*this, oFlags); });
 
         // Remove all adjacent pairs of ops that are inverses of each other.
-        int inverseops  = RemoveInverseOps(*this, oFlags);
+        int inverseops  = ApplyRule(report, "RemoveInverseOps",
+                                    [this, oFlags]() { return RemoveInverseOps(*this, oFlags); });
 
         // Combine a pair of ops, for example multiply two adjacent Matrix ops.
         // (Combines at most one pair on each iteration.)
-        int combines    = CombineOps(*this, oFlags);
+        int combines    = ApplyRule(report, "CombineOps",
+                                    [this, oFlags]() { return CombineOps(*this, oFlags); });
 
         if (noops + identityops + inverseops + combines == 0)
         {
@@ -700,7 +1007,8 @@ void OpRcPtrVec::optimize(OptimizationFlags oFlags)
             // optimization is possible.
             if (fastLut)
             {
-                const int inverses = ReplaceInverseLuts(*this);
+                const int inverses = ApplyRule(report, "ReplaceInverseLuts",
+                                               [this]() { return ReplaceInverseLuts(*this); });
                 if (inverses == 0)
                 {
                     break;
@@ -723,6 +1031,11 @@ void OpRcPtrVec::optimize(OptimizationFlags oFlags)
         ++passes;
     }
 
+    if (report)
+    {
+        OptimizationReportBuilder::SetNumPasses(*report, passes);
+    }
+
     if (passes == MAX_OPTIMIZATION_PASSES)
     {
         std::ostringstream os;
@@ -753,25 +1066,34 @@ void OpRcPtrVec::optimize(OptimizationFlags oFlags)
         os << SerializeOpVec(*this, 4);
         LogDebug(os.str());
     }
+
+    if (!cacheKey.empty())
+    {
+        GetOptimizedOpsCache().add(cacheKey, *this);
+    }
 }
 
 void OpRcPtrVec::optimizeForBitdepth(const BitDepth & inBitDepth,
                                      const BitDepth & outBitDepth,
-                                     OptimizationFlags oFlags)
+                                     OptimizationFlags oFlags,
+                                     OptimizationReport * report)
 {
     if (!empty())
     {
         if (!IsFloatBitDepth(inBitDepth))
         {
-            RemoveLeadingClampIdentity(*this);
+            ApplyRule(report, "RemoveLeadingClampIdentity",
+                      [this]() { return RemoveLeadingClampIdentity(*this); });
         }
         if (!IsFloatBitDepth(outBitDepth))
         {
-            RemoveTrailingClampIdentity(*this);
+            ApplyRule(report, "RemoveTrailingClampIdentity",
+                      [this]() { return RemoveTrailingClampIdentity(*this); });
         }
         if (HasFlag(oFlags, OPTIMIZATION_COMP_SEPARABLE_PREFIX))
         {
-            OptimizeSeparablePrefix(*this, inBitDepth);
+            ApplyRule(report, "OptimizeSeparablePrefix",
+                      [this, inBitDepth]() { return OptimizeSeparablePrefix(*this, inBitDepth); });
         }
     }
 }
@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_PARALLELUTILS_H
+#define INCLUDED_OCIO_PARALLELUTILS_H
+
+#include <algorithm>
+#include <cstdlib>
+#include <exception>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "Platform.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+// Maximum number of threads used by ParallelFor i.e. the value of the OCIO_NUM_THREADS_ENVVAR
+// env. variable when it's a positive number, otherwise the number of hardware threads. The
+// variable is read once.
+inline unsigned GetMaxNumThreads()
+{
+    static const unsigned maxThreads = []()
+    {
+        std::string value;
+        if (Platform::Getenv(OCIO_NUM_THREADS_ENVVAR, value) && !value.empty())
+        {
+            const long numThreads = std::strtol(value.c_str(), nullptr, 10);
+            if (numThreads > 0)
+            {
+                return (unsigned)numThreads;
+            }
+        }
+        return std::max(1u, std::thread::hardware_concurrency());
+    }();
+
+    return maxThreads;
+}
+
+// Number of worker threads to use for a job of numItems items where each thread should process
+// at least minItemsPerThread items (i.e. the minimum work size, which depends on the cost of an
+// item).  Returns 1 when the job is too small to be worth splitting.
+inline unsigned GetNumThreads(long numItems, long minItemsPerThread)
+{
+    const long maxThreads = numItems / std::max(1L, minItemsPerThread);
+    return (unsigned)std::max(1L, std::min((long)GetMaxNumThreads(), maxThreads));
+}
+
+// Split [0, numItems) into contiguous chunks and call func(begin, end) for each chunk, using
+// several threads when the job is large enough (see GetNumThreads).  The calling thread
+// processes the first chunk.
+// This is intended for the one-time, compute heavy work done while building ops or renderers
+// (not for the per-pixel processing which is left to the client application).
+//
+// Note: func must only write to the memory corresponding to its own chunk.  If any call throws,
+// the first exception is rethrown once all the threads are finished.
+template<typename Func>
+void ParallelFor(long numItems, long minItemsPerThread, Func && func)
+{
+    if (numItems <= 0)
+    {
+        return;
+    }
+
+    const unsigned numThreads = GetNumThreads(numItems, minItemsPerThread);
+    if (numThreads == 1)
+    {
+        func(0L, numItems);
+        return;
+    }
+
+    const long chunkSize = (numItems + numThreads - 1) / numThreads;
+
+    std::vector<std::exception_ptr> errors(numThreads);
+    std::vector<std::thread> workers;
+    workers.reserve(numThreads - 1);
+
+    for (unsigned t = 1; t < numThreads; ++t)
+    {
+        const long begin = std::min(numItems, t * chunkSize);
+        const long end   = std::min(numItems, begin + chunkSize);
+
+        workers.emplace_back([&func, &errors, t, begin, end]()
+        {
+            try
+            {
+                func(begin, end);
+            }
+            catch (...)
+            {
+                errors[t] = std::current_exception();
+            }
+        });
+    }
+
+    try
+    {
+        func(0L, std::min(numItems, chunkSize));
+    }
+    catch (...)
+    {
+        errors[0] = std::current_exception();
+    }
+
+    for (auto & worker : workers)
+    {
+        worker.join();
+    }
+
+    for (const auto & error : errors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif
@@ -2,8 +2,12 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 
+#include <algorithm>
+#include <chrono>
 #include <iostream>
 #include <map>
+#include <unordered_map>
+#include <unordered_set>
 
 #include <pystring.h>
 
@@ -31,6 +35,7 @@ namespace
 // The global variable holds the hash function to use.
 // It could be changed using SetComputeHashFunction() to customize the implementation.
 ComputeHashFunction g_hashFunction = Platform::CreateFileContentHash;
+bool g_customHashFunction = false;
 
 // We mutex both the main map and each item individually, so that
 // the potentially slow stat calls dont block other lookups to already
@@ -49,16 +54,69 @@ typedef std::map<std::string, FileHashResultPtr> FileCacheMap;
 
 FileCacheMap g_fastFileHashCache;
 Mutex g_fastFileHashCache_mutex;
+
+// The directory index holds the listing of the directories used to resolve the relative file
+// references. As for the file hash cache, the map and each item have their own mutex.
+
+struct DirectoryListing
+{
+    Mutex mutex;
+    std::unordered_set<std::string> names;
+    // False if the directory could not be listed i.e. the files must be checked.
+    bool valid { false };
+    bool ready { false };
+    std::chrono::steady_clock::time_point time;
+};
+
+typedef OCIO_SHARED_PTR<DirectoryListing> DirectoryListingPtr;
+typedef std::unordered_map<std::string, DirectoryListingPtr> DirectoryIndexMap;
+
+DirectoryIndexMap g_directoryIndex;
+Mutex g_directoryIndex_mutex;
+
+#if defined(_WIN32) || defined(__APPLE__)
+// The default file systems are case insensitive.
+inline std::string IndexName(const std::string & name) { return StringUtils::Lower(name); }
+#else
+inline const std::string & IndexName(const std::string & name) { return name; }
+#endif
+
+// Return true if the directory index is enabled, and its time to live in seconds (where 0 means
+// no expiration).
+bool GetDirectoryIndexTTL(double & ttl)
+{
+    std::string value;
+    if (!Platform::Getenv(OCIO_SEARCH_PATH_INDEX_ENVVAR, value))
+    {
+        return false;
+    }
+
+    ttl = 0.;
+    if (!value.empty())
+    {
+        try
+        {
+            ttl = std::max(std::stod(value), 0.);
+        }
+        catch (const std::exception &)
+        {
+            // Invalid values do not expire.
+        }
+    }
+    return true;
+}
 }
 
 void SetComputeHashFunction(ComputeHashFunction hashFunction)
 {
     g_hashFunction = hashFunction;
+    g_customHashFunction = true;
 }
 
 void ResetComputeHashFunction()
 {
     g_hashFunction = Platform::CreateFileContentHash;
+    g_customHashFunction = false;
 }
 
 std::string GetFastFileHash(const std::string & filename, const Context & context)
@@ -120,10 +178,94 @@ bool FileExists(const std::string & filename, const Context & context)
     return (!hash.empty());
 }
 
+bool IsFileListed(const std::string & filename, const Context & context)
+{
+    double ttl = 0.;
+    if (!GetDirectoryIndexTTL(ttl))
+    {
+        return true;
+    }
+
+    // The index only knows about the file system.
+    if (context.getConfigIOProxy() || g_customHashFunction)
+    {
+        return true;
+    }
+
+#ifdef __APPLE__
+    // The file system could use a different unicode normalization for the names.
+    for (const char c : filename)
+    {
+        if (static_cast<unsigned char>(c) > 0x7F) return true;
+    }
+#endif
+
+    const std::string fullpath = pystring::os::path::normpath(filename);
+
+    std::string dirname, basename;
+    pystring::os::path::split(dirname, basename, fullpath);
+    if (dirname.empty() || basename.empty())
+    {
+        return true;
+    }
+
+    DirectoryListingPtr listing;
+    {
+        AutoMutex lock(g_directoryIndex_mutex);
+        DirectoryListingPtr & entry = g_directoryIndex[dirname];
+        if (!entry)
+        {
+            entry = std::make_shared<DirectoryListing>();
+        }
+        listing = entry;
+    }
+
+    AutoMutex lock(listing->mutex);
+
+    const auto now = std::chrono::steady_clock::now();
+    if (listing->ready && ttl > 0.
+        && std::chrono::duration<double>(now - listing->time).count() > ttl)
+    {
+        listing->ready = false;
+    }
+
+    if (!listing->ready)
+    {
+        listing->ready = true;
+        listing->time  = now;
+        listing->names.clear();
+
+        std::vector<std::string> names;
+        if (Platform::ListDirectory(dirname, names))
+        {
+            listing->valid = true;
+            for (const auto & name : names)
+            {
+                listing->names.insert(IndexName(name));
+            }
+        }
+        else
+        {
+            // A missing directory has no files, otherwise (e.g. no read permission) the files
+            // must be individually checked.
+            listing->valid = Platform::CreateFileContentHash(dirname).empty();
+        }
+    }
+
+    return !listing->valid || listing->names.count(IndexName(basename)) != 0;
+}
+
 void ClearPathCaches()
 {
-    AutoMutex lock(g_fastFileHashCache_mutex);
-    g_fastFileHashCache.clear();
+    {
+        AutoMutex lock(g_fastFileHashCache_mutex);
+        g_fastFileHashCache.clear();
+    }
+
+    {
+        AutoMutex lock(g_directoryIndex_mutex);
+        g_directoryIndex.clear();
+    }
 }
 
 namespace
@@ -24,6 +24,12 @@ bool FileExists(const std::string & filename, const Context & context);
 // Currently, this checks the mtime and the inode number.
 std::string GetFastFileHash(const std::string & filename, const Context & context);
 
+// Return false if the file is known to be missing i.e. its directory listing does not contain
+// it. That's only possible when the directory index is enabled (see
+// OCIO_SEARCH_PATH_INDEX_ENVVAR), otherwise (or when the directory could not be listed) it
+// returns true and the caller must still check the file with FileExists().
+bool IsFileListed(const std::string & filename, const Context & context);
+
 void ClearPathCaches();
 
 // Works on active and inactive color spaces name and aliases.
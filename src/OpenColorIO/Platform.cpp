@@ -13,7 +13,11 @@
 #include "Platform.h"
 
 #ifndef _WIN32
+#include <dirent.h>
+#include <fcntl.h>
 #include <strings.h>
+#include <sys/mman.h>
+#include <unistd.h>
 #endif
 
 
@@ -356,6 +360,153 @@ std::string CreateFileContentHash(const std::string &filename)
     return "";
 }
 
+bool ListDirectory(const std::string & dirname, std::vector<std::string> & names)
+{
+    names.clear();
+
+#ifdef _WIN32
+
+    const std::string pattern = dirname + "\\*";
+
+#ifdef UNICODE
+    WIN32_FIND_DATAW data;
+    HANDLE handle = FindFirstFileW(Utf8ToUtf16(pattern).c_str(), &data);
+#else
+    WIN32_FIND_DATAA data;
+    HANDLE handle = FindFirstFileA(pattern.c_str(), &data);
+#endif
+    if (handle == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    do
+    {
+#ifdef UNICODE
+        names.push_back(Utf16ToUtf8(data.cFileName));
+#else
+        names.push_back(data.cFileName);
+#endif
+    }
+#ifdef UNICODE
+    while (FindNextFileW(handle, &data));
+#else
+    while (FindNextFileA(handle, &data));
+#endif
+
+    FindClose(handle);
+
+#else
+
+    DIR * dir = ::opendir(dirname.c_str());
+    if (!dir)
+    {
+        return false;
+    }
+
+    while (const struct dirent * entry = ::readdir(dir))
+    {
+        names.push_back(entry->d_name);
+    }
+
+    ::closedir(dir);
+
+#endif
+
+    return true;
+}
+
+MappedFile::MappedFile(const std::string & filename)
+{
+    std::ostringstream error;
+    error << "Could not map the file '" << filename << "' in memory";
+
+#ifdef _WIN32
+
+#ifdef UNICODE
+    HANDLE file = CreateFileW(Utf8ToUtf16(filename).c_str(), GENERIC_READ, FILE_SHARE_READ,
+                              nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+#else
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                              nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+#endif
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        error << ": the file could not be opened.";
+        throw Exception(error.str().c_str());
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize))
+    {
+        CloseHandle(file);
+        error << ": the file size is unknown.";
+        throw Exception(error.str().c_str());
+    }
+    m_size = (size_t)fileSize.QuadPart;
+
+    if (m_size > 0)
+    {
+        HANDLE mapping = CreateFileMapping(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping)
+        {
+            m_data = static_cast<const uint8_t *>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+            // The view keeps a reference on the mapping object.
+            CloseHandle(mapping);
+        }
+    }
+    CloseHandle(file);
+
+#else
+
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        error << ": the file could not be opened.";
+        throw Exception(error.str().c_str());
+    }
+
+    struct stat fileInfo;
+    if (::fstat(fd, &fileInfo) != 0)
+    {
+        ::close(fd);
+        error << ": the file size is unknown.";
+        throw Exception(error.str().c_str());
+    }
+    m_size = (size_t)fileInfo.st_size;
+
+    if (m_size > 0)
+    {
+        void * data = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        m_data = (data == MAP_FAILED) ? nullptr : static_cast<const uint8_t *>(data);
+    }
+    // The mapping stays valid once the file descriptor is closed.
+    ::close(fd);
+
+#endif
+
+    if (m_size > 0 && !m_data)
+    {
+        m_size = 0;
+        error << ".";
+        throw Exception(error.str().c_str());
+    }
+}
+
+MappedFile::~MappedFile()
+{
+    if (m_data)
+    {
+#ifdef _WIN32
+        UnmapViewOfFile(m_data);
+#else
+        ::munmap(const_cast<uint8_t *>(m_data), m_size);
+#endif
+        m_data = nullptr;
+        m_size = 0;
+    }
+}
+
 } // Platform
 
 } // namespace OCIO_NAMESPACE
@@ -20,8 +20,10 @@
 #endif // _WIN32
 
 
+#include <cstdint>
 #include <fstream>
 #include <string>
+#include <vector>
 
 
 // Missing functions on Windows.
@@ -106,12 +108,36 @@ void OpenInputFileStream(std::ifstream & stream, const char * filename, std::ios
 // Create a unique hash of a file provided as a UTF-8 filename on any platform.
 std::string CreateFileContentHash(const std::string &filename);
 
+// List the entry names (i.e. files, directories, links...) of a directory provided as a UTF-8
+// name on any platform. Return false if the directory could not be read.
+bool ListDirectory(const std::string & dirname, std::vector<std::string> & names);
+
 // Convert UTF-8 string to UTF-16LE.
 std::wstring Utf8ToUtf16(const std::string & str);
 
 // Convert UTF-16LE string to UTF-8.
 std::string Utf16ToUtf8(const std::wstring & str);
 
+// Read-only memory mapping of a complete file using a UTF-8 filename on any platform. The
+// file content is paged in on demand by the OS and could be shared between threads.
+class MappedFile
+{
+public:
+    explicit MappedFile(const std::string & filename);
+    ~MappedFile();
+
+    MappedFile() = delete;
+    MappedFile(const MappedFile &) = delete;
+    MappedFile & operator=(const MappedFile &) = delete;
+
+    const uint8_t * data() const noexcept { return m_data; }
+    size_t size() const noexcept { return m_size; }
+
+private:
+    const uint8_t * m_data = nullptr;
+    size_t m_size = 0;
+};
+
 }
 
 } // namespace OCIO_NAMESPACE
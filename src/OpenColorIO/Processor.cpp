@@ -2,12 +2,17 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 #include <algorithm>
+#include <chrono>
 #include <cstring>
+#include <iomanip>
 #include <iterator>
+#include <limits>
 #include <sstream>
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "BakingUtils.h"
+#include "BitDepthUtils.h"
 #include "CPUProcessor.h"
 #include "GPUProcessor.h"
 #include "HashUtils.h"
@@ -15,6 +20,7 @@
 #include "OpBuilders.h"
 #include "ops/noop/NoOps.h"
 #include "Processor.h"
+#include "ProcessorSerialization.h"
 #include "TransformBuilder.h"
 #include "utils/StringUtils.h"
 
@@ -98,6 +104,368 @@ void ProcessorMetadata::addLook(const char * look)
 
 //////////////////////////////////////////////////////////////////////////
 
+class OptimizationReport::Impl
+{
+public:
+    struct Rule
+    {
+        std::string name;
+        int count = 0;
+        double time = 0.;
+    };
+
+    struct Renderer
+    {
+        std::string name;
+        double time = 0.;
+    };
+
+    int passes = 0;
+    bool fromCache = false;
+    double optimizationTime = 0.;
+
+    std::vector<Rule> rules;
+    StringUtils::StringVec opsBefore;
+    StringUtils::StringVec opsAfter;
+    std::vector<Renderer> renderers;
+
+    Impl()  = default;
+    ~Impl() = default;
+};
+
+OptimizationReportRcPtr OptimizationReport::Create()
+{
+    return OptimizationReportRcPtr(new OptimizationReport(), &deleter);
+}
+
+OptimizationReport::OptimizationReport()
+    : m_impl(new OptimizationReport::Impl)
+{ }
+
+OptimizationReport::~OptimizationReport()
+{
+    delete m_impl;
+    m_impl = nullptr;
+}
+
+void OptimizationReport::deleter(OptimizationReport* c)
+{
+    delete c;
+}
+
+int OptimizationReport::getNumPasses() const
+{
+    return getImpl()->passes;
+}
+
+bool OptimizationReport::isFromCache() const
+{
+    return getImpl()->fromCache;
+}
+
+double OptimizationReport::getOptimizationTime() const
+{
+    return getImpl()->optimizationTime;
+}
+
+int OptimizationReport::getNumRules() const
+{
+    return static_cast<int>(getImpl()->rules.size());
+}
+
+const char * OptimizationReport::getRuleName(int index) const
+{
+    if (index < 0 || index >= getNumRules())
+    {
+        return "";
+    }
+
+    return getImpl()->rules[index].name.c_str();
+}
+
+int OptimizationReport::getRuleCount(int index) const
+{
+    if (index < 0 || index >= getNumRules())
+    {
+        return 0;
+    }
+
+    return getImpl()->rules[index].count;
+}
+
+double OptimizationReport::getRuleTime(int index) const
+{
+    if (index < 0 || index >= getNumRules())
+    {
+        return 0.;
+    }
+
+    return getImpl()->rules[index].time;
+}
+
+int OptimizationReport::getNumOpsBefore() const
+{
+    return static_cast<int>(getImpl()->opsBefore.size());
+}
+
+const char * OptimizationReport::getOpBefore(int index) const
+{
+    if (index < 0 || index >= getNumOpsBefore())
+    {
+        return "";
+    }
+
+    return getImpl()->opsBefore[index].c_str();
+}
+
+int OptimizationReport::getNumOpsAfter() const
+{
+    return static_cast<int>(getImpl()->opsAfter.size());
+}
+
+const char * OptimizationReport::getOpAfter(int index) const
+{
+    if (index < 0 || index >= getNumOpsAfter())
+    {
+        return "";
+    }
+
+    return getImpl()->opsAfter[index].c_str();
+}
+
+int OptimizationReport::getNumRenderers() const
+{
+    return static_cast<int>(getImpl()->renderers.size());
+}
+
+const char * OptimizationReport::getRendererName(int index) const
+{
+    if (index < 0 || index >= getNumRenderers())
+    {
+        return "";
+    }
+
+    return getImpl()->renderers[index].name.c_str();
+}
+
+double OptimizationReport::getRendererTime(int index) const
+{
+    if (index < 0 || index >= getNumRenderers())
+    {
+        return 0.;
+    }
+
+    return getImpl()->renderers[index].time;
+}
+
+OptimizationReportRcPtr OptimizationReportBuilder::Create()
+{
+    return OptimizationReport::Create();
+}
+
+ConstOptimizationReportRcPtr OptimizationReportBuilder::GetEmpty()
+{
+    static const ConstOptimizationReportRcPtr empty = OptimizationReport::Create();
+    return empty;
+}
+
+void OptimizationReportBuilder::SetNumPasses(OptimizationReport & report, int numPasses)
+{
+    report.getImpl()->passes = numPasses;
+}
+
+void OptimizationReportBuilder::SetFromCache(OptimizationReport & report, bool fromCache)
+{
+    report.getImpl()->fromCache = fromCache;
+}
+
+void OptimizationReportBuilder::SetOptimizationTime(OptimizationReport & report, double time)
+{
+    report.getImpl()->optimizationTime = time;
+}
+
+void OptimizationReportBuilder::AddRule(OptimizationReport & report,
+                                        const char * name,
+                                        int count,
+                                        double time)
+{
+    auto & rules = report.getImpl()->rules;
+
+    auto it = std::find_if(rules.begin(), rules.end(),
+                           [name](const OptimizationReport::Impl::Rule & rule)
+                           {
+                               return rule.name == name;
+                           });
+    if (it == rules.end())
+    {
+        OptimizationReport::Impl::Rule rule;
+        rule.name = name;
+        it = rules.insert(rules.end(), rule);
+    }
+
+    it->count += count;
+    it->time  += time;
+}
+
+void OptimizationReportBuilder::AddOpBefore(OptimizationReport & report, const char * opType)
+{
+    report.getImpl()->opsBefore.push_back(opType);
+}
+
+void OptimizationReportBuilder::AddOpAfter(OptimizationReport & report, const char * opType)
+{
+    report.getImpl()->opsAfter.push_back(opType);
+}
+
+void OptimizationReportBuilder::AddRenderer(OptimizationReport & report,
+                                            const char * name,
+                                            double time)
+{
+    OptimizationReport::Impl::Renderer renderer;
+    renderer.name = name;
+    renderer.time = time;
+    report.getImpl()->renderers.push_back(renderer);
+}
+
+std::ostream & operator<< (std::ostream & os, const OptimizationReport & report)
+{
+    os << "Optimization: " << report.getOptimizationTime() << " ms, "
+       << report.getNumPasses() << " passes";
+    if (report.isFromCache())
+    {
+        os << ", found in the cache";
+    }
+    os << "\n";
+
+    for (int idx = 0; idx < report.getNumRules(); ++idx)
+    {
+        os << "    " << report.getRuleName(idx) << ": "
+           << report.getRuleCount(idx) << " changes, "
+           << report.getRuleTime(idx) << " ms\n";
+    }
+
+    os << "Ops before (" << report.getNumOpsBefore() << "):";
+    for (int idx = 0; idx < report.getNumOpsBefore(); ++idx)
+    {
+        os << " " << report.getOpBefore(idx);
+    }
+    os << "\n";
+
+    os << "Ops after (" << report.getNumOpsAfter() << "):";
+    for (int idx = 0; idx < report.getNumOpsAfter(); ++idx)
+    {
+        os << " " << report.getOpAfter(idx);
+    }
+    os << "\n";
+
+    if (report.getNumRenderers() > 0)
+    {
+        os << "CPU renderers:\n";
+        for (int idx = 0; idx < report.getNumRenderers(); ++idx)
+        {
+            os << "    " << report.getRendererName(idx) << ": "
+               << report.getRendererTime(idx) << " ms\n";
+        }
+    }
+
+    return os;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+class MemoryUsage::Impl
+{
+public:
+    struct Entry
+    {
+        std::string name;
+        size_t size = 0;
+    };
+
+    std::vector<Entry> entries;
+
+    Impl()  = default;
+    ~Impl() = default;
+};
+
+MemoryUsageRcPtr MemoryUsage::Create()
+{
+    return MemoryUsageRcPtr(new MemoryUsage(), &deleter);
+}
+
+MemoryUsage::MemoryUsage()
+    : m_impl(new MemoryUsage::Impl)
+{
+}
+
+MemoryUsage::~MemoryUsage()
+{
+    delete m_impl;
+    m_impl = nullptr;
+}
+
+void MemoryUsage::deleter(MemoryUsage* c)
+{
+    delete c;
+}
+
+size_t MemoryUsage::getTotalSize() const
+{
+    size_t total = 0;
+    for (const auto & entry : getImpl()->entries)
+    {
+        total += entry.size;
+    }
+    return total;
+}
+
+int MemoryUsage::getNumEntries() const
+{
+    return static_cast<int>(getImpl()->entries.size());
+}
+
+const char * MemoryUsage::getEntryName(int index) const
+{
+    if (index < 0 || index >= getNumEntries())
+    {
+        return "";
+    }
+
+    return getImpl()->entries[index].name.c_str();
+}
+
+size_t MemoryUsage::getEntrySize(int index) const
+{
+    if (index < 0 || index >= getNumEntries())
+    {
+        return 0;
+    }
+
+    return getImpl()->entries[index].size;
+}
+
+void MemoryUsage::addEntry(const char * name, size_t size)
+{
+    Impl::Entry entry;
+    entry.name = name ? name : "";
+    entry.size = size;
+    getImpl()->entries.push_back(entry);
+}
+
+std::ostream & operator<< (std::ostream & os, const MemoryUsage & memoryUsage)
+{
+    os << "Memory usage: " << memoryUsage.getTotalSize() << " bytes\n";
+    for (int idx = 0; idx < memoryUsage.getNumEntries(); ++idx)
+    {
+        os << "    " << memoryUsage.getEntryName(idx) << ": "
+           << memoryUsage.getEntrySize(idx) << " bytes\n";
+    }
+
+    return os;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
 ProcessorRcPtr Processor::Create()
 {
     return ProcessorRcPtr(new Processor(), &deleter);
@@ -134,6 +502,16 @@ ConstProcessorMetadataRcPtr Processor::getProcessorMetadata() const
     return getImpl()->getProcessorMetadata();
 }
 
+ConstOptimizationReportRcPtr Processor::getOptimizationReport() const
+{
+    return getImpl()->getOptimizationReport();
+}
+
+ConstMemoryUsageRcPtr Processor::getMemoryUsage() const
+{
+    return getImpl()->getMemoryUsage();
+}
+
 const FormatMetadata & Processor::getFormatMetadata() const
 {
     return getImpl()->getFormatMetadata();
@@ -154,6 +532,24 @@ GroupTransformRcPtr Processor::createGroupTransform() const
     return getImpl()->createGroupTransform();
 }
 
+void Processor::serialize(std::ostream & os, const char * fingerprint) const
+{
+    getImpl()->serialize(os, fingerprint);
+}
+
+ConstProcessorRcPtr Processor::CreateFromSerializedFile(const char * filePath,
+                                                       const char * fingerprint)
+{
+    if (!filePath || !*filePath)
+    {
+        throw Exception("Processor::CreateFromSerializedFile: the file path is empty.");
+    }
+
+    ProcessorRcPtr processor = Create();
+    processor->getImpl()->deserialize(filePath, fingerprint);
+    return processor;
+}
+
 bool Processor::isDynamic() const noexcept
 {
     return getImpl()->isDynamic();
@@ -218,6 +614,14 @@ ConstCPUProcessorRcPtr Processor::getOptimizedCPUProcessor(BitDepth inBitDepth,
     return getImpl()->getOptimizedCPUProcessor(inBitDepth, outBitDepth, oFlags);
 }
 
+ConstCPUProcessorRcPtr Processor::getOptimizedCPUProcessor(BitDepth inBitDepth,
+                                                            BitDepth outBitDepth,
+                                                            OptimizationFlags oFlags,
+                                                            float bakeTolerance) const
+{
+    return getImpl()->getOptimizedCPUProcessor(inBitDepth, outBitDepth, oFlags, bakeTolerance);
+}
+
 
 // Instantiate the cache with the right types.
 template class ProcessorCache<std::size_t, ProcessorRcPtr>;
@@ -226,7 +630,8 @@ template class ProcessorCache<std::size_t, CPUProcessorRcPtr>;
 
 
 Processor::Impl::Impl():
-    m_metadata(ProcessorMetadata::Create())
+    m_metadata(ProcessorMetadata::Create()),
+    m_optimizationReport(OptimizationReportBuilder::GetEmpty())
 {
 }
 
@@ -243,6 +648,8 @@ Processor::Impl & Processor::Impl::operator=(const Impl & rhs)
         m_metadata = rhs.m_metadata;
         m_ops      = rhs.m_ops;
 
+        m_optimizationReport = rhs.m_optimizationReport;
+
         m_cacheID.clear();
 
         m_cacheFlags = rhs.m_cacheFlags;
@@ -277,6 +684,21 @@ ConstProcessorMetadataRcPtr Processor::Impl::getProcessorMetadata() const
     return m_metadata;
 }
 
+ConstOptimizationReportRcPtr Processor::Impl::getOptimizationReport() const
+{
+    return m_optimizationReport;
+}
+
+ConstMemoryUsageRcPtr Processor::Impl::getMemoryUsage() const
+{
+    MemoryUsageRcPtr memoryUsage = MemoryUsage::Create();
+    for (const auto & op : m_ops)
+    {
+        memoryUsage->addEntry(op->getInfo().c_str(), GetMemoryUsage(op));
+    }
+    return memoryUsage;
+}
+
 const FormatMetadata & Processor::Impl::getFormatMetadata() const
 {
     return m_ops.getFormatMetadata();
@@ -313,6 +735,11 @@ GroupTransformRcPtr Processor::Impl::createGroupTransform() const
     return group;
 }
 
+void Processor::Impl::serialize(std::ostream & os, const char * fingerprint) const
+{
+    SerializeProcessor(os, m_ops, *m_metadata, getCacheID(), fingerprint);
+}
+
 bool Processor::Impl::isDynamic() const noexcept
 {
     return m_ops.isDynamic();
@@ -353,7 +780,11 @@ OptimizationFlags EnvironmentOverride(OptimizationFlags oFlags)
         try
         {
             // Use 0 to allow base to be determined by the format.
-            oFlags = static_cast<OptimizationFlags>(std::stoul(envFlag, nullptr, 0));
+            const unsigned long envFlags = std::stoul(envFlag, nullptr, 0);
+
+            // The envvar only forces the optimizations, the report stays requested by the caller.
+            oFlags = static_cast<OptimizationFlags>((envFlags & ~OPTIMIZATION_REPORT)
+                                                    | (oFlags & OPTIMIZATION_REPORT));
         }
         catch (const std::exception & e)
         {
@@ -386,9 +817,39 @@ ConstProcessorRcPtr Processor::Impl::getOptimizedProcessor(BitDepth inBitDepth,
         ProcessorRcPtr proc = Create();
         *proc->getImpl() = procImpl;
 
-        proc->getImpl()->m_ops.finalize();
-        proc->getImpl()->m_ops.optimize(oFlags);
-        proc->getImpl()->m_ops.optimizeForBitdepth(inBitDepth, outBitDepth, oFlags);
+        OpRcPtrVec & ops = proc->getImpl()->m_ops;
+
+        // The report is only collected on request as it costs the op descriptions & timings.
+        OptimizationReportRcPtr report;
+        if (HasFlag(oFlags, OPTIMIZATION_REPORT))
+        {
+            report = OptimizationReportBuilder::Create();
+            for (const auto & op : ops)
+            {
+                OptimizationReportBuilder::AddOpBefore(*report, op->getInfo().c_str());
+            }
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+
+        ops.finalize();
+        ops.optimize(oFlags, report.get());
+        ops.optimizeForBitdepth(inBitDepth, outBitDepth, oFlags, report.get());
+
+        if (report)
+        {
+            const std::chrono::duration<double, std::milli> elapsed
+                = std::chrono::steady_clock::now() - start;
+            OptimizationReportBuilder::SetOptimizationTime(*report, elapsed.count());
+
+            for (const auto & op : ops)
+            {
+                OptimizationReportBuilder::AddOpAfter(*report, op->getInfo().c_str());
+            }
+        }
+
+        proc->getImpl()->m_optimizationReport
+            = report ? report : OptimizationReportBuilder::GetEmpty();
         proc->getImpl()->m_ops.validateDynamicProperties();
 
         return proc;
@@ -532,17 +993,67 @@ ConstCPUProcessorRcPtr Processor::Impl::getOptimizedCPUProcessor(BitDepth inBitD
                                                                  BitDepth outBitDepth,
                                                                  OptimizationFlags oFlags) const
 {
-    // Helper method.
-    auto CreateProcessor = [](const OpRcPtrVec & ops,
-                              BitDepth inBitDepth,
-                              BitDepth outBitDepth,
-                              OptimizationFlags oFlags) -> CPUProcessorRcPtr
+    return getOptimizedCPUProcessor(inBitDepth, outBitDepth, oFlags, 0.0f);
+}
+
+ConstCPUProcessorRcPtr Processor::Impl::getOptimizedCPUProcessor(BitDepth inBitDepth,
+                                                                 BitDepth outBitDepth,
+                                                                 OptimizationFlags oFlags,
+                                                                 float bakeTolerance) const
+{
+    // Helper methods.
+    auto CreateCPUProcessor = [](const OpRcPtrVec & ops,
+                                 BitDepth inBitDepth,
+                                 BitDepth outBitDepth,
+                                 OptimizationFlags oFlags) -> CPUProcessorRcPtr
     {
         CPUProcessorRcPtr cpu = CPUProcessorRcPtr(new CPUProcessor(), &CPUProcessor::deleter);
         cpu->getImpl()->finalize(ops, inBitDepth, outBitDepth, oFlags);
         return cpu;
     };
 
+    auto CreateProcessor = [&CreateCPUProcessor, bakeTolerance](const OpRcPtrVec & ops,
+                                                                BitDepth inBitDepth,
+                                                                BitDepth outBitDepth,
+                                                                OptimizationFlags oFlags)
+        -> CPUProcessorRcPtr
+    {
+        CPUProcessorRcPtr cpu = CreateCPUProcessor(ops, inBitDepth, outBitDepth, oFlags);
+
+        // Baking would freeze the dynamic properties.
+        const bool canBake = bakeTolerance > 0.0f && !cpu->isIdentity()
+                             && (!ops.isDynamic() || HasFlag(oFlags, OPTIMIZATION_NO_DYNAMIC_PROPERTIES));
+        if (!canBake)
+        {
+            return cpu;
+        }
+
+        // The exact color processing is sampled in F32.
+        CPUProcessorRcPtr exact = cpu;
+        if (inBitDepth != BIT_DEPTH_F32 || outBitDepth != BIT_DEPTH_F32)
+        {
+            exact = CreateCPUProcessor(ops, BIT_DEPTH_F32, BIT_DEPTH_F32, oFlags);
+        }
+
+        OpRcPtrVec bakedOps;
+        float maxError = 0.0f;
+        if (!BakeProcessorOps(bakedOps, maxError, exact, IsFloatBitDepth(inBitDepth), bakeTolerance))
+        {
+            return cpu;
+        }
+
+        if (IsDebugLoggingEnabled())
+        {
+            std::ostringstream oss;
+            oss << "Baked the CPU processor into " << bakedOps.size()
+                << " LUT op(s) with a max error of " << maxError << ".";
+            LogDebug(oss.str());
+        }
+
+        // The baked LUTs are already optimal and must not be resampled.
+        return CreateCPUProcessor(bakedOps, inBitDepth, outBitDepth, OPTIMIZATION_NONE);
+    };
+
     oFlags = EnvironmentOverride(oFlags);
 
     const bool shareDynamicProperties 
@@ -556,6 +1067,12 @@ ConstCPUProcessorRcPtr Processor::Impl::getOptimizedCPUProcessor(BitDepth inBitD
 
         std::ostringstream oss;
         oss << inBitDepth << outBitDepth << oFlags;
+        if (bakeTolerance > 0.0f)
+        {
+            // Close tolerances must not share the same CPU processor.
+            oss << "bake" << std::setprecision(std::numeric_limits<float>::max_digits10)
+                << bakeTolerance;
+        }
 
         const std::size_t key = std::hash<std::string>{}(oss.str());
 
@@ -646,6 +1163,23 @@ void Processor::Impl::concatenate(ConstProcessorRcPtr & p1, ConstProcessorRcPtr
 }
 
 
+void Processor::Impl::deserialize(const char * filePath, const char * fingerprint)
+{
+    if (!m_ops.empty())
+    {
+        throw Exception("Internal error: Processor should be empty");
+    }
+
+    {
+        AutoMutex lock(m_resultsCacheMutex);
+        DeserializeProcessor(filePath, fingerprint, m_ops, m_metadata, m_cacheID);
+    }
+
+    m_ops.finalize();
+
+    m_ops.validateDynamicProperties();
+}
+
 void Processor::Impl::computeMetadata()
 {
     AutoMutex lock(m_resultsCacheMutex);
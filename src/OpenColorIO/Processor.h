@@ -20,6 +20,9 @@ class Processor::Impl
 private:
     ProcessorMetadataRcPtr m_metadata;
 
+    // Describes how the ops were optimized (only filled by getOptimizedProcessor()).
+    ConstOptimizationReportRcPtr m_optimizationReport;
+
     // Vector of ops for the processor.
     OpRcPtrVec m_ops;
 
@@ -45,6 +48,10 @@ public:
 
     ConstProcessorMetadataRcPtr getProcessorMetadata() const;
 
+    ConstOptimizationReportRcPtr getOptimizationReport() const;
+
+    ConstMemoryUsageRcPtr getMemoryUsage() const;
+
     const FormatMetadata & getFormatMetadata() const;
 
     int getNumTransforms() const;
@@ -58,6 +65,8 @@ public:
 
     GroupTransformRcPtr createGroupTransform() const;
 
+    void serialize(std::ostream & os, const char * fingerprint) const;
+
     ConstProcessorRcPtr getOptimizedProcessor(OptimizationFlags oFlags) const;
 
     ConstProcessorRcPtr getOptimizedProcessor(BitDepth inBD,
@@ -84,6 +93,12 @@ public:
                                                     BitDepth outBitDepth,
                                                     OptimizationFlags oFlags) const;
 
+    // Get a optimized CPU processor instance where the color processing could be baked into LUTs.
+    ConstCPUProcessorRcPtr getOptimizedCPUProcessor(BitDepth inBitDepth,
+                                                    BitDepth outBitDepth,
+                                                    OptimizationFlags oFlags,
+                                                    float bakeTolerance) const;
+
     // Enable or disable the internal caches.
     void setProcessorCacheFlags(ProcessorCacheFlags flags) noexcept;
 
@@ -105,6 +120,9 @@ public:
 
     void computeMetadata();
 
+    // Replace the ops by the ones of a file written by serialize().
+    void deserialize(const char * filePath, const char * fingerprint);
+
 protected:
     ConstGPUProcessorRcPtr getGPUProcessor(const OpRcPtrVec & gpuOps,
                                            OptimizationFlags oFlags) const;
@@ -0,0 +1,707 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <type_traits>
+#include <vector>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "fileformats/ctf/CTFTransform.h"
+#include "fileformats/xmlutils/XMLWriterUtils.h"
+#include "HashUtils.h"
+#include "ops/cdl/CDLOp.h"
+#include "ops/exponent/ExponentOp.h"
+#include "ops/fixedfunction/FixedFunctionOp.h"
+#include "ops/gamma/GammaOp.h"
+#include "ops/log/LogOp.h"
+#include "ops/lut1d/Lut1DOp.h"
+#include "ops/lut3d/Lut3DOp.h"
+#include "ops/matrix/MatrixOp.h"
+#include "ops/range/RangeOp.h"
+#include "Platform.h"
+#include "ProcessorSerialization.h"
+#include "transforms/FileTransform.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+namespace
+{
+
+constexpr char BINARY_MAGIC[8] = { 'O', 'C', 'I', 'O', 'P', 'R', 'O', 'C' };
+constexpr uint32_t BINARY_BYTE_ORDER_MARK = 0x01020304;
+
+// Largest Lut3D grid size accepted when reading, to detect corrupted files before allocating.
+constexpr uint32_t BINARY_MAX_LUT3D_GRID_SIZE = 1024;
+
+// Note: The values are part of the file format so never change or reuse them.
+enum RecordType : uint32_t
+{
+    RECORD_MATRIX         = 1,
+    RECORD_RANGE          = 2,
+    RECORD_LUT1D          = 3,
+    RECORD_LUT3D          = 4,
+    RECORD_LOG            = 5,
+    RECORD_GAMMA          = 6,
+    RECORD_CDL            = 7,
+    RECORD_EXPONENT       = 8,
+    RECORD_FIXED_FUNCTION = 9,
+    RECORD_CTF            = 100
+};
+
+class BinaryWriter
+{
+public:
+    BinaryWriter() = delete;
+    BinaryWriter(const BinaryWriter &) = delete;
+    BinaryWriter & operator=(const BinaryWriter &) = delete;
+
+    explicit BinaryWriter(std::ostream & os)
+        : m_os(os)
+    {
+    }
+
+    template<typename T>
+    void write(T value)
+    {
+        static_assert(std::is_arithmetic<T>::value, "Only arithmetic types are supported.");
+        writeBytes(&value, sizeof(T));
+    }
+
+    void writeString(const std::string & str)
+    {
+        write<uint64_t>(str.size());
+        writeBytes(str.data(), str.size());
+    }
+
+    // Write the number of values followed by the aligned values.
+    template<typename T>
+    void writeValues(const T * values, size_t numValues)
+    {
+        static_assert(std::is_arithmetic<T>::value, "Only arithmetic types are supported.");
+
+        write<uint64_t>(numValues);
+        align();
+        writeBytes(values, numValues * sizeof(T));
+    }
+
+    template<typename T>
+    void writeValues(const std::vector<T> & values)
+    {
+        writeValues(values.data(), values.size());
+    }
+
+private:
+    void align()
+    {
+        static const char padding[BINARY_ALIGNMENT] = { 0 };
+
+        const size_t remainder = m_pos % BINARY_ALIGNMENT;
+        if (remainder != 0)
+        {
+            writeBytes(padding, BINARY_ALIGNMENT - remainder);
+        }
+    }
+
+    void writeBytes(const void * data, size_t size)
+    {
+        m_os.write(static_cast<const char *>(data), size);
+        m_pos += size;
+    }
+
+    std::ostream & m_os;
+    size_t m_pos = 0;
+};
+
+class BinaryReader
+{
+public:
+    BinaryReader() = delete;
+    BinaryReader(const BinaryReader &) = delete;
+    BinaryReader & operator=(const BinaryReader &) = delete;
+
+    BinaryReader(const uint8_t * data, size_t size, const std::string & filePath)
+        : m_data(data)
+        , m_size(size)
+        , m_filePath(filePath)
+    {
+    }
+
+    template<typename T>
+    T read()
+    {
+        static_assert(std::is_arithmetic<T>::value, "Only arithmetic types are supported.");
+
+        T value;
+        checkAvailable(sizeof(T));
+        std::memcpy(&value, m_data + m_pos, sizeof(T));
+        m_pos += sizeof(T);
+        return value;
+    }
+
+    // Enums are stored as uint32_t values and the ones used here are contiguous from 0, so
+    // check the value against the last enumerator rather than blindly casting it.
+    template<typename T>
+    T readEnum(const char * name, T lastValue)
+    {
+        const uint32_t value = read<uint32_t>();
+        if (value > static_cast<uint32_t>(lastValue))
+        {
+            throwInvalidEnum(name, value);
+        }
+        return static_cast<T>(value);
+    }
+
+    Interpolation readInterpolation()
+    {
+        const uint32_t value = read<uint32_t>();
+        switch (value)
+        {
+            case INTERP_UNKNOWN:
+            case INTERP_NEAREST:
+            case INTERP_LINEAR:
+            case INTERP_TETRAHEDRAL:
+            case INTERP_CUBIC:
+            case INTERP_DEFAULT:
+            case INTERP_BEST:
+                return static_cast<Interpolation>(value);
+        }
+        throwInvalidEnum("interpolation", value);
+    }
+
+    std::string readString()
+    {
+        const uint64_t size = read<uint64_t>();
+        checkAvailable(size);
+        std::string str(reinterpret_cast<const char *>(m_data + m_pos), size_t(size));
+        m_pos += size_t(size);
+        return str;
+    }
+
+    // Return the address of the values in the mapped memory i.e. no copy.
+    template<typename T>
+    const uint8_t * readValues(size_t & numValues)
+    {
+        const uint64_t num = read<uint64_t>();
+        align();
+        if (num > (m_size - m_pos) / sizeof(T))
+        {
+            throwError("the data is truncated.");
+        }
+
+        const uint8_t * values = m_data + m_pos;
+        m_pos += size_t(num) * sizeof(T);
+        numValues = size_t(num);
+        return values;
+    }
+
+    // Copy exactly numValues values.
+    template<typename T>
+    void readValues(T * values, size_t numValues)
+    {
+        size_t num = 0;
+        const uint8_t * src = readValues<T>(num);
+        if (num != numValues)
+        {
+            throwError("an array has an unexpected number of values.");
+        }
+        std::memcpy(values, src, num * sizeof(T));
+    }
+
+    template<typename T>
+    void readValues(std::vector<T> & values)
+    {
+        size_t num = 0;
+        const uint8_t * src = readValues<T>(num);
+        values.resize(num);
+        std::memcpy(values.data(), src, num * sizeof(T));
+    }
+
+    bool atEnd() const noexcept { return m_pos == m_size; }
+
+    [[noreturn]] void throwError(const std::string & reason) const
+    {
+        std::ostringstream oss;
+        oss << "Error reading the binary processor file '" << m_filePath << "': " << reason;
+        throw Exception(oss.str().c_str());
+    }
+
+private:
+    [[noreturn]] void throwInvalidEnum(const char * name, uint32_t value) const
+    {
+        std::ostringstream oss;
+        oss << "invalid " << name << " value " << value << ".";
+        throwError(oss.str());
+    }
+
+    void align()
+    {
+        const size_t remainder = m_pos % BINARY_ALIGNMENT;
+        if (remainder != 0)
+        {
+            checkAvailable(BINARY_ALIGNMENT - remainder);
+            m_pos += BINARY_ALIGNMENT - remainder;
+        }
+    }
+
+    void checkAvailable(uint64_t numBytes) const
+    {
+        if (numBytes > m_size - m_pos)
+        {
+            throwError("the data is truncated.");
+        }
+    }
+
+    const uint8_t * m_data;
+    size_t m_size;
+    size_t m_pos = 0;
+    const std::string & m_filePath;
+};
+
+void WriteCTFRecord(BinaryWriter & writer, const OpRcPtr & op)
+{
+    OpRcPtrVec ops;
+    ops.push_back(op);
+
+    CTFReaderTransformPtr transform
+        = std::make_shared<CTFReaderTransform>(ops, FormatMetadataImpl(METADATA_ROOT, ""));
+
+    const std::string opId = ops.getCacheID();
+    std::ostringstream id;
+    id << "urn:uuid:" << CacheIDHashUUID(opId.c_str(), opId.size());
+    transform->setID(id.str().c_str());
+
+    std::ostringstream oss;
+    oss << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>" << std::endl;
+    XmlFormatter fmt(oss);
+    TransformWriter ctfWriter(fmt, transform, TransformWriter::SubFormat::FORMAT_CTF);
+    ctfWriter.write();
+
+    writer.write<uint32_t>(RECORD_CTF);
+    writer.writeString(oss.str());
+}
+
+void WriteOp(BinaryWriter & writer, const OpRcPtr & op)
+{
+    ConstOpRcPtr constOp = op;
+    ConstOpDataRcPtr data = constOp->data();
+
+    switch (data->getType())
+    {
+    case OpData::MatrixType:
+    {
+        auto matrix = DynamicPtrCast<const MatrixOpData>(data);
+        writer.write<uint32_t>(RECORD_MATRIX);
+        writer.write<uint32_t>(matrix->getDirection());
+        writer.writeValues(matrix->getArray().getValues());
+        writer.writeValues(matrix->getOffsets().getValues(), 4);
+        break;
+    }
+    case OpData::RangeType:
+    {
+        auto range = DynamicPtrCast<const RangeOpData>(data);
+        writer.write<uint32_t>(RECORD_RANGE);
+        writer.write<uint32_t>(range->getDirection());
+        writer.write<double>(range->getMinInValue());
+        writer.write<double>(range->getMaxInValue());
+        writer.write<double>(range->getMinOutValue());
+        writer.write<double>(range->getMaxOutValue());
+        break;
+    }
+    case OpData::Lut1DType:
+    {
+        auto lut = DynamicPtrCast<const Lut1DOpData>(data);
+        writer.write<uint32_t>(RECORD_LUT1D);
+        writer.write<uint32_t>(lut->getDirection());
+        writer.write<uint32_t>(lut->getInterpolation());
+        writer.write<uint32_t>(lut->getHalfFlags());
+        writer.write<uint32_t>(lut->getHueAdjust());
+        writer.write<uint32_t>(lut->getArray().getLength());
+        writer.write<uint32_t>(lut->getArray().getNumColorComponents());
+        writer.writeValues(lut->getArray().getValues());
+        break;
+    }
+    case OpData::Lut3DType:
+    {
+        auto lut = DynamicPtrCast<const Lut3DOpData>(data);
+        writer.write<uint32_t>(RECORD_LUT3D);
+        writer.write<uint32_t>(lut->getDirection());
+        writer.write<uint32_t>(lut->getInterpolation());
+        writer.write<uint32_t>(static_cast<uint32_t>(lut->getGridSize()));
+        writer.writeValues(lut->getArray().getValues());
+        break;
+    }
+    case OpData::LogType:
+    {
+        auto log = DynamicPtrCast<const LogOpData>(data);
+        writer.write<uint32_t>(RECORD_LOG);
+        writer.write<uint32_t>(log->getDirection());
+        writer.write<double>(log->getBase());
+        writer.writeValues(log->getRedParams());
+        writer.writeValues(log->getGreenParams());
+        writer.writeValues(log->getBlueParams());
+        break;
+    }
+    case OpData::GammaType:
+    {
+        auto gamma = DynamicPtrCast<const GammaOpData>(data);
+        writer.write<uint32_t>(RECORD_GAMMA);
+        writer.write<uint32_t>(gamma->getStyle());
+        writer.writeValues(gamma->getRedParams());
+        writer.writeValues(gamma->getGreenParams());
+        writer.writeValues(gamma->getBlueParams());
+        writer.writeValues(gamma->getAlphaParams());
+        break;
+    }
+    case OpData::CDLType:
+    {
+        auto cdl = DynamicPtrCast<const CDLOpData>(data);
+
+        double slope[3], offset[3], power[3];
+        cdl->getSlopeParams().getRGB(slope);
+        cdl->getOffsetParams().getRGB(offset);
+        cdl->getPowerParams().getRGB(power);
+
+        writer.write<uint32_t>(RECORD_CDL);
+        writer.write<uint32_t>(cdl->getStyle());
+        writer.writeValues(slope, 3);
+        writer.writeValues(offset, 3);
+        writer.writeValues(power, 3);
+        writer.write<double>(cdl->getSaturation());
+        break;
+    }
+    case OpData::ExponentType:
+    {
+        auto exp = DynamicPtrCast<const ExponentOpData>(data);
+        writer.write<uint32_t>(RECORD_EXPONENT);
+        writer.writeValues(exp->m_exp4, 4);
+        break;
+    }
+    case OpData::FixedFunctionType:
+    {
+        auto func = DynamicPtrCast<const FixedFunctionOpData>(data);
+        writer.write<uint32_t>(RECORD_FIXED_FUNCTION);
+        writer.write<uint32_t>(func->getStyle());
+        writer.writeValues(func->getParams());
+        break;
+    }
+    case OpData::ReferenceType:
+    {
+        throw Exception("Cannot serialize a processor containing an unresolved reference.");
+    }
+    case OpData::ExposureContrastType:
+    case OpData::GradingPrimaryType:
+    case OpData::GradingRGBCurveType:
+    case OpData::GradingHueCurveType:
+    case OpData::GradingToneType:
+    {
+        // Use the CTF format for the other ops as it has a lossless mapping for all of them.
+        WriteCTFRecord(writer, op);
+        break;
+    }
+    case OpData::NoOpType:
+    {
+        // The no-ops are removed by the caller as they do not contribute to the processing.
+        throw Exception("Cannot serialize a no-op.");
+    }
+    }
+}
+
+void ReadOp(BinaryReader & reader, OpRcPtrVec & ops, ConstConfigRcPtr & rawConfig)
+{
+    const uint32_t recordType = reader.read<uint32_t>();
+
+    switch (recordType)
+    {
+    case RECORD_MATRIX:
+    {
+        auto matrix = std::make_shared<MatrixOpData>();
+        matrix->setDirection(reader.readEnum("direction", TRANSFORM_DIR_INVERSE));
+        reader.readValues(matrix->getArray().getValues().data(),
+                          matrix->getArray().getValues().size());
+        reader.readValues(matrix->getOffsets().getValues(), 4);
+        CreateMatrixOp(ops, matrix, TRANSFORM_DIR_FORWARD);
+        break;
+    }
+    case RECORD_RANGE:
+    {
+        const auto dir          = reader.readEnum("direction", TRANSFORM_DIR_INVERSE);
+        const double minInValue  = reader.read<double>();
+        const double maxInValue  = reader.read<double>();
+        const double minOutValue = reader.read<double>();
+        const double maxOutValue = reader.read<double>();
+
+        auto range = std::make_shared<RangeOpData>(minInValue, maxInValue,
+                                                   minOutValue, maxOutValue, dir);
+        CreateRangeOp(ops, range, TRANSFORM_DIR_FORWARD);
+        break;
+    }
+    case RECORD_LUT1D:
+    {
+        const auto dir           = reader.readEnum("direction", TRANSFORM_DIR_INVERSE);
+        const auto interpolation = reader.readInterpolation();
+        const auto halfFlags     = reader.readEnum("half flags", Lut1DOpData::LUT_INPUT_OUTPUT_HALF_CODE);
+        const auto hueAdjust     = reader.readEnum("hue adjust", HUE_WYPN);
+        const uint32_t length    = reader.read<uint32_t>();
+        const uint32_t numComps  = reader.read<uint32_t>();
+
+        size_t numValues = 0;
+        const uint8_t * values = reader.readValues<float>(numValues);
+        if (length < 2 || numValues != size_t(length) * 3 || (numComps != 1 && numComps != 3))
+        {
+            reader.throwError("invalid Lut1D dimensions.");
+        }
+
+        auto lut = std::make_shared<Lut1DOpData>(halfFlags, length, false);
+        lut->setDirection(dir);
+        lut->setInterpolation(interpolation);
+        lut->setHueAdjust(hueAdjust);
+        lut->getArray().setNumColorComponents(numComps);
+        std::memcpy(lut->getArray().getValues().data(), values, numValues * sizeof(float));
+        CreateLut1DOp(ops, lut, TRANSFORM_DIR_FORWARD);
+        break;
+    }
+    case RECORD_LUT3D:
+    {
+        const auto dir           = reader.readEnum("direction", TRANSFORM_DIR_INVERSE);
+        const auto interpolation = reader.readInterpolation();
+        const uint32_t gridSize  = reader.read<uint32_t>();
+
+        size_t numValues = 0;
+        const uint8_t * values = reader.readValues<float>(numValues);
+        if (gridSize < 2 || gridSize > BINARY_MAX_LUT3D_GRID_SIZE
+            || numValues != size_t(gridSize) * gridSize * gridSize * 3)
+        {
+            reader.throwError("invalid Lut3D dimensions.");
+        }
+
+        auto lut = std::make_shared<Lut3DOpData>(interpolation, gridSize);
+        lut->setDirection(dir);
+        std::memcpy(lut->getArray().getValues().data(), values, numValues * sizeof(float));
+        CreateLut3DOp(ops, lut, TRANSFORM_DIR_FORWARD);
+        break;
+    }
+    case RECORD_LOG:
+    {
+        const auto dir    = reader.readEnum("direction", TRANSFORM_DIR_INVERSE);
+        const double base = reader.read<double>();
+
+        LogOpData::Params redParams, greenParams, blueParams;
+        reader.readValues(redParams);
+        reader.readValues(greenParams);
+        reader.readValues(blueParams);
+
+        auto log = std::make_shared<LogOpData>(base, redParams, greenParams, blueParams, dir);
+        CreateLogOp(ops, log, TRANSFORM_DIR_FORWARD);
+        break;
+    }
+    case RECORD_GAMMA:
+    {
+        const auto style = reader.readEnum("gamma style", GammaOpData::MONCURVE_MIRROR_REV);
+
+        GammaOpData::Params redParams, greenParams, blueParams, alphaParams;
+        reader.readValues(redParams);
+        reader.readValues(greenParams);
+        reader.readValues(blueParams);
+        reader.readValues(alphaParams);
+
+        auto gamma = std::make_shared<GammaOpData>(style, redParams, greenParams,
+                                                   blueParams, alphaParams);
+        CreateGammaOp(ops, gamma, TRANSFORM_DIR_FORWARD);
+        break;
+    }
+    case RECORD_CDL:
+    {
+        const auto style = reader.readEnum("CDL style", CDLOpData::CDL_NO_CLAMP_REV);
+
+        double slope[3], offset[3], power[3];
+        reader.readValues(slope, 3);
+        reader.readValues(offset, 3);
+        reader.readValues(power, 3);
+        const double saturation = reader.read<double>();
+
+        auto cdl = std::make_shared<CDLOpData>(style,
+                                               CDLOpData::ChannelParams(slope[0], slope[1], slope[2]),
+                                               CDLOpData::ChannelParams(offset[0], offset[1], offset[2]),
+                                               CDLOpData::ChannelParams(power[0], power[1], power[2]),
+                                               saturation);
+        CreateCDLOp(ops, cdl, TRANSFORM_DIR_FORWARD);
+        break;
+    }
+    case RECORD_EXPONENT:
+    {
+        double exp4[4];
+        reader.readValues(exp4, 4);
+
+        auto exp = std::make_shared<ExponentOpData>(exp4);
+        CreateExponentOp(ops, exp, TRANSFORM_DIR_FORWARD);
+        break;
+    }
+    case RECORD_FIXED_FUNCTION:
+    {
+        const auto style = reader.readEnum("fixed function style", FixedFunctionOpData::HSY_VID_TO_RGB);
+
+        FixedFunctionOpData::Params params;
+        reader.readValues(params);
+
+        auto func = std::make_shared<FixedFunctionOpData>(style, params);
+        CreateFixedFunctionOp(ops, func, TRANSFORM_DIR_FORWARD);
+        break;
+    }
+    case RECORD_CTF:
+    {
+        std::istringstream iss(reader.readString());
+
+        FileFormat * format = FormatRegistry::GetInstance().getFileFormatByName(FILEFORMAT_CTF);
+        CachedFileRcPtr cachedFile = format->read(iss, "", INTERP_DEFAULT);
+
+        if (!rawConfig)
+        {
+            rawConfig = Config::CreateRaw();
+        }
+
+        // Use a separate list as the CTF reader also sets the processor metadata.
+        OpRcPtrVec ctfOps;
+        format->buildFileOps(ctfOps, *rawConfig, rawConfig->getCurrentContext(), cachedFile,
+                             *FileTransform::Create(), TRANSFORM_DIR_FORWARD);
+        ops += ctfOps;
+        break;
+    }
+    default:
+    {
+        std::ostringstream oss;
+        oss << "unknown record type " << recordType << ".";
+        reader.throwError(oss.str());
+    }
+    }
+}
+
+} // anon.
+
+void SerializeProcessor(std::ostream & os,
+                        const OpRcPtrVec & ops,
+                        const ProcessorMetadata & metadata,
+                        const char * cacheID,
+                        const char * fingerprint)
+{
+    BinaryWriter writer(os);
+
+    for (const char c : BINARY_MAGIC)
+    {
+        writer.write<char>(c);
+    }
+    writer.write<uint32_t>(BINARY_PROCESSOR_VERSION);
+    writer.write<uint32_t>(BINARY_BYTE_ORDER_MARK);
+
+    writer.writeString(cacheID ? cacheID : "");
+    writer.writeString(fingerprint ? fingerprint : "");
+
+    writer.write<uint32_t>(metadata.getNumFiles());
+    for (int idx = 0; idx < metadata.getNumFiles(); ++idx)
+    {
+        writer.writeString(metadata.getFile(idx));
+    }
+
+    writer.write<uint32_t>(metadata.getNumLooks());
+    for (int idx = 0; idx < metadata.getNumLooks(); ++idx)
+    {
+        writer.writeString(metadata.getLook(idx));
+    }
+
+    // No-ops do not contribute to the color processing so they are not serialized.
+    OpRcPtrVec serializedOps;
+    for (const auto & op : ops)
+    {
+        if (!op->isNoOpType())
+        {
+            serializedOps.push_back(op);
+        }
+    }
+
+    writer.write<uint32_t>(static_cast<uint32_t>(serializedOps.size()));
+    for (const auto & op : serializedOps)
+    {
+        WriteOp(writer, op);
+    }
+
+    if (!os.good())
+    {
+        throw Exception("Error writing the binary processor: the stream is in a bad state.");
+    }
+}
+
+void DeserializeProcessor(const std::string & filePath,
+                          const char * fingerprint,
+                          OpRcPtrVec & ops,
+                          ProcessorMetadataRcPtr & metadata,
+                          std::string & cacheID)
+{
+    const Platform::MappedFile file(filePath);
+
+    BinaryReader reader(file.data(), file.size(), filePath);
+
+    char magic[sizeof(BINARY_MAGIC)];
+    for (auto & c : magic)
+    {
+        c = reader.read<char>();
+    }
+    if (0 != std::memcmp(magic, BINARY_MAGIC, sizeof(BINARY_MAGIC)))
+    {
+        reader.throwError("this is not a binary processor file.");
+    }
+
+    const uint32_t version = reader.read<uint32_t>();
+    if (version != BINARY_PROCESSOR_VERSION)
+    {
+        std::ostringstream oss;
+        oss << "unsupported version " << version
+            << " (expected " << BINARY_PROCESSOR_VERSION << ").";
+        reader.throwError(oss.str());
+    }
+
+    if (reader.read<uint32_t>() != BINARY_BYTE_ORDER_MARK)
+    {
+        reader.throwError("the file was written on a platform with a different byte order.");
+    }
+
+    cacheID = reader.readString();
+
+    const std::string fileFingerprint = reader.readString();
+    if (fingerprint && *fingerprint && fileFingerprint != fingerprint)
+    {
+        reader.throwError("the dependency fingerprint does not match.");
+    }
+
+    metadata = ProcessorMetadata::Create();
+
+    const uint32_t numFiles = reader.read<uint32_t>();
+    for (uint32_t idx = 0; idx < numFiles; ++idx)
+    {
+        metadata->addFile(reader.readString().c_str());
+    }
+
+    const uint32_t numLooks = reader.read<uint32_t>();
+    for (uint32_t idx = 0; idx < numLooks; ++idx)
+    {
+        metadata->addLook(reader.readString().c_str());
+    }
+
+    ConstConfigRcPtr rawConfig;
+
+    const uint32_t numOps = reader.read<uint32_t>();
+    for (uint32_t idx = 0; idx < numOps; ++idx)
+    {
+        ReadOp(reader, ops, rawConfig);
+    }
+
+    if (!reader.atEnd())
+    {
+        reader.throwError("unexpected data after the last op.");
+    }
+}
+
+} // namespace OCIO_NAMESPACE
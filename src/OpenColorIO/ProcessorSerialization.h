@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_PROCESSORSERIALIZATION_H
+#define INCLUDED_OCIO_PROCESSORSERIALIZATION_H
+
+#include <ostream>
+#include <string>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "Op.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+// The binary processor format stores a list of ops so that a processor can be recreated
+// without parsing the config or any LUT file. The layout is:
+//
+//   magic "OCIOPROC", format version, byte order mark,
+//   processor cache ID, dependency fingerprint, processor metadata (files & looks),
+//   number of ops, then one record per op.
+//
+// Matrix, Range, Lut1D, Lut3D, Log, Gamma, CDL, Exponent and FixedFunction ops are stored as
+// raw values. Any other op (e.g. grading or exposure/contrast ops) is stored as a CTF process
+// list containing only this op. Arrays (i.e. matrix & LUT values) are aligned on
+// BINARY_ALIGNMENT bytes from the start of the data so they could be directly read from a
+// memory mapped file. Values are stored in the byte order of the writing platform and reading
+// a file written on a platform with a different byte order throws.
+
+static constexpr unsigned BINARY_PROCESSOR_VERSION = 1;
+static constexpr unsigned BINARY_ALIGNMENT = 64;
+
+// Write the ops into the binary processor format. The stream is expected to be positioned at
+// the start of the file so the alignment of the arrays is preserved.
+void SerializeProcessor(std::ostream & os,
+                        const OpRcPtrVec & ops,
+                        const ProcessorMetadata & metadata,
+                        const char * cacheID,
+                        const char * fingerprint);
+
+// Read the ops from a file in the binary processor format. If the fingerprint is not null or
+// empty, it must match the one of the file. The file is memory mapped and the arrays are copied
+// from the mapped memory i.e. no text parsing for the raw ops.
+void DeserializeProcessor(const std::string & filePath,
+                          const char * fingerprint,
+                          OpRcPtrVec & ops,
+                          ProcessorMetadataRcPtr & metadata,
+                          std::string & cacheID);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // INCLUDED_OCIO_PROCESSORSERIALIZATION_H
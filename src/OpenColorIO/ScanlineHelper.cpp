@@ -30,6 +30,34 @@ Optimizations GetOptimizationMode(const GenericImageDesc & imgDesc)
 }
 
 
+namespace
+{
+
+// When the image lines are contiguous, the lines of the small images (e.g. tiles) are merged to
+// process up to this number of pixels at once. That reduces the overhead per line while keeping
+// the intermediate buffers small enough to stay in the cache.
+static constexpr long MinLineSize = 1024;
+
+// Byte offset of a pixel in an image.
+inline ptrdiff_t GetPixelOffset(const GenericImageDesc & img, long pixelIndex)
+{
+    return img.m_yStrideBytes * (pixelIndex / img.m_width)
+           + img.m_xStrideBytes * (pixelIndex % img.m_width);
+}
+
+// The buffers are never shrunk so that a helper reused for several images does not
+// reallocate them.
+template<typename T>
+void GrowBuffer(std::vector<T> & buffer, size_t size)
+{
+    if(buffer.size() < size)
+    {
+        buffer.resize(size);
+    }
+}
+
+}
+
 template<typename InType, typename OutType>
 GenericScanlineHelper<InType, OutType>::GenericScanlineHelper(BitDepth inputBitDepth,
                                                               const ConstOpCPURcPtr & inBitDepthOp,
@@ -42,7 +70,9 @@ GenericScanlineHelper<InType, OutType>::GenericScanlineHelper(BitDepth inputBitD
     ,   m_outBitDepthOp(outBitDepthOp)
     ,   m_inOptimizedMode(NO_OPTIMIZATION)
     ,   m_outOptimizedMode(NO_OPTIMIZATION)
-    ,   m_yIndex(0)
+    ,   m_lineSize(0)
+    ,   m_pixelIndex(0)
+    ,   m_numPixels(0)
     ,   m_useDstBuffer(false)
 {
 }
@@ -50,8 +80,6 @@ GenericScanlineHelper<InType, OutType>::GenericScanlineHelper(BitDepth inputBitD
 template<typename InType, typename OutType>
 void GenericScanlineHelper<InType, OutType>::init(const ImageDesc & srcImg, const ImageDesc & dstImg)
 {
-    m_yIndex = 0;
-
     m_srcImg.init(srcImg, m_inputBitDepth, m_inBitDepthOp);
     m_dstImg.init(dstImg, m_outputBitDepth, m_outBitDepthOp);
 
@@ -67,25 +95,25 @@ void GenericScanlineHelper<InType, OutType>::init(const ImageDesc & srcImg, cons
     m_useDstBuffer
         = (m_outOptimizedMode & PACKED_FLOAT_OPTIMIZATION) == PACKED_FLOAT_OPTIMIZATION;
 
+    initLines(m_srcImg.hasContiguousLines() && m_dstImg.hasContiguousLines());
+
+    const size_t bufferSize = 4 * size_t(m_lineSize);
+
     if( (m_inOptimizedMode & PACKED_OPTIMIZATION) != PACKED_OPTIMIZATION)
     {
-        const long bufferSize = 4 * m_dstImg.m_width;
-        m_inBitDepthBuffer.resize(bufferSize);
+        GrowBuffer(m_inBitDepthBuffer, bufferSize);
     }
 
     if(!m_useDstBuffer)
     {
-        const long bufferSize = 4 * m_dstImg.m_width;
-        m_rgbaFloatBuffer.resize(bufferSize);
-        m_outBitDepthBuffer.resize(bufferSize);
+        GrowBuffer(m_rgbaFloatBuffer, bufferSize);
+        GrowBuffer(m_outBitDepthBuffer, bufferSize);
     }
 }
 
 template<typename InType, typename OutType>
 void GenericScanlineHelper<InType, OutType>::init(const ImageDesc & img)
 {
-    m_yIndex = 0;
-
     m_srcImg.init(img, m_inputBitDepth, m_inBitDepthOp);
     m_dstImg.init(img, m_outputBitDepth, m_outBitDepthOp);
 
@@ -96,16 +124,30 @@ void GenericScanlineHelper<InType, OutType>::init(const ImageDesc & img)
     m_useDstBuffer
         = (m_outOptimizedMode & PACKED_FLOAT_OPTIMIZATION) == PACKED_FLOAT_OPTIMIZATION;
 
+    initLines(m_srcImg.hasContiguousLines());
+
     if(!m_useDstBuffer)
     {
-        // TODO: Re-use memory from thread-safe memory pool, rather
-        // than doing a new allocation each time.
+        const size_t bufferSize = 4 * size_t(m_lineSize);
 
-        const long bufferSize = 4 * m_dstImg.m_width;
+        GrowBuffer(m_rgbaFloatBuffer, bufferSize);
+        GrowBuffer(m_inBitDepthBuffer, bufferSize);
+        GrowBuffer(m_outBitDepthBuffer, bufferSize);
+    }
+}
 
-        m_rgbaFloatBuffer.resize(bufferSize);
-        m_inBitDepthBuffer.resize(bufferSize);
-        m_outBitDepthBuffer.resize(bufferSize);
+template<typename InType, typename OutType>
+void GenericScanlineHelper<InType, OutType>::initLines(bool contiguousLines)
+{
+    m_pixelIndex = 0;
+    m_numPixels  = 0;
+    m_lineSize   = m_dstImg.m_width;
+
+    if(contiguousLines && m_dstImg.m_width > 0 && m_dstImg.m_width < MinLineSize)
+    {
+        // Process several image lines at once.
+        const long numLines = std::min(MinLineSize / m_dstImg.m_width, m_dstImg.m_height);
+        m_lineSize = m_dstImg.m_width * std::max(numLines, 1L);
     }
 }
 
@@ -118,22 +160,26 @@ GenericScanlineHelper<InType, OutType>::~GenericScanlineHelper()
 template<typename InType, typename OutType>
 void GenericScanlineHelper<InType, OutType>::prepRGBAScanline(float** buffer, long & numPixels)
 {
-    // Note that only a line-by-line processing is done on the image buffer.
+    // Note that only a line-by-line processing is done on the image buffer (where a line could
+    // contain several lines of the image, refer to initLines()).
 
-    if(m_yIndex >= m_dstImg.m_height)
+    const long imgPixels = m_dstImg.m_width * m_dstImg.m_height;
+    if(m_pixelIndex >= imgPixels)
     {
         numPixels = 0;
         return;
     }
 
-    *buffer = m_useDstBuffer ? (float*)(m_dstImg.m_rData + m_dstImg.m_yStrideBytes * m_yIndex)
+    m_numPixels = std::min(m_lineSize, imgPixels - m_pixelIndex);
+
+    *buffer = m_useDstBuffer ? (float*)(m_dstImg.m_rData + GetPixelOffset(m_dstImg, m_pixelIndex))
                              : &m_rgbaFloatBuffer[0];
 
     if((m_inOptimizedMode&PACKED_OPTIMIZATION)==PACKED_OPTIMIZATION)
     {
-        const void * inBuffer = (void*)(m_srcImg.m_rData + m_srcImg.m_yStrideBytes * m_yIndex);
+        const void * inBuffer = (void*)(m_srcImg.m_rData + GetPixelOffset(m_srcImg, m_pixelIndex));
 
-        m_srcImg.m_bitDepthOp->apply(inBuffer, *buffer, m_dstImg.m_width);
+        m_srcImg.m_bitDepthOp->apply(inBuffer, *buffer, m_numPixels);
     }
     else
     {
@@ -142,12 +188,12 @@ void GenericScanlineHelper<InType, OutType>::prepRGBAScanline(float** buffer, lo
         Generic<InType>::PackRGBAFromImageDesc(m_srcImg,
                                                &m_inBitDepthBuffer[0],
                                                *buffer,
-                                               m_dstImg.m_width,
-                                               m_yIndex * m_dstImg.m_width, 
+                                               m_numPixels,
+                                               m_pixelIndex,
                                                m_inputBitDepth);
     }
 
-    numPixels = m_dstImg.m_width;
+    numPixels = m_numPixels;
 }
 
 // Write back the result of our work, from the scanline to our destination image.
@@ -158,11 +204,11 @@ void GenericScanlineHelper<InType, OutType>::finishRGBAScanline()
 
     if((m_outOptimizedMode&PACKED_OPTIMIZATION)==PACKED_OPTIMIZATION)
     {
-        void * out = (void*)(m_dstImg.m_rData + m_dstImg.m_yStrideBytes * m_yIndex);
+        void * out = (void*)(m_dstImg.m_rData + GetPixelOffset(m_dstImg, m_pixelIndex));
 
         const void * in  = m_useDstBuffer ? out : (void*)&m_rgbaFloatBuffer[0];
 
-        m_dstImg.m_bitDepthOp->apply(in, out, m_dstImg.m_width);
+        m_dstImg.m_bitDepthOp->apply(in, out, m_numPixels);
     }
     else
     {
@@ -170,11 +216,11 @@ void GenericScanlineHelper<InType, OutType>::finishRGBAScanline()
         Generic<OutType>::UnpackRGBAToImageDesc(m_dstImg,
                                                 &m_rgbaFloatBuffer[0],
                                                 &m_outBitDepthBuffer[0],
-                                                m_dstImg.m_width,
-                                                m_yIndex * m_dstImg.m_width);
+                                                m_numPixels,
+                                                m_pixelIndex);
     }
 
-    ++m_yIndex;
+    m_pixelIndex += m_numPixels;
 }
 
 
@@ -69,6 +69,9 @@ public:
     void finishRGBAScanline() override;
 
 private:
+    // Compute the line size i.e. the number of pixels to process at once.
+    void initLines(bool contiguousLines);
+
     BitDepth m_inputBitDepth;
     BitDepth m_outputBitDepth;
     ConstOpCPURcPtr m_inBitDepthOp;
@@ -88,8 +91,15 @@ private:
     std::vector<InType> m_inBitDepthBuffer;
     std::vector<OutType> m_outBitDepthBuffer;
 
-    // The index of the current line to process.
-    int m_yIndex;
+    // Number of pixels processed at once i.e. the image width, or several lines for the small
+    // images (e.g. tiles) having contiguous lines.
+    long m_lineSize;
+
+    // The index of the first pixel of the current line to process.
+    long m_pixelIndex;
+
+    // The number of pixels of the current line.
+    long m_numPixels;
 
     // If the destination buffer is packed RGBA F32 it could then be used
     // as the internal processing buffer (i.e. instead of m_rgbaFloatBuffer
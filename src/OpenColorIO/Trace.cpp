@@ -0,0 +1,322 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "Logging.h"
+#include "Mutex.h"
+#include "Platform.h"
+#include "Trace.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+std::atomic<bool> g_traceActive{ true };
+
+namespace
+{
+
+Mutex g_traceMutex;
+TraceFunction g_traceFunction;
+
+// The Chrome trace-event JSON file (i.e. the 'JSON Array Format' which the trace viewers accept
+// even if the closing bracket is missing, for example after a crash).
+struct TraceFile
+{
+    std::ofstream m_stream;
+    bool m_firstEvent = true;
+};
+std::unique_ptr<TraceFile> g_traceFile;
+
+const std::chrono::steady_clock::time_point g_traceOrigin = std::chrono::steady_clock::now();
+
+std::atomic<unsigned long long> g_traceThreadCounter{ 0 };
+
+thread_local unsigned long long t_traceThreadID = 0;
+thread_local unsigned t_traceDepth = 0;
+
+// You must manually acquire the trace mutex before calling this.
+void UpdateTraceActive()
+{
+    g_traceActive.store(g_traceFunction || g_traceFile, std::memory_order_relaxed);
+}
+
+double GetTraceTime()
+{
+    const auto elapsed = std::chrono::steady_clock::now() - g_traceOrigin;
+    return std::chrono::duration<double, std::micro>(elapsed).count();
+}
+
+unsigned long long GetTraceThreadID()
+{
+    if (t_traceThreadID == 0)
+    {
+        t_traceThreadID = ++g_traceThreadCounter;
+    }
+    return t_traceThreadID;
+}
+
+long GetProcessID()
+{
+#ifdef _WIN32
+    return static_cast<long>(_getpid());
+#else
+    return static_cast<long>(getpid());
+#endif
+}
+
+void WriteJSONString(std::ostream & os, const char * str)
+{
+    os << '"';
+    for (const char * c = str; *c; ++c)
+    {
+        switch (*c)
+        {
+            case '"':  os << "\\\""; break;
+            case '\\': os << "\\\\"; break;
+            case '\n': os << "\\n";  break;
+            case '\r': os << "\\r";  break;
+            case '\t': os << "\\t";  break;
+            default:
+            {
+                if (static_cast<unsigned char>(*c) < 0x20)
+                {
+                    char buffer[8];
+                    std::snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<unsigned>(*c));
+                    os << buffer;
+                }
+                else
+                {
+                    os << *c;
+                }
+                break;
+            }
+        }
+    }
+    os << '"';
+}
+
+// You must manually acquire the trace mutex before calling this.
+void WriteTraceEvent(TraceFile & file, const TraceEvent & event)
+{
+    std::ostream & os = file.m_stream;
+
+    os << (file.m_firstEvent ? "\n" : ",\n");
+    file.m_firstEvent = false;
+
+    os << "{\"name\":";
+    WriteJSONString(os, event.name);
+    os << ",\"cat\":";
+    WriteJSONString(os, event.category);
+    os << ",\"ph\":\"X\"";
+    os << ",\"ts\":"   << event.start;
+    os << ",\"dur\":"  << event.duration;
+    os << ",\"pid\":"  << GetProcessID();
+    os << ",\"tid\":"  << event.threadID;
+    os << ",\"args\":{\"depth\":" << event.depth;
+    if (*event.detail)
+    {
+        os << ",\"detail\":";
+        WriteJSONString(os, event.detail);
+    }
+    os << "}}";
+}
+
+// You must manually acquire the trace mutex before calling this.
+void CloseTraceFile()
+{
+    if (g_traceFile)
+    {
+        g_traceFile->m_stream << "\n]\n";
+        g_traceFile.reset();
+    }
+}
+
+// You must manually acquire the trace mutex before calling this.
+void OpenTraceFile(const std::string & filename)
+{
+    CloseTraceFile();
+
+    if (!filename.empty())
+    {
+        std::unique_ptr<TraceFile> file(new TraceFile);
+        file->m_stream.open(Platform::filenameToUTF(filename).c_str(), std::ios_base::out);
+        if (file->m_stream.fail())
+        {
+            std::ostringstream oss;
+            oss << "Could not open the trace file '" << filename << "'.";
+            LogWarning(oss.str());
+        }
+        else
+        {
+            file->m_stream.precision(3);
+            file->m_stream << std::fixed << "[";
+            g_traceFile = std::move(file);
+        }
+    }
+}
+
+// Start the trace file named by the environment variable on the first use of the tracing
+// rather than at library load, so that it does not depend on the static initialization order
+// (e.g. of the logging). Until then, g_traceActive is true so that the first span gets here.
+void InitTraceFromEnv()
+{
+    static const bool initialized = []()
+    {
+        AutoMutex lock(g_traceMutex);
+#ifndef OCIO_DISABLE_TRACING
+        std::string filename;
+        if (Platform::Getenv(OCIO_TRACE_FILE_ENVVAR, filename) && !filename.empty())
+        {
+            OpenTraceFile(filename);
+        }
+#endif
+        UpdateTraceActive();
+        return true;
+    }();
+    (void)initialized;
+}
+
+// Complete the trace file at exit.
+class TraceFileCloser
+{
+public:
+    ~TraceFileCloser()
+    {
+        AutoMutex lock(g_traceMutex);
+        CloseTraceFile();
+        UpdateTraceActive();
+    }
+};
+TraceFileCloser g_traceFileCloser;
+
+} // anon.
+
+
+void TraceScope::begin(const char * category, const char * name,
+                       const std::string * detail) noexcept
+{
+    try
+    {
+        InitTraceFromEnv();
+    }
+    catch (...)
+    {
+    }
+    if (!IsTraceActive())
+    {
+        return;
+    }
+
+    m_category = category;
+    m_name     = name;
+    if (detail)
+    {
+        try
+        {
+            m_detail = *detail;
+        }
+        catch (...)
+        {
+        }
+    }
+    m_active = true;
+
+    ++t_traceDepth;
+    m_start = GetTraceTime();
+}
+
+void TraceScope::end() noexcept
+{
+    const double endTime = GetTraceTime();
+    --t_traceDepth;
+
+    TraceEvent event;
+    event.name     = m_name;
+    event.category = m_category;
+    event.detail   = m_detail.c_str();
+    event.start    = m_start;
+    event.duration = endTime - m_start;
+    event.threadID = GetTraceThreadID();
+    event.depth    = t_traceDepth;
+
+    try
+    {
+        TraceFunction traceFunction;
+        {
+            AutoMutex lock(g_traceMutex);
+            if (g_traceFile)
+            {
+                WriteTraceEvent(*g_traceFile, event);
+            }
+            traceFunction = g_traceFunction;
+        }
+
+        // The function is called outside of the lock as it could use the library.
+        if (traceFunction)
+        {
+            traceFunction(event);
+        }
+    }
+    catch (...)
+    {
+        // A trace sink must never break the traced code.
+    }
+}
+
+void SetTraceFile(const std::string & filename)
+{
+    InitTraceFromEnv();
+
+    AutoMutex lock(g_traceMutex);
+    OpenTraceFile(filename);
+    UpdateTraceActive();
+}
+
+void SetTraceFunction(TraceFunction traceFunction)
+{
+    if (!traceFunction)
+    {
+        throw Exception("SetTraceFunction: traceFunction must not be null.");
+    }
+    InitTraceFromEnv();
+
+    AutoMutex lock(g_traceMutex);
+    g_traceFunction = traceFunction;
+    UpdateTraceActive();
+}
+
+void ResetTraceFunction()
+{
+    InitTraceFromEnv();
+
+    AutoMutex lock(g_traceMutex);
+    g_traceFunction = nullptr;
+    UpdateTraceActive();
+}
+
+bool IsTracingEnabled()
+{
+#ifdef OCIO_DISABLE_TRACING
+    return false;
+#else
+    InitTraceFromEnv();
+    return IsTraceActive();
+#endif
+}
+
+} // namespace OCIO_NAMESPACE
@@ -0,0 +1,110 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_TRACE_H
+#define INCLUDED_OCIO_TRACE_H
+
+#include <atomic>
+#include <string>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+
+namespace OCIO_NAMESPACE
+{
+
+// Trace spans record the duration of the expensive steps of the processor creation (i.e. config
+// loading, LUT file reading, op optimization and renderer finalization). The events are sent to
+// the function set by SetTraceFunction() and/or written to the Chrome trace-event JSON file
+// named by OCIO_TRACE_FILE_ENVVAR.
+//
+// Use the OCIO_TRACE_SCOPE macros rather than the TraceScope class so that the instrumentation
+// is removed when the library is built with OCIO_ENABLE_TRACING=OFF. When tracing is built but
+// no sink is active, a span only costs one relaxed atomic load (once the first span has read the
+// OCIO_TRACE_FILE_ENVVAR environment variable).
+
+extern std::atomic<bool> g_traceActive;
+
+inline bool IsTraceActive() noexcept
+{
+    return g_traceActive.load(std::memory_order_relaxed);
+}
+
+class TraceScope
+{
+public:
+    TraceScope(const char * category, const char * name) noexcept
+    {
+        if (IsTraceActive())
+        {
+            begin(category, name, nullptr);
+        }
+    }
+
+    // The detail (e.g. a file path) is only copied when tracing is active.
+    TraceScope(const char * category, const char * name, const std::string & detail) noexcept
+    {
+        if (IsTraceActive())
+        {
+            begin(category, name, &detail);
+        }
+    }
+
+    TraceScope(const char * category, const char * name, const char * detail) noexcept
+    {
+        if (IsTraceActive())
+        {
+            const std::string str(detail ? detail : "");
+            begin(category, name, &str);
+        }
+    }
+
+    TraceScope(const TraceScope &) = delete;
+    TraceScope & operator=(const TraceScope &) = delete;
+
+    ~TraceScope()
+    {
+        if (m_active)
+        {
+            end();
+        }
+    }
+
+private:
+    void begin(const char * category, const char * name, const std::string * detail) noexcept;
+    void end() noexcept;
+
+    const char * m_category = nullptr;
+    const char * m_name     = nullptr;
+    std::string m_detail;
+    double m_start  = 0.;
+    bool m_active   = false;
+};
+
+// Start (or stop, if the filename is empty) writing the trace events to a Chrome trace-event
+// JSON file. The file is completed when it is closed, i.e. at exit or on the next call.
+void SetTraceFile(const std::string & filename);
+
+} // namespace OCIO_NAMESPACE
+
+
+#ifdef OCIO_DISABLE_TRACING
+
+#define OCIO_TRACE_SCOPE(category, name)
+#define OCIO_TRACE_SCOPE_DETAIL(category, name, detail)
+
+#else
+
+#define OCIO_TRACE_CONCAT_IMPL(a, b) a##b
+#define OCIO_TRACE_CONCAT(a, b) OCIO_TRACE_CONCAT_IMPL(a, b)
+
+#define OCIO_TRACE_SCOPE(category, name) \
+    OCIO_NAMESPACE::TraceScope OCIO_TRACE_CONCAT(ocioTraceScope, __LINE__)(category, name)
+
+#define OCIO_TRACE_SCOPE_DETAIL(category, name, detail) \
+    OCIO_NAMESPACE::TraceScope OCIO_TRACE_CONCAT(ocioTraceScope, __LINE__)(category, name, detail)
+
+#endif
+
+#endif // INCLUDED_OCIO_TRACE_H
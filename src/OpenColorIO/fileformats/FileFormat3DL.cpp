@@ -84,6 +84,11 @@ public:
     LocalCachedFile() = default;
     ~LocalCachedFile() = default;
 
+    size_t getMemoryUsage() const override
+    {
+        return GetMemoryUsage(lut1D) + GetMemoryUsage(lut3D);
+    }
+
     Lut1DOpDataRcPtr lut1D;
     Lut3DOpDataRcPtr lut3D;
 };
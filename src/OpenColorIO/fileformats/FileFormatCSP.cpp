@@ -297,6 +297,11 @@ public:
     }
     ~CachedFileCSP() = default;
 
+    size_t getMemoryUsage() const override
+    {
+        return GetMemoryUsage(prelut) + GetMemoryUsage(lut1D) + GetMemoryUsage(lut3D);
+    }
+
     std::string metadata;
 
     double prelut_from_min[3] = { 0.0, 0.0, 0.0 };
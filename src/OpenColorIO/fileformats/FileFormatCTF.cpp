@@ -115,6 +115,16 @@ public:
     };
     ~LocalCachedFile() {};
 
+    size_t getMemoryUsage() const override
+    {
+        size_t size = 0;
+        for (const auto & op : m_transform->getOpDataVec())
+        {
+            size += GetMemoryUsage(op);
+        }
+        return size;
+    }
+
     CTFReaderTransformPtr m_transform;
     std::string m_filePath;
 
@@ -212,20 +222,41 @@ public:
 
     void Parse(std::istream & istream)
     {
-        std::string line;
-        m_lineNumber = 0;
+        // The parser is fed with large blocks of complete lines rather than line by line, which
+        // is much faster for large LUTs. As a block always ends with a newline, a number is
+        // never split between two character data callbacks. Note that the parser tracks the
+        // line numbers.
+        static constexpr size_t BlockSize = 1024 * 1024;
+
+        std::vector<char> buffer(BlockSize);
+        std::string block;
+        std::string remainder;
+
         while (istream.good())
         {
-            std::getline(istream, line);
-            // Add back the newline character. Parsing will copy the line in a
-            // buffer up to the length of the line without the null termination.
-            // Our code will be called back to parse the buffer into a number.
-            // Code uses strtod. The buffer has to be delimited so that strtod
-            // does not access it after its length.
-            line.push_back('\n');
-            ++m_lineNumber;
-
-            Parse(line, !istream.good());
+            istream.read(buffer.data(), BlockSize);
+            const size_t count = static_cast<size_t>(istream.gcount());
+
+            block.swap(remainder);
+            block.append(buffer.data(), count);
+            remainder.clear();
+
+            const bool lastBlock = !istream.good();
+            if (!lastBlock)
+            {
+                // Keep the incomplete last line for the next block.
+                const size_t pos = block.find_last_of('\n');
+                if (pos == std::string::npos)
+                {
+                    block.swap(remainder);
+                    continue;
+                }
+
+                remainder.assign(block, pos + 1, std::string::npos);
+                block.resize(pos + 1);
+            }
+
+            Parse(block, lastBlock);
         }
 
         if (!m_elms.empty())
@@ -252,9 +283,9 @@ public:
         }
     }
 
-    void Parse(const std::string & buffer, bool lastLine)
+    void Parse(const std::string & buffer, bool lastBlock)
     {
-        const int done = lastLine?1:0;
+        const int done = lastBlock?1:0;
 
         if (XML_STATUS_ERROR == XML_Parse(m_parser,
                                           buffer.c_str(),
@@ -345,7 +376,7 @@ private:
         os << "Error parsing CTF/CLF file (";
         os << m_fileName.c_str() << "). ";
         os << "Error is: " << error.c_str();
-        os << ". At line (" << m_lineNumber << ")";
+        os << ". At line (" << getXmLineNumber() << ")";
         throw Exception(os.str().c_str());
     }
 
@@ -528,7 +559,7 @@ private:
                     std::make_shared<CTFReaderMetadataElt>(
                         name,
                         pMD,
-                        pImpl->m_lineNumber,
+                        pImpl->getXmLineNumber(),
                         pImpl->m_fileName));
 
                 pImpl->m_elms.back()->start(atts);
@@ -1206,7 +1237,7 @@ private:
 
     unsigned int getXmLineNumber() const
     {
-        return m_lineNumber;
+        return static_cast<unsigned int>(XML_GetCurrentLineNumber(m_parser));
     }
 
     const std::string & getXmlFilename() const
@@ -1220,7 +1251,6 @@ private:
     }
 
     XML_Parser m_parser;
-    unsigned int m_lineNumber;
     std::string m_fileName;
     bool m_isCLF;
     XmlReaderElementStack m_elms; // Parsing stack
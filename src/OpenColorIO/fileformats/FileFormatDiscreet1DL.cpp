@@ -647,6 +647,11 @@ public:
     };
     ~LocalCachedFile() = default;
 
+    size_t getMemoryUsage() const override
+    {
+        return GetMemoryUsage(lut1D);
+    }
+
     Lut1DOpDataRcPtr lut1D;
 };
 
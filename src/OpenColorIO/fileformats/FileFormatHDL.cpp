@@ -234,6 +234,11 @@ public:
     }
     ~CachedFileHDL() = default;
 
+    size_t getMemoryUsage() const override
+    {
+        return GetMemoryUsage(lut1D) + GetMemoryUsage(lut3D);
+    }
+
     void setLUT1D(const std::vector<float> & values, Interpolation interp)
     {
         auto lutSize = static_cast<unsigned long>(values.size());
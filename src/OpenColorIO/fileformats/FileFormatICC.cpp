@@ -39,6 +39,11 @@ public:
     LocalCachedFile() = default;
     ~LocalCachedFile() = default;
 
+    size_t getMemoryUsage() const override
+    {
+        return GetMemoryUsage(lut);
+    }
+
     // The profile description.
     std::string mProfileDescription;
 
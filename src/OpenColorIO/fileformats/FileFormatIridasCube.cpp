@@ -77,6 +77,11 @@ public:
     LocalCachedFile() = default;
     ~LocalCachedFile() = default;
 
+    size_t getMemoryUsage() const override
+    {
+        return GetMemoryUsage(lut1D) + GetMemoryUsage(lut3D);
+    }
+
     Lut1DOpDataRcPtr lut1D;
     Lut3DOpDataRcPtr lut3D;
     float domain_min[3]{ 0.0f, 0.0f, 0.0f };
@@ -53,6 +53,11 @@ public:
     LocalCachedFile() = default;
     ~LocalCachedFile() = default;
 
+    size_t getMemoryUsage() const override
+    {
+        return GetMemoryUsage(lut3D);
+    }
+
     Lut3DOpDataRcPtr lut3D;
 };
 
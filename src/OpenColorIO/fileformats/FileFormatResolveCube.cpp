@@ -182,6 +182,11 @@ public:
     LocalCachedFile() = default;
     ~LocalCachedFile() = default;
 
+    size_t getMemoryUsage() const override
+    {
+        return GetMemoryUsage(lut1D) + GetMemoryUsage(lut3D);
+    }
+
     Lut1DOpDataRcPtr lut1D;
     float range1d_min = 0.0f;
     float range1d_max = 1.0f;
@@ -43,6 +43,11 @@ public:
     LocalCachedFile() = default;
     ~LocalCachedFile() = default;
 
+    size_t getMemoryUsage() const override
+    {
+        return GetMemoryUsage(lut);
+    }
+
     Lut1DOpDataRcPtr lut;
     float from_min = 0.0f;
     float from_max = 1.0f;
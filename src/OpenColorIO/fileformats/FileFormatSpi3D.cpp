@@ -40,6 +40,11 @@ public:
     LocalCachedFile() = default;
     ~LocalCachedFile() = default;
 
+    size_t getMemoryUsage() const override
+    {
+        return GetMemoryUsage(lut);
+    }
+
     Lut3DOpDataRcPtr lut;
 };
 
@@ -26,6 +26,11 @@ public:
     LocalCachedFile() = default;
     ~LocalCachedFile() = default;
 
+    size_t getMemoryUsage() const override
+    {
+        return GetMemoryUsage(lut3D);
+    }
+
     Lut3DOpDataRcPtr lut3D;
     double m44[16]{ 0 };
     bool useMatrix = false;
@@ -414,58 +414,56 @@ void CTFReaderArrayElt::setRawData(const char * s,
                                    unsigned int/*xmlLine*/)
 {
     const unsigned long maxValues = m_array->getNumValues();
-    size_t pos(0);
 
     //
-    // using GetNextNumber here instead of GetNumbers to leverage the loop
-    // needed here to process each value from the strings.  This function
-    // is the most used when reading in large transforms.
+    // The values are parsed at once and then set at once in the array, instead of
+    // processing each value, as this function is the most used when reading in large
+    // transforms.
     //
 
-    pos = FindNextTokenStart(s, len, 0);
-    while (pos != len)
+    m_values.clear();
+
+    try
+    {
+        AppendNumbers(s, len, m_values);
+    }
+    catch (Exception& /*ce*/)
     {
-        double data(0.);
+        ThrowM(*this, "Illegal values '", TruncateString(s, len),
+               "' in array of ", getTypeName(), ".");
+    }
 
-        try
+    if (m_values.size() > maxValues - m_position)
+    {
+        const CTFReaderOpElt* p = static_cast<const CTFReaderOpElt*>(getParent().get());
+
+        std::ostringstream arg;
+        if (p->getOp()->getType() == OpData::Lut1DType)
         {
-            GetNextNumber(s, len, pos, data);
+            arg << m_array->getLength();
+            arg << "x" << m_array->getNumColorComponents();
         }
-        catch (Exception& /*ce*/)
+        else if (p->getOp()->getType() == OpData::Lut3DType)
         {
-            ThrowM(*this, "Illegal values '", TruncateString(s, len),
-                   "' in array of ", getTypeName(), ".");
+            arg << m_array->getLength() << "x" << m_array->getLength();
+            arg << "x" << m_array->getLength();
+            arg << "x" << m_array->getNumColorComponents();
         }
-
-        if (m_position<maxValues)
+        else  // Matrix
         {
-            m_array->setDoubleValue(m_position++, data);
+            arg << m_array->getLength();
+            arg << "x" << m_array->getLength();
         }
-        else
-        {
-            const CTFReaderOpElt* p = static_cast<const CTFReaderOpElt*>(getParent().get());
 
-            std::ostringstream arg;
-            if (p->getOp()->getType() == OpData::Lut1DType)
-            {
-                arg << m_array->getLength();
-                arg << "x" << m_array->getNumColorComponents();
-            }
-            else if (p->getOp()->getType() == OpData::Lut3DType)
-            {
-                arg << m_array->getLength() << "x" << m_array->getLength();
-                arg << "x" << m_array->getLength();
-                arg << "x" << m_array->getNumColorComponents();
-            }
-            else  // Matrix
-            {
-                arg << m_array->getLength();
-                arg << "x" << m_array->getLength();
-            }
+        ThrowM(*this, "Expected ", arg.str(),
+               " Array, found too many values in array of '", getTypeName(), "'.");
+    }
 
-            ThrowM(*this, "Expected ", arg.str(),
-                   " Array, found too many values in array of '", getTypeName(), "'.");
-        }
+    if (!m_values.empty())
+    {
+        m_array->setDoubleValues(m_position, m_values.data(),
+                                 static_cast<unsigned long>(m_values.size()));
+        m_position += static_cast<unsigned int>(m_values.size());
     }
 }
 
@@ -212,6 +212,9 @@ private:
 
     // The current position to fill.
     unsigned int m_position;
+
+    // The values of the current character data.
+    std::vector<double> m_values;
 };
 
 class CTFArrayMgt
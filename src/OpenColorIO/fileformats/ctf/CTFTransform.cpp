@@ -1,6 +1,10 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <limits>
 #include <sstream>
 #include <regex>
 
@@ -629,18 +633,65 @@ typename std::enable_if<!std::is_floating_point<T>::value, void>::type WriteValu
     stream << value;
 }
 
+// Default width and precision used to write the floating-point values.
+template <typename T>
+struct ValueFormat
+{
+    static constexpr unsigned width     = 11;
+    static constexpr unsigned precision = 8;
+};
+
+template <>
+struct ValueFormat<double>
+{
+    static constexpr unsigned width     = 19;
+    static constexpr unsigned precision = DOUBLE_PRECISION;
+};
+
 template <typename T>
 void SetOStream(T, std::ostream & xml)
 {
-    xml.width(11);
-    xml.precision(8);
+    xml.width(ValueFormat<T>::width);
+    xml.precision(ValueFormat<T>::precision);
 }
 
-template <>
-void SetOStream<double>(double, std::ostream & xml)
+// Format a value in the buffer (like a stream with the precision would do) and return the
+// number of characters.
+template <typename T>
+size_t FormatValue(T value, bool floatValue, unsigned precision, char * buffer, size_t size)
 {
-    xml.width(19);
-    xml.precision(DOUBLE_PRECISION);
+    if (floatValue)
+    {
+        // Same special values as WriteValue().
+        const char * str = nullptr;
+        if (IsNan(value))
+        {
+            str = "nan";
+        }
+        else if (value == std::numeric_limits<T>::infinity())
+        {
+            str = "inf";
+        }
+        else if (value == -std::numeric_limits<T>::infinity())
+        {
+            str = "-inf";
+        }
+
+        if (str)
+        {
+            const size_t len = strlen(str);
+            memcpy(buffer, str, len);
+            return len;
+        }
+    }
+
+    const auto result = NumberUtils::to_chars(buffer, buffer + size, double(value), precision);
+    if (result.ec != std::errc())
+    {
+        throw Exception("CTF/CLF writer: failed to format a value.");
+    }
+
+    return static_cast<size_t>(result.ptr - buffer);
 }
 
 template<typename Iter, typename scaleType>
@@ -655,7 +706,6 @@ void WriteValues(XmlFormatter & formatter,
     // Method used to write an array of values of the same type.
 
     std::ostream & xml = formatter.getStream();
-    std::ostringstream oss;
 
     // The numbers in a CLF/CTF file may always contain fractional values, regardless of the
     // bit-depth attributes.  E.g., even if the bit-depth is 8i, the array could contain values
@@ -664,41 +714,47 @@ void WriteValues(XmlFormatter & formatter,
     // And if the array really does only have integers, it is nicer to print those without
     // decimal points.
 
+    // The default precision of a stream.
+    unsigned precision = 6;
+    size_t width = 0;
+
     switch (bitDepth)
     {
     case BIT_DEPTH_UINT8:
     {
-        oss.width(3);
+        width = 3;
         break;
     }
     case BIT_DEPTH_UINT10:
     {
-        oss.width(4);
+        width = 4;
         break;
     }
 
     case BIT_DEPTH_UINT12:
     {
-        oss.width(4);
+        width = 4;
         break;
     }
 
     case BIT_DEPTH_UINT16:
     {
-        oss.width(5);
+        width = 5;
         break;
     }
 
     case BIT_DEPTH_F16:
     {
-        oss.width(11);
-        oss.precision(5);
+        width = 11;
+        precision = 5;
         break;
     }
 
     case BIT_DEPTH_F32:
     {
-        SetOStream(*valuesBegin, oss);
+        typedef typename std::iterator_traits<Iter>::value_type ValueType;
+        width = ValueFormat<ValueType>::width;
+        precision = ValueFormat<ValueType>::precision;
         break;
     }
 
@@ -718,41 +774,48 @@ void WriteValues(XmlFormatter & formatter,
 
     const bool floatValues = (bitDepth == BIT_DEPTH_F16) || (bitDepth == BIT_DEPTH_F32);
 
+    // The values are formatted in a buffer, written to the stream by large blocks, as going
+    // through the stream for each value is slow for large LUTs.
+    static constexpr size_t BlockSize = 64 * 1024;
+
+    std::string block;
+    block.reserve(BlockSize + 256);
+
+    char value[64];
+
     for (Iter it(valuesBegin); it != valuesEnd; it += iterStep)
     {
-        oss.str("");
+        const size_t length = FormatValue((*it) * scale, floatValues, precision,
+                                          value, sizeof(value));
 
-        if (floatValues)
+        // Right-align the value.
+        if (length < width)
         {
-            WriteValue((*it) * scale, oss);
-        }
-        else
-        {
-            oss << (*it) * scale;
-        }
-
-        const std::string value = oss.str();
-        if (value.length() > (size_t)oss.width())
-        {
-            // The imposed precision requires more characters so the code
-            // recomputes the width to better align the values for the next lines. 
-            oss.width(value.length());
+            block.append(width - length, ' ');
         }
+        block.append(value, length);
 
-        xml << value;
+        // The imposed precision could require more characters so the code
+        // recomputes the width to better align the values for the next lines.
+        width = std::max(width, length);
 
         if (std::distance(valuesBegin, it) % valuesPerLine == valuesPerLine - 1)
         {
-            // std::endln writes a newline and flushes the output buffer where '\n' only
-            // writes a newline. Flushing the buffer for all floats of large LUTs
-            // introduces a huge performance hit so only use '\n'.
-            xml << "\n";
+            block.push_back('\n');
         }
         else
         {
-            xml << " ";
+            block.push_back(' ');
+        }
+
+        if (block.size() >= BlockSize)
+        {
+            xml.write(block.data(), block.size());
+            block.clear();
         }
     }
+
+    xml.write(block.data(), block.size());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
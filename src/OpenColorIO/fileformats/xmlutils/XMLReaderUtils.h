@@ -226,6 +226,49 @@ void GetNextNumber(const char * s, size_t len, size_t & pos, T & num)
     }
 }
 
+// Append the numbers of a string (delimited by spaces, commas or newlines) to the values.
+// That's much faster than GetNextNumber() to read the large arrays of the LUTs.
+inline void AppendNumbers(const char * str, size_t len, std::vector<double> & values)
+{
+    const char * ptr = str;
+    const char * end = str + len;
+
+    while (true)
+    {
+        while (ptr != end && IsNumberDelimiter(*ptr))
+        {
+            ++ptr;
+        }
+
+        if (ptr == end)
+        {
+            break;
+        }
+
+        const char * tokenEnd = ptr;
+        while (tokenEnd != end && !IsNumberDelimiter(*tokenEnd))
+        {
+            ++tokenEnd;
+        }
+
+        double value = 0.;
+        const auto result = NumberUtils::from_chars(ptr, tokenEnd, value);
+
+        if (result.ec == std::errc::invalid_argument || result.ptr != tokenEnd)
+        {
+            std::ostringstream oss;
+            oss << "AppendNumbers: Characters '"
+                << std::string(ptr, tokenEnd - ptr)
+                << "' can not be parsed to numbers in '"
+                << TruncateString(str, len, 100) << "'.";
+            throw Exception(oss.str().c_str());
+        }
+
+        values.push_back(value);
+        ptr = tokenEnd;
+    }
+}
+
 // This method tokenizes a string like "0 1 2" of integers or floats.
 // returns the numbers extracted from the string.
 template<typename T>
@@ -4,12 +4,19 @@
 #ifndef INCLUDED_OCIO_OPARRAY_H
 #define INCLUDED_OCIO_OPARRAY_H
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
 #include <sstream>
+#include <unordered_map>
 #include <vector>
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "HashUtils.h"
 #include "MathUtils.h"
+#include "Mutex.h"
 
 namespace OCIO_NAMESPACE
 {
@@ -20,6 +27,9 @@ public:
     ArrayBase() {}
     virtual ~ArrayBase() {}
     virtual void setDoubleValue(unsigned long index, double value) = 0;
+    // Set the values starting at the index, much faster than setDoubleValue() for each value.
+    virtual void setDoubleValues(unsigned long index, const double * values,
+                                 unsigned long numValues) = 0;
     virtual double getDoubleValue(unsigned long index) = 0;
     virtual unsigned long getLength() const = 0;
     virtual unsigned long getNumColorComponents() const = 0;
@@ -35,6 +45,12 @@ public:
 // other classes. Since the dimensionality of the underlying array of those 
 // classes varies, the interpretation of "length" is defined by child classes.
 // The class represents the array for a 3by1D LUT and a 3D LUT or a matrix.
+//
+// The values are reference counted and copy-on-write i.e. copying an array (and so cloning
+// an op data) only shares the values, which are copied on the first non-const access. Note that
+// a reference returned by a non-const accessor must not be kept across a copy of the array.
+// In addition, intern() shares the values with any other interned array having the same content
+// so that the processors using the same LUT share its memory.
 template<typename T> class ArrayT : public ArrayBase
 {
 public:
@@ -58,7 +74,7 @@ public:
     {
         m_length = length;
         m_numColorComponents = numColorComponents;
-        m_data.resize(getNumValues());
+        editableValues().resize(getNumValues());
     }
 
     void setLength(unsigned long length)
@@ -66,18 +82,28 @@ public:
         if (m_length != length)
         {
             m_length = length;
-            m_data.resize(getNumValues());
+            editableValues().resize(getNumValues());
         }
     }
 
     void setDoubleValue(unsigned long index, double value) override
     {
-        m_data[index] = (T)value;
+        editableValues()[index] = (T)value;
+    }
+
+    void setDoubleValues(unsigned long index, const double * values,
+                         unsigned long numValues) override
+    {
+        T * data = editableValues().data() + index;
+        for (unsigned long idx = 0; idx < numValues; ++idx)
+        {
+            data[idx] = (T)values[idx];
+        }
     }
 
     double getDoubleValue(unsigned long index) override
     {
-        return double(m_data[index]);
+        return double(values()[index]);
     }
 
     unsigned long getLength() const override
@@ -90,7 +116,7 @@ public:
         if (m_numColorComponents != getMaxColorComponents())
         {
             m_numColorComponents = getMaxColorComponents();
-            m_data.resize(getNumValues());
+            editableValues().resize(getNumValues());
         }
     }
 
@@ -104,7 +130,7 @@ public:
         if (m_numColorComponents != numColorComponents)
         {
             m_numColorComponents = numColorComponents;
-            m_data.resize(getNumValues());
+            editableValues().resize(getNumValues());
         }
     }
 
@@ -112,17 +138,19 @@ public:
     {
         if (m_numColorComponents == 3)
         {
+            const Values & data = values();
+
             bool sameCoeff = true;
             for (unsigned long idx = 0; idx < m_length && sameCoeff; ++idx)
             {
-                if (IsNan(m_data[idx * 3]) &&
-                    IsNan(m_data[idx * 3 + 1]) &&
-                    IsNan(m_data[idx * 3 + 2]))
+                if (IsNan(data[idx * 3]) &&
+                    IsNan(data[idx * 3 + 1]) &&
+                    IsNan(data[idx * 3 + 2]))
                 {
                     continue;
                 }
-                if (m_data[idx * 3] != m_data[idx * 3 + 1]
-                    || m_data[idx * 3] != m_data[idx * 3 + 2])
+                if (data[idx * 3] != data[idx * 3 + 1]
+                    || data[idx * 3] != data[idx * 3 + 2])
                 {
                     sameCoeff = false;
                     break;
@@ -143,22 +171,23 @@ public:
 
     inline const Values& getValues() const
     {
-        return m_data;
+        return values();
     }
 
+    // Note that the values are copied if they are shared.
     inline Values& getValues()
     {
-        return m_data;
+        return editableValues();
     }
 
     inline const T& operator[](unsigned long index) const
     {
-        return m_data[index];
+        return values()[index];
     }
 
     inline T& operator[](unsigned long index)
     {
-        return m_data[index];
+        return editableValues()[index];
     }
 
     virtual void validate() const
@@ -170,10 +199,10 @@ public:
 
         // getNumValues is based on the dimensions claimed in the file.  Check
         // that this matches the number of values that were actually set.
-        if (m_data.size() != getNumValues())
+        if (values().size() != getNumValues())
         {
             std::ostringstream os;
-            os << "Array contains: " << m_data.size() << " values, ";
+            os << "Array contains: " << values().size() << " values, ";
             os << "but " << getNumValues() << " are expected.";
             throw Exception(os.str().c_str());
         }
@@ -184,25 +213,153 @@ public:
         if (this == &a) return true;
         return (m_length == a.m_length)
             && (m_numColorComponents == a.m_numColorComponents)
-            && (m_data == a.m_data);
+            && (m_buffer == a.m_buffer || values() == a.values());
     }
 
     void scale(T scale)
     {
         if (scale != (T)1.)
         {
-            const size_t nbVal = m_data.size();
+            Values & data = editableValues();
+
+            const size_t nbVal = data.size();
             for (size_t i = 0; i < nbVal; ++i)
             {
-                m_data[i] *= scale;
+                data[i] *= scale;
             }
         }
     }
 
+    // Share the values with the other interned arrays having the same content, or register them.
+    // The interned values are immutable i.e. a later modification works on a copy.
+    void intern()
+    {
+        if (!m_buffer || m_buffer->m_values.empty() || m_buffer->isInterned())
+        {
+            return;
+        }
+
+        const std::string hash = ComputeHash(m_buffer->m_values);
+
+        Registry & registry = GetRegistry();
+        AutoMutex lock(registry.m_mutex);
+
+        // Another array sharing the same values could have interned them in the meantime.
+        if (m_buffer->isInterned())
+        {
+            return;
+        }
+
+        std::weak_ptr<Buffer> & entry = registry.m_buffers[hash];
+
+        BufferRcPtr existing = entry.lock();
+        if (existing)
+        {
+            // Compare the bits so that the NaNs of a half domain LUT are equal.
+            const Values & v1 = existing->m_values;
+            const Values & v2 = m_buffer->m_values;
+            if (v1.size() == v2.size() && std::memcmp(v1.data(), v2.data(), v1.size() * sizeof(T)) == 0)
+            {
+                m_buffer = existing;
+            }
+            // Otherwise, it's a hash collision so the values are simply not shared.
+            return;
+        }
+
+        m_buffer->m_hash = hash;
+        m_buffer->m_interned.store(true, std::memory_order_release);
+        entry = m_buffer;
+
+        // Remove the entries of the released values from time to time.
+        if (registry.m_buffers.size() > registry.m_pruneSize)
+        {
+            for (auto it = registry.m_buffers.begin(); it != registry.m_buffers.end(); )
+            {
+                it = it->second.expired() ? registry.m_buffers.erase(it) : std::next(it);
+            }
+            registry.m_pruneSize = std::max<size_t>(64, 2 * registry.m_buffers.size());
+        }
+    }
+
+    // Size (in bytes) of the values buffer.
+    size_t getMemoryUsage() const
+    {
+        return m_buffer ? m_buffer->m_values.capacity() * sizeof(T) : 0;
+    }
+
+    // Return the hash of the values (cached for the interned values).
+    std::string getContentHash() const
+    {
+        if (m_buffer && m_buffer->isInterned())
+        {
+            return m_buffer->m_hash;
+        }
+        return ComputeHash(values());
+    }
+
 protected:
     unsigned long m_length;
     unsigned long m_numColorComponents;
-    Values        m_data;
+
+private:
+    struct Buffer
+    {
+        Buffer() = default;
+        explicit Buffer(const Values & values) : m_values(values) { }
+
+        bool isInterned() const { return m_interned.load(std::memory_order_acquire); }
+
+        Values m_values;
+        // Only valid once interned.
+        std::string m_hash;
+        std::atomic<bool> m_interned{ false };
+    };
+    typedef std::shared_ptr<Buffer> BufferRcPtr;
+
+    struct Registry
+    {
+        Mutex m_mutex;
+        std::unordered_map<std::string, std::weak_ptr<Buffer>> m_buffers;
+        size_t m_pruneSize = 64;
+    };
+
+    static Registry & GetRegistry()
+    {
+        static Registry registry;
+        return registry;
+    }
+
+    static std::string ComputeHash(const Values & values)
+    {
+        return CacheIDHash(reinterpret_cast<const char *>(values.data()),
+                           values.size() * sizeof(T));
+    }
+
+    inline const Values & values() const
+    {
+        static const Values empty;
+        return m_buffer ? m_buffer->m_values : empty;
+    }
+
+    Values & editableValues()
+    {
+        if (!m_buffer)
+        {
+            m_buffer = std::make_shared<Buffer>();
+        }
+        else if (m_buffer.use_count() > 1 || m_buffer->isInterned())
+        {
+            m_buffer = std::make_shared<Buffer>(m_buffer->m_values);
+        }
+        else
+        {
+            // Synchronize with the release of the values by the other owners.
+            std::atomic_thread_fence(std::memory_order_acquire);
+        }
+        return m_buffer->m_values;
+    }
+
+    BufferRcPtr m_buffer;
 };
 
 typedef ArrayT<double> ArrayDouble;
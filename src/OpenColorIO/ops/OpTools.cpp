@@ -5,6 +5,7 @@
 
 #include "BitDepthUtils.h"
 #include "ops/OpTools.h"
+#include "ParallelUtils.h"
 
 namespace OCIO_NAMESPACE
 {
@@ -30,11 +31,25 @@ void EvalTransform(const float * in,
     ops.finalize();
     ops.optimize(OPTIMIZATION_NONE);
 
+    // Create the renderers only once, they are then shared by all the threads.
+    std::vector<ConstOpCPURcPtr> cpuOps;
+    cpuOps.reserve(ops.size());
     for (OpRcPtrVec::size_type i = 0, size = ops.size(); i<size; ++i)
     {
-        ops[i]->apply(&tmp[0], &tmp[0], numPixels);
+        cpuOps.push_back(ops[i]->getCPUOp(false));
     }
 
+    // Some renderers (e.g. the exact inverse of a Lut3D) are expensive so the pixels are
+    // processed in parallel when there are enough of them.
+    ParallelFor(numPixels, 4096, [&cpuOps, &tmp](long begin, long end)
+    {
+        float * pixels = &tmp[4 * begin];
+        for (const auto & cpuOp : cpuOps)
+        {
+            cpuOp->apply(pixels, pixels, end - begin);
+        }
+    });
+
     float * result = out;
     for (long idx = 0; idx<numPixels; ++idx)
     {
@@ -8,6 +8,7 @@
 
 #include "BitDepthUtils.h"
 #include "DynamicProperty.h"
+#include "FastLogExpPowCPU.h"
 #include "ops/exposurecontrast/ExposureContrastOpCPU.h"
 #include "SSE.h"
 
@@ -32,6 +33,12 @@ public:
 protected:
     virtual void updateData(ConstExposureContrastOpDataRcPtr & ec) = 0;
 
+    // Apply out = pow( max(in * inScale, 0), exponent ) * outScale to the RGB channels.
+    void applyPower(const float * in, float * out, long numPixels,
+                    float inScale, float exponent, float outScale) const;
+
+    FastLogExpPowFunc * m_applyPowerFunc = nullptr;
+
     DynamicPropertyDoubleImplRcPtr m_exposure;
     DynamicPropertyDoubleImplRcPtr m_contrast;
     DynamicPropertyDoubleImplRcPtr m_gamma;
@@ -42,6 +49,7 @@ protected:
 
 ECRendererBase::ECRendererBase(ConstExposureContrastOpDataRcPtr & ec)
     : OpCPU()
+    , m_applyPowerFunc(GetFastLogExpPowFunc(FAST_POWER))
 {
     // Initialized with the instances from the processor and decouple them.
     m_exposure = ec->getExposureProperty();
@@ -65,6 +73,36 @@ ECRendererBase::~ECRendererBase()
 {
 }
 
+void ECRendererBase::applyPower(const float * in, float * out, long numPixels,
+                                float inScale, float exponent, float outScale) const
+{
+    if (m_applyPowerFunc)
+    {
+        FastLogExpPowParams params;
+        for (int c = 0; c < 3; ++c)
+        {
+            params.m_inScale[c]  = inScale;
+            params.m_exponent[c] = exponent;
+            params.m_outScale[c] = outScale;
+        }
+
+        m_applyPowerFunc(params, in, out, numPixels);
+        return;
+    }
+
+    for (long idx = 0; idx<numPixels; ++idx)
+    {
+        // Note: With std::max NAN becomes 0.
+        out[0] = powf(std::max(0.0f, in[0] * inScale), exponent) * outScale;
+        out[1] = powf(std::max(0.0f, in[1] * inScale), exponent) * outScale;
+        out[2] = powf(std::max(0.0f, in[2] * inScale), exponent) * outScale;
+        out[3] = in[3];
+
+        in += 4;
+        out += 4;
+    }
+}
+
 bool ECRendererBase::isDynamic() const
 {
     return m_exposure->isDynamic() || m_contrast->isDynamic() || m_gamma->isDynamic();
@@ -182,55 +220,10 @@ void ECLinearRenderer::apply(const void * inImg, void * outImg, long numPixels)
     }
     else
     {
-#if OCIO_USE_SSE2
-        __m128 contrast = _mm_set1_ps(contrastVal);
-        __m128 exposure_over_pivot = _mm_set1_ps(exposureVal / m_pivot);
-        __m128 piv = _mm_set1_ps(m_pivot);
-        for (long idx = 0; idx<numPixels; ++idx)
-        {
-            const float outAlpha = in[3];
-            __m128 data = _mm_set_ps(in[3],
-                                     in[2],
-                                     in[1],
-                                     in[0]);
-
-            //
-            // out = powf( i * exposure / pivot, contrast ) * pivot
-            //
-            _mm_storeu_ps(out,
-                _mm_mul_ps(
-                    ssePower(
-                        _mm_mul_ps(
-                            data,
-                            exposure_over_pivot),
-                        contrast),
-                    piv));
-            out[3] = outAlpha;
-
-            in += 4;
-            out += 4;
-        }
-#else
-        const float exposureOverPivotVal = exposureVal / m_pivot;
-        for (long idx = 0; idx<numPixels; ++idx)
-        {
-
-            //
-            // out = powf( i * exposure / iPivot, contrast ) * oPivot
-            //
-            // Note: With std::max NAN becomes 0.
-            out[0] = powf(std::max(0.0f, in[0] * exposureOverPivotVal),
-                           contrastVal) * m_pivot;
-            out[1] = powf(std::max(0.0f, in[1] * exposureOverPivotVal),
-                           contrastVal) * m_pivot;
-            out[2] = powf(std::max(0.0f, in[2] * exposureOverPivotVal),
-                           contrastVal) * m_pivot;
-            out[3] = in[3];
-
-            in += 4;
-            out += 4;
-        }
-#endif
+        //
+        // out = powf( i * exposure / pivot, contrast ) * pivot
+        //
+        applyPower(in, out, numPixels, exposureVal / m_pivot, contrastVal, m_pivot);
     }
 }
 
@@ -282,61 +275,10 @@ void ECLinearRevRenderer::apply(const void * inImg, void * outImg, long numPixel
     }
     else
     {
-#if OCIO_USE_SSE2
-        __m128 inv_contrast = _mm_set1_ps(invContrastVal);
-
-        const float pivotOverExposureVal = m_pivot * invExposureVal;
-        const float invPivotVal = 1.f / m_pivot;
-
-        __m128 pivot_over_exposure = _mm_set1_ps(pivotOverExposureVal);
-        __m128 inv_pivot = _mm_set1_ps(invPivotVal);
-
-        for (long idx = 0; idx<numPixels; ++idx)
-        {
-            const float outAlpha = in[3];
-            __m128 data = _mm_set_ps(in[3],
-                                     in[2],
-                                     in[1],
-                                     in[0]);
-
-            //
-            // out = powf( i / pivot, 1 / contrast ) * pivot / exposure
-            //
-            _mm_storeu_ps(out,
-                _mm_mul_ps(
-                    ssePower(
-                        _mm_mul_ps(
-                            data,
-                            inv_pivot),
-                        inv_contrast),
-                    pivot_over_exposure));
-
-            out[3] = outAlpha;
-
-            in += 4;
-            out += 4;
-        }
-#else
-        const float pivotOverExposureVal = m_pivot * invExposureVal;
-        const float invPivotVal = 1.f / m_pivot;
-
-        for (long idx = 0; idx<numPixels; ++idx)
-        {
-            //
-            // out = powf( i / pivot, 1 / contrast ) * pivot / exposure
-            //
-            out[0] = powf(std::max(0.0f, in[0] * invPivotVal),
-                           invContrastVal) * pivotOverExposureVal;
-            out[1] = powf(std::max(0.0f, in[1] * invPivotVal),
-                           invContrastVal) * pivotOverExposureVal;
-            out[2] = powf(std::max(0.0f, in[2] * invPivotVal),
-                           invContrastVal) * pivotOverExposureVal;
-            out[3] = in[3];
-
-            in += 4;
-            out += 4;
-        }
-#endif
+        //
+        // out = powf( i / pivot, 1 / contrast ) * pivot / exposure
+        //
+        applyPower(in, out, numPixels, 1.f / m_pivot, invContrastVal, m_pivot * invExposureVal);
     }
 }
 
@@ -392,53 +334,10 @@ void ECVideoRenderer::apply(const void * inImg, void * outImg, long numPixels) c
     }
     else
     {
-#if OCIO_USE_SSE2
-        __m128 contrast = _mm_set1_ps(contrastVal);
-        __m128 exposure_over_pivot = _mm_set1_ps(exposureVal / m_pivot);
-        __m128 piv = _mm_set1_ps(m_pivot);
-        for (long idx = 0; idx<numPixels; ++idx)
-        {
-            const float outAlpha = in[3];
-            __m128 data = _mm_set_ps(in[3],
-                                     in[2],
-                                     in[1],
-                                     in[0]);
-
-            //
-            // out = powf( i * exposure / pivot, contrast ) * pivot
-            //
-            _mm_storeu_ps(out,
-                _mm_mul_ps(
-                    ssePower(
-                        _mm_mul_ps(
-                            data,
-                            exposure_over_pivot),
-                        contrast),
-                    piv));
-            out[3] = outAlpha;
-
-            in += 4;
-            out += 4;
-        }
-#else
-        const float exposureOverPivotVal = exposureVal / m_pivot;
-        for (long idx = 0; idx<numPixels; ++idx)
-        {
-            //
-            // out = powf( i * exposure / pivot, contrast ) * pivot
-            //
-            out[0] = powf(std::max(0.0f, in[0] * exposureOverPivotVal),
-                           contrastVal) * m_pivot;
-            out[1] = powf(std::max(0.0f, in[1] * exposureOverPivotVal),
-                           contrastVal) * m_pivot;
-            out[2] = powf(std::max(0.0f, in[2] * exposureOverPivotVal),
-                           contrastVal) * m_pivot;
-            out[3] = in[3];
-
-            in += 4;
-            out += 4;
-        }
-#endif
+        //
+        // out = powf( i * exposure / pivot, contrast ) * pivot
+        //
+        applyPower(in, out, numPixels, exposureVal / m_pivot, contrastVal, m_pivot);
     }
 }
 
@@ -497,53 +396,10 @@ void ECVideoRevRenderer::apply(const void * inImg, void * outImg, long numPixels
     }
     else
     {
-#if OCIO_USE_SSE2
-        __m128 inv_contrast = _mm_set1_ps(invContrastVal);
-        __m128 pivot_over_exposure = _mm_set1_ps(pivotOverExposureVal);
-        __m128 inv_pivot = _mm_set1_ps(invPivotVal);
-
-        for (long idx = 0; idx<numPixels; ++idx)
-        {
-            const float outAlpha = in[3];
-            __m128 data = _mm_set_ps(in[3],
-                                     in[2],
-                                     in[1],
-                                     in[0]);
-
-            //
-            // out = powf( i / pivot, 1 / contrast ) * pivot / exposure
-            //
-            _mm_storeu_ps(out,
-                _mm_mul_ps(
-                    ssePower(
-                        _mm_mul_ps(
-                            data,
-                            inv_pivot),
-                        inv_contrast),
-                    pivot_over_exposure));
-            out[3] = outAlpha;
-
-            in += 4;
-            out += 4;
-        }
-#else
-        for (long idx = 0; idx<numPixels; ++idx)
-        {
-            //
-            // out = powf( i / pivot, 1 / contrast ) * pivot / exposure
-            //
-            out[0] = powf(std::max(0.0f, in[0] * invPivotVal),
-                           invContrastVal) * pivotOverExposureVal;
-            out[1] = powf(std::max(0.0f, in[1] * invPivotVal),
-                           invContrastVal) * pivotOverExposureVal;
-            out[2] = powf(std::max(0.0f, in[2] * invPivotVal),
-                           invContrastVal) * pivotOverExposureVal;
-            out[3] = in[3];
-
-            in += 4;
-            out += 4;
-        }
-#endif
+        //
+        // out = powf( i / pivot, 1 / contrast ) * pivot / exposure
+        //
+        applyPower(in, out, numPixels, invPivotVal, invContrastVal, pivotOverExposureVal);
     }
 }
 
@@ -28,7 +28,7 @@ void AddUniform(GpuShaderCreatorRcPtr & shaderCreator,
                                                         prop.get());
     shaderCreator->addUniform(name.c_str(), getDouble);
     // Declare uniform.
-    GpuShaderText stDecl(shaderCreator->getLanguage());
+    GpuShaderText stDecl(shaderCreator->getLanguage(), UseUniformBlock(*shaderCreator));
     stDecl.declareUniformFloat(name);
     shaderCreator->addToParameterDeclareShaderCode(stDecl.string().c_str());
 }
@@ -7,6 +7,7 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "FastLogExpPowCPU.h"
 #include "ops/gamma/GammaOpCPU.h"
 #include "ops/gamma/GammaOpUtils.h"
 
@@ -33,6 +34,9 @@ public:
 protected:
     void update(ConstGammaOpDataRcPtr & gamma);
 
+    // Parameters of the fast power kernels.
+    FastLogExpPowParams getFastPowerParams() const;
+
 protected:
     float m_redGamma;
     float m_grnGamma;
@@ -46,10 +50,16 @@ class GammaBasicOpCPUSSE : public GammaBasicOpCPU
 public:
     explicit GammaBasicOpCPUSSE(ConstGammaOpDataRcPtr & gamma)
         : GammaBasicOpCPU(gamma)
+        , m_params(getFastPowerParams())
+        , m_applyFunc(GetFastLogExpPowFunc(FAST_POWER))
     {
     }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+private:
+    FastLogExpPowParams m_params;
+    FastLogExpPowFunc * m_applyFunc = nullptr;
 };
 #endif
 
@@ -69,10 +79,16 @@ class GammaBasicMirrorOpCPUSSE : public GammaBasicMirrorOpCPU
 public:
     explicit GammaBasicMirrorOpCPUSSE(ConstGammaOpDataRcPtr & gamma)
         : GammaBasicMirrorOpCPU(gamma)
+        , m_params(getFastPowerParams())
+        , m_applyFunc(GetFastLogExpPowFunc(FAST_POWER_MIRROR))
     {
     }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+private:
+    FastLogExpPowParams m_params;
+    FastLogExpPowFunc * m_applyFunc = nullptr;
 };
 #endif
 
@@ -92,10 +108,16 @@ class GammaBasicPassThruOpCPUSSE : public GammaBasicPassThruOpCPU
 public:
     explicit GammaBasicPassThruOpCPUSSE(ConstGammaOpDataRcPtr & gamma)
         : GammaBasicPassThruOpCPU(gamma)
+        , m_params(getFastPowerParams())
+        , m_applyFunc(GetFastLogExpPowFunc(FAST_POWER_PASS_THRU))
     {
     }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+private:
+    FastLogExpPowParams m_params;
+    FastLogExpPowFunc * m_applyFunc = nullptr;
 };
 #endif
 
@@ -317,25 +339,31 @@ void GammaBasicOpCPU::update(ConstGammaOpDataRcPtr & gamma)
     m_alpGamma = (float)(forward ? gamma->getAlphaParams()[0] : 1. / gamma->getAlphaParams()[0]);
 }
 
-#if OCIO_USE_SSE2
-void GammaBasicOpCPUSSE::apply(const void * inImg, void * outImg, long numPixels) const
+FastLogExpPowParams GammaBasicOpCPU::getFastPowerParams() const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
-    const __m128 gamma = _mm_set_ps(m_alpGamma, m_bluGamma, m_grnGamma, m_redGamma);
+    FastLogExpPowParams params;
 
-    for(long idx=0; idx<numPixels; ++idx)
-    {
-        __m128 pixel = _mm_set_ps(in[3], in[2], in[1], in[0]);
+    params.m_exponent[0] = m_redGamma;
+    params.m_exponent[1] = m_grnGamma;
+    params.m_exponent[2] = m_bluGamma;
+    params.m_exponent[3] = m_alpGamma;
 
-        pixel = ssePower(pixel, gamma);
+    // The alpha channel is also processed.
+    params.m_keepAlpha = false;
 
-        _mm_storeu_ps(out, pixel);
+    return params;
+}
 
-        in  += 4;
-        out += 4;
+#if OCIO_USE_SSE2
+void GammaBasicOpCPUSSE::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    if (!m_applyFunc)
+    {
+        GammaBasicOpCPU::apply(inImg, outImg, numPixels);
+        return;
     }
+
+    m_applyFunc(m_params, (const float *)inImg, (float *)outImg, numPixels);
 }
 #endif // OCIO_USE_SSE2
 
@@ -369,25 +397,13 @@ GammaBasicMirrorOpCPU::GammaBasicMirrorOpCPU(ConstGammaOpDataRcPtr & gamma)
 #if OCIO_USE_SSE2
 void GammaBasicMirrorOpCPUSSE::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
-    const __m128 gamma = _mm_set_ps(m_alpGamma, m_bluGamma, m_grnGamma, m_redGamma);
-
-    for (long idx = 0; idx<numPixels; ++idx)
+    if (!m_applyFunc)
     {
-        __m128 pixel = _mm_set_ps(in[3], in[2], in[1], in[0]);
-        __m128 sign_pix = _mm_and_ps(pixel, ESIGN_MASK);
-        __m128 abs_pix = _mm_and_ps(pixel, EABS_MASK);
-
-        pixel = ssePower(abs_pix, gamma);
-        pixel = _mm_or_ps(sign_pix, pixel);
-
-        _mm_storeu_ps(out, pixel);
-
-        in += 4;
-        out += 4;
+        GammaBasicMirrorOpCPU::apply(inImg, outImg, numPixels);
+        return;
     }
+
+    m_applyFunc(m_params, (const float *)inImg, (float *)outImg, numPixels);
 }
 #endif
 
@@ -421,29 +437,13 @@ GammaBasicPassThruOpCPU::GammaBasicPassThruOpCPU(ConstGammaOpDataRcPtr & gamma)
 #if OCIO_USE_SSE2
 void GammaBasicPassThruOpCPUSSE::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
-    const __m128 gamma = _mm_set_ps(m_alpGamma, m_bluGamma, m_grnGamma, m_redGamma);
-    const __m128 breakPnt = _mm_set_ps(0.0, 0.f, 0.f, 0.f);
-
-    for (long idx = 0; idx<numPixels; ++idx)
+    if (!m_applyFunc)
     {
-        __m128 pixel = _mm_set_ps(in[3], in[2], in[1], in[0]);
-        __m128 data = pixel;
-
-        data = ssePower(data, gamma);
-
-        __m128 flag = _mm_cmpgt_ps(pixel, breakPnt);
-
-        data = _mm_or_ps(_mm_and_ps(flag, data),
-                         _mm_andnot_ps(flag, pixel));
-
-        _mm_storeu_ps(out, data);
-
-        in += 4;
-        out += 4;
+        GammaBasicPassThruOpCPU::apply(inImg, outImg, numPixels);
+        return;
     }
+
+    m_applyFunc(m_params, (const float *)inImg, (float *)outImg, numPixels);
 }
 #endif
 
@@ -93,7 +93,7 @@ void AddUniform(GpuShaderCreatorRcPtr & shaderCreator,
     if (shaderCreator->addUniform(name.c_str(), getSize, getVector, maxSize))
     {
         // Declare uniform.
-        GpuShaderText stDecl(shaderCreator->getLanguage());
+        GpuShaderText stDecl(shaderCreator->getLanguage(), UseUniformBlock(*shaderCreator));
         stDecl.declareUniformArrayFloat(name, maxSize);
         shaderCreator->addToParameterDeclareShaderCode(stDecl.string().c_str());
     }
@@ -111,7 +111,7 @@ void AddUniform(GpuShaderCreatorRcPtr & shaderCreator,
     if (shaderCreator->addUniform(name.c_str(), getSize, getVector, arrayLen))
     {
         // Declare uniform.
-        GpuShaderText stDecl(shaderCreator->getLanguage());
+        GpuShaderText stDecl(shaderCreator->getLanguage(), UseUniformBlock(*shaderCreator));
         // Need 2 ints for each curve.
         stDecl.declareUniformArrayInt(name, arrayLen);
         shaderCreator->addToParameterDeclareShaderCode(stDecl.string().c_str());
@@ -126,7 +126,7 @@ void AddUniform(GpuShaderCreatorRcPtr & shaderCreator,
     if (shaderCreator->addUniform(name.c_str(), getBool))
     {
         // Declare uniform.
-        GpuShaderText stDecl(shaderCreator->getLanguage());
+        GpuShaderText stDecl(shaderCreator->getLanguage(), UseUniformBlock(*shaderCreator));
         stDecl.declareUniformBool(name);
         shaderCreator->addToParameterDeclareShaderCode(stDecl.string().c_str());
     }
@@ -40,7 +40,7 @@ void AddUniform(GpuShaderCreatorRcPtr & shaderCreator,
     if (shaderCreator->addUniform(name.c_str(), getter))
     {
         // Declare uniform.
-        GpuShaderText stDecl(shaderCreator->getLanguage());
+        GpuShaderText stDecl(shaderCreator->getLanguage(), UseUniformBlock(*shaderCreator));
         stDecl.declareUniformFloat(name);
         shaderCreator->addToParameterDeclareShaderCode(stDecl.string().c_str());
     }
@@ -54,7 +54,7 @@ void AddBoolUniform(GpuShaderCreatorRcPtr & shaderCreator,
     if (shaderCreator->addUniform(name.c_str(), getBool))
     {
         // Declare uniform.
-        GpuShaderText stDecl(shaderCreator->getLanguage());
+        GpuShaderText stDecl(shaderCreator->getLanguage(), UseUniformBlock(*shaderCreator));
         stDecl.declareUniformBool(name);
         shaderCreator->addToParameterDeclareShaderCode(stDecl.string().c_str());
     }
@@ -68,7 +68,7 @@ void AddUniform(GpuShaderCreatorRcPtr & shaderCreator,
     if (shaderCreator->addUniform(name.c_str(), getter))
     {
         // Declare uniform.
-        GpuShaderText stDecl(shaderCreator->getLanguage());
+        GpuShaderText stDecl(shaderCreator->getLanguage(), UseUniformBlock(*shaderCreator));
         stDecl.declareUniformFloat3(name);
         shaderCreator->addToParameterDeclareShaderCode(stDecl.string().c_str());
     }
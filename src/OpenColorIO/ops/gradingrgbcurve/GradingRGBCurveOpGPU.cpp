@@ -89,7 +89,7 @@ void AddUniform(GpuShaderCreatorRcPtr & shaderCreator,
     if (shaderCreator->addUniform(name.c_str(), getSize, getVector, maxSize))
     {
         // Declare uniform.
-        GpuShaderText stDecl(shaderCreator->getLanguage());
+        GpuShaderText stDecl(shaderCreator->getLanguage(), UseUniformBlock(*shaderCreator));
         stDecl.declareUniformArrayFloat(name, maxSize);
         shaderCreator->addToParameterDeclareShaderCode(stDecl.string().c_str());
     }
@@ -107,7 +107,7 @@ void AddUniform(GpuShaderCreatorRcPtr & shaderCreator,
     if (shaderCreator->addUniform(name.c_str(), getSize, getVector, arrayLen))
     {
         // Declare uniform.
-        GpuShaderText stDecl(shaderCreator->getLanguage());
+        GpuShaderText stDecl(shaderCreator->getLanguage(), UseUniformBlock(*shaderCreator));
         // Need 2 ints for each RGBM curve.
         stDecl.declareUniformArrayInt(name, arrayLen);
         shaderCreator->addToParameterDeclareShaderCode(stDecl.string().c_str());
@@ -122,7 +122,7 @@ void AddUniform(GpuShaderCreatorRcPtr & shaderCreator,
     if (shaderCreator->addUniform(name.c_str(), getBool))
     {
         // Declare uniform.
-        GpuShaderText stDecl(shaderCreator->getLanguage());
+        GpuShaderText stDecl(shaderCreator->getLanguage(), UseUniformBlock(*shaderCreator));
         stDecl.declareUniformBool(name);
         shaderCreator->addToParameterDeclareShaderCode(stDecl.string().c_str());
     }
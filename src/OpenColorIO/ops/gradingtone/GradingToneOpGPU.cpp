@@ -64,7 +64,7 @@ void AddUniform(GpuShaderCreatorRcPtr & shaderCreator,
     if (shaderCreator->addUniform(name.c_str(), getter))
     {
         // Declare uniform.
-        GpuShaderText stDecl(shaderCreator->getLanguage());
+        GpuShaderText stDecl(shaderCreator->getLanguage(), UseUniformBlock(*shaderCreator));
         stDecl.declareUniformFloat(name);
         shaderCreator->addToParameterDeclareShaderCode(stDecl.string().c_str());
     }
@@ -78,7 +78,7 @@ void AddBoolUniform(GpuShaderCreatorRcPtr & shaderCreator,
     if (shaderCreator->addUniform(name.c_str(), getBool))
     {
         // Declare uniform.
-        GpuShaderText stDecl(shaderCreator->getLanguage());
+        GpuShaderText stDecl(shaderCreator->getLanguage(), UseUniformBlock(*shaderCreator));
         stDecl.declareUniformBool(name);
         shaderCreator->addToParameterDeclareShaderCode(stDecl.string().c_str());
     }
@@ -11,6 +11,7 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "FastLogExpPowCPU.h"
 #include "MathUtils.h"
 #include "ops/log/LogOpCPU.h"
 #include "ops/log/LogUtils.h"
@@ -73,6 +74,10 @@ public:
     explicit Log2LinRendererSSE(ConstLogOpDataRcPtr & log);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+protected:
+    FastLogExpPowParams m_params;
+    FastLogExpPowFunc * m_applyFunc = nullptr;
 };
 #endif
 
@@ -100,6 +105,10 @@ public:
     explicit Lin2LogRendererSSE(ConstLogOpDataRcPtr & log);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+protected:
+    FastLogExpPowParams m_params;
+    FastLogExpPowFunc * m_applyFunc = nullptr;
 };
 #endif
 
@@ -193,6 +202,10 @@ public:
     explicit LogRendererSSE(ConstLogOpDataRcPtr & log, float logScale);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+protected:
+    FastLogExpPowParams m_params;
+    FastLogExpPowFunc * m_applyFunc = nullptr;
 };
 #endif
 
@@ -215,6 +228,10 @@ public:
     explicit AntiLogRendererSSE(ConstLogOpDataRcPtr & log, float log2base);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+protected:
+    FastLogExpPowParams m_params;
+    FastLogExpPowFunc * m_applyFunc = nullptr;
 };
 #endif
 
@@ -416,38 +433,27 @@ void LogRenderer::apply(const void * inImg, void * outImg, long numPixels) const
 #if OCIO_USE_SSE2
 LogRendererSSE::LogRendererSSE(ConstLogOpDataRcPtr & log, float logScale)
     : LogRenderer(log, logScale)
-{
-}
-void LogRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
 {
     //
     // out = log2( max(in, minValue) ) * logScale;
     //
-    static constexpr float minValue = std::numeric_limits<float>::min();
-
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
-    const __m128 mm_minValue = _mm_set1_ps(minValue);
-    const __m128 mm_logScale = _mm_set1_ps(m_logScale);
-
-    __m128 mm_pixel;
-
-    for (long idx = 0; idx<numPixels; ++idx)
+    for (int c = 0; c < 3; ++c)
     {
-        mm_pixel = _mm_set_ps(0.0f, in[2], in[1], in[0]);
-        mm_pixel = _mm_max_ps(mm_pixel, mm_minValue);
-        mm_pixel = sseLog2(mm_pixel);
-        mm_pixel = _mm_mul_ps(mm_pixel, mm_logScale);
-
-        const float alphares = in[3];
+        m_params.m_outScale[c] = logScale;
+    }
 
-        _mm_storeu_ps(out, mm_pixel);
-        out[3] = alphares;
+    m_applyFunc = GetFastLogExpPowFunc(FAST_LOG2);
+}
 
-        in  += 4;
-        out += 4;
+void LogRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    if (!m_applyFunc)
+    {
+        LogRenderer::apply(inImg, outImg, numPixels);
+        return;
     }
+
+    m_applyFunc(m_params, (const float *)inImg, (float *)outImg, numPixels);
 }
 #endif
 
@@ -484,10 +490,6 @@ void AntiLogRenderer::apply(const void * inImg, void * outImg, long numPixels) c
 #if OCIO_USE_SSE2
 AntiLogRendererSSE::AntiLogRendererSSE(ConstLogOpDataRcPtr & log, float log2base)
     : AntiLogRenderer(log, log2base)
-{
-}
-
-void AntiLogRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
 {
     //
     // out = pow(base, in);
@@ -496,27 +498,23 @@ void AntiLogRendererSSE::apply(const void * inImg, void * outImg, long numPixels
     //   out = exp2( log2(base) * in);
     //   so that the constant factor log2(base) can be moved outside the loop.
     //
-
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
-    const __m128 mm_log2_base = _mm_set1_ps(m_log2_base);
-
-    __m128 mm_pixel;
-
-    for (long idx = 0; idx<numPixels; ++idx)
+    for (int c = 0; c < 3; ++c)
     {
-        mm_pixel = _mm_set_ps(0.0f, in[2], in[1], in[0]);
-        mm_pixel = sseExp2(_mm_mul_ps(mm_pixel, mm_log2_base));
-
-        const float alphares = in[3];
+        m_params.m_inScale[c] = log2base;
+    }
 
-        _mm_storeu_ps(out, mm_pixel);
-        out[3] = alphares;
+    m_applyFunc = GetFastLogExpPowFunc(FAST_EXP2);
+}
 
-        in  += 4;
-        out += 4;
+void AntiLogRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    if (!m_applyFunc)
+    {
+        AntiLogRenderer::apply(inImg, outImg, numPixels);
+        return;
     }
+
+    m_applyFunc(m_params, (const float *)inImg, (float *)outImg, numPixels);
 }
 #endif
 
@@ -574,11 +572,6 @@ void Log2LinRenderer::apply(const void * inImg, void * outImg, long numPixels) c
 #if OCIO_USE_SSE2
 Log2LinRendererSSE::Log2LinRendererSSE(ConstLogOpDataRcPtr & log)
     : Log2LinRenderer(log)
-{
-
-}
-
-void Log2LinRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
 {
     //
     // out = ( pow( base, (in - logOffset) / logSlope ) - linOffset ) / linSlope;
@@ -589,34 +582,26 @@ void Log2LinRendererSSE::apply(const void * inImg, void * outImg, long numPixels
     //   pow(base, exponent) = exp2( log2(base) * exponent )
     //   so that the constant factor log2(base) can be moved outside the loop.
     //
-
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
-    const __m128 mm_kinv = _mm_set_ps(0.0f, m_kinv[2], m_kinv[1], m_kinv[0]);
-    const __m128 mm_minuskb = _mm_set_ps(0.0f, m_minuskb[2], m_minuskb[1], m_minuskb[0]);
-    const __m128 mm_minusb = _mm_set_ps(0.0f, m_minusb[2], m_minusb[1], m_minusb[0]);
-    const __m128 mm_minv = _mm_set_ps(0.0f, m_minv[2], m_minv[1], m_minv[0]);
-
-    __m128 mm_pixel;
-
-    for (long idx = 0; idx < numPixels; ++idx)
+    for (int c = 0; c < 3; ++c)
     {
-        mm_pixel = _mm_set_ps(0.0f, in[2], in[1], in[0]);
-        mm_pixel = _mm_add_ps(mm_pixel, mm_minuskb);
-        mm_pixel = _mm_mul_ps(mm_pixel, mm_kinv);
-        mm_pixel = sseExp2(mm_pixel);
-        mm_pixel = _mm_add_ps(mm_pixel, mm_minusb);
-        mm_pixel = _mm_mul_ps(mm_pixel, mm_minv);
-
-        const float alphares = in[3];
+        m_params.m_inScale[c]   = m_kinv[c];
+        m_params.m_inOffset[c]  = m_minuskb[c] * m_kinv[c];
+        m_params.m_outScale[c]  = m_minv[c];
+        m_params.m_outOffset[c] = m_minusb[c] * m_minv[c];
+    }
 
-        _mm_storeu_ps(out, mm_pixel);
-        out[3] = alphares;
+    m_applyFunc = GetFastLogExpPowFunc(FAST_EXP2);
+}
 
-        out += 4;
-        in  += 4;
+void Log2LinRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    if (!m_applyFunc)
+    {
+        Log2LinRenderer::apply(inImg, outImg, numPixels);
+        return;
     }
+
+    m_applyFunc(m_params, (const float *)inImg, (float *)outImg, numPixels);
 }
 #endif
 
@@ -676,47 +661,31 @@ void Lin2LogRenderer::apply(const void * inImg, void * outImg, long numPixels) c
 #if OCIO_USE_SSE2
 Lin2LogRendererSSE::Lin2LogRendererSSE(ConstLogOpDataRcPtr & log)
     : Lin2LogRenderer(log)
-{
-}
-
-void Lin2LogRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
 {
     // out = ( logSlope * log( base, max( minValue, (in*linSlope + linOffset) ) ) + logOffset )
     //
     // out = log2( max( minValue, (in*linSlope + linOffset) ) ) * logSlope / log2(base) + logOffset
     //
-    static constexpr float minValue = std::numeric_limits<float>::min();
-
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
-    const __m128 mm_minValue = _mm_set1_ps(minValue);
-
-    const __m128 mm_m = _mm_set_ps(0.0f, m_m[2], m_m[1], m_m[0]);
-    const __m128 mm_b = _mm_set_ps(0.0f, m_b[2], m_b[1], m_b[0]);
-    const __m128 mm_klog = _mm_set_ps(0.0f, m_klog[2], m_klog[1], m_klog[0]);
-    const __m128 mm_kb = _mm_set_ps(0.0f, m_kb[2], m_kb[1], m_kb[0]);
-
-    __m128 mm_pixel;
-
-    for (long idx = 0; idx<numPixels; ++idx)
+    for (int c = 0; c < 3; ++c)
     {
-        mm_pixel = _mm_set_ps(0.0f, in[2], in[1], in[0]);
-        mm_pixel = _mm_mul_ps(mm_pixel, mm_m);
-        mm_pixel = _mm_add_ps(mm_pixel, mm_b);
-        mm_pixel = _mm_max_ps(mm_pixel, mm_minValue);
-        mm_pixel = sseLog2(mm_pixel);
-        mm_pixel = _mm_mul_ps(mm_pixel, mm_klog);
-        mm_pixel = _mm_add_ps(mm_pixel, mm_kb);
-
-        const float alphares = in[3];
+        m_params.m_inScale[c]   = m_m[c];
+        m_params.m_inOffset[c]  = m_b[c];
+        m_params.m_outScale[c]  = m_klog[c];
+        m_params.m_outOffset[c] = m_kb[c];
+    }
 
-        _mm_storeu_ps(out, mm_pixel);
-        out[3] = alphares;
+    m_applyFunc = GetFastLogExpPowFunc(FAST_LOG2);
+}
 
-        out += 4;
-        in  += 4;
+void Lin2LogRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    if (!m_applyFunc)
+    {
+        Lin2LogRenderer::apply(inImg, outImg, numPixels);
+        return;
     }
+
+    m_applyFunc(m_params, (const float *)inImg, (float *)outImg, numPixels);
 }
 #endif
 
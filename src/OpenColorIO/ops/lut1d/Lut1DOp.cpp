@@ -182,11 +182,10 @@ void CreateLut1DOp(OpRcPtrVec & ops,
     // TODO: Detect if 1D LUT can be exactly approximated as y = mx + b
     // If so, return a mtx instead.
 
-    Lut1DOpDataRcPtr lutData = lut;
-    if (direction == TRANSFORM_DIR_INVERSE)
-    {
-        lutData = lut->inverse();
-    }
+    // The LUT could be shared (e.g. by the file cache) while the op data gets modified by the
+    // op finalization, so the op always owns its data (the values are not copied).
+    Lut1DOpDataRcPtr lutData = (direction == TRANSFORM_DIR_INVERSE) ? lut->inverse()
+                                                                     : lut->clone();
 
     ops.push_back(std::make_shared<Lut1DOp>(lutData));
 }
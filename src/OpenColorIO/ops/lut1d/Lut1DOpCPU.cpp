@@ -77,6 +77,8 @@ public:
     //     that having a way to test it is critical.
     constexpr bool isLookup() const noexcept { return inBD != BIT_DEPTH_F32; }
 
+    size_t getMemoryUsage() const override { return 3 * m_tmpLutSize; }
+
 protected:
 
     virtual void update(ConstLut1DOpDataRcPtr & lut);
@@ -95,6 +97,7 @@ protected:
     void * m_tmpLutR = nullptr;
     void * m_tmpLutG = nullptr;
     void * m_tmpLutB = nullptr;
+    size_t m_tmpLutSize = 0; // Size (in bytes) of each channel table.
 
     float m_alphaScaling = 0.0f;
 
@@ -218,6 +221,12 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    size_t getMemoryUsage() const override
+    {
+        return (m_tmpLutR.capacity() + m_tmpLutG.capacity() + m_tmpLutB.capacity())
+               * sizeof(float);
+    }
+
     void resetData();
 
     virtual void updateData(ConstLut1DOpDataRcPtr & lut);
@@ -407,6 +416,7 @@ void BaseLut1DRenderer<inBD, outBD>::updateData(ConstLut1DOpDataRcPtr & lut)
         m_tmpLutR = new T[m_dim];
         m_tmpLutG = new T[m_dim];
         m_tmpLutB = new T[m_dim];
+        m_tmpLutSize = m_dim * sizeof(T);
 
         const Array::Values & lutValues = newLut->getArray().getValues();
 
@@ -425,6 +435,7 @@ void BaseLut1DRenderer<inBD, outBD>::updateData(ConstLut1DOpDataRcPtr & lut)
         m_tmpLutR = new float[m_dim];
         m_tmpLutG = new float[m_dim];
         m_tmpLutB = new float[m_dim];
+        m_tmpLutSize = m_dim * sizeof(float);
 
         for(unsigned long i=0; i<m_dim; ++i)
         {
@@ -490,6 +501,7 @@ void BaseLut1DRenderer<inBD, outBD>::resetData()
     delete [](T*)m_tmpLutR; m_tmpLutR = nullptr;
     delete [](T*)m_tmpLutG; m_tmpLutG = nullptr;
     delete [](T*)m_tmpLutB; m_tmpLutB = nullptr;
+    m_tmpLutSize = 0;
 }
 
 template<BitDepth inBD, BitDepth outBD>
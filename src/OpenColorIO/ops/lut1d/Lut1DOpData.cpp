@@ -629,17 +629,13 @@ std::string Lut1DOpData::getCacheID() const
 {
     AutoMutex lock(m_mutex);
 
-    const Lut3by1DArray::Values & values = getArray().getValues();
-
     std::ostringstream cacheIDStream;
     if (!getID().empty())
     {
         cacheIDStream << getID() << " ";
     }
 
-    cacheIDStream << CacheIDHash(reinterpret_cast<const char*>(&values[0]), 
-                                 values.size() * sizeof(values[0]))
-                  << " ";
+    cacheIDStream << getArray().getContentHash() << " ";
 
     cacheIDStream << TransformDirectionToString(m_direction)                   << " ";
     cacheIDStream << InterpolationToString(m_interpolation)                    << " ";
@@ -916,6 +912,11 @@ void Lut1DOpData::finalize()
         initializeFromForward();
     }
     m_array.adjustColorComponentNumber();
+
+    // Share the values with the other LUTs having the same content. The lock protects the
+    // computation of the cache ID which reads the values.
+    AutoMutex lock(m_mutex);
+    m_array.intern();
 }
 
 void Lut1DOpData::initializeFromForward()
@@ -941,10 +942,16 @@ void Lut1DOpData::initializeFromForward()
     const unsigned long length = getArray().getLength();
     const unsigned long maxChannels = getArray().getMaxColorComponents();
     const unsigned long activeChannels = getArray().getNumColorComponents();
-    Array::Values& values = getArray().getValues();
+
+    // The values are only accessed through the const array unless a reversal has to be
+    // flattened. Finalizing again an op (e.g. an op shared by several processors) then
+    // neither copies nor modifies its (possibly interned) values.
+    const Array & constArray = m_array;
 
     for (unsigned long c = 0; c < activeChannels; ++c)
     {
+        const Array::Values & values = constArray.getValues();
+
         // Determine if the LUT is overall increasing or decreasing.
         // The heuristic used is to compare first and last entries.
         // (Note flat LUTs (arbitrarily) have isIncreasing == false.)
@@ -963,69 +970,88 @@ void Lut1DOpData::initializeFromForward()
         {
             m_componentProperties[c].isIncreasing = (values[lowInd] < values[highInd]);
         }
+    }
 
-        // Flatten reversals.
-        // (If the LUT has a reversal, there is not a unique inverse.
-        // Furthermore we require sorted values for the exact eval algorithm.)
-        {
-            bool isIncreasing = m_componentProperties[c].isIncreasing;
+    // Flatten reversals.
+    // (If the LUT has a reversal, there is not a unique inverse.
+    // Furthermore we require sorted values for the exact eval algorithm.)
+    // When out is null, only check if there is a value to modify.
+    auto flattenReversals = [&](const float * in, float * out) -> bool
+    {
+        bool hasReversal = false;
 
-            if (!isInputHalfDomain())
+        auto flatten = [&](unsigned long startInd, unsigned long endInd,
+                           bool isIncreasing, float prevValue) -> bool
+        {
+            for (unsigned long idx = startInd; idx <= endInd; idx += maxChannels)
             {
-                float prevValue = values[c];
-                for (unsigned long idx = c + maxChannels;
-                     idx < length * maxChannels;
-                     idx += maxChannels)
+                if (isIncreasing != (in[idx] > prevValue))
                 {
-                    if (isIncreasing != (values[idx] > prevValue))
+                    // Note that a flat spot does not need to be modified.
+                    if (in[idx] != prevValue && !(IsNan(in[idx]) && IsNan(prevValue)))
                     {
-                        values[idx] = prevValue;
-                    }
-                    else
-                    {
-                        prevValue = values[idx];
+                        if (!out)
+                        {
+                            return true;
+                        }
+                        hasReversal = true;
+                        out[idx] = prevValue;
                     }
                 }
+                else
+                {
+                    prevValue = in[idx];
+                }
+            }
+            return hasReversal;
+        };
+
+        for (unsigned long c = 0; c < activeChannels; ++c)
+        {
+            const bool isIncreasing = m_componentProperties[c].isIncreasing;
+
+            if (!isInputHalfDomain())
+            {
+                if (flatten(c + maxChannels, (length - 1) * maxChannels + c,
+                            isIncreasing, in[c]) && !out)
+                {
+                    return true;
+                }
             }
             else
             {
                 // Do positive numbers.
                 unsigned long startInd = 0u * maxChannels + c; // 0 == +zero
                 unsigned long endInd = 31744u * maxChannels;   // 31744 == +infinity
-                float prevValue = values[startInd];
-                for (unsigned long idx = startInd + maxChannels;
-                     idx <= endInd;
-                     idx += maxChannels)
+                if (flatten(startInd + maxChannels, endInd, isIncreasing, in[startInd]) && !out)
                 {
-                    if (isIncreasing != (values[idx] > prevValue))
-                    {
-                        values[idx] = prevValue;
-                    }
-                    else
-                    {
-                        prevValue = values[idx];
-                    }
+                    return true;
                 }
 
                 // Do negative numbers.
-                isIncreasing = !isIncreasing;
                 startInd = 32768u * maxChannels + c;      // 32768 == -zero
                 endInd = 64512u * maxChannels;            // 64512 == -infinity
-                prevValue = values[c];  // prev value for -0 is +0 (disallow overlaps)
-                for (unsigned long idx = startInd; idx <= endInd; idx += maxChannels)
+                // Prev value for -0 is +0 (disallow overlaps).
+                if (flatten(startInd, endInd, !isIncreasing, in[c]) && !out)
                 {
-                    if (isIncreasing != (values[idx] > prevValue))
-                    {
-                        values[idx] = prevValue;
-                    }
-                    else
-                    {
-                        prevValue = values[idx];
-                    }
+                    return true;
                 }
             }
         }
 
+        return hasReversal;
+    };
+
+    if (flattenReversals(constArray.getValues().data(), nullptr))
+    {
+        Array::Values & values = getArray().getValues();
+        flattenReversals(values.data(), values.data());
+    }
+
+    for (unsigned long c = 0; c < activeChannels; ++c)
+    {
+        const Array::Values & values = constArray.getValues();
+
         // Determine effective domain from the starting/ending flat spots.
         // (If the LUT begins or ends with a flat spot, the inverse should be
         // the value nearest the center of the LUT.)
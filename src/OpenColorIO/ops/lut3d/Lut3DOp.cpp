@@ -93,6 +93,7 @@ public:
     bool canCombineWith(ConstOpRcPtr & op) const override;
     void combineWith(OpRcPtrVec & ops, ConstOpRcPtr & secondOp) const override;
     bool hasChannelCrosstalk() const override;
+    void finalize() override;
     std::string getCacheID() const override;
 
     ConstOpCPURcPtr getCPUOp(bool fastLogExpPow) const override;
@@ -184,6 +185,11 @@ bool Lut3DOp::hasChannelCrosstalk() const
     return lut3DData()->hasChannelCrosstalk();
 }
 
+void Lut3DOp::finalize()
+{
+    lut3DData()->finalize();
+}
+
 std::string Lut3DOp::getCacheID() const
 {
     std::ostringstream cacheIDStream;
@@ -222,12 +228,10 @@ void Lut3DOp::extractGpuShaderInfo(GpuShaderCreatorRcPtr & shaderCreator) const
 
 void CreateLut3DOp(OpRcPtrVec & ops, Lut3DOpDataRcPtr & lut, TransformDirection direction)
 {
-    Lut3DOpDataRcPtr lutData = lut;
-
-    if (direction == TRANSFORM_DIR_INVERSE)
-    {
-        lutData = lut->inverse();
-    }
+    // The LUT could be shared (e.g. by the file cache) while the op data gets modified by the
+    // op finalization, so the op always owns its data (the values are not copied).
+    Lut3DOpDataRcPtr lutData = (direction == TRANSFORM_DIR_INVERSE) ? lut->inverse()
+                                                                     : lut->clone();
 
     ops.push_back(std::make_shared<Lut3DOp>(lutData));
 }
@@ -12,6 +12,7 @@
 #include "MathUtils.h"
 #include "ops/lut3d/Lut3DOpCPU.h"
 #include "ops/OpTools.h"
+#include "ParallelUtils.h"
 #include "Platform.h"
 #include "SSE.h"
 #include "CPUInfo.h"
@@ -33,6 +34,11 @@ public:
     explicit BaseLut3DRenderer(ConstLut3DOpDataRcPtr & lut);
     virtual ~BaseLut3DRenderer();
 
+    size_t getMemoryUsage() const override
+    {
+        return static_cast<size_t>(m_dim) * m_dim * m_dim * m_components * sizeof(float);
+    }
+
 protected:
     void updateData(ConstLut3DOpDataRcPtr & lut);
 
@@ -78,20 +84,13 @@ public:
 class InvLut3DRenderer : public OpCPU
 {
     typedef std::vector<unsigned long> ulongVector;
-    // A level of the RangeTree.
+    // A level of the RangeTree.  The level data is stored in the arenas owned by the tree.
     struct treeLevel
     {
-        unsigned long      elems;         // number of elements on this level
-        unsigned long      chans;         // in/out channels of the LUT
-        std::vector<float> minVals;       // min LUT value for the sub-tree
-        std::vector<float> maxVals;       // max LUT value for the sub-tree
-        ulongVector        child0offsets; // offsets to the first children
-        ulongVector        numChildren;   // number of children in the subtree
-
-        treeLevel()
-        {
-            elems = 0;  chans = 0;
-        }
+        unsigned long elems = 0;          // number of elements on this level
+        unsigned long chans = 0;          // in/out channels of the LUT
+        unsigned long rangesOffset = 0;   // offset of the level into the ranges arena
+        unsigned long childrenOffset = 0; // offset of the level into the children arena
     };
     typedef std::vector<treeLevel> TreeLevels;
 
@@ -114,6 +113,12 @@ class InvLut3DRenderer : public OpCPU
     // value for each channel.  This class is a modified nd-tree which allows
     // fast identification of the cubes of the LUT that could potentially
     // contain the inverse.
+    //
+    // All the levels are stored in two flat arenas so that a traversal of the
+    // tree only touches contiguous memory.  For each node, the ranges arena holds
+    // the min values of all channels followed by the max values of all channels
+    // and the children arena holds the offset to the first child (in the next
+    // level) followed by the number of children.
     class RangeTree
     {
     public:
@@ -123,7 +128,7 @@ class InvLut3DRenderer : public OpCPU
         // Populate the tree using the LUT values.
         // - gridVector Pointer to the vectorized 3d-LUT values.
         // - gridSize The dimension of each side of the 3d-LUT.
-        void initialize(float *gridVector, unsigned long gridSize);
+        void initialize(const float *gridVector, unsigned long gridSize);
 
         virtual ~RangeTree();
 
@@ -139,9 +144,31 @@ class InvLut3DRenderer : public OpCPU
         // Get the tree levels data structure.
         inline const TreeLevels& getLevels() const { return m_levels; }
 
+        // Get the min/max values of the nodes of a level.
+        inline const float * getRanges(unsigned long level) const
+        {
+            return m_ranges.data() + m_levels[level].rangesOffset;
+        }
+
+        // Get the first child offset and number of children of the nodes of a level.
+        inline const unsigned long * getChildren(unsigned long level) const
+        {
+            return m_children.data() + m_levels[level].childrenOffset;
+        }
+
         // Get the offsets to the base of the vectors.
         inline const BaseIndsVec& getBaseInds() const { return m_baseInds; }
 
+        // Size (in bytes) of the tree arenas.
+        size_t getMemoryUsage() const
+        {
+            return m_levels.capacity() * sizeof(treeLevel)
+                   + m_ranges.capacity() * sizeof(float)
+                   + m_children.capacity() * sizeof(unsigned long)
+                   + m_baseInds.capacity() * sizeof(baseInd)
+                   + m_levelScales.capacity() * sizeof(unsigned long);
+        }
+
         // Debugging method to print tree properties.
         // void print() const;
 
@@ -150,7 +177,7 @@ class InvLut3DRenderer : public OpCPU
         void initInds();
 
         // Initialize the tree with the min and max values for each LUT cube.
-        void initRanges(float *grvec);
+        void initRanges(const float *grvec);
 
         void indsToHash(const unsigned long i);
 
@@ -159,10 +186,22 @@ class InvLut3DRenderer : public OpCPU
 
         void updateRanges(const unsigned long level);
 
+        inline float * ranges(unsigned long level)
+        {
+            return m_ranges.data() + m_levels[level].rangesOffset;
+        }
+
+        inline unsigned long * children(unsigned long level)
+        {
+            return m_children.data() + m_levels[level].childrenOffset;
+        }
+
         unsigned long   m_chans = 0;          // in/out channels of the LUT
         unsigned long   m_gsz[4] = {0,0,0,0}; // grid size of the LUT
         unsigned long   m_depth = 0;          // depth of the tree
         TreeLevels      m_levels;             // tree level structure
+        std::vector<float> m_ranges;          // min/max values of all the levels
+        ulongVector     m_children;           // child offsets/counts of all the levels
         BaseIndsVec     m_baseInds;           // indices for LUT base grid points
         ulongVector     m_levelScales;        // scaling of the tree levels
     };
@@ -174,6 +213,11 @@ public:
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const;
 
+    size_t getMemoryUsage() const override
+    {
+        return m_grvec.capacity() * sizeof(float) + m_tree.getMemoryUsage();
+    }
+
     virtual void updateData(ConstLut3DOpDataRcPtr & lut);
 
     // Extrapolate the 3d-LUT to handle values outside the LUT gamut
@@ -626,6 +670,33 @@ void Lut3DTetrahedralRenderer::apply(const void * inImg, void * outImg, long num
 Lut3DRenderer::Lut3DRenderer(ConstLut3DOpDataRcPtr & lut)
     : BaseLut3DRenderer(lut)
 {
+    #if OCIO_USE_SSE2
+    if (CPUInfo::instance().hasSSE2())
+    {
+        m_applyLutFunc = applyTrilinearSSE2;
+    }
+    #endif
+
+    #if OCIO_USE_AVX
+    if (CPUInfo::instance().hasAVX() && !CPUInfo::instance().AVXSlow())
+    {
+        m_applyLutFunc = applyTrilinearAVX;
+    }
+    #endif
+
+    #if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2() && !CPUInfo::instance().AVX2SlowGather())
+    {
+        m_applyLutFunc = applyTrilinearAVX2;
+    }
+    #endif
+
+    #if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        m_applyLutFunc = applyTrilinearAVX512;
+    }
+    #endif
 }
 
 Lut3DRenderer::~Lut3DRenderer()
@@ -637,6 +708,12 @@ void Lut3DRenderer::apply(const void * inImg, void * outImg, long numPixels) con
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
+    if (m_applyLutFunc && numPixels > 1)
+    {
+        m_applyLutFunc(m_optLut, m_dim, in, out, numPixels);
+        return;
+    }
+
 #if OCIO_USE_SSE2
 
     __m128 step = _mm_set1_ps(m_step);
@@ -1085,12 +1162,11 @@ InvLut3DRenderer::RangeTree::~RangeTree()
 {
 }
 
-void InvLut3DRenderer::RangeTree::initRanges(float *grvec)
+void InvLut3DRenderer::RangeTree::initRanges(const float *grvec)
 {
     const unsigned long depthm1 = m_depth - 1;
     const unsigned long N = m_levels[depthm1].elems;
-    m_levels[depthm1].minVals.resize(N * m_chans);
-    m_levels[depthm1].maxVals.resize(N * m_chans);
+    float * levelRanges = ranges(depthm1);
     // Our 3d-LUTs are stored with the blue chan varying most rapidly.
     const unsigned long ind0scale = m_gsz[2] * m_gsz[1];
     const unsigned long ind1scale = m_gsz[2];
@@ -1122,38 +1198,46 @@ void InvLut3DRenderer::RangeTree::initRanges(float *grvec)
         throw Exception("Unsupported channel number.");
     }
 
-    float minVal[MAX_N] = { 0.0f, 0.0f, 0.0f, 0.0f };
-    float maxVal[MAX_N] = { 0.0f, 0.0f, 0.0f, 0.0f };
-    for (unsigned long i = 0; i < N; i++)
-    {
-        const unsigned long baseOffset = m_baseInds[i].inds[0] * ind0scale +
-            m_baseInds[i].inds[1] * ind1scale + m_baseInds[i].inds[2];
+    const unsigned long chans = m_chans;
+    const BaseIndsVec & baseInds = m_baseInds;
 
-        for (unsigned long k = 0; k < m_chans; k++)
+    // The cubes are independent so they are processed in parallel.
+    ParallelFor((long)N, 4096, [&](long begin, long end)
+    {
+        float minVal[MAX_N] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        float maxVal[MAX_N] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        for (unsigned long i = (unsigned long)begin; i < (unsigned long)end; i++)
         {
-            minVal[k] = grvec[baseOffset * m_chans + k];
-            maxVal[k] = minVal[k];
-        }
+            const unsigned long baseOffset = baseInds[i].inds[0] * ind0scale +
+                baseInds[i].inds[1] * ind1scale + baseInds[i].inds[2];
 
-        for (unsigned long j = 1; j < corners; j++)
-        {
-            const unsigned long index = (baseOffset + cornerOffsets[j]) * m_chans;
-            for (unsigned long k = 0; k < m_chans; k++)
+            for (unsigned long k = 0; k < chans; k++)
             {
-                minVal[k] = std::min(minVal[k], grvec[index + k]);
-                maxVal[k] = std::max(maxVal[k], grvec[index + k]);
+                minVal[k] = grvec[baseOffset * chans + k];
+                maxVal[k] = minVal[k];
             }
-        }
 
-        // Expand the ranges slightly to allow for error in forward evaluation.
-        const float TOL = 1e-6f;
+            for (unsigned long j = 1; j < corners; j++)
+            {
+                const unsigned long index = (baseOffset + cornerOffsets[j]) * chans;
+                for (unsigned long k = 0; k < chans; k++)
+                {
+                    minVal[k] = std::min(minVal[k], grvec[index + k]);
+                    maxVal[k] = std::max(maxVal[k], grvec[index + k]);
+                }
+            }
 
-        for (unsigned long k = 0; k < m_chans; k++)
-        {
-            m_levels[depthm1].minVals[i * m_chans + k] = minVal[k] - TOL;
-            m_levels[depthm1].maxVals[i * m_chans + k] = maxVal[k] + TOL;
+            // Expand the ranges slightly to allow for error in forward evaluation.
+            const float TOL = 1e-6f;
+
+            float * node = levelRanges + i * 2 * chans;
+            for (unsigned long k = 0; k < chans; k++)
+            {
+                node[k]         = minVal[k] - TOL;
+                node[chans + k] = maxVal[k] + TOL;
+            }
         }
-    }
+    });
 }
 
 void InvLut3DRenderer::RangeTree::initInds()
@@ -1230,80 +1314,69 @@ void InvLut3DRenderer::RangeTree::updateChildren(
 )
 {
     const unsigned long levelSize = m_levels[level].elems;
-    m_levels[level].child0offsets.resize(levelSize);
-    m_levels[level].numChildren.resize(levelSize);
+    unsigned long * levelChildren = children(level);
 
     const unsigned long maxChildren = 1 << m_chans;
     const unsigned long gap = m_levelScales[level + 1] * maxChildren;
     unsigned long cnt = 1;
 
-    m_levels[level].child0offsets[0] = 0;
+    levelChildren[0] = 0;
     const unsigned long prevSize = static_cast<unsigned long>(hashes.size());
     for (unsigned long i = 1; i < prevSize; i++)
     {
         if (hashes[i] - hashes[i - 1] > gap)
         {
-            m_levels[level].child0offsets[cnt] = i;
+            levelChildren[cnt * 2] = i;
             cnt++;
         }
     }
 
     for (unsigned long i = 0; i < levelSize - 1; i++)
     {
-        m_levels[level].numChildren[i] = m_levels[level].child0offsets[i + 1] -
-                                         m_levels[level].child0offsets[i];
+        levelChildren[i * 2 + 1] = levelChildren[(i + 1) * 2] - levelChildren[i * 2];
     }
-    const unsigned long tmp
-        = static_cast<unsigned long>(hashes.size() - m_levels[level].child0offsets[levelSize - 1]);
-    m_levels[level].numChildren[levelSize - 1] = tmp;
+    levelChildren[(levelSize - 1) * 2 + 1] = prevSize - levelChildren[(levelSize - 1) * 2];
 }
 
 void InvLut3DRenderer::RangeTree::updateRanges(const unsigned long level)
 {
-    const unsigned long maxChildren = 1 << m_chans;
     const unsigned long levelSize = m_levels[level].elems;
+    const unsigned long chans = m_chans;
 
-    m_levels[level].minVals.resize(levelSize * m_chans);
-    m_levels[level].maxVals.resize(levelSize * m_chans);
+    const unsigned long * levelChildren = children(level);
+    const float * childRanges = ranges(level + 1);
+    float * levelRanges = ranges(level);
 
-    for (unsigned long i = 0; i < levelSize; i++)
+    // The nodes of a level are independent so they are processed in parallel.
+    ParallelFor((long)levelSize, 4096, [&](long begin, long end)
     {
-        const unsigned long index = m_levels[level].child0offsets[i];
-        for (unsigned long k = 0; k < m_chans; k++)
+        for (unsigned long i = (unsigned long)begin; i < (unsigned long)end; i++)
         {
-            m_levels[level].minVals[i * m_chans + k] =
-                m_levels[level + 1].minVals[index * m_chans + k];
-            m_levels[level].maxVals[i * m_chans + k] =
-                m_levels[level + 1].maxVals[index * m_chans + k];
-        }
+            const unsigned long index = levelChildren[i * 2];
+            const unsigned long numChildren = levelChildren[i * 2 + 1];
 
-        // New min/max combine the min/max for all children from next lower level.
-        for (unsigned long j = 2; j <= maxChildren; j++)
-        {
-            if (m_levels[level].numChildren[i] >= j)
+            float * node = levelRanges + i * 2 * chans;
+            const float * child = childRanges + index * 2 * chans;
+            for (unsigned long k = 0; k < 2 * chans; k++)
             {
-                const unsigned long ind = index + j - 1;
-                for (unsigned long k = 0; k < m_chans; k++)
+                node[k] = child[k];
+            }
+
+            // New min/max combine the min/max for all children from next lower level.
+            for (unsigned long j = 1; j < numChildren; j++)
+            {
+                child += 2 * chans;
+                for (unsigned long k = 0; k < chans; k++)
                 {
-                    const float minVal = m_levels[level].minVals[i * m_chans + k];
-                    const float childMinVal = m_levels[level + 1].minVals[ind * m_chans + k];
-                    if (childMinVal < minVal)
-                    {
-                        m_levels[level].minVals[i * m_chans + k] = childMinVal;
-                    }
-                    const float maxVal = m_levels[level].maxVals[i * m_chans + k];
-                    const float childMaxVal = m_levels[level + 1].maxVals[ind * m_chans + k];
-                    if (childMaxVal > maxVal)
-                    {
-                        m_levels[level].maxVals[i * m_chans + k] = childMaxVal;
-                    }
+                    node[k]         = std::min(node[k], child[k]);
+                    node[chans + k] = std::max(node[chans + k], child[chans + k]);
                 }
             }
         }
-    }
+    });
 }
 
-void InvLut3DRenderer::RangeTree::initialize(float *grvec, unsigned long gsz)
+void InvLut3DRenderer::RangeTree::initialize(const float *grvec, unsigned long gsz)
 {
     m_chans = 3;  // only supporting Lut3D for now
     m_gsz[0] = m_gsz[1] = m_gsz[2] = gsz;
@@ -1319,9 +1392,12 @@ void InvLut3DRenderer::RangeTree::initialize(float *grvec, unsigned long gsz)
     frexp(maxGsz - 2.f, &log2base);
     m_depth = (unsigned long)log2base;
 
+    m_levels.clear();
     m_levels.resize(m_depth);
 
-    // Determine size of each level.
+    // Determine size of each level and its location in the arenas.
+    unsigned long rangesSize = 0;
+    unsigned long childrenSize = 0;
     for (unsigned long i = 0; i < m_depth; i++)
     {
         unsigned long levelSize = 1;
@@ -1333,8 +1409,21 @@ void InvLut3DRenderer::RangeTree::initialize(float *grvec, unsigned long gsz)
         }
         m_levels[i].elems = levelSize;
         m_levels[i].chans = m_chans;
+
+        m_levels[i].rangesOffset = rangesSize;
+        rangesSize += levelSize * 2 * m_chans;
+
+        // The leaves do not have children.
+        m_levels[i].childrenOffset = childrenSize;
+        if (i + 1 < m_depth)
+        {
+            childrenSize += levelSize * 2;
+        }
     }
 
+    m_ranges.assign(rangesSize, 0.0f);
+    m_children.assign(childrenSize, 0);
+
     // Determine scale to use for hash.
     m_levelScales.resize(m_depth);
     for (unsigned long level = 0; level < m_depth; level++)
@@ -1351,10 +1440,13 @@ void InvLut3DRenderer::RangeTree::initialize(float *grvec, unsigned long gsz)
     // Calculate hash for indices.
 
     const unsigned long cnt = static_cast<unsigned long>(m_baseInds.size());
-    for (unsigned long i = 0; i < cnt; i++)
+    ParallelFor((long)cnt, 16384, [this](long begin, long end)
     {
-        indsToHash(i);
-    }
+        for (long i = begin; i < end; i++)
+        {
+            indsToHash((unsigned long)i);
+        }
+    });
 
     // Sort indices based on hash.
     std::sort(m_baseInds.begin(), m_baseInds.end());
@@ -1375,10 +1467,11 @@ void InvLut3DRenderer::RangeTree::initialize(float *grvec, unsigned long gsz)
         updateChildren(hashes, level);
 
         const unsigned long levelSize = m_levels[level].elems;
+        const unsigned long * levelChildren = children(level);
 
         for (unsigned long i = 0; i < levelSize; i++)
         {
-            const unsigned long index = m_levels[level].child0offsets[i];
+            const unsigned long index = levelChildren[i * 2];
             hashes[i] = hashes[index];
         }
         hashes.resize(levelSize);
@@ -1468,19 +1561,21 @@ void InvLut3DRenderer::extrapolate3DArray(ConstLut3DOpDataRcPtr & lut)
 
     Lut3DOpData::Lut3DArray newArray(newDim);
 
-    // Copy center values.
-    for (unsigned long idx = 0; idx<dim; idx++)
+    // Copy center values (each blue row is contiguous in both arrays).
+    const float * srcValues = array.getValues().data();
+    float * dstValues = newArray.getValues().data();
+    ParallelFor((long)dim, 8, [&](long begin, long end)
     {
-        for (unsigned long jdx = 0; jdx<dim; jdx++)
+        for (unsigned long idx = (unsigned long)begin; idx<(unsigned long)end; idx++)
         {
-            for (unsigned long kdx = 0; kdx<dim; kdx++)
+            for (unsigned long jdx = 0; jdx<dim; jdx++)
             {
-                float RGB[3];
-                array.getRGB(idx, jdx, kdx, RGB);
-                newArray.setRGB(idx + 1, jdx + 1, kdx + 1, RGB);
+                const float * src = srcValues + ((idx * dim + jdx) * dim) * 3;
+                float * dst = dstValues + (((idx + 1) * newDim + (jdx + 1)) * newDim + 1) * 3;
+                std::copy(src, src + dim * 3, dst);
             }
         }
-    }
+    });
 
     const float center = 0.5f;
     const float scale = 4.f;
@@ -1587,7 +1682,7 @@ void InvLut3DRenderer::extrapolate3DArray(ConstLut3DOpDataRcPtr & lut)
         }
     }
 
-    m_grvec = newArray.getValues();
+    m_grvec = std::move(newArray.getValues());
 }
 
 // TODO apply() needs further optimization work.
@@ -1665,7 +1760,7 @@ void InvLut3DRenderer::apply(const void * inImg, void * outImg, long numPixels)
         const long depthm1 = depth - 1;
         unsigned long baseIndx[3] = {0, 0, 0};
 
-        currentNumChildren[0] = (unsigned long)levels[0].child0offsets.size();
+        currentNumChildren[0] = levels[0].elems;
         currentChild[0] = 0;
         currentChildInd[0] = 0;
 
@@ -1678,13 +1773,14 @@ void InvLut3DRenderer::apply(const void * inImg, void * outImg, long numPixels)
             while (currentChild[level] < currentNumChildren[level])
             {
                 const unsigned long node = currentChildInd[level];
+                const float * ranges = m_tree.getRanges(level) + node * 2 * chans;
                 const bool inRange =
-                    R >= levels[level].minVals[node * chans] &&
-                    G >= levels[level].minVals[node * chans + 1] &&
-                    B >= levels[level].minVals[node * chans + 2] &&
-                    R <= levels[level].maxVals[node * chans] &&
-                    G <= levels[level].maxVals[node * chans + 1] &&
-                    B <= levels[level].maxVals[node * chans + 2];
+                    R >= ranges[0] &&
+                    G >= ranges[1] &&
+                    B >= ranges[2] &&
+                    R <= ranges[3] &&
+                    G <= ranges[4] &&
+                    B <= ranges[5];
                 currentChild[level]++;
                 currentChildInd[level]++;
 
@@ -1712,8 +1808,9 @@ void InvLut3DRenderer::apply(const void * inImg, void * outImg, long numPixels)
                     else
                     {
                         const int newLevel = level + 1;
-                        currentNumChildren[newLevel] = levels[level].numChildren[node];
-                        currentChildInd[newLevel] = levels[level].child0offsets[node];
+                        const unsigned long * children = m_tree.getChildren(level) + node * 2;
+                        currentNumChildren[newLevel] = children[1];
+                        currentChildInd[newLevel] = children[0];
                         level = newLevel;
                         currentChild[level] = 0;
                     }
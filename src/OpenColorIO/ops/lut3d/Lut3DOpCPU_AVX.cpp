@@ -221,8 +221,98 @@ static inline rgbavec_avx interp_tetrahedral_avx(const Lut3DContextAVX &ctx, __m
     return result;
 }
 
-template<BitDepth inBD, BitDepth outBD>
-static inline void applyTetrahedralAVXFunc(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count)
+static inline rgbavec_avx lerp_rgb_avx(const rgbavec_avx &x, const rgbavec_avx &y, __m256 t)
+{
+    rgbavec_avx result;
+    result.r = fmadd_ps_avx(t, _mm256_sub_ps(y.r, x.r), x.r);
+    result.g = fmadd_ps_avx(t, _mm256_sub_ps(y.g, x.g), x.g);
+    result.b = fmadd_ps_avx(t, _mm256_sub_ps(y.b, x.b), x.b);
+    return result;
+}
+
+// Interpolate along the blue axis the edge of the cube starting at the prescaled (r, g) index.
+static inline rgbavec_avx interp_blue_edge_avx(const float *lut, __m256 rg, __m256 prev_b, __m256 next_b, __m256 d_b)
+{
+    AVX_ALIGN(uint32_t indices[8]);
+
+    __m256 tmp0, tmp1, tmp2, tmp3;
+    __m256 row0, row1, row2, row3;
+    __m256 sample_r, sample_g, sample_b;
+
+    rgbavec_avx prev, next;
+
+    gather_rgb_avx(lut, _mm256_cvttps_epi32(_mm256_add_ps(rg, prev_b)));
+    prev.r = sample_r;
+    prev.g = sample_g;
+    prev.b = sample_b;
+
+    gather_rgb_avx(lut, _mm256_cvttps_epi32(_mm256_add_ps(rg, next_b)));
+    next.r = sample_r;
+    next.g = sample_g;
+    next.b = sample_b;
+
+    return lerp_rgb_avx(prev, next, d_b);
+}
+
+static inline rgbavec_avx interp_trilinear_avx(const Lut3DContextAVX &ctx, __m256 r, __m256 g, __m256 b, __m256 a)
+{
+    __m256 lut_max  = ctx.lutmax;
+    __m256 lutsize  = ctx.lutsize;
+    __m256 lutsize2 = ctx.lutsize2;
+
+    __m256 one_f   = _mm256_set1_ps(1.0f);
+    __m256 four_f  = _mm256_set1_ps(4.0f);
+
+    __m256 prev_r = _mm256_floor_ps(r);
+    __m256 prev_g = _mm256_floor_ps(g);
+    __m256 prev_b = _mm256_floor_ps(b);
+
+    // rgb delta values
+    __m256 d_r = _mm256_sub_ps(r, prev_r);
+    __m256 d_g = _mm256_sub_ps(g, prev_g);
+    __m256 d_b = _mm256_sub_ps(b, prev_b);
+
+    __m256 next_r = _mm256_min_ps(lut_max, _mm256_add_ps(prev_r, one_f));
+    __m256 next_g = _mm256_min_ps(lut_max, _mm256_add_ps(prev_g, one_f));
+    __m256 next_b = _mm256_min_ps(lut_max, _mm256_add_ps(prev_b, one_f));
+
+    // prescale indices
+    prev_r = _mm256_mul_ps(prev_r, lutsize2);
+    next_r = _mm256_mul_ps(next_r, lutsize2);
+
+    prev_g = _mm256_mul_ps(prev_g, lutsize);
+    next_g = _mm256_mul_ps(next_g, lutsize);
+
+    prev_b = _mm256_mul_ps(prev_b, four_f);
+    next_b = _mm256_mul_ps(next_b, four_f);
+
+    // This is the trilinear blend, i.e. linear interpolations along the blue axis
+    // for the four edges of the cube, then along the green axis and finally along the red axis:
+    // c00 = lerp(c000, c001, d_b), c01 = lerp(c010, c011, d_b), c10 = ..., c11 = ...
+    // c0 = lerp(c00, c01, d_g), c1 = lerp(c10, c11, d_g)
+    // result = lerp(c0, c1, d_r)
+    // where lerp(x, y, t) = x + (y - x) * t and c### are samples from the lut (see the
+    // tetrahedral interpolation for the indices).
+
+    rgbavec_avx c00 = interp_blue_edge_avx(ctx.lut, _mm256_add_ps(prev_r, prev_g), prev_b, next_b, d_b);
+    rgbavec_avx c01 = interp_blue_edge_avx(ctx.lut, _mm256_add_ps(prev_r, next_g), prev_b, next_b, d_b);
+    rgbavec_avx c10 = interp_blue_edge_avx(ctx.lut, _mm256_add_ps(next_r, prev_g), prev_b, next_b, d_b);
+    rgbavec_avx c11 = interp_blue_edge_avx(ctx.lut, _mm256_add_ps(next_r, next_g), prev_b, next_b, d_b);
+
+    rgbavec_avx c0 = lerp_rgb_avx(c00, c01, d_g);
+    rgbavec_avx c1 = lerp_rgb_avx(c10, c11, d_g);
+
+    rgbavec_avx result = lerp_rgb_avx(c0, c1, d_r);
+
+    result.a = a;
+
+    return result;
+}
+
+typedef rgbavec_avx (interp_func_avx)(const Lut3DContextAVX &ctx, __m256 r, __m256 g, __m256 b, __m256 a);
+
+template<BitDepth inBD, BitDepth outBD, interp_func_avx interp>
+static inline void applyLut3DAVXFunc(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count)
 {
     typedef typename BitDepthInfo<inBD>::Type InType;
     typedef typename BitDepthInfo<outBD>::Type OutType;
@@ -262,7 +352,7 @@ static inline void applyTetrahedralAVXFunc(const float *lut3d, int dim, const fl
         g = _mm256_min_ps(g, ctx.lutmax);
         b = _mm256_min_ps(b, ctx.lutmax);
 
-        c = interp_tetrahedral_avx(ctx, r, g, b, a);
+        c = interp(ctx, r, g, b, a);
 
         AVXRGBAPack<outBD>::Store(dst, c.r, c.g, c.b, c.a);
 
@@ -300,7 +390,7 @@ static inline void applyTetrahedralAVXFunc(const float *lut3d, int dim, const fl
         g = _mm256_min_ps(g, ctx.lutmax);
         b = _mm256_min_ps(b, ctx.lutmax);
 
-        c = interp_tetrahedral_avx(ctx, r, g, b, a);
+        c = interp(ctx, r, g, b, a);
 
         AVXRGBAPack<outBD>::Store(out_buf, c.r, c.g, c.b, c.a);
 
@@ -319,7 +409,12 @@ static inline void applyTetrahedralAVXFunc(const float *lut3d, int dim, const fl
 
 void applyTetrahedralAVX(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count)
 {
-    applyTetrahedralAVXFunc<BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, dim, src, dst, total_pixel_count);
+    applyLut3DAVXFunc<BIT_DEPTH_F32, BIT_DEPTH_F32, interp_tetrahedral_avx>(lut3d, dim, src, dst, total_pixel_count);
+}
+
+void applyTrilinearAVX(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count)
+{
+    applyLut3DAVXFunc<BIT_DEPTH_F32, BIT_DEPTH_F32, interp_trilinear_avx>(lut3d, dim, src, dst, total_pixel_count);
 }
 
 } // OCIO_NAMESPACE
@@ -173,8 +173,94 @@ static inline rgbavec_avx512 interp_tetrahedral_avx512(const Lut3DContextAVX512
     return result;
 }
 
-template<BitDepth inBD, BitDepth outBD>
-inline void applyTetrahedralAVX512Func(const float *lut3d, int dim, const void *inImg, void *outImg, int numPixels)
+static inline rgbavec_avx512 lerp_rgb_avx512(const rgbavec_avx512 &x, const rgbavec_avx512 &y, __m512 t)
+{
+    rgbavec_avx512 result;
+    result.r = _mm512_fmadd_ps(t, _mm512_sub_ps(y.r, x.r), x.r);
+    result.g = _mm512_fmadd_ps(t, _mm512_sub_ps(y.g, x.g), x.g);
+    result.b = _mm512_fmadd_ps(t, _mm512_sub_ps(y.b, x.b), x.b);
+    return result;
+}
+
+// Interpolate along the blue axis the edge of the cube starting at the prescaled (r, g) index.
+static inline rgbavec_avx512 interp_blue_edge_avx512(const float *lut, __m512 rg, __m512 prev_b, __m512 next_b, __m512 d_b)
+{
+    __m512 sample_r, sample_g, sample_b;
+
+    rgbavec_avx512 prev, next;
+
+    gather_rgb_avx512(lut, _mm512_cvttps_epi32(_mm512_add_ps(rg, prev_b)));
+    prev.r = sample_r;
+    prev.g = sample_g;
+    prev.b = sample_b;
+
+    gather_rgb_avx512(lut, _mm512_cvttps_epi32(_mm512_add_ps(rg, next_b)));
+    next.r = sample_r;
+    next.g = sample_g;
+    next.b = sample_b;
+
+    return lerp_rgb_avx512(prev, next, d_b);
+}
+
+static inline rgbavec_avx512 interp_trilinear_avx512(const Lut3DContextAVX512 &ctx, __m512& r, __m512& g, __m512& b, __m512& a)
+{
+    __m512 lut_max  = ctx.lutmax;
+    __m512 lutsize  = ctx.lutsize;
+    __m512 lutsize2 = ctx.lutsize2;
+
+    __m512 one_f   = _mm512_set1_ps(1.0f);
+    __m512 four_f  = _mm512_set1_ps(4.0f);
+
+    __m512 prev_r = _mm512_floor_ps(r);
+    __m512 prev_g = _mm512_floor_ps(g);
+    __m512 prev_b = _mm512_floor_ps(b);
+
+    // rgb delta values
+    __m512 d_r = _mm512_sub_ps(r, prev_r);
+    __m512 d_g = _mm512_sub_ps(g, prev_g);
+    __m512 d_b = _mm512_sub_ps(b, prev_b);
+
+    __m512 next_r = _mm512_min_ps(lut_max, _mm512_add_ps(prev_r, one_f));
+    __m512 next_g = _mm512_min_ps(lut_max, _mm512_add_ps(prev_g, one_f));
+    __m512 next_b = _mm512_min_ps(lut_max, _mm512_add_ps(prev_b, one_f));
+
+    // prescale indices
+    prev_r = _mm512_mul_ps(prev_r, lutsize2);
+    next_r = _mm512_mul_ps(next_r, lutsize2);
+
+    prev_g = _mm512_mul_ps(prev_g, lutsize);
+    next_g = _mm512_mul_ps(next_g, lutsize);
+
+    prev_b = _mm512_mul_ps(prev_b, four_f);
+    next_b = _mm512_mul_ps(next_b, four_f);
+
+    // This is the trilinear blend, i.e. linear interpolations along the blue axis
+    // for the four edges of the cube, then along the green axis and finally along the red axis:
+    // c00 = lerp(c000, c001, d_b), c01 = lerp(c010, c011, d_b), c10 = ..., c11 = ...
+    // c0 = lerp(c00, c01, d_g), c1 = lerp(c10, c11, d_g)
+    // result = lerp(c0, c1, d_r)
+    // where lerp(x, y, t) = x + (y - x) * t and c### are samples from the lut (see the
+    // tetrahedral interpolation for the indices).
+
+    rgbavec_avx512 c00 = interp_blue_edge_avx512(ctx.lut, _mm512_add_ps(prev_r, prev_g), prev_b, next_b, d_b);
+    rgbavec_avx512 c01 = interp_blue_edge_avx512(ctx.lut, _mm512_add_ps(prev_r, next_g), prev_b, next_b, d_b);
+    rgbavec_avx512 c10 = interp_blue_edge_avx512(ctx.lut, _mm512_add_ps(next_r, prev_g), prev_b, next_b, d_b);
+    rgbavec_avx512 c11 = interp_blue_edge_avx512(ctx.lut, _mm512_add_ps(next_r, next_g), prev_b, next_b, d_b);
+
+    rgbavec_avx512 c0 = lerp_rgb_avx512(c00, c01, d_g);
+    rgbavec_avx512 c1 = lerp_rgb_avx512(c10, c11, d_g);
+
+    rgbavec_avx512 result = lerp_rgb_avx512(c0, c1, d_r);
+
+    result.a = a;
+
+    return result;
+}
+
+typedef rgbavec_avx512 (interp_func_avx512)(const Lut3DContextAVX512 &ctx, __m512& r, __m512& g, __m512& b, __m512& a);
+
+template<BitDepth inBD, BitDepth outBD, interp_func_avx512 interp>
+inline void applyLut3DAVX512Func(const float *lut3d, int dim, const void *inImg, void *outImg, int numPixels)
 {
     typedef typename BitDepthInfo<inBD>::Type InType;
     typedef typename BitDepthInfo<outBD>::Type OutType;
@@ -215,7 +301,7 @@ inline void applyTetrahedralAVX512Func(const float *lut3d, int dim, const void *
         g = _mm512_min_ps(g, ctx.lutmax);
         b = _mm512_min_ps(b, ctx.lutmax);
 
-        c = interp_tetrahedral_avx512(ctx, r, g, b, a);
+        c = interp(ctx, r, g, b, a);
 
         AVX512RGBAPack<outBD>::Store(dst, c.r, c.g, c.b, c.a);
 
@@ -241,7 +327,7 @@ inline void applyTetrahedralAVX512Func(const float *lut3d, int dim, const void *
         g = _mm512_min_ps(g, ctx.lutmax);
         b = _mm512_min_ps(b, ctx.lutmax);
 
-        c = interp_tetrahedral_avx512(ctx, r, g, b, a);
+        c = interp(ctx, r, g, b, a);
 
         AVX512RGBAPack<outBD>::StoreMasked(dst, c.r, c.g, c.b, c.a, remainder);
     }
@@ -251,7 +337,12 @@ inline void applyTetrahedralAVX512Func(const float *lut3d, int dim, const void *
 
 void applyTetrahedralAVX512(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count)
 {
-    applyTetrahedralAVX512Func<BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, dim, src, dst, total_pixel_count);
+    applyLut3DAVX512Func<BIT_DEPTH_F32, BIT_DEPTH_F32, interp_tetrahedral_avx512>(lut3d, dim, src, dst, total_pixel_count);
+}
+
+void applyTrilinearAVX512(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count)
+{
+    applyLut3DAVX512Func<BIT_DEPTH_F32, BIT_DEPTH_F32, interp_trilinear_avx512>(lut3d, dim, src, dst, total_pixel_count);
 }
 
 } // OCIO_NAMESPACE
@@ -215,8 +215,98 @@ static inline rgbavec_sse2 interp_tetrahedral_sse2(const Lut3DContextSSE2 &ctx,
     return result;
 }
 
-template<BitDepth inBD, BitDepth outBD>
-static inline void applyTetrahedralSSE2Func(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count)
+static inline rgbavec_sse2 lerp_rgb_sse2(const rgbavec_sse2 &x, const rgbavec_sse2 &y, __m128 t)
+{
+    rgbavec_sse2 result;
+    result.r = fmadd_ps_sse2(t, _mm_sub_ps(y.r, x.r), x.r);
+    result.g = fmadd_ps_sse2(t, _mm_sub_ps(y.g, x.g), x.g);
+    result.b = fmadd_ps_sse2(t, _mm_sub_ps(y.b, x.b), x.b);
+    return result;
+}
+
+// Interpolate along the blue axis the edge of the cube starting at the prescaled (r, g) index.
+static inline rgbavec_sse2 interp_blue_edge_sse2(const float *lut, __m128 rg, __m128 prev_b, __m128 next_b, __m128 d_b)
+{
+    SSE2_ALIGN(uint32_t indices[4]);
+
+    __m128 tmp0, tmp1, tmp2, tmp3;
+    __m128 row0, row1, row2, row3;
+    __m128 sample_r, sample_g, sample_b;
+
+    rgbavec_sse2 prev, next;
+
+    gather_rgb_sse2(lut, _mm_cvttps_epi32(_mm_add_ps(rg, prev_b)));
+    prev.r = sample_r;
+    prev.g = sample_g;
+    prev.b = sample_b;
+
+    gather_rgb_sse2(lut, _mm_cvttps_epi32(_mm_add_ps(rg, next_b)));
+    next.r = sample_r;
+    next.g = sample_g;
+    next.b = sample_b;
+
+    return lerp_rgb_sse2(prev, next, d_b);
+}
+
+static inline rgbavec_sse2 interp_trilinear_sse2(const Lut3DContextSSE2 &ctx, __m128 r, __m128 g, __m128 b, __m128 a)
+{
+    __m128 lut_max  = ctx.lutmax;
+    __m128 lutsize  = ctx.lutsize;
+    __m128 lutsize2 = ctx.lutsize2;
+
+    __m128 one_f   = _mm_set1_ps(1.0f);
+    __m128 four_f  = _mm_set1_ps(4.0f);
+
+    __m128 prev_r = floor_ps_sse2(r);
+    __m128 prev_g = floor_ps_sse2(g);
+    __m128 prev_b = floor_ps_sse2(b);
+
+    // rgb delta values
+    __m128 d_r = _mm_sub_ps(r, prev_r);
+    __m128 d_g = _mm_sub_ps(g, prev_g);
+    __m128 d_b = _mm_sub_ps(b, prev_b);
+
+    __m128 next_r = _mm_min_ps(lut_max, _mm_add_ps(prev_r, one_f));
+    __m128 next_g = _mm_min_ps(lut_max, _mm_add_ps(prev_g, one_f));
+    __m128 next_b = _mm_min_ps(lut_max, _mm_add_ps(prev_b, one_f));
+
+    // prescale indices
+    prev_r = _mm_mul_ps(prev_r, lutsize2);
+    next_r = _mm_mul_ps(next_r, lutsize2);
+
+    prev_g = _mm_mul_ps(prev_g, lutsize);
+    next_g = _mm_mul_ps(next_g, lutsize);
+
+    prev_b = _mm_mul_ps(prev_b, four_f);
+    next_b = _mm_mul_ps(next_b, four_f);
+
+    // This is the trilinear blend, i.e. linear interpolations along the blue axis
+    // for the four edges of the cube, then along the green axis and finally along the red axis:
+    // c00 = lerp(c000, c001, d_b), c01 = lerp(c010, c011, d_b), c10 = ..., c11 = ...
+    // c0 = lerp(c00, c01, d_g), c1 = lerp(c10, c11, d_g)
+    // result = lerp(c0, c1, d_r)
+    // where lerp(x, y, t) = x + (y - x) * t and c### are samples from the lut (see the
+    // tetrahedral interpolation for the indices).
+
+    rgbavec_sse2 c00 = interp_blue_edge_sse2(ctx.lut, _mm_add_ps(prev_r, prev_g), prev_b, next_b, d_b);
+    rgbavec_sse2 c01 = interp_blue_edge_sse2(ctx.lut, _mm_add_ps(prev_r, next_g), prev_b, next_b, d_b);
+    rgbavec_sse2 c10 = interp_blue_edge_sse2(ctx.lut, _mm_add_ps(next_r, prev_g), prev_b, next_b, d_b);
+    rgbavec_sse2 c11 = interp_blue_edge_sse2(ctx.lut, _mm_add_ps(next_r, next_g), prev_b, next_b, d_b);
+
+    rgbavec_sse2 c0 = lerp_rgb_sse2(c00, c01, d_g);
+    rgbavec_sse2 c1 = lerp_rgb_sse2(c10, c11, d_g);
+
+    rgbavec_sse2 result = lerp_rgb_sse2(c0, c1, d_r);
+
+    result.a = a;
+
+    return result;
+}
+
+typedef rgbavec_sse2 (interp_func_sse2)(const Lut3DContextSSE2 &ctx, __m128 r, __m128 g, __m128 b, __m128 a);
+
+template<BitDepth inBD, BitDepth outBD, interp_func_sse2 interp>
+static inline void applyLut3DSSE2Func(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count)
 {
     typedef typename BitDepthInfo<inBD>::Type InType;
     typedef typename BitDepthInfo<outBD>::Type OutType;
@@ -258,7 +348,7 @@ static inline void applyTetrahedralSSE2Func(const float *lut3d, int dim, const f
         g = _mm_min_ps(g, ctx.lutmax);
         b = _mm_min_ps(b, ctx.lutmax);
 
-        c = interp_tetrahedral_sse2(ctx, r, g, b, a);
+        c = interp(ctx, r, g, b, a);
 
         SSE2RGBAPack<outBD>::Store(dst, c.r, c.g, c.b, c.a);
 
@@ -295,7 +385,7 @@ static inline void applyTetrahedralSSE2Func(const float *lut3d, int dim, const f
         g = _mm_min_ps(g, ctx.lutmax);
         b = _mm_min_ps(b, ctx.lutmax);
 
-        c = interp_tetrahedral_sse2(ctx, r, g, b, a);
+        c = interp(ctx, r, g, b, a);
 
         SSE2RGBAPack<outBD>::Store(out_buf, c.r, c.g, c.b, c.a);
 
@@ -313,7 +403,12 @@ static inline void applyTetrahedralSSE2Func(const float *lut3d, int dim, const f
 
 void applyTetrahedralSSE2(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count)
 {
-    applyTetrahedralSSE2Func<BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, dim, src, dst, total_pixel_count);
+    applyLut3DSSE2Func<BIT_DEPTH_F32, BIT_DEPTH_F32, interp_tetrahedral_sse2>(lut3d, dim, src, dst, total_pixel_count);
+}
+
+void applyTrilinearSSE2(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count)
+{
+    applyLut3DSSE2Func<BIT_DEPTH_F32, BIT_DEPTH_F32, interp_trilinear_sse2>(lut3d, dim, src, dst, total_pixel_count);
 }
 
 } // OCIO_NAMESPACE
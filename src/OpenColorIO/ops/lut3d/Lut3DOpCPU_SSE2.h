@@ -13,6 +13,7 @@ namespace OCIO_NAMESPACE
 {
 
 void applyTetrahedralSSE2(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count);
+void applyTrilinearSSE2(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count);
 
 } // namespace OCIO_NAMESPACE
 
@@ -468,17 +468,13 @@ std::string Lut3DOpData::getCacheID() const
 {
     AutoMutex lock(m_mutex);
 
-    const Lut3DArray::Values & values = getArray().getValues();
-
     std::ostringstream cacheIDStream;
     if (!getID().empty())
     {
         cacheIDStream << getID() << " ";
     }
 
-    cacheIDStream << CacheIDHash(reinterpret_cast<const char*>(&values[0]),
-                                 values.size() * sizeof(values[0]))
-                  << " ";
+    cacheIDStream << getArray().getContentHash() << " ";
 
     cacheIDStream << InterpolationToString(m_interpolation)  << " ";
     cacheIDStream << TransformDirectionToString(m_direction) << " ";
@@ -491,6 +487,14 @@ void Lut3DOpData::scale(float scale)
     getArray().scale(scale);
 }
 
+void Lut3DOpData::finalize()
+{
+    // Share the values with the other LUTs having the same content. The lock protects the
+    // computation of the cache ID which reads the values.
+    AutoMutex lock(m_mutex);
+    m_array.intern();
+}
+
 bool operator==(const Lut3DOpData & lhs, const Lut3DOpData & rhs)
 {
     return lhs.equals(rhs);
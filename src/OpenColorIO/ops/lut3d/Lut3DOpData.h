@@ -83,11 +83,15 @@ public:
 
     std::string getCacheID() const override;
 
+    size_t getMemoryUsage() const override { return m_array.getMemoryUsage(); }
+
     inline BitDepth getFileOutputBitDepth() const { return m_fileOutBitDepth; }
     inline void setFileOutputBitDepth(BitDepth out) { m_fileOutBitDepth = out; }
 
     void scale(float scale);
 
+    void finalize();
+
 protected:
     // Test core parts of LUTs for equality.
     bool haveEqualBasics(const Lut3DOpData & other) const;
@@ -7,6 +7,7 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "ContextVariableUtils.h"
+#include "LazyTransform.h"
 #include "NamedTransform.h"
 #include "OpBuilders.h"
 #include "ops/allocation/AllocationOp.h"
@@ -281,6 +282,9 @@ void BuildColorSpaceToReferenceOps(OpRcPtrVec & ops,
     if (dataBypass && srcColorSpace->isData())
         return;
 
+    // Report the errors of a lazily loaded transform instead of silently ignoring it.
+    ColorSpaceLazyTransforms::Materialize(*srcColorSpace);
+
     AllocationData srcAllocation;
     srcAllocation.allocation = srcColorSpace->getAllocation();
     srcAllocation.vars.resize(srcColorSpace->getAllocationNumVars());
@@ -319,6 +323,9 @@ void BuildColorSpaceFromReferenceOps(OpRcPtrVec & ops,
     if (dataBypass && dstColorSpace->isData())
         return;
 
+    // Report the errors of a lazily loaded transform instead of silently ignoring it.
+    ColorSpaceLazyTransforms::Materialize(*dstColorSpace);
+
     // Go from the reference space, either by using:
     // * ref->cs in the forward direction.
     // * cs->ref in the inverse direction.
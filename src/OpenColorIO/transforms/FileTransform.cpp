@@ -21,6 +21,7 @@
 #include "ops/noop/NoOps.h"
 #include "PathUtils.h"
 #include "Platform.h"
+#include "Trace.h"
 #include "utils/StringUtils.h"
 
 namespace OCIO_NAMESPACE
@@ -804,6 +805,8 @@ void GetCachedFileAndFormat(FileFormat * & format,
                             Interpolation interp,
                             const Config& config)
 {
+    OCIO_TRACE_SCOPE_DETAIL("file", "GetCachedFileAndFormat", filepath);
+
     // Have a two-mutex approach to decouple the cache entry creation from
     // the data creation. It was originally done to improve the multi-threaded
     // file lookup.  Refer to PR #309 for details.
@@ -841,6 +844,7 @@ void GetCachedFileAndFormat(FileFormat * & format,
 
         try
         {
+            OCIO_TRACE_SCOPE_DETAIL("file", "LoadFileUncached", filepath);
             LoadFileUncached(result->format, result->cachedFile, filepath, interp, config);
         }
         catch (std::exception & e)
@@ -892,6 +896,34 @@ void ClearFileTransformCaches()
     g_fileCache.clear();
 }
 
+size_t GetFileTransformCachesMemoryUsage()
+{
+    // The entries are locked one at a time, and not under the cache lock, as a file being
+    // loaded holds its entry lock while it could load other files.
+    std::vector<FileCacheResultPtr> results;
+    {
+        AutoMutex guard(g_fileCache.lock());
+        for (const auto & entry : g_fileCache)
+        {
+            if (entry.second)
+            {
+                results.push_back(entry.second);
+            }
+        }
+    }
+
+    size_t memoryUsage = 0;
+    for (const auto & result : results)
+    {
+        AutoMutex guard(result->mutex);
+        if (result->ready && result->cachedFile)
+        {
+            memoryUsage += result->cachedFile->getMemoryUsage();
+        }
+    }
+    return memoryUsage;
+}
+
 void BuildFileTransformOps(OpRcPtrVec & ops,
                            const Config& config,
                            const ConstContextRcPtr & context,
@@ -20,6 +20,9 @@ namespace OCIO_NAMESPACE
 {
 void ClearFileTransformCaches();
 
+// Estimate of the memory (in bytes) held by the cache of the file contents.
+size_t GetFileTransformCachesMemoryUsage();
+
 class CachedFile
 {
 public:
@@ -30,6 +33,9 @@ public:
     {
         throw Exception("Not a CDL file format.");
     }
+
+    // Estimate of the memory (in bytes) held by the file content (e.g. the LUT values).
+    virtual size_t getMemoryUsage() const { return 0; }
 };
 
 typedef OCIO_SHARED_PTR<CachedFile> CachedFileRcPtr;
@@ -1,10 +1,17 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <atomic>
+#include <chrono>
 #include <cstdlib>
+#include <functional>
+#include <iomanip>
 #include <iostream>
 #include <fstream>
 #include <set>
+#include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 #include <algorithm>
 
@@ -104,9 +111,145 @@ bool isValidInteropID(const std::string& id)
     return true;
 }
 
+// Result of checking one item of the config (e.g. building the processors of a color space).
+struct CheckResult
+{
+    std::vector<std::string> m_errors;
+    // Messages logged while checking the item.
+    std::string m_log;
+    double m_durationMs = 0.0;
+};
+
+// Messages logged while checking an item are buffered by the checking thread, so they are
+// printed along with the item whatever the thread scheduling.
+thread_local std::string * g_threadLog = nullptr;
+
+void BufferedLoggingFunction(const char * message)
+{
+    if (g_threadLog)
+    {
+        *g_threadLog += message;
+    }
+    else
+    {
+        std::cerr << message;
+    }
+}
+
+// Call check(i, result) for all the items in [0, numItems) using numThreads threads. The items
+// are handed out one at a time as their costs vary a lot (e.g. a color space with or without
+// LUTs). The results are stored by index so they are reported in the config order.
+std::vector<CheckResult> RunChecks(int numItems,
+                                   unsigned numThreads,
+                                   const std::function<void(int, CheckResult &)> & check)
+{
+    std::vector<CheckResult> results(numItems);
+    std::atomic<int> nextItem{ 0 };
+
+    auto worker = [&]()
+    {
+        for (int i = nextItem++; i < numItems; i = nextItem++)
+        {
+            CheckResult & result = results[i];
+            g_threadLog = &result.m_log;
+
+            const auto start = std::chrono::steady_clock::now();
+            try
+            {
+                check(i, result);
+            }
+            catch (std::exception & exception)
+            {
+                result.m_errors.push_back(exception.what());
+            }
+            catch (...)
+            {
+                result.m_errors.push_back("Unknown error encountered.");
+            }
+            const std::chrono::duration<double, std::milli> duration
+                = std::chrono::steady_clock::now() - start;
+            result.m_durationMs = duration.count();
+
+            g_threadLog = nullptr;
+        }
+    };
+
+    const unsigned numWorkers = std::max(1u, std::min(numThreads, (unsigned)std::max(1, numItems)));
+
+    OCIO::SetLoggingFunction(&BufferedLoggingFunction);
+
+    std::vector<std::thread> workers;
+    for (unsigned t = 1; t < numWorkers; ++t)
+    {
+        workers.emplace_back(worker);
+    }
+    worker();
+
+    for (auto & thread : workers)
+    {
+        thread.join();
+    }
+
+    OCIO::ResetToDefaultLoggingFunction();
+
+    return results;
+}
+
+// Try to build the processor of the transform -- this will load any LUTs.
+void CheckTransform(const OCIO::ConstConfigRcPtr & config,
+                    const OCIO::ConstTransformRcPtr & transform,
+                    CheckResult & result)
+{
+    if (transform)
+    {
+        try
+        {
+            OCIO::ConstProcessorRcPtr p = config->getProcessor(transform);
+        }
+        catch (OCIO::Exception & exception)
+        {
+            result.m_errors.push_back(exception.what());
+        }
+    }
+}
+
+// Time spent checking an item, empty unless the timings are requested.
+std::string TimingStr(const CheckResult & result, bool timing)
+{
+    std::ostringstream oss;
+    if (timing)
+    {
+        oss << " [" << std::fixed << std::setprecision(2) << result.m_durationMs << " ms]";
+    }
+    return oss.str();
+}
+
+// Print the check result of a color space, a named transform or a look. Returns false if
+// there was a problem with one of its transforms.
+bool PrintCheckResult(const char * name, const CheckResult & result, bool timing)
+{
+    std::cerr << result.m_log;
+
+    if (!result.m_errors.empty())
+    {
+        std::cout << name;
+        std::cout << " -- error" << TimingStr(result, timing) << std::endl;
+        for (const auto & error : result.m_errors)
+        {
+            std::cout << "\t" << error << std::endl;
+        }
+        return false;
+    }
+
+    std::cout << name << TimingStr(result, timing) << std::endl;
+    return true;
+}
+
 int main(int argc, const char **argv)
 {
     bool help = false;
+    bool timing = false;
+    int threads = 0;
     int errorcount = 0;
     int warningcount = 0;
     std::string inputconfig;
@@ -118,6 +261,9 @@ int main(int argc, const char **argv)
                "--help", &help, "Print help message",
                "--iconfig %s", &inputconfig, "Input .ocio configuration file (default: $OCIO)",
                "--oconfig %s", &outputconfig, "Output .ocio file",
+               "--threads %d", &threads, "Number of threads used to check the transforms "
+                                         "(default: number of cores)",
+               "--timing", &timing, "Print the time spent checking each item and the slowest ones",
                NULL);
 
     if (ap.parse(argc, argv) < 0)
@@ -138,6 +284,12 @@ int main(int argc, const char **argv)
     // Set the logging level to INFO.
     OCIO::SetLoggingLevel(OCIO::LOGGING_LEVEL_INFO);
 
+    const unsigned numThreads
+        = threads > 0 ? (unsigned)threads : std::max(1u, std::thread::hardware_concurrency());
+
+    // Time spent checking each item, to report the slowest ones.
+    std::vector<std::pair<double, std::string>> timings;
+
     try
     {
         OCIO::ConstConfigRcPtr srcConfig;
@@ -236,58 +388,58 @@ int main(int argc, const char **argv)
 
                 // Iterate over all displays & views (active & inactive).
 
+                std::vector<std::pair<std::string, std::string>> displayViews;
                 for (int idxDisp = 0; idxDisp < config->getNumDisplaysAll(); ++idxDisp)
                 {
                     const char * displayName = config->getDisplayAll(idxDisp);
 
-                    // Iterate over shared views.
-                    int numViews = config->getNumViews(OCIO::VIEW_SHARED, displayName);
-                    for (int idxView = 0; idxView < numViews; ++idxView)
+                    // Shared views, then display-defined views.
+                    for (const auto type : { OCIO::VIEW_SHARED, OCIO::VIEW_DISPLAY_DEFINED })
                     {
-                        const char * viewName = config->getView(OCIO::VIEW_SHARED, 
-                                                                displayName, 
-                                                                idxView);
-                        try
-                        {
-                            OCIO::ConstProcessorRcPtr process 
-                                = displayTestConfig->getProcessor(srcColorSpace.c_str(), 
-                                                                  displayName,
-                                                                  viewName,
-                                                                  OCIO::TRANSFORM_DIR_FORWARD);
-
-                            std::cout << "(" << displayName << ", " << viewName << ")"
-                                      << std::endl;
-                        }
-                        catch(OCIO::Exception & exception)
+                        const int numViews = config->getNumViews(type, displayName);
+                        for (int idxView = 0; idxView < numViews; ++idxView)
                         {
-                            std::cout << "ERROR: " << exception.what() << std::endl;
-                            errorcount += 1;
+                            displayViews.emplace_back(displayName,
+                                                      config->getView(type, displayName, idxView));
                         }
                     }
+                }
 
-                    // Iterate over display-defined views.
-                    numViews = config->getNumViews(OCIO::VIEW_DISPLAY_DEFINED, displayName);
-                    for (int idxView = 0; idxView < numViews; ++idxView)
+                const std::vector<CheckResult> results = RunChecks(
+                    (int)displayViews.size(),
+                    numThreads,
+                    [&](int i, CheckResult & result)
                     {
-                        const char * viewName = config->getView(OCIO::VIEW_DISPLAY_DEFINED, 
-                                                                displayName, idxView);
                         try
                         {
-                            OCIO::ConstProcessorRcPtr process 
-                                = displayTestConfig->getProcessor(srcColorSpace.c_str(), 
-                                                                  displayName,
-                                                                  viewName,
+                            OCIO::ConstProcessorRcPtr process
+                                = displayTestConfig->getProcessor(srcColorSpace.c_str(),
+                                                                  displayViews[i].first.c_str(),
+                                                                  displayViews[i].second.c_str(),
                                                                   OCIO::TRANSFORM_DIR_FORWARD);
-
-                            std::cout << "(" << displayName << ", " << viewName << ")"
-                                      << std::endl;
                         }
                         catch(OCIO::Exception & exception)
                         {
-                            std::cout << "ERROR: " << exception.what() << std::endl;
-                            errorcount += 1;
+                            result.m_errors.push_back(exception.what());
                         }
+                    });
+
+                for (size_t i = 0; i < displayViews.size(); ++i)
+                {
+                    const std::string name
+                        = "(" + displayViews[i].first + ", " + displayViews[i].second + ")";
+
+                    std::cerr << results[i].m_log;
+                    if (results[i].m_errors.empty())
+                    {
+                        std::cout << name << TimingStr(results[i], timing) << std::endl;
+                    }
+                    else
+                    {
+                        std::cout << "ERROR: " << results[i].m_errors.front() << std::endl;
+                        errorcount += 1;
                     }
+                    timings.emplace_back(results[i].m_durationMs, name);
                 }
             }
         }
@@ -374,12 +526,30 @@ int main(int argc, const char **argv)
             bool foundCategory = false;
             bool foundNoCategory = false;
 
+            std::vector<OCIO::ConstColorSpaceRcPtr> colorSpaces;
             for(int i=0; i<numCS; ++i)
             {
-                OCIO::ConstColorSpaceRcPtr cs = config->getColorSpace(config->getColorSpaceNameByIndex(
+                colorSpaces.push_back(config->getColorSpace(config->getColorSpaceNameByIndex(
                     OCIO::SEARCH_REFERENCE_SPACE_ALL,
                     OCIO::COLORSPACE_ALL,
-                    i));
+                    i)));
+            }
+
+            // Try to load the transforms for the to_ref and from_ref directions -- this will
+            // load any LUTs.
+            const std::vector<CheckResult> results = RunChecks(
+                numCS,
+                numThreads,
+                [&](int i, CheckResult & result)
+                {
+                    const OCIO::ConstColorSpaceRcPtr & cs = colorSpaces[i];
+                    CheckTransform(config, cs->getTransform(OCIO::COLORSPACE_DIR_TO_REFERENCE), result);
+                    CheckTransform(config, cs->getTransform(OCIO::COLORSPACE_DIR_FROM_REFERENCE), result);
+                });
+
+            for(int i=0; i<numCS; ++i)
+            {
+                const OCIO::ConstColorSpaceRcPtr & cs = colorSpaces[i];
 
                 std::string interopID = cs->getInteropID();
                 if (!interopID.empty())
@@ -396,60 +566,11 @@ int main(int argc, const char **argv)
                     else foundNoCategory = true;
                 }
 
-                // Try to load the transform for the to_ref direction -- this will load any LUTs.
-                bool toRefOK = true;
-                std::string toRefErrorText;
-                try
+                if(!PrintCheckResult(cs->getName(), results[i], timing))
                 {
-                    OCIO::ConstTransformRcPtr t = cs->getTransform(OCIO::COLORSPACE_DIR_TO_REFERENCE);
-                    if(t)
-                    {
-                        OCIO::ConstProcessorRcPtr p = config->getProcessor(t);
-                    }
-                }
-                catch(OCIO::Exception & exception)
-                {
-                    toRefOK = false;
-                    toRefErrorText = exception.what();
-                }
-
-                // Try to load the transform for the from_ref direction -- this will load any LUTs.
-                bool fromRefOK = true;
-                std::string fromRefErrorText;
-                try
-                {
-                    OCIO::ConstTransformRcPtr t = cs->getTransform(OCIO::COLORSPACE_DIR_FROM_REFERENCE);
-                    if(t)
-                    {
-                        OCIO::ConstProcessorRcPtr p = config->getProcessor(t);
-                    }
-                }
-                catch(OCIO::Exception & exception)
-                {
-                    fromRefOK = false;
-                    fromRefErrorText = exception.what();
-                }
-
-                if(!toRefOK || !fromRefOK)
-                {
-                    // There was a problem with one of the color space's transforms.
-                    std::cout << cs->getName();
-                    std::cout << " -- error" << std::endl;
-                    if(!toRefOK)
-                    {
-                        std::cout << "\t" << toRefErrorText << std::endl;
-                    }
-                    if(!fromRefOK)
-                    {
-                        std::cout << "\t" << fromRefErrorText << std::endl;
-                    }
                     errorcount += 1;
                 }
-                else
-                {
-                    // The color space's transforms load ok.
-                    std::cout << cs->getName() << std::endl;
-                }
+                timings.emplace_back(results[i].m_durationMs, cs->getName());
             }
 
             if(foundCategory && foundNoCategory)
@@ -475,71 +596,39 @@ int main(int argc, const char **argv)
             bool foundCategory = false;
             bool foundNoCategory = false;
 
+            std::vector<OCIO::ConstNamedTransformRcPtr> namedTransforms;
             for(int i = 0; i<numNT; ++i)
             {
-                OCIO::ConstNamedTransformRcPtr nt = config->getNamedTransform(
-                    config->getNamedTransformNameByIndex(OCIO::NAMEDTRANSFORM_ALL, i));
+                namedTransforms.push_back(config->getNamedTransform(
+                    config->getNamedTransformNameByIndex(OCIO::NAMEDTRANSFORM_ALL, i)));
+            }
 
-                if(!config->isInactiveColorSpace(nt->getName()))
+            // Try to load the transform and the inverse transform -- this will load any LUTs.
+            const std::vector<CheckResult> results = RunChecks(
+                numNT,
+                numThreads,
+                [&](int i, CheckResult & result)
                 {
-                    if(nt->getNumCategories() > 0) foundCategory = true;
-                    else foundNoCategory = true;
-                }
+                    const OCIO::ConstNamedTransformRcPtr & nt = namedTransforms[i];
+                    CheckTransform(config, nt->getTransform(OCIO::TRANSFORM_DIR_FORWARD), result);
+                    CheckTransform(config, nt->getTransform(OCIO::TRANSFORM_DIR_INVERSE), result);
+                });
 
-                // Try to load the transform -- this will load any LUTs.
-                bool fwdOK = true;
-                std::string fwdErrorText;
-                try
-                {
-                    OCIO::ConstTransformRcPtr t = nt->getTransform(OCIO::TRANSFORM_DIR_FORWARD);
-                    if(t)
-                    {
-                        OCIO::ConstProcessorRcPtr p = config->getProcessor(t);
-                    }
-                }
-                catch(OCIO::Exception & exception)
-                {
-                    fwdOK = false;
-                    fwdErrorText = exception.what();
-                }
+            for(int i = 0; i<numNT; ++i)
+            {
+                const OCIO::ConstNamedTransformRcPtr & nt = namedTransforms[i];
 
-                // Try to load the inverse_transform -- this will load any LUTs.
-                bool invOK = true;
-                std::string invErrorText;
-                try
-                {
-                    OCIO::ConstTransformRcPtr t = nt->getTransform(OCIO::TRANSFORM_DIR_INVERSE);
-                    if(t)
-                    {
-                        OCIO::ConstProcessorRcPtr p = config->getProcessor(t);
-                    }
-                }
-                catch(OCIO::Exception & exception)
+                if(!config->isInactiveColorSpace(nt->getName()))
                 {
-                    invOK = false;
-                    invErrorText = exception.what();
+                    if(nt->getNumCategories() > 0) foundCategory = true;
+                    else foundNoCategory = true;
                 }
 
-                if(!fwdOK || !invOK)
+                if(!PrintCheckResult(nt->getName(), results[i], timing))
                 {
-                    // There was a problem with one of the named transform's transforms.
-                    std::cout << nt->getName();
-                    std::cout << " -- error" << std::endl;
-                    if(!fwdOK)
-                    {
-                        std::cout << "\t" << fwdErrorText << std::endl;
-                    }
-                    if(!invOK)
-                    {
-                        std::cout << "\t" << invErrorText << std::endl;
-                    }
                     errorcount += 1;
                 }
-                else
-                {
-                    // The named transform's transforms load ok.
-                    std::cout << nt->getName() << std::endl;
-                }
+                timings.emplace_back(results[i].m_durationMs, nt->getName());
             }
 
             if(foundCategory && foundNoCategory)
@@ -561,65 +650,51 @@ int main(int argc, const char **argv)
                 std::cout << "no looks defined" << std::endl;
             }
 
+            std::vector<OCIO::ConstLookRcPtr> looks;
             for(int i=0; i<numL; ++i)
             {
-                OCIO::ConstLookRcPtr look = config->getLook(config->getLookNameByIndex(i)); 
-
-                // Try to load the transform -- this will load any LUTs.
-                bool fwdOK = true;
-                std::string fwdErrorText;
-                try
-                {
-                    OCIO::ConstTransformRcPtr t = look->getTransform();
-                    if(t)
-                    {
-                        OCIO::ConstProcessorRcPtr p = config->getProcessor(t);
-                    }
-                }
-                catch(OCIO::Exception & exception)
-                {
-                    fwdOK = false;
-                    fwdErrorText = exception.what();
-                }
+                looks.push_back(config->getLook(config->getLookNameByIndex(i)));
+            }
 
-                // Try to load the inverse transform -- this will load any LUTs.
-                bool invOK = true;
-                std::string invErrorText;
-                try
-                {
-                    OCIO::ConstTransformRcPtr t = look->getInverseTransform();
-                    if(t)
-                    {
-                        OCIO::ConstProcessorRcPtr p = config->getProcessor(t);
-                    }
-                }
-                catch(OCIO::Exception & exception)
+            // Try to load the transform and the inverse transform -- this will load any LUTs.
+            const std::vector<CheckResult> results = RunChecks(
+                numL,
+                numThreads,
+                [&](int i, CheckResult & result)
                 {
-                    invOK = false;
-                    invErrorText = exception.what();
-                }
+                    CheckTransform(config, looks[i]->getTransform(), result);
+                    CheckTransform(config, looks[i]->getInverseTransform(), result);
+                });
 
-                if(!fwdOK || !invOK)
+            for(int i=0; i<numL; ++i)
+            {
+                if(!PrintCheckResult(looks[i]->getName(), results[i], timing))
                 {
-                    // There was a problem with one of the look transform's transforms.
-                    std::cout << look->getName();
-                    std::cout << " -- error" << std::endl;
-                    if(!fwdOK)
-                    {
-                        std::cout << "\t" << fwdErrorText << std::endl;
-                    }
-                    if(!invOK)
-                    {
-                        std::cout << "\t" << invErrorText << std::endl;
-                    }
                     errorcount += 1;
                 }
-                else
-                {
-                    // The look transform's transforms load ok.
-                    std::cout << look->getName() << std::endl;
-                }
+                timings.emplace_back(results[i].m_durationMs, looks[i]->getName());
+            }
+        }
+
+        if (timing && !timings.empty())
+        {
+            std::cout << std::endl;
+            std::cout << "** Slowest items **" << std::endl;
+
+            std::stable_sort(timings.begin(), timings.end(),
+                             [](const std::pair<double, std::string> & a,
+                                const std::pair<double, std::string> & b)
+                             {
+                                 return a.first > b.first;
+                             });
+
+            const size_t numSlowest = std::min<size_t>(10, timings.size());
+            for (size_t i = 0; i < numSlowest; ++i)
+            {
+                std::cout << std::fixed << std::setprecision(2) << std::setw(10)
+                          << timings[i].first << " ms  " << timings[i].second << std::endl;
             }
+            std::cout.unsetf(std::ios_base::floatfield);
         }
 
         std::cout << std::endl;
@@ -12,6 +12,7 @@
 namespace OCIO = OCIO_NAMESPACE;
 
 #include "apputils/argparse.h"
+#include "utils/FrameUtils.h"
 
 #ifdef OCIO_GPU_ENABLED
 #include "oglapp.h"
@@ -41,6 +42,100 @@ bool StringToFloat(float * fval, const char * str);
 
 bool StringToInt(int * ival, const char * str);
 
+OCIO::BitDepth GetOutputBitDepth(OCIO::BitDepth inputBitDepth, OCIO::BitDepth userOutputBitDepth);
+
+int StreamConvert(const OCIO::ConstConfigRcPtr & config,
+                  const OCIO::ConstProcessorRcPtr & processor,
+                  const std::string & inputimage,
+                  const std::string & outputimage,
+                  const char * outputcolorspace,
+                  const std::vector<int> & frames,
+                  OCIO::BitDepth userOutputBitDepth,
+                  int blockHeight,
+                  const std::vector<std::string> & floatAttrs,
+                  const std::vector<std::string> & intAttrs,
+                  const std::vector<std::string> & stringAttrs,
+                  bool verbose);
+
+// Set the "name=value" attributes on the output image (i.e. an ImageIO or an ImageWriter).
+// Return false if any of them could not be parsed.
+template<typename Image>
+bool SetImageAttributes(Image & img,
+                        const std::vector<std::string> & floatAttrs,
+                        const std::vector<std::string> & intAttrs,
+                        const std::vector<std::string> & stringAttrs)
+{
+    bool parseError = false;
+    for (unsigned int i=0; i<floatAttrs.size(); ++i)
+    {
+        std::string name, value;
+        float fval = 0.0f;
+
+        if (!ParseNameValuePair(name, value, floatAttrs[i]) ||
+           !StringToFloat(&fval,value.c_str()))
+        {
+            std::cerr << "ERROR: Attribute string '" << floatAttrs[i]
+                      << "' should be in the form name=floatvalue." << std::endl;
+            parseError = true;
+            continue;
+        }
+
+        img.attribute(name, fval);
+    }
+
+    for (unsigned int i=0; i<intAttrs.size(); ++i)
+    {
+        std::string name, value;
+        int ival = 0;
+        if (!ParseNameValuePair(name, value, intAttrs[i]) ||
+           !StringToInt(&ival,value.c_str()))
+        {
+            std::cerr << "ERROR: Attribute string '" << intAttrs[i]
+                      << "' should be in the form name=intvalue." << std::endl;
+            parseError = true;
+            continue;
+        }
+
+        img.attribute(name, ival);
+    }
+
+    for (unsigned int i=0; i<stringAttrs.size(); ++i)
+    {
+        std::string name, value;
+        if (!ParseNameValuePair(name, value, stringAttrs[i]))
+        {
+            std::cerr << "ERROR: Attribute string '" << stringAttrs[i]
+                      << "' should be in the form name=value." << std::endl;
+            parseError = true;
+            continue;
+        }
+
+        img.attribute(name, value);
+    }
+
+    return !parseError;
+}
+
+// Set the output color space and its interop ID (if available) on the output image.
+template<typename Image>
+void SetOutputColorSpace(Image & img,
+                         const OCIO::ConstConfigRcPtr & config,
+                         const char * outputcolorspace)
+{
+    if (outputcolorspace)
+    {
+        img.attribute("oiio:ColorSpace", outputcolorspace);
+
+        // Set the color space interopID if available.
+        auto cs = config->getColorSpace(outputcolorspace);
+        const char* interopID = cs ? cs->getInteropID() : nullptr;
+        if(interopID && *interopID)
+        {
+            img.attribute("colorInteropID", interopID);
+        }
+    }
+}
+
 int main(int argc, const char **argv)
 {
     ArgParse ap;
@@ -62,6 +157,9 @@ int main(int argc, const char **argv)
     bool useInvertView          = false;
     bool useNamedTransform      = false;
     bool useInvNamedTransform   = false;
+    bool useStream              = false;
+    int blockHeight             = 64;
+    std::string frameRange;
 
     ap.options("ocioconvert -- apply colorspace transform to an image \n\n"
                "usage: ocioconvert [options] inputimage inputcolorspace outputimage outputcolorspace\n"
@@ -95,6 +193,14 @@ int main(int argc, const char **argv)
                                                        "for outputimage",
                "--string-attribute %L", &stringAttrs,  "\"name=string\" pair defining a string attribute "
                                                        "for outputimage",
+               "<SEPARATOR>", "\nStreaming options (CPU only):",
+               "--stream",              &useStream,    "Read, process and write the image by blocks of scanlines "
+                                                       "on separate threads instead of loading the whole image",
+               "--blockheight %d",      &blockHeight,  "Number of scanlines of a block when streaming (default: 64)",
+               "--frames %s",           &frameRange,   "Convert the frame range \"first-last\" (or a single frame) "
+                                                       "reusing the same processor, the '#' characters of "
+                                                       "inputimage and outputimage are replaced by the "
+                                                       "zero-padded frame number (implies --stream)",
                NULL
                );
 
@@ -120,6 +226,27 @@ int main(int argc, const char **argv)
     }
 #endif // OCIO_GPU_ENABLED
 
+    if ((useStream || !frameRange.empty()) && (usegpu || outputgpuInfo || usegpuLegacy))
+    {
+        std::cerr << "ERROR: Options stream & frames are only available for CPU processing.";
+        std::cerr << std::endl;
+        exit(1);
+    }
+
+    if (blockHeight <= 0)
+    {
+        std::cerr << "ERROR: The block height must be positive." << std::endl;
+        exit(1);
+    }
+
+    std::vector<int> frames;
+    if (!frameRange.empty() && !FrameUtils::ParseFrameRange(frames, frameRange))
+    {
+        std::cerr << "ERROR: Frame range '" << frameRange
+                  << "' should be in the form first-last or frame." << std::endl;
+        exit(1);
+    }
+
     OCIO::BitDepth userOutputBitDepth = OCIO::BIT_DEPTH_UNKNOWN;
     if (!outputDepth.empty())
     {
@@ -327,6 +454,93 @@ int main(int argc, const char **argv)
         std::cout << "Using GPU color processing." << std::endl;
     }
 
+    // Get the processor, it does not depend on the image(s).
+    OCIO::ConstProcessorRcPtr processor;
+
+    try
+    {
+        if (useLut)
+        {
+            // Create the OCIO processor for the specified transform.
+            OCIO::FileTransformRcPtr t = OCIO::FileTransform::Create();
+            t->setSrc(lutFile);
+            t->setInterpolation(OCIO::INTERP_BEST);
+
+            processor = config->getProcessor(t);
+        }
+        else if (useDisplayView)
+        {
+            OCIO::DisplayViewTransformRcPtr t = OCIO::DisplayViewTransform::Create();
+            t->setSrc(inputcolorspace);
+            t->setDisplay(display);
+            t->setView(view);
+            processor = config->getProcessor(t);
+        }
+        else if (useInvertView)
+        {
+            OCIO::DisplayViewTransformRcPtr t = OCIO::DisplayViewTransform::Create();
+            t->setSrc(outputcolorspace);
+            t->setDisplay(display);
+            t->setView(view);
+            processor = config->getProcessor(t, OCIO::TRANSFORM_DIR_INVERSE);
+        }
+        else if (useNamedTransform)
+        {
+            auto nt = config->getNamedTransform(namedtransform);
+
+            if (nt)
+            {
+                processor = config->getProcessor(nt, OCIO::TRANSFORM_DIR_FORWARD);
+            }
+            else
+            {
+               std::cout << "ERROR: Could not get NamedTransform " << namedtransform << std::endl;
+               exit(1);
+            }                
+        }
+        else if (useInvNamedTransform)
+        {
+            auto nt = config->getNamedTransform(namedtransform);
+
+            if (nt)
+            {
+                processor = config->getProcessor(nt, OCIO::TRANSFORM_DIR_INVERSE);
+            }
+            else
+            {
+                std::cout << "ERROR: Could not get NamedTransform " << namedtransform << std::endl;
+                exit(1);
+            }
+        }
+        else
+        {
+            processor = config->getProcessor(inputcolorspace, outputcolorspace);
+        }
+    }
+    catch (const OCIO::Exception & e)
+    {
+        std::cout << "ERROR: OCIO failed with: " << e.what() << std::endl;
+        exit(1);
+    }
+    catch (...)
+    {
+        std::cout << "ERROR: Creating processor unknown failure." << std::endl;
+        exit(1);
+    }
+
+    if (useStream || !frames.empty())
+    {
+        if (useDisplayView)
+        {
+            outputcolorspace = config->getDisplayViewColorSpaceName(display, view);
+        }
+
+        return StreamConvert(config, processor,
+                             inputimage, outputimage, outputcolorspace,
+                             frames, userOutputBitDepth, blockHeight,
+                             floatAttrs, intAttrs, stringAttrs, verbose);
+    }
+
     OCIO::ImageIO imgInput;
     OCIO::ImageIO imgOutputCPU;
     // Default is to perform in-place conversion.
@@ -407,80 +621,6 @@ int main(int argc, const char **argv)
     // Process the image.
     try
     {
-        // Get the processor.
-        OCIO::ConstProcessorRcPtr processor;
-
-        try
-        {
-            if (useLut)
-            {
-                // Create the OCIO processor for the specified transform.
-                OCIO::FileTransformRcPtr t = OCIO::FileTransform::Create();
-                t->setSrc(lutFile);
-                t->setInterpolation(OCIO::INTERP_BEST);
-    
-                processor = config->getProcessor(t);
-            }
-            else if (useDisplayView)
-            {
-                OCIO::DisplayViewTransformRcPtr t = OCIO::DisplayViewTransform::Create();
-                t->setSrc(inputcolorspace);
-                t->setDisplay(display);
-                t->setView(view);
-                processor = config->getProcessor(t);
-            }
-            else if (useInvertView)
-            {
-                OCIO::DisplayViewTransformRcPtr t = OCIO::DisplayViewTransform::Create();
-                t->setSrc(outputcolorspace);
-                t->setDisplay(display);
-                t->setView(view);
-                processor = config->getProcessor(t, OCIO::TRANSFORM_DIR_INVERSE);
-            }
-            else if (useNamedTransform)
-            {
-                auto nt = config->getNamedTransform(namedtransform);
-
-                if (nt)
-                {
-                    processor = config->getProcessor(nt, OCIO::TRANSFORM_DIR_FORWARD);
-                }
-                else
-                {
-                   std::cout << "ERROR: Could not get NamedTransform " << namedtransform << std::endl;
-                   exit(1);
-                }                
-            }
-            else if (useInvNamedTransform)
-            {
-                auto nt = config->getNamedTransform(namedtransform);
-
-                if (nt)
-                {
-                    processor = config->getProcessor(nt, OCIO::TRANSFORM_DIR_INVERSE);
-                }
-                else
-                {
-                    std::cout << "ERROR: Could not get NamedTransform " << namedtransform << std::endl;
-                    exit(1);
-                }
-            }
-            else
-            {
-                processor = config->getProcessor(inputcolorspace, outputcolorspace);
-            }
-        }
-        catch (const OCIO::Exception & e)
-        {
-            std::cout << "ERROR: OCIO failed with: " << e.what() << std::endl;
-            exit(1);
-        }
-        catch (...)
-        {
-            std::cout << "ERROR: Creating processor unknown failure." << std::endl;
-            exit(1);
-        }
-
 #ifdef OCIO_GPU_ENABLED
         if (usegpu || usegpuLegacy)
         {
@@ -505,40 +645,16 @@ int main(int argc, const char **argv)
                 Set the bit-depth of the output buffer.
 
                 Whereas the GPU processor always work on float data, the CPU processor
-                can be optimised for a specific input and output bit-depth.
-
-                The converted image may require more bits than the source image.
-                For example, converting a log image to linear requires at least a half-float
-                output format. For most cases, half-float strikes a good balance between
-                precision and storage space. But if the input depth would lose precision
-                when converted to half-float, use float for the output depth instead.
+                can be optimised for a specific input and output bit-depth (refer to
+                GetOutputBitDepth()).
 
                 Note that when using OpenImageIO, the actual output bit-depth may be overrided
                 if the file format doesn't support it. OCIO is not trying to analyze the filename
                 to emulate OpenImageIO's decision making process.
             */
             const OCIO::BitDepth inputBitDepth = imgInput.getBitDepth();
-            OCIO::BitDepth outputBitDepth;
-
-            if (userOutputBitDepth != OCIO::BIT_DEPTH_UNKNOWN)
-            {
-                outputBitDepth = userOutputBitDepth;
-            }
-            else
-            {
-                if (inputBitDepth == OCIO::BIT_DEPTH_UINT16 || inputBitDepth == OCIO::BIT_DEPTH_F32)
-                {
-                    outputBitDepth = OCIO::BIT_DEPTH_F32;
-                }
-                else if (inputBitDepth == OCIO::BIT_DEPTH_UINT8 || inputBitDepth == OCIO::BIT_DEPTH_F16)
-                {
-                    outputBitDepth = OCIO::BIT_DEPTH_F16;
-                }
-                else
-                {
-                    throw OCIO::Exception("Unsupported input bitdepth, must be uint8, uint16, half or float.");
-                }
-            }
+            const OCIO::BitDepth outputBitDepth
+                = GetOutputBitDepth(inputBitDepth, userOutputBitDepth);
 
             OCIO::ConstCPUProcessorRcPtr cpuProcessor
                 = processor->getOptimizedCPUProcessor(inputBitDepth,
@@ -594,53 +710,7 @@ int main(int argc, const char **argv)
     }
 
     // Set the provided image attributes.
-    bool parseError = false;
-    for (unsigned int i=0; i<floatAttrs.size(); ++i)
-    {
-        std::string name, value;
-        float fval = 0.0f;
-
-        if (!ParseNameValuePair(name, value, floatAttrs[i]) ||
-           !StringToFloat(&fval,value.c_str()))
-        {
-            std::cerr << "ERROR: Attribute string '" << floatAttrs[i]
-                      << "' should be in the form name=floatvalue." << std::endl;
-            parseError = true;
-            continue;
-        }
-
-        imgOutput->attribute(name, fval);
-    }
-
-    for (unsigned int i=0; i<intAttrs.size(); ++i)
-    {
-        std::string name, value;
-        int ival = 0;
-        if (!ParseNameValuePair(name, value, intAttrs[i]) ||
-           !StringToInt(&ival,value.c_str()))
-        {
-            std::cerr << "ERROR: Attribute string '" << intAttrs[i]
-                      << "' should be in the form name=intvalue." << std::endl;
-            parseError = true;
-            continue;
-        }
-
-        imgOutput->attribute(name, ival);
-    }
-
-    for (unsigned int i=0; i<stringAttrs.size(); ++i)
-    {
-        std::string name, value;
-        if (!ParseNameValuePair(name, value, stringAttrs[i]))
-        {
-            std::cerr << "ERROR: Attribute string '" << stringAttrs[i]
-                      << "' should be in the form name=value." << std::endl;
-            parseError = true;
-            continue;
-        }
-
-        imgOutput->attribute(name, value);
-    }
+    const bool parseError = !SetImageAttributes(*imgOutput, floatAttrs, intAttrs, stringAttrs);
 
     if (parseError)
     {
@@ -655,18 +725,7 @@ int main(int argc, const char **argv)
             outputcolorspace = config->getDisplayViewColorSpaceName(display, view);
         }
 
-        if (outputcolorspace)
-        {
-            imgOutput->attribute("oiio:ColorSpace", outputcolorspace);
-
-            // Set the color space interopID if available.
-            auto cs = config->getColorSpace(outputcolorspace);
-            const char* interopID = cs ? cs->getInteropID() : nullptr;
-            if(interopID && *interopID)
-            {
-                imgOutput->attribute("colorInteropID", interopID);
-            }
-        }
+        SetOutputColorSpace(*imgOutput, config, outputcolorspace);
 
         imgOutput->write(outputimage, userOutputBitDepth);
     }
@@ -744,3 +803,178 @@ bool StringToInt(int * ival, const char * str)
     }
     return true;
 }
+
+/*
+    Get the bit-depth of the output buffer.
+
+    The converted image may require more bits than the source image.
+    For example, converting a log image to linear requires at least a half-float
+    output format. For most cases, half-float strikes a good balance between
+    precision and storage space. But if the input depth would lose precision
+    when converted to half-float, use float for the output depth instead.
+*/
+OCIO::BitDepth GetOutputBitDepth(OCIO::BitDepth inputBitDepth, OCIO::BitDepth userOutputBitDepth)
+{
+    if (userOutputBitDepth != OCIO::BIT_DEPTH_UNKNOWN)
+    {
+        return userOutputBitDepth;
+    }
+
+    if (inputBitDepth == OCIO::BIT_DEPTH_UINT16 || inputBitDepth == OCIO::BIT_DEPTH_F32)
+    {
+        return OCIO::BIT_DEPTH_F32;
+    }
+    else if (inputBitDepth == OCIO::BIT_DEPTH_UINT8 || inputBitDepth == OCIO::BIT_DEPTH_F16)
+    {
+        return OCIO::BIT_DEPTH_F16;
+    }
+
+    throw OCIO::Exception("Unsupported input bitdepth, must be uint8, uint16, half or float.");
+}
+
+// Convert the image, or each image of the frame sequence, by blocks of scanlines flowing
+// through a read -> process -> write pipeline (see OCIO::StreamImage()). The whole image
+// is never in memory and the I/O overlaps with the processing. All the frames reuse the
+// same processor.
+int StreamConvert(const OCIO::ConstConfigRcPtr & config,
+                  const OCIO::ConstProcessorRcPtr & processor,
+                  const std::string & inputimage,
+                  const std::string & outputimage,
+                  const char * outputcolorspace,
+                  const std::vector<int> & frames,
+                  OCIO::BitDepth userOutputBitDepth,
+                  int blockHeight,
+                  const std::vector<std::string> & floatAttrs,
+                  const std::vector<std::string> & intAttrs,
+                  const std::vector<std::string> & stringAttrs,
+                  bool verbose)
+{
+    // Pairs of input & output image names.
+    std::vector<std::pair<std::string, std::string>> images;
+
+    try
+    {
+        if (frames.empty())
+        {
+            images.emplace_back(inputimage, outputimage);
+        }
+
+        for (int frame : frames)
+        {
+            std::string inputName, outputName;
+            if (!FrameUtils::ExpandFramePattern(inputName, inputimage, frame)
+                || !FrameUtils::ExpandFramePattern(outputName, outputimage, frame))
+            {
+                std::ostringstream os;
+                os << "The image names '" << inputimage << "' and '" << outputimage
+                   << "' must have the '#' frame number characters.";
+                throw OCIO::Exception(os.str().c_str());
+            }
+            images.emplace_back(inputName, outputName);
+        }
+    }
+    catch (const OCIO::Exception & e)
+    {
+        std::cerr << "ERROR: " << e.what() << std::endl;
+        return 1;
+    }
+
+    // The CPU processor is only fetched again if the bit-depths change between frames.
+    OCIO::ConstCPUProcessorRcPtr cpuProcessor;
+
+    for (const auto & image : images)
+    {
+        std::cout << std::endl;
+        std::cout << "Streaming " << image.first << std::endl;
+
+        try
+        {
+            OCIO::ImageReader reader(image.first);
+            std::cout << reader.getImageDescStr() << std::endl;
+
+            const long width                     = reader.getWidth();
+            const OCIO::ChannelOrdering chanOrder = reader.getChannelOrder();
+            const OCIO::BitDepth inputBitDepth   = reader.getBitDepth();
+            const OCIO::BitDepth outputBitDepth
+                = GetOutputBitDepth(inputBitDepth, userOutputBitDepth);
+
+            if (!cpuProcessor
+                || cpuProcessor->getInputBitDepth() != inputBitDepth
+                || cpuProcessor->getOutputBitDepth() != outputBitDepth)
+            {
+                cpuProcessor = processor->getOptimizedCPUProcessor(inputBitDepth,
+                                                                   outputBitDepth,
+                                                                   OCIO::OPTIMIZATION_DEFAULT);
+            }
+
+            OCIO::ImageWriter writer(reader, outputBitDepth, userOutputBitDepth);
+
+            if (!SetImageAttributes(writer, floatAttrs, intAttrs, stringAttrs))
+            {
+                return 1;
+            }
+            SetOutputColorSpace(writer, config, outputcolorspace);
+
+            writer.open(image.second);
+
+            const std::chrono::high_resolution_clock::time_point start
+                = std::chrono::high_resolution_clock::now();
+
+            OCIO::StreamImage(
+                reader,
+                writer,
+                [&](long yBegin, long yEnd, uint8_t * src, uint8_t * dst)
+                {
+                    OCIO::PackedImageDesc srcDesc(src, width, yEnd - yBegin,
+                                                  chanOrder, inputBitDepth,
+                                                  OCIO::AutoStride,
+                                                  OCIO::AutoStride,
+                                                  OCIO::AutoStride);
+                    if (src == dst)
+                    {
+                        cpuProcessor->apply(srcDesc);
+                    }
+                    else
+                    {
+                        OCIO::PackedImageDesc dstDesc(dst, width, yEnd - yBegin,
+                                                      chanOrder, outputBitDepth,
+                                                      OCIO::AutoStride,
+                                                      OCIO::AutoStride,
+                                                      OCIO::AutoStride);
+                        cpuProcessor->apply(srcDesc, dstDesc);
+                    }
+                },
+                blockHeight);
+
+            writer.close();
+
+            if (verbose)
+            {
+                const std::chrono::high_resolution_clock::time_point end
+                    = std::chrono::high_resolution_clock::now();
+
+                std::chrono::duration<float, std::milli> duration = end - start;
+
+                std::cout << std::endl;
+                std::cout << "Streaming (read, CPU processing & write) took: "
+                          << duration.count()
+                          <<  " ms" << std::endl;
+            }
+
+            std::cout << "Wrote " << image.second << std::endl;
+            std::cout << writer.getImageDescStr() << std::endl;
+        }
+        catch (const std::exception & e)
+        {
+            std::cerr << "ERROR: Converting \"" << image.first << "\" failed: " << e.what() << std::endl;
+            return 1;
+        }
+        catch (...)
+        {
+            std::cerr << "ERROR: Converting \"" << image.first << "\" failed." << std::endl;
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,1191 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "benchmarks.h"
+#include "utils/NumberUtils.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+namespace
+{
+
+struct BenchmarkResult
+{
+    std::string m_name;
+    // Number of processed pixels per iteration (0 for the benchmarks not processing an image).
+    size_t m_numPixels = 0;
+
+    double m_min  = 0.;
+    double m_mean = 0.;
+    double m_p50  = 0.;
+    double m_p90  = 0.;
+    double m_p99  = 0.;
+    double m_max  = 0.;
+
+    // Millions of pixels processed per second, based on the median time.
+    double getThroughput() const
+    {
+        return (m_numPixels > 0 && m_p50 > 0.) ? double(m_numPixels) / (m_p50 * 1000.) : 0.;
+    }
+};
+
+// Compute the percentile (in [0, 100]) of sorted values using a linear interpolation between
+// the closest ranks.
+double Percentile(const std::vector<double> & sortedValues, double percentile)
+{
+    if (sortedValues.empty())
+    {
+        return 0.;
+    }
+
+    const double rank = percentile / 100. * double(sortedValues.size() - 1);
+    const size_t lower = static_cast<size_t>(std::floor(rank));
+    const size_t upper = std::min(lower + 1, sortedValues.size() - 1);
+    const double frac = rank - double(lower);
+
+    return sortedValues[lower] + frac * (sortedValues[upper] - sortedValues[lower]);
+}
+
+void WriteJSONString(std::ostream & os, const std::string & str)
+{
+    os << '"';
+    for (const char c : str)
+    {
+        switch (c)
+        {
+            case '"':  os << "\\\""; break;
+            case '\\': os << "\\\\"; break;
+            case '\n': os << "\\n";  break;
+            case '\r': os << "\\r";  break;
+            case '\t': os << "\\t";  break;
+            default:
+            {
+                if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    char buffer[8];
+                    std::snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<unsigned>(c));
+                    os << buffer;
+                }
+                else
+                {
+                    os << c;
+                }
+                break;
+            }
+        }
+    }
+    os << '"';
+}
+
+// Read the median times of the benchmarks from a JSON file written by writeJSON(). It is a
+// minimal JSON parser so the layout of the file does not matter, and the unknown members are
+// skipped.
+class BaselineReader
+{
+public:
+    BaselineReader() = delete;
+    BaselineReader(const BaselineReader &) = delete;
+
+    BaselineReader(const std::string & text, const std::string & filename)
+        :   m_text(text)
+        ,   m_filename(filename)
+    {
+    }
+
+    std::map<std::string, double> read()
+    {
+        std::map<std::string, double> baseline;
+
+        expect('{');
+        if (!consume('}'))
+        {
+            do
+            {
+                const std::string key = readString();
+                expect(':');
+                if (key == "benchmarks")
+                {
+                    readBenchmarks(baseline);
+                }
+                else
+                {
+                    skipValue();
+                }
+            }
+            while (consume(','));
+            expect('}');
+        }
+
+        skipSpaces();
+        if (m_pos != m_text.size())
+        {
+            throwError("unexpected data after the root object.");
+        }
+
+        return baseline;
+    }
+
+private:
+    void readBenchmarks(std::map<std::string, double> & baseline)
+    {
+        expect('[');
+        if (consume(']'))
+        {
+            return;
+        }
+
+        do
+        {
+            std::string name;
+            double p50 = -1.;
+
+            expect('{');
+            if (!consume('}'))
+            {
+                do
+                {
+                    const std::string key = readString();
+                    expect(':');
+                    if (key == "name")
+                    {
+                        name = readString();
+                    }
+                    else if (key == "p50_ms")
+                    {
+                        p50 = readNumber();
+                    }
+                    else
+                    {
+                        skipValue();
+                    }
+                }
+                while (consume(','));
+                expect('}');
+            }
+
+            if (name.empty() || p50 < 0.)
+            {
+                throwError("a benchmark has no name or no p50_ms value.");
+            }
+            baseline[name] = p50;
+        }
+        while (consume(','));
+        expect(']');
+    }
+
+    void skipSpaces()
+    {
+        while (m_pos < m_text.size()
+               && (m_text[m_pos] == ' ' || m_text[m_pos] == '\t'
+                   || m_text[m_pos] == '\n' || m_text[m_pos] == '\r'))
+        {
+            ++m_pos;
+        }
+    }
+
+    char peek()
+    {
+        skipSpaces();
+        if (m_pos == m_text.size())
+        {
+            throwError("unexpected end of file.");
+        }
+        return m_text[m_pos];
+    }
+
+    bool consume(char c)
+    {
+        if (peek() == c)
+        {
+            ++m_pos;
+            return true;
+        }
+        return false;
+    }
+
+    void expect(char c)
+    {
+        if (!consume(c))
+        {
+            std::ostringstream oss;
+            oss << "expected '" << c << "'.";
+            throwError(oss.str());
+        }
+    }
+
+    void expectWord(const char * word)
+    {
+        const size_t length = std::char_traits<char>::length(word);
+        if (m_text.compare(m_pos, length, word) != 0)
+        {
+            throwError("invalid value.");
+        }
+        m_pos += length;
+    }
+
+    std::string readString()
+    {
+        expect('"');
+
+        std::string str;
+        while (true)
+        {
+            if (m_pos == m_text.size())
+            {
+                throwError("unterminated string.");
+            }
+
+            const char c = m_text[m_pos++];
+            if (c == '"')
+            {
+                return str;
+            }
+            if (c != '\\')
+            {
+                str += c;
+                continue;
+            }
+
+            if (m_pos == m_text.size())
+            {
+                throwError("unterminated string.");
+            }
+
+            const char escaped = m_text[m_pos++];
+            switch (escaped)
+            {
+                case '"':
+                case '\\':
+                case '/': str += escaped; break;
+                case 'b': str += '\b';    break;
+                case 'f': str += '\f';    break;
+                case 'n': str += '\n';    break;
+                case 'r': str += '\r';    break;
+                case 't': str += '\t';    break;
+                case 'u':
+                {
+                    if (m_pos + 4 > m_text.size())
+                    {
+                        throwError("invalid unicode escape sequence.");
+                    }
+                    unsigned code = 0;
+                    for (size_t idx = 0; idx < 4; ++idx)
+                    {
+                        const char h = m_text[m_pos++];
+                        code <<= 4;
+                        if (h >= '0' && h <= '9')      code += unsigned(h - '0');
+                        else if (h >= 'a' && h <= 'f') code += unsigned(h - 'a' + 10);
+                        else if (h >= 'A' && h <= 'F') code += unsigned(h - 'A' + 10);
+                        else throwError("invalid unicode escape sequence.");
+                    }
+
+                    // UTF-8 encoding of the code point.
+                    if (code < 0x80)
+                    {
+                        str += char(code);
+                    }
+                    else if (code < 0x800)
+                    {
+                        str += char(0xC0 | (code >> 6));
+                        str += char(0x80 | (code & 0x3F));
+                    }
+                    else
+                    {
+                        str += char(0xE0 | (code >> 12));
+                        str += char(0x80 | ((code >> 6) & 0x3F));
+                        str += char(0x80 | (code & 0x3F));
+                    }
+                    break;
+                }
+                default:
+                    throwError("invalid escape sequence.");
+            }
+        }
+    }
+
+    double readNumber()
+    {
+        skipSpaces();
+
+        const char * first = m_text.c_str() + m_pos;
+        const char * last  = m_text.c_str() + m_text.size();
+
+        double value = 0.;
+        const auto result = NumberUtils::from_chars(first, last, value);
+        if (result.ec != std::errc() || result.ptr == first)
+        {
+            throwError("invalid number.");
+        }
+
+        m_pos += size_t(result.ptr - first);
+        return value;
+    }
+
+    void skipValue()
+    {
+        const char c = peek();
+        if (c == '"')
+        {
+            readString();
+        }
+        else if (c == '{' || c == '[')
+        {
+            const char closing = (c == '{') ? '}' : ']';
+            ++m_pos;
+            if (!consume(closing))
+            {
+                do
+                {
+                    if (c == '{')
+                    {
+                        readString();
+                        expect(':');
+                    }
+                    skipValue();
+                }
+                while (consume(','));
+                expect(closing);
+            }
+        }
+        else if (c == 't')
+        {
+            expectWord("true");
+        }
+        else if (c == 'f')
+        {
+            expectWord("false");
+        }
+        else if (c == 'n')
+        {
+            expectWord("null");
+        }
+        else
+        {
+            readNumber();
+        }
+    }
+
+    [[noreturn]] void throwError(const std::string & reason) const
+    {
+        std::ostringstream oss;
+        oss << "Error parsing the baseline file '" << m_filename << "' at offset " << m_pos
+            << ": " << reason;
+        throw Exception(oss.str().c_str());
+    }
+
+    const std::string m_text;
+    const std::string m_filename;
+    size_t m_pos = 0;
+};
+
+class BenchmarkRunner
+{
+public:
+    BenchmarkRunner() = delete;
+    BenchmarkRunner(const BenchmarkRunner &) = delete;
+
+    explicit BenchmarkRunner(const BenchmarkOptions & options)
+        :   m_options(options)
+    {
+    }
+
+    bool isSelected(const std::string & name) const
+    {
+        return m_options.m_filter.empty() || name.find(m_options.m_filter) != std::string::npos;
+    }
+
+    // Measure the function for the requested number of iterations. The optional prepare
+    // function is called before each iteration and is not measured.
+    void run(const std::string & name,
+             size_t numPixels,
+             const std::function<void()> & func,
+             const std::function<void()> & prepare = nullptr)
+    {
+        if (!isSelected(name))
+        {
+            return;
+        }
+
+        const unsigned iterations = std::max(m_options.m_iterations, 1u);
+
+        std::vector<double> times;
+        times.reserve(iterations);
+
+        for (unsigned iter = 0; iter < iterations; ++iter)
+        {
+            if (prepare)
+            {
+                prepare();
+            }
+
+            const auto start = std::chrono::high_resolution_clock::now();
+            func();
+            const auto end = std::chrono::high_resolution_clock::now();
+
+            times.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+        }
+
+        BenchmarkResult result;
+        result.m_name      = name;
+        result.m_numPixels = numPixels;
+
+        double sum = 0.;
+        for (const auto time : times)
+        {
+            sum += time;
+        }
+        result.m_mean = sum / double(times.size());
+
+        std::sort(times.begin(), times.end());
+        result.m_min = times.front();
+        result.m_max = times.back();
+        result.m_p50 = Percentile(times, 50.);
+        result.m_p90 = Percentile(times, 90.);
+        result.m_p99 = Percentile(times, 99.);
+
+        print(result);
+
+        m_results.push_back(result);
+    }
+
+    static void printHeader()
+    {
+        std::cout << std::left << std::setw(NameWidth) << "Benchmark" << std::right
+                  << std::setw(ValueWidth) << "p50 (ms)"
+                  << std::setw(ValueWidth) << "mean"
+                  << std::setw(ValueWidth) << "min"
+                  << std::setw(ValueWidth) << "p90"
+                  << std::setw(ValueWidth) << "p99"
+                  << std::setw(ValueWidth) << "max"
+                  << std::setw(ValueWidth) << "MPix/s"
+                  << std::endl;
+    }
+
+    void writeJSON(const std::string & filename) const
+    {
+        std::ofstream stream(filename, std::ios_base::out);
+        if (stream.fail())
+        {
+            std::ostringstream oss;
+            oss << "Could not open the JSON file '" << filename << "'.";
+            throw Exception(oss.str().c_str());
+        }
+
+        stream << std::fixed << std::setprecision(4);
+
+        stream << "{" << std::endl;
+        stream << "  \"ocio_version\": ";
+        WriteJSONString(stream, GetVersion());
+        stream << "," << std::endl;
+        stream << "  \"simd\": ";
+        WriteJSONString(stream, m_options.m_simd);
+        stream << "," << std::endl;
+        stream << "  \"iterations\": " << m_options.m_iterations << "," << std::endl;
+        stream << "  \"benchmarks\": [" << std::endl;
+
+        // Each benchmark is on its own line to ease the reading of the file.
+        for (size_t idx = 0; idx < m_results.size(); ++idx)
+        {
+            const BenchmarkResult & result = m_results[idx];
+
+            stream << "    {\"name\": ";
+            WriteJSONString(stream, result.m_name);
+            stream << ", \"pixels\": "  << result.m_numPixels
+                   << ", \"min_ms\": "  << result.m_min
+                   << ", \"mean_ms\": " << result.m_mean
+                   << ", \"p50_ms\": "  << result.m_p50
+                   << ", \"p90_ms\": "  << result.m_p90
+                   << ", \"p99_ms\": "  << result.m_p99
+                   << ", \"max_ms\": "  << result.m_max
+                   << ", \"mpix_per_s\": " << result.getThroughput()
+                   << "}" << (idx + 1 < m_results.size() ? "," : "") << std::endl;
+        }
+
+        stream << "  ]" << std::endl;
+        stream << "}" << std::endl;
+    }
+
+    // Compare the median times to the ones of a JSON file written by writeJSON(). Returns
+    // false if at least one benchmark regresses.
+    bool compareToBaseline(const std::string & filename) const
+    {
+        std::ifstream stream(filename, std::ios_base::in);
+        if (stream.fail())
+        {
+            std::ostringstream oss;
+            oss << "Could not open the baseline file '" << filename << "'.";
+            throw Exception(oss.str().c_str());
+        }
+
+        std::ostringstream text;
+        text << stream.rdbuf();
+
+        BaselineReader reader(text.str(), filename);
+        const std::map<std::string, double> baseline = reader.read();
+
+        std::cout << std::endl;
+        std::cout << "Comparison of the median times to '" << filename << "' (threshold: "
+                  << m_options.m_threshold << "%):" << std::endl << std::endl;
+
+        bool success = true;
+        for (const auto & result : m_results)
+        {
+            const auto entry = baseline.find(result.m_name);
+            if (entry == baseline.end() || entry->second <= 0.)
+            {
+                std::cout << std::left << std::setw(NameWidth) << result.m_name
+                          << "not in the baseline" << std::endl;
+                continue;
+            }
+
+            const double change = (result.m_p50 - entry->second) / entry->second * 100.;
+            const bool regression = change > m_options.m_threshold;
+            success = success && !regression;
+
+            std::cout << std::left << std::setw(NameWidth) << result.m_name << std::right
+                      << std::fixed << std::setprecision(3)
+                      << std::setw(ValueWidth) << entry->second << " -> "
+                      << std::setw(ValueWidth) << result.m_p50 << " ms"
+                      << std::showpos << std::setprecision(1)
+                      << std::setw(ValueWidth) << change << "%" << std::noshowpos
+                      << (regression ? "  REGRESSION" : "") << std::endl;
+        }
+
+        return success;
+    }
+
+private:
+    static constexpr int NameWidth  = 40;
+    static constexpr int ValueWidth = 11;
+
+    static void print(const BenchmarkResult & result)
+    {
+        std::cout << std::left << std::setw(NameWidth) << result.m_name << std::right
+                  << std::fixed << std::setprecision(3)
+                  << std::setw(ValueWidth) << result.m_p50
+                  << std::setw(ValueWidth) << result.m_mean
+                  << std::setw(ValueWidth) << result.m_min
+                  << std::setw(ValueWidth) << result.m_p90
+                  << std::setw(ValueWidth) << result.m_p99
+                  << std::setw(ValueWidth) << result.m_max
+                  << std::setprecision(1)
+                  << std::setw(ValueWidth) << result.getThroughput()
+                  << std::endl;
+    }
+
+    const BenchmarkOptions & m_options;
+    std::vector<BenchmarkResult> m_results;
+};
+
+// Generate a synthetic RGBA image by emulating a LUT3D identity algorithm that steps through
+// many different colors (i.e. avoid a constant image or simple gradients which would result in
+// more cache hits than a typical image). The values are slightly outside [0, 1] in case some
+// algorithms are faster or slower for these values.
+std::vector<float> CreateImage(size_t numPixels)
+{
+    static constexpr size_t length   = 201;
+    static constexpr float stepValue = 1.0f / ((float)length - 1.0f);
+    static constexpr float min       = -0.25f;
+    static constexpr float max       =  1.25f;
+
+    auto adjustValue = [](float val) -> float
+    {
+        return val * (max - min) + min;
+    };
+
+    std::vector<float> img(numPixels * 4);
+    for (size_t idx = 0; idx < numPixels; ++idx)
+    {
+        img[4 * idx + 0] = adjustValue( ((idx / length / length) % length) * stepValue );
+        img[4 * idx + 1] = adjustValue( ((idx / length) % length) * stepValue );
+        img[4 * idx + 2] = adjustValue( (idx % length) * stepValue );
+        img[4 * idx + 3] = adjustValue( float(idx) / float(numPixels) );
+    }
+
+    return img;
+}
+
+size_t GetChannelSizeInBytes(BitDepth bitDepth)
+{
+    switch (bitDepth)
+    {
+        case BIT_DEPTH_UINT8:
+            return 1;
+        case BIT_DEPTH_UINT16:
+        case BIT_DEPTH_F16:
+            return 2;
+        case BIT_DEPTH_F32:
+            return 4;
+        case BIT_DEPTH_UNKNOWN:
+        case BIT_DEPTH_UINT10:
+        case BIT_DEPTH_UINT12:
+        case BIT_DEPTH_UINT14:
+        case BIT_DEPTH_UINT32:
+            break;
+    }
+
+    throw Exception("Unsupported bit-depth.");
+}
+
+// An image in any bit-depth and channel order.
+struct Image
+{
+    Image(long width, long height, BitDepth bitDepth, ChannelOrdering channelOrder)
+        :   m_buffer(size_t(width) * size_t(height)
+                        * (channelOrder == CHANNEL_ORDERING_RGB ? 3 : 4)
+                        * GetChannelSizeInBytes(bitDepth))
+        ,   m_desc(m_buffer.data(), width, height, channelOrder, bitDepth,
+                   AutoStride, AutoStride, AutoStride)
+    {
+    }
+
+    size_t getNumPixels() const
+    {
+        return size_t(m_desc.getWidth()) * size_t(m_desc.getHeight());
+    }
+
+    std::vector<char> m_buffer;
+    PackedImageDesc m_desc;
+};
+
+// Convert the synthetic image to the bit-depth and channel order of the image.
+void FillImage(Image & image)
+{
+    std::vector<float> src = CreateImage(image.getNumPixels());
+    const PackedImageDesc srcDesc(src.data(), image.m_desc.getWidth(), image.m_desc.getHeight(), 4);
+
+    ConstProcessorRcPtr proc = Config::CreateRaw()->getProcessor(MatrixTransform::Create());
+    ConstCPUProcessorRcPtr cpu = proc->getOptimizedCPUProcessor(BIT_DEPTH_F32,
+                                                                image.m_desc.getBitDepth(),
+                                                                OPTIMIZATION_DEFAULT);
+    cpu->apply(srcDesc, image.m_desc);
+}
+
+const OptimizationFlags ExactFlags
+    = OptimizationFlags(OPTIMIZATION_DEFAULT & ~(OPTIMIZATION_FAST_LOG_EXP_POW
+                                                  | OPTIMIZATION_LUT_INV_FAST));
+
+// Measure the CPU renderer of the transform i.e. a RGBA F32 image with two buffers.
+void RunOpBenchmark(BenchmarkRunner & runner,
+                    const std::string & name,
+                    const ConstTransformRcPtr & transform,
+                    OptimizationFlags flags = ExactFlags)
+{
+    const std::string fullName = "op/" + name;
+    if (!runner.isSelected(fullName))
+    {
+        return;
+    }
+
+    static constexpr long width  = 1024;
+    static constexpr long height = 1024;
+
+    ConstProcessorRcPtr proc = Config::CreateRaw()->getProcessor(transform);
+    ConstCPUProcessorRcPtr cpu = proc->getOptimizedCPUProcessor(BIT_DEPTH_F32, BIT_DEPTH_F32, flags);
+
+    Image src(width, height, BIT_DEPTH_F32, CHANNEL_ORDERING_RGBA);
+    Image dst(width, height, BIT_DEPTH_F32, CHANNEL_ORDERING_RGBA);
+    FillImage(src);
+
+    // Warm-up.
+    cpu->apply(src.m_desc, dst.m_desc);
+
+    runner.run(fullName, src.getNumPixels(), [&]() { cpu->apply(src.m_desc, dst.m_desc); });
+}
+
+Lut1DTransformRcPtr CreateLut1D(unsigned long length)
+{
+    Lut1DTransformRcPtr lut = Lut1DTransform::Create(length, false);
+    for (unsigned long idx = 0; idx < length; ++idx)
+    {
+        const float x = float(idx) / float(length - 1);
+        lut->setValue(idx, std::pow(x, 1.f / 2.2f), std::pow(x, 1.f / 2.4f), std::pow(x, 1.f / 2.6f));
+    }
+    return lut;
+}
+
+Lut3DTransformRcPtr CreateLut3D(unsigned long gridSize, Interpolation interpolation)
+{
+    Lut3DTransformRcPtr lut = Lut3DTransform::Create(gridSize);
+    lut->setInterpolation(interpolation);
+
+    const float scale = 1.f / float(gridSize - 1);
+    for (unsigned long r = 0; r < gridSize; ++r)
+    {
+        for (unsigned long g = 0; g < gridSize; ++g)
+        {
+            for (unsigned long b = 0; b < gridSize; ++b)
+            {
+                const float R = r * scale, G = g * scale, B = b * scale;
+                // Some channel crosstalk, while keeping the LUT invertible.
+                lut->setValue(r, g, b,
+                              std::pow(0.80f * R + 0.15f * G + 0.05f * B, 0.9f),
+                              std::pow(0.10f * R + 0.85f * G + 0.05f * B, 0.9f),
+                              std::pow(0.05f * R + 0.10f * G + 0.85f * B, 0.9f));
+            }
+        }
+    }
+    return lut;
+}
+
+void RunOpBenchmarks(BenchmarkRunner & runner)
+{
+    {
+        MatrixTransformRcPtr t = MatrixTransform::Create();
+        const double m44[16] = { 0.6, 0.3, 0.1, 0.,
+                                 0.1, 0.8, 0.1, 0.,
+                                 0.0, 0.1, 0.9, 0.,
+                                 0.0, 0.0, 0.0, 1. };
+        const double offset4[4] = { 0.01, 0.02, 0.03, 0. };
+        t->setMatrix(m44);
+        t->setOffset(offset4);
+        RunOpBenchmark(runner, "matrix", t);
+    }
+    {
+        ExponentTransformRcPtr t = ExponentTransform::Create();
+        t->setValue({ 2.2, 2.4, 2.6, 1. });
+        RunOpBenchmark(runner, "gamma", t);
+        RunOpBenchmark(runner, "gamma_fast", t, OPTIMIZATION_DEFAULT);
+    }
+    {
+        ExponentWithLinearTransformRcPtr t = ExponentWithLinearTransform::Create();
+        t->setGamma({ 2.4, 2.4, 2.4, 1. });
+        t->setOffset({ 0.055, 0.055, 0.055, 0. });
+        RunOpBenchmark(runner, "moncurve", t);
+    }
+    {
+        LogTransformRcPtr t = LogTransform::Create();
+        t->setBase(10.);
+        RunOpBenchmark(runner, "log", t);
+        RunOpBenchmark(runner, "log_fast", t, OPTIMIZATION_DEFAULT);
+    }
+    {
+        LogAffineTransformRcPtr t = LogAffineTransform::Create();
+        t->setBase(2.);
+        t->setLogSideSlopeValue({ 0.18, 0.18, 0.18 });
+        t->setLogSideOffsetValue({ 0.6, 0.6, 0.6 });
+        t->setLinSideSlopeValue({ 1.1, 1.1, 1.1 });
+        t->setLinSideOffsetValue({ 0.01, 0.01, 0.01 });
+        RunOpBenchmark(runner, "log_affine", t);
+    }
+    {
+        LogCameraTransformRcPtr t = LogCameraTransform::Create({ 0.01, 0.01, 0.01 });
+        t->setBase(2.);
+        t->setLogSideSlopeValue({ 0.18, 0.18, 0.18 });
+        t->setLogSideOffsetValue({ 0.6, 0.6, 0.6 });
+        RunOpBenchmark(runner, "log_camera", t);
+    }
+    {
+        CDLTransformRcPtr t = CDLTransform::Create();
+        const double slope[3]  = { 1.1, 1.0, 0.9 };
+        const double offset[3] = { 0.01, 0.0, -0.01 };
+        const double power[3]  = { 1.2, 1.0, 0.8 };
+        t->setSlope(slope);
+        t->setOffset(offset);
+        t->setPower(power);
+        t->setSat(1.1);
+        RunOpBenchmark(runner, "cdl", t);
+    }
+    {
+        ExposureContrastTransformRcPtr t = ExposureContrastTransform::Create();
+        t->setStyle(EXPOSURE_CONTRAST_LINEAR);
+        t->setExposure(0.5);
+        t->setContrast(1.2);
+        t->setPivot(0.18);
+        RunOpBenchmark(runner, "exposure_contrast", t);
+    }
+    {
+        RangeTransformRcPtr t = RangeTransform::Create();
+        t->setMinInValue(0.);
+        t->setMaxInValue(1.);
+        t->setMinOutValue(0.1);
+        t->setMaxOutValue(0.9);
+        RunOpBenchmark(runner, "range", t);
+    }
+    {
+        RunOpBenchmark(runner, "fixed_function_rgb_to_hsv",
+                       FixedFunctionTransform::Create(FIXED_FUNCTION_RGB_TO_HSV));
+        RunOpBenchmark(runner, "fixed_function_aces_red_mod_10",
+                       FixedFunctionTransform::Create(FIXED_FUNCTION_ACES_RED_MOD_10));
+    }
+    {
+        GradingPrimary values(GRADING_LOG);
+        values.m_contrast   = GradingRGBM(1.1, 1.0, 0.9, 1.2);
+        values.m_saturation = 1.1;
+        GradingPrimaryTransformRcPtr t = GradingPrimaryTransform::Create(GRADING_LOG);
+        t->setValue(values);
+        RunOpBenchmark(runner, "grading_primary", t);
+    }
+    {
+        ConstGradingBSplineCurveRcPtr curve
+            = GradingBSplineCurve::Create({ { -5.f, -5.f }, { -1.f, -0.5f }, { 1.f, 1.5f },
+                                            { 5.f, 5.f } });
+        GradingRGBCurveTransformRcPtr t = GradingRGBCurveTransform::Create(GRADING_LOG);
+        t->setValue(GradingRGBCurve::Create(curve, curve, curve, curve));
+        RunOpBenchmark(runner, "grading_rgbcurve", t);
+    }
+    {
+        GradingTone values(GRADING_LOG);
+        values.m_scontrast = 1.2;
+        GradingToneTransformRcPtr t = GradingToneTransform::Create(GRADING_LOG);
+        t->setValue(values);
+        RunOpBenchmark(runner, "grading_tone", t);
+    }
+    {
+        Lut1DTransformRcPtr lut = CreateLut1D(4096);
+        RunOpBenchmark(runner, "lut1d", lut);
+
+        Lut1DTransformRcPtr inv = CreateLut1D(4096);
+        inv->setDirection(TRANSFORM_DIR_INVERSE);
+        RunOpBenchmark(runner, "lut1d_inverse", inv);
+    }
+    {
+        if (runner.isSelected("op/lut1d_half"))
+        {
+            Lut1DTransformRcPtr lut = Lut1DTransform::Create(65536, true);
+            // The index is the bit pattern of the half input value so the curve is only
+            // monotonic for the positive values, which is enough for a benchmark.
+            for (unsigned long idx = 0; idx < 65536; ++idx)
+            {
+                const float y = std::pow(float(idx & 0x7FFF) / float(0x7BFF), 1.f / 2.2f);
+                lut->setValue(idx, y, y, y);
+            }
+            RunOpBenchmark(runner, "lut1d_half", lut);
+        }
+    }
+    {
+        RunOpBenchmark(runner, "lut3d_tetrahedral", CreateLut3D(33, INTERP_TETRAHEDRAL));
+        RunOpBenchmark(runner, "lut3d_trilinear", CreateLut3D(33, INTERP_LINEAR));
+
+        Lut3DTransformRcPtr inv = CreateLut3D(33, INTERP_TETRAHEDRAL);
+        inv->setDirection(TRANSFORM_DIR_INVERSE);
+        RunOpBenchmark(runner, "lut3d_inverse", inv);
+    }
+}
+
+const char * GetBitDepthName(BitDepth bitDepth)
+{
+    switch (bitDepth)
+    {
+        case BIT_DEPTH_UINT8:  return "uint8";
+        case BIT_DEPTH_UINT16: return "uint16";
+        case BIT_DEPTH_F16:    return "f16";
+        case BIT_DEPTH_F32:    return "f32";
+        case BIT_DEPTH_UNKNOWN:
+        case BIT_DEPTH_UINT10:
+        case BIT_DEPTH_UINT12:
+        case BIT_DEPTH_UINT14:
+        case BIT_DEPTH_UINT32: break;
+    }
+    return "unknown";
+}
+
+const char * GetChannelOrderName(ChannelOrdering channelOrder)
+{
+    switch (channelOrder)
+    {
+        case CHANNEL_ORDERING_RGBA: return "rgba";
+        case CHANNEL_ORDERING_BGRA: return "bgra";
+        case CHANNEL_ORDERING_ABGR: return "abgr";
+        case CHANNEL_ORDERING_RGB:  return "rgb";
+        case CHANNEL_ORDERING_BGR:  return "bgr";
+    }
+    return "unknown";
+}
+
+// Measure the processing of images for several bit-depths, channel orders and image sizes.
+void RunImageBenchmarks(BenchmarkRunner & runner, const BenchmarkOptions & options)
+{
+    ConstProcessorRcPtr proc = options.m_processor;
+    if (!proc)
+    {
+        GroupTransformRcPtr group = GroupTransform::Create();
+
+        MatrixTransformRcPtr matrix = MatrixTransform::Create();
+        const double m44[16] = { 0.6, 0.3, 0.1, 0.,
+                                 0.1, 0.8, 0.1, 0.,
+                                 0.0, 0.1, 0.9, 0.,
+                                 0.0, 0.0, 0.0, 1. };
+        matrix->setMatrix(m44);
+
+        group->appendTransform(CreateLut3D(33, INTERP_TETRAHEDRAL));
+        group->appendTransform(matrix);
+
+        proc = Config::CreateRaw()->getProcessor(group);
+    }
+
+    static const BitDepth bitDepths[]
+        = { BIT_DEPTH_UINT8, BIT_DEPTH_UINT16, BIT_DEPTH_F16, BIT_DEPTH_F32 };
+    static const ChannelOrdering channelOrders[]
+        = { CHANNEL_ORDERING_RGBA, CHANNEL_ORDERING_BGRA, CHANNEL_ORDERING_RGB };
+    static const long sizes[][2] = { { 256, 256 }, { 1920, 1080 }, { 3840, 2160 } };
+
+    for (const auto bitDepth : bitDepths)
+    {
+        ConstCPUProcessorRcPtr cpu
+            = proc->getOptimizedCPUProcessor(bitDepth, bitDepth, OPTIMIZATION_DEFAULT);
+
+        for (const auto channelOrder : channelOrders)
+        {
+            for (const auto & size : sizes)
+            {
+                std::ostringstream oss;
+                oss << "image/" << GetBitDepthName(bitDepth) << "/"
+                    << GetChannelOrderName(channelOrder) << "/" << size[0] << "x" << size[1];
+                const std::string name = oss.str();
+
+                if (!runner.isSelected(name))
+                {
+                    continue;
+                }
+
+                Image src(size[0], size[1], bitDepth, channelOrder);
+                Image dst(size[0], size[1], bitDepth, channelOrder);
+                FillImage(src);
+
+                // Warm-up.
+                cpu->apply(src.m_desc, dst.m_desc);
+
+                runner.run(name, src.getNumPixels(),
+                           [&]() { cpu->apply(src.m_desc, dst.m_desc); });
+            }
+        }
+
+        // Process a HD image by small tiles (i.e. one apply call per tile) like a compositing
+        // application would do.
+        std::ostringstream oss;
+        oss << "tile/" << GetBitDepthName(bitDepth) << "/rgba/64x64";
+        const std::string name = oss.str();
+
+        if (runner.isSelected(name))
+        {
+            static constexpr long TileSize = 64;
+            static constexpr size_t NumTiles = (1920 / TileSize) * ((1080 + TileSize - 1) / TileSize);
+
+            std::vector<std::unique_ptr<Image>> srcTiles, dstTiles;
+            for (size_t idx = 0; idx < NumTiles; ++idx)
+            {
+                srcTiles.emplace_back(new Image(TileSize, TileSize, bitDepth, CHANNEL_ORDERING_RGBA));
+                dstTiles.emplace_back(new Image(TileSize, TileSize, bitDepth, CHANNEL_ORDERING_RGBA));
+                FillImage(*srcTiles.back());
+            }
+
+            runner.run(name, NumTiles * TileSize * TileSize,
+                       [&]()
+                       {
+                           for (size_t idx = 0; idx < NumTiles; ++idx)
+                           {
+                               cpu->apply(srcTiles[idx]->m_desc, dstTiles[idx]->m_desc);
+                           }
+                       });
+        }
+    }
+
+    // Process sparse colors (e.g. the vertex colors of a mesh) one at a time or at once.
+    if (runner.isSelected("pixels/f32/rgb/single") || runner.isSelected("pixels/f32/rgb/array"))
+    {
+        static constexpr long NumPixels = 256 * 256;
+
+        ConstCPUProcessorRcPtr cpu = proc->getDefaultCPUProcessor();
+
+        std::vector<float> src(3 * NumPixels), dst(3 * NumPixels);
+        for (size_t idx = 0; idx < src.size(); ++idx)
+        {
+            src[idx] = float(idx % 256) / 255.0f;
+        }
+
+        runner.run("pixels/f32/rgb/single", NumPixels,
+                   [&]()
+                   {
+                       for (long idx = 0; idx < NumPixels; ++idx)
+                       {
+                           cpu->applyRGB(&dst[3 * idx]);
+                       }
+                   },
+                   [&]() { dst = src; });
+
+        runner.run("pixels/f32/rgb/array", NumPixels,
+                   [&]() { cpu->applyRGB(dst.data(), NumPixels, AutoStride); },
+                   [&]() { dst = src; });
+    }
+}
+
+// Measure the config loading, the processor creation and the shader generation.
+void RunBuildBenchmarks(BenchmarkRunner & runner, const BenchmarkOptions & options)
+{
+    if (!runner.isSelected("build/config_load") && !runner.isSelected("build/processor")
+        && !runner.isSelected("build/cpu_processor") && !runner.isSelected("build/gpu_shader"))
+    {
+        return;
+    }
+
+    const std::string configFile
+        = options.m_configFile.empty() ? "ocio://default" : options.m_configFile;
+
+    ConstConfigRcPtr config;
+    runner.run("build/config_load", 0,
+               [&]() { config = Config::CreateFromFile(configFile.c_str()); });
+
+    if (!config)
+    {
+        config = Config::CreateFromFile(configFile.c_str());
+    }
+
+    // Caches must be bypassed to measure the complete construction at each iteration.
+    ConfigRcPtr editableConfig = config->createEditableCopy();
+    editableConfig->setProcessorCacheFlags(PROCESSOR_CACHE_OFF);
+
+    const char * display = editableConfig->getDefaultDisplay();
+    DisplayViewTransformRcPtr transform = DisplayViewTransform::Create();
+    transform->setSrc(editableConfig->hasRole(ROLE_SCENE_LINEAR)
+                        ? ROLE_SCENE_LINEAR : editableConfig->getColorSpaceNameByIndex(0));
+    transform->setDisplay(display);
+    transform->setView(editableConfig->getDefaultView(display));
+
+    ConstProcessorRcPtr proc;
+    runner.run("build/processor", 0,
+               [&]() { proc = editableConfig->getProcessor(transform); },
+               []() { ClearAllCaches(); });
+
+    if (!proc)
+    {
+        proc = editableConfig->getProcessor(transform);
+    }
+
+    runner.run("build/cpu_processor", 0,
+               [&]() { proc->getOptimizedCPUProcessor(OPTIMIZATION_DEFAULT); });
+
+    // The GPU processor caches the shaders so a new one is needed for each iteration.
+    ConstGPUProcessorRcPtr gpu;
+    runner.run("build/gpu_shader", 0,
+               [&]()
+               {
+                   GpuShaderDescRcPtr shaderDesc = GpuShaderDesc::CreateShaderDesc();
+                   shaderDesc->setLanguage(GPU_LANGUAGE_GLSL_4_0);
+                   gpu->extractGpuShaderInfo(shaderDesc);
+               },
+               [&]() { gpu = proc->getOptimizedGPUProcessor(OPTIMIZATION_DEFAULT); });
+}
+
+// Measure the writing and the reading of a large CLF file.
+void RunFileBenchmarks(BenchmarkRunner & runner)
+{
+    if (!runner.isSelected("io/clf_write") && !runner.isSelected("io/clf_read"))
+    {
+        return;
+    }
+
+    ConfigRcPtr config = Config::CreateRaw()->createEditableCopy();
+    // Caches must be bypassed to read the file at each iteration.
+    config->setProcessorCacheFlags(PROCESSOR_CACHE_OFF);
+
+    GroupTransformRcPtr group = GroupTransform::Create();
+    group->appendTransform(CreateLut3D(65, INTERP_TETRAHEDRAL));
+
+    std::string content;
+    runner.run("io/clf_write", 0,
+               [&]()
+               {
+                   std::ostringstream oss;
+                   group->write(config, "Academy/ASC Common LUT Format", oss);
+                   content = oss.str();
+               });
+
+    if (!runner.isSelected("io/clf_read"))
+    {
+        return;
+    }
+
+    if (content.empty())
+    {
+        std::ostringstream oss;
+        group->write(config, "Academy/ASC Common LUT Format", oss);
+        content = oss.str();
+    }
+
+    const std::string filename
+        = (std::filesystem::temp_directory_path() / "ocioperf_lut3d_65.clf").string();
+    {
+        std::ofstream file(filename, std::ios_base::out | std::ios_base::binary);
+        file << content;
+        if (!file.good())
+        {
+            throw Exception("Could not write the temporary CLF file.");
+        }
+    }
+
+    FileTransformRcPtr file = FileTransform::Create();
+    file->setSrc(filename.c_str());
+
+    try
+    {
+        runner.run("io/clf_read", 0,
+                   [&]() { config->getProcessor(file); },
+                   []() { ClearAllCaches(); });
+    }
+    catch (...)
+    {
+        std::remove(filename.c_str());
+        throw;
+    }
+
+    std::remove(filename.c_str());
+}
+
+} // anon.
+
+
+bool RunBenchmarks(const BenchmarkOptions & options)
+{
+    BenchmarkRunner runner(options);
+
+    std::cout << std::endl;
+    std::cout << "OCIO Version: " << GetVersion() << std::endl;
+    std::cout << "SIMD:         " << options.m_simd << std::endl;
+    std::cout << "Iterations:   " << options.m_iterations << std::endl;
+    std::cout << std::endl;
+
+    BenchmarkRunner::printHeader();
+
+    RunOpBenchmarks(runner);
+    RunImageBenchmarks(runner, options);
+    RunBuildBenchmarks(runner, options);
+    RunFileBenchmarks(runner);
+
+    if (!options.m_jsonFile.empty())
+    {
+        runner.writeJSON(options.m_jsonFile);
+
+        std::cout << std::endl;
+        std::cout << "Results written to '" << options.m_jsonFile << "'" << std::endl;
+    }
+
+    if (!options.m_baselineFile.empty())
+    {
+        return runner.compareToBaseline(options.m_baselineFile);
+    }
+
+    return true;
+}
+
+} // namespace OCIO_NAMESPACE
@@ -0,0 +1,50 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_OCIOPERF_BENCHMARKS_H
+#define INCLUDED_OCIO_OCIOPERF_BENCHMARKS_H
+
+#include <string>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+
+namespace OCIO_NAMESPACE
+{
+
+struct BenchmarkOptions
+{
+    // Number of measured iterations of each benchmark.
+    unsigned m_iterations = 50;
+    // Only run the benchmarks whose name contains this string (all of them if empty).
+    std::string m_filter;
+    // Config used by the config loading and processor creation benchmarks (the default
+    // built-in config if empty).
+    std::string m_configFile;
+    // Processor used by the image format benchmarks (a 3D LUT and a matrix if null).
+    ConstProcessorRcPtr m_processor;
+    // Instruction sets limit (i.e. the value of OCIO_CPU_SIMD_ENVVAR) to save with the results.
+    std::string m_simd;
+    // Write the results to this JSON file (if not empty).
+    std::string m_jsonFile;
+    // Compare the results to this JSON file, written by a previous run (if not empty).
+    std::string m_baselineFile;
+    // A benchmark regresses when its median time exceeds the baseline one by this percentage.
+    double m_threshold = 10.;
+};
+
+//
+// Run the benchmark suite i.e. the CPU renderer of each op type, the image processing for
+// several bit-depths, channel orders and image sizes, the processing of pixel arrays, the
+// config loading, the processor creation, the shader generation and the writing and reading
+// of a CLF file. The statistics of each benchmark (i.e. minimum, mean, maximum and
+// percentiles of the iteration times) are printed and optionally written to a JSON file.
+//
+// Returns false if a benchmark regresses compared to the baseline.
+//
+bool RunBenchmarks(const BenchmarkOptions & options);
+
+} // namespace OCIO_NAMESPACE
+
+#endif
@@ -5,10 +5,12 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "apputils/argparse.h"
+#include "benchmarks.h"
 #include "utils/StringUtils.h"
 
 #include <chrono>
 #include <cmath>
+#include <cstdlib>
 #include <limits>
 #include <iostream>
 
@@ -167,12 +169,124 @@ void ProcessPixels(CustomMeasure & m,
     m.pause();
 }
 
+// Measure the creation of the inverse of a LUT file i.e. the exact inverse (which builds the
+// search structures of the inverse renderers) and the fast inverse (which bakes the exact
+// inverse into a forward LUT).
+void MeasureInverseLut(const std::string & lutFile, unsigned iterations)
+{
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+    // Caches must be bypassed to measure the complete construction at each iteration.
+    config->setProcessorCacheFlags(OCIO::PROCESSOR_CACHE_OFF);
+
+    OCIO::FileTransformRcPtr transform = OCIO::FileTransform::Create();
+    transform->setSrc(lutFile.c_str());
+    transform->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+
+    OCIO::ConstProcessorRcPtr processor;
+
+    {
+        CustomMeasure m("Create the inverse LUT processor:\t\t", iterations);
+        for (unsigned iter = 0; iter < iterations; ++iter)
+        {
+            OCIO::ClearAllCaches();
+
+            m.resume();
+            processor = config->getProcessor(transform);
+            m.pause();
+        }
+    }
+
+    const OCIO::OptimizationFlags exactFlags
+        = OCIO::OptimizationFlags(OCIO::OPTIMIZATION_DEFAULT & ~OCIO::OPTIMIZATION_LUT_INV_FAST);
+
+    {
+        CustomMeasure m("Create the exact inverse CPU processor:\t", iterations);
+        for (unsigned iter = 0; iter < iterations; ++iter)
+        {
+            m.resume();
+            processor->getOptimizedCPUProcessor(exactFlags);
+            m.pause();
+        }
+    }
+
+    const OCIO::OptimizationFlags fastFlags
+        = OCIO::OptimizationFlags(OCIO::OPTIMIZATION_DEFAULT | OCIO::OPTIMIZATION_LUT_INV_FAST);
+
+    {
+        CustomMeasure m("Create the fast inverse CPU processor:\t", iterations);
+        for (unsigned iter = 0; iter < iterations; ++iter)
+        {
+            m.resume();
+            processor->getOptimizedCPUProcessor(fastFlags);
+            m.pause();
+        }
+    }
+}
+
+// Measure the resolution of the context variables when the environment contains a lot of
+// variables (e.g. a render farm environment). Each iteration resolves new strings (with used,
+// missing and no context variables) to bypass the context cache of resolved strings.
+void MeasureContextVariables(unsigned numVars, unsigned iterations)
+{
+    OCIO::ContextRcPtr context = OCIO::Context::Create();
+    context->setEnvironmentMode(OCIO::ENV_ENVIRONMENT_LOAD_ALL);
+    context->loadEnvironment();
+
+    for (unsigned idx = 0; idx < numVars; ++idx)
+    {
+        const std::string name  = "OCIOPERF_VARIABLE_" + std::to_string(idx);
+        const std::string value = "value_" + std::to_string(idx);
+        context->setStringVar(name.c_str(), value.c_str());
+    }
+
+    context->setStringVar("SHOW", "show");
+    context->setStringVar("SHOT", "${SEQ}_0010");
+    context->setStringVar("SEQ", "seq");
+    context->setStringVar("TASK", "comp");
+
+    std::cout << "Number of context variables: " << context->getNumStringVars()
+              << std::endl << std::endl;
+
+    static constexpr unsigned NumStrings = 1000;
+
+    CustomMeasure m("Resolve 1000 strings:\t\t\t", iterations);
+    for (unsigned iter = 0; iter < iterations; ++iter)
+    {
+        std::vector<std::string> strings;
+        strings.reserve(NumStrings);
+        for (unsigned idx = 0; idx < NumStrings; ++idx)
+        {
+            const std::string suffix = std::to_string(iter) + "_" + std::to_string(idx);
+            switch (idx % 3)
+            {
+                case 0:
+                    strings.push_back("/$SHOW/${SHOT}/%TASK%/lut_" + suffix + ".csp");
+                    break;
+                case 1:
+                    strings.push_back("/$SHOW/$MISSING_VARIABLE/lut_" + suffix + ".csp");
+                    break;
+                default:
+                    strings.push_back("lut_" + suffix + ".csp");
+                    break;
+            }
+        }
+
+        m.resume();
+        for (const auto & str : strings)
+        {
+            context->resolveStringVar(str.c_str());
+        }
+        m.pause();
+    }
+}
+
 int main(int argc, const char **argv)
 {
     bool help = false;
     bool verbose = false;
     signed int testType = -1;
-    std::string transformFile;
+    std::string transformFile, invertLutFile;
+    signed int numContextVars = -1;
     std::string inColorSpace, outColorSpace, display, view;
     std::string inBitDepthStr("f32"), outBitDepthStr("f32");
     unsigned iterations = 50;
@@ -185,6 +299,10 @@ int main(int argc, const char **argv)
     std::string inputconfig;
     OCIO::ConstConfigRcPtr srcConfig;
 
+    bool runBenchmarks = false;
+    std::string benchFilter, jsonFile, baselineFile, simd;
+    double threshold = 10.;
+
 
     ArgParse ap;
     ap.options("ocioperf -- apply and measure a color transformation processing\n\n"
@@ -201,6 +319,12 @@ int main(int argc, const char **argv)
                                             "2 is pixel-per-pixel and -1 performs all the test types",
                "--transform %s",            &transformFile, 
                                             "Provide the transform file to apply on the image",
+               "--invertlut %s",            &invertLutFile,
+                                            "Only measure the creation of the exact and fast inverse "\
+                                            "of the LUT file",
+               "--contextvars %d",          &numContextVars,
+                                            "Only measure the resolution of context variables "\
+                                            "with the given number of extra variables",
                "--colorspaces %s %s",       &inColorSpace, &outColorSpace,
                                             "Provide the input and output color spaces to apply on the image",
                "--view %s %s %s",           &inColorSpace, &display, &view,
@@ -218,6 +342,20 @@ int main(int argc, const char **argv)
                                             "Bypass all caches. Default is false",
                "--nooptim",                 &nooptim, 
                                             "Disable the processor optimizations. Default is false",
+               "--bench",                   &runBenchmarks,
+                                            "Run the benchmark suite (i.e. op renderers, image formats, "\
+                                            "config loading, processor and shader creation, CLF file writing and reading)",
+               "--filter %s",               &benchFilter,
+                                            "Only run the benchmarks whose name contains the string",
+               "--json %s",                 &jsonFile,
+                                            "Write the benchmark results to a JSON file",
+               "--baseline %s",             &baselineFile,
+                                            "Compare the benchmark results to a JSON file from a previous run",
+               "--threshold %F",            &threshold,
+                                            "Percentage of the median time increase reported as a regression. "\
+                                            "Default is 10",
+               "--simd %s",                 &simd,
+                                            "Limit the CPU instruction sets (i.e. none, sse2, avx, avx2 or avx512)",
                NULL);
 
     if (ap.parse (argc, argv) < 0)
@@ -233,12 +371,103 @@ int main(int argc, const char **argv)
         return 0;
     }
 
+    if (!simd.empty())
+    {
+        if (simd != "none" && simd != "sse2" && simd != "avx" && simd != "avx2" && simd != "avx512")
+        {
+            std::cerr << "ERROR: Unsupported instruction set: " << simd << std::endl;
+            return 1;
+        }
+
+        // The instruction sets are detected once, at the first CPU processor creation.
+#ifdef _WIN32
+        _putenv_s(OCIO::OCIO_CPU_SIMD_ENVVAR, simd.c_str());
+#else
+        setenv(OCIO::OCIO_CPU_SIMD_ENVVAR, simd.c_str(), 1);
+#endif
+    }
+
     if (verbose)
     {
         std::cout << std::endl;
         std::cout << "OCIO Version: " << OCIO::GetVersion() << std::endl;
     }
 
+    if (runBenchmarks)
+    {
+        try
+        {
+            OCIO::BenchmarkOptions options;
+            options.m_iterations   = iterations;
+            options.m_filter       = benchFilter;
+            options.m_configFile   = inputconfig;
+            options.m_jsonFile     = jsonFile;
+            options.m_baselineFile = baselineFile;
+            options.m_threshold    = threshold;
+
+            const char * simdValue = OCIO::GetEnvVariable(OCIO::OCIO_CPU_SIMD_ENVVAR);
+            options.m_simd = (simdValue && *simdValue) ? simdValue : "native";
+
+            if (!transformFile.empty())
+            {
+                OCIO::FileTransformRcPtr transform = OCIO::FileTransform::Create();
+                transform->setSrc(transformFile.c_str());
+                options.m_processor = OCIO::Config::CreateRaw()->getProcessor(transform);
+            }
+
+            if (!OCIO::RunBenchmarks(options))
+            {
+                std::cerr << std::endl << "ERROR: Some benchmarks regressed." << std::endl;
+                return 1;
+            }
+        }
+        catch (OCIO::Exception & ex)
+        {
+            std::cerr << "OCIO ERROR: " << ex.what() << std::endl;
+            return 1;
+        }
+
+        std::cout << std::endl;
+        return 0;
+    }
+
+    if (!invertLutFile.empty())
+    {
+        std::cout << std::endl;
+        std::cout << "Inverting '" << invertLutFile << "'" << std::endl << std::endl;
+
+        try
+        {
+            MeasureInverseLut(invertLutFile, iterations);
+        }
+        catch (OCIO::Exception & ex)
+        {
+            std::cerr << "OCIO ERROR: " << ex.what() << std::endl;
+            return 1;
+        }
+
+        std::cout << std::endl;
+        return 0;
+    }
+
+    if (numContextVars >= 0)
+    {
+        std::cout << std::endl;
+
+        try
+        {
+            MeasureContextVariables(static_cast<unsigned>(numContextVars), iterations);
+        }
+        catch (OCIO::Exception & ex)
+        {
+            std::cerr << "OCIO ERROR: " << ex.what() << std::endl;
+            return 1;
+        }
+
+        std::cout << std::endl;
+        return 0;
+    }
+
     if (!transformFile.empty())
     {
         std::cout << std::endl;
@@ -511,6 +740,39 @@ int main(int argc, const char **argv)
             }
         }
 
+        // The reports come from dedicated processors so that the measures above do not include
+        // the cost of their collection.
+        const OCIO::OptimizationFlags reportFlags
+            = OCIO::OptimizationFlags(optimFlags | OCIO::OPTIMIZATION_REPORT);
+
+        OCIO::ConstProcessorRcPtr reportProcessor
+            = processor->getOptimizedProcessor(inBitDepth, outBitDepth, reportFlags);
+
+        std::cout << std::endl << std::endl;
+        std::cout << "Optimization report of the optimized processor:" << std::endl << std::endl;
+        std::cout << *reportProcessor->getOptimizationReport();
+
+        std::cout << std::endl;
+        std::cout << "Optimization report of the CPU processor:" << std::endl << std::endl;
+        std::cout << *reportProcessor->getOptimizedCPUProcessor(inBitDepth, outBitDepth, reportFlags)
+                                     ->getOptimizationReport();
+
+        std::cout << std::endl << std::endl;
+        std::cout << "Memory usage of the optimized processor:" << std::endl << std::endl;
+        std::cout << *optProcessor->getMemoryUsage();
+
+        std::cout << std::endl;
+        std::cout << "Memory usage of the CPU processor:" << std::endl << std::endl;
+        std::cout << *cpuProcessor->getMemoryUsage();
+
+        std::cout << std::endl;
+        std::cout << "Memory usage of the GPU processor:" << std::endl << std::endl;
+        std::cout << *gpuProcessor->getMemoryUsage();
+
+        std::cout << std::endl;
+        std::cout << "Memory usage of the caches:" << std::endl << std::endl;
+        std::cout << *OCIO::GetCachesMemoryUsage();
+
         std::cout << std::endl << std::endl;
         std::cout << "Image processing statistics:" << std::endl << std::endl;
 
@@ -43,6 +43,10 @@ void bindPyCPUProcessor(py::module & m)
              DOC(CPUProcessor, hasDynamicProperty))
         .def("isDynamic", &CPUProcessor::isDynamic,
              DOC(CPUProcessor, isDynamic))
+        .def("getOptimizationReport", &CPUProcessor::getOptimizationReport,
+             DOC(CPUProcessor, getOptimizationReport))
+        .def("getMemoryUsage", &CPUProcessor::getMemoryUsage,
+             DOC(CPUProcessor, getMemoryUsage))
 
         .def("apply", [](CPUProcessorRcPtr & self, PyImageDesc & imgDesc) 
             {
@@ -130,9 +134,9 @@ as the flattened array size is divisible by 3. Array values are
 modified in place.
 
 .. note::
-    This differs from the C++ implementation which only applies to a 
-    single pixel. This method uses a ``PackedImageDesc`` under the 
-    hood to apply to an entire image at once. The GIL is released 
+    This differs from the C++ implementation which only applies to 
+    32-bit float pixels. This method uses a ``PackedImageDesc`` under 
+    the hood to apply to an entire image at once. The GIL is released 
     during processing, freeing up Python to execute other threads 
     concurrently.
 
@@ -158,9 +162,9 @@ long as the list length is divisible by 3. A new list with processed
 float values is returned, leaving the input list unchanged.
 
 .. note::
-    This differs from the C++ implementation which only applies to a 
-    single pixel. This method uses a ``PackedImageDesc`` under the 
-    hood to apply to an entire image at once. The GIL is released 
+    This differs from the C++ implementation which only applies to 
+    32-bit float pixels. This method uses a ``PackedImageDesc`` under 
+    the hood to apply to an entire image at once. The GIL is released 
     during processing, freeing up Python to execute other threads 
     concurrently.
 
@@ -207,9 +211,9 @@ as the flattened array size is divisible by 4. Array values are
 modified in place.
 
 .. note::
-    This differs from the C++ implementation which only applies to a 
-    single pixel. This method uses a ``PackedImageDesc`` under the 
-    hood to apply to an entire image at once. The GIL is released 
+    This differs from the C++ implementation which only applies to 
+    32-bit float pixels. This method uses a ``PackedImageDesc`` under 
+    the hood to apply to an entire image at once. The GIL is released 
     during processing, freeing up Python to execute other threads 
     concurrently.
 
@@ -235,9 +239,9 @@ long as the list length is divisible by 4. A new list with processed
 float values is returned, leaving the input list unchanged.
 
 .. note::
-    This differs from the C++ implementation which only applies to a 
-    single pixel. This method uses a ``PackedImageDesc`` under the 
-    hood to apply to an entire image at once. The GIL is released 
+    This differs from the C++ implementation which only applies to 
+    32-bit float pixels. This method uses a ``PackedImageDesc`` under 
+    the hood to apply to an entire image at once. The GIL is released 
     during processing, freeing up Python to execute other threads 
     concurrently.
 
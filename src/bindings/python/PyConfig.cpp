@@ -965,6 +965,8 @@ void bindPyConfig(py::module & m)
              DOC(Config, setProcessorCacheFlags))
         .def("clearProcessorCache", &Config::clearProcessorCache, 
              DOC(Config, setProcessorCacheFlags))
+        .def("getProcessorCacheMemoryUsage", &Config::getProcessorCacheMemoryUsage,
+             DOC(Config, getProcessorCacheMemoryUsage))
 
         // Archiving
         .def("isArchivable", &Config::isArchivable, DOC(Config, isArchivable))
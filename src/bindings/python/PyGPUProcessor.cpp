@@ -22,7 +22,9 @@ void bindPyGPUProcessor(py::module & m)
              (void (GPUProcessor::*)(GpuShaderDescRcPtr &) const) 
              &GPUProcessor::extractGpuShaderInfo,
              "shaderDesc"_a, 
-             DOC(GPUProcessor, extractGpuShaderInfo));
+             DOC(GPUProcessor, extractGpuShaderInfo))
+        .def("getMemoryUsage", &GPUProcessor::getMemoryUsage,
+             DOC(GPUProcessor, getMemoryUsage));
 }
 
 } // namespace OCIO_NAMESPACE
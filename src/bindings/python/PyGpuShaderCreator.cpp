@@ -83,6 +83,14 @@ void bindPyGpuShaderCreator(py::module & m)
             DOC(GpuShaderCreator, setAllowTexture1D))
         .def("getAllowTexture1D", &GpuShaderCreator::getAllowTexture1D,
              DOC(GpuShaderCreator, getAllowTexture1D))
+        .def("setTextureBitDepth", &GpuShaderCreator::setTextureBitDepth, "bitDepth"_a,
+             DOC(GpuShaderCreator, setTextureBitDepth))
+        .def("getTextureBitDepth", &GpuShaderCreator::getTextureBitDepth,
+             DOC(GpuShaderCreator, getTextureBitDepth))
+        .def("setUseUniformBlock", &GpuShaderCreator::setUseUniformBlock, "use"_a,
+             DOC(GpuShaderCreator, setUseUniformBlock))
+        .def("getUseUniformBlock", &GpuShaderCreator::getUseUniformBlock,
+             DOC(GpuShaderCreator, getUseUniformBlock))
         .def("getNextResourceIndex", &GpuShaderCreator::getNextResourceIndex,
             DOC(GpuShaderCreator, getNextResourceIndex))
 
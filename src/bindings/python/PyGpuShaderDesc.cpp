@@ -30,6 +30,7 @@ struct Texture
     GpuShaderDesc::TextureDimensions m_dimensions;
     Interpolation m_interpolation;
     unsigned m_textureShaderBindingIndex;
+    std::string m_cacheID;
     GpuShaderDescRcPtr m_shaderDesc;
     int m_index;
 };
@@ -41,10 +42,26 @@ struct Texture3D
     unsigned m_edgelen;
     Interpolation m_interpolation;
     unsigned m_textureShaderBindingIndex;
+    std::string m_cacheID;
     GpuShaderDescRcPtr m_shaderDesc;
     int m_index;
 };
 
+py::array GetTextureData(BitDepth bitDepth, const void * data, py::ssize_t numValues)
+{
+    switch (bitDepth)
+    {
+    case BIT_DEPTH_F32:
+        return py::array(py::dtype("float32"), { numValues }, { sizeof(float) }, data);
+    case BIT_DEPTH_F16:
+        return py::array(py::dtype("float16"), { numValues }, { sizeof(uint16_t) }, data);
+    case BIT_DEPTH_UINT16:
+        return py::array(py::dtype("uint16"), { numValues }, { sizeof(uint16_t) }, data);
+    default:
+        throw Exception("Error: Unsupported texture bit-depth");
+    }
+}
+
 } // namespace
 
 void bindPyGpuShaderDesc(py::module & m)
@@ -111,6 +128,13 @@ void bindPyGpuShaderDesc(py::module & m)
             })
         .def("getUniformBufferSize", &GpuShaderDesc::getUniformBufferSize,
              DOC(GpuShaderDesc, getUniformBufferSize))
+        .def("fillUniformBuffer", [](GpuShaderDescRcPtr & self)
+            {
+                py::array_t<uint8_t> buffer(py::ssize_t(self->getUniformBufferSize()));
+                self->fillUniformBuffer(buffer.mutable_data(), buffer.size());
+                return buffer;
+            },
+             DOC(GpuShaderDesc, fillUniformBuffer))
 
         // 1D lut related methods
         .def("addTexture", [](GpuShaderDescRcPtr & self,
@@ -256,6 +280,7 @@ void bindPyGpuShaderDesc(py::module & m)
         .def_readonly("dimensions", &Texture::m_dimensions)
         .def_readonly("interpolation", &Texture::m_interpolation)
         .def_readonly("textureShaderBindingIndex", &Texture::m_textureShaderBindingIndex)
+        .def_readonly("cacheID", &Texture::m_cacheID)
         .def("getValues", [](Texture & self)
             {
                 py::gil_scoped_release release;
@@ -282,7 +307,18 @@ void bindPyGpuShaderDesc(py::module & m)
                                  { self.m_height * self.m_width * numChannels },
                                  { sizeof(float) }, 
                                  values);
-            }, DOC(GpuShaderDesc, getTextureValues));
+            }, DOC(GpuShaderDesc, getTextureValues))
+        .def("getData", [](Texture & self)
+            {
+                BitDepth bitDepth = BIT_DEPTH_F32;
+                const void * data = nullptr;
+                self.m_shaderDesc->getTextureData(self.m_index, bitDepth, data);
+
+                const py::ssize_t numChannels
+                    = self.m_channel == GpuShaderDesc::TEXTURE_RGB_CHANNEL ? 3 : 1;
+
+                return GetTextureData(bitDepth, data, self.m_height * self.m_width * numChannels);
+            }, DOC(GpuShaderDesc, getTextureData));
 
     clsTextureIterator
         .def("__len__", [](TextureIterator & it) 
@@ -303,7 +339,7 @@ void bindPyGpuShaderDesc(py::module & m)
                 unsigned textureShaderBindingIndex = it.m_obj->getTextureShaderBindingIndex(i);
 
                 return { textureName, samplerName, width, height, channel, dimensions, interpolation,
-                         textureShaderBindingIndex, it.m_obj, i};
+                         textureShaderBindingIndex, it.m_obj->getTextureCacheID(i), it.m_obj, i};
             })
         .def("__iter__", [](TextureIterator & it) -> TextureIterator & 
             { 
@@ -324,7 +360,7 @@ void bindPyGpuShaderDesc(py::module & m)
                 unsigned textureShaderBindingIndex = it.m_obj->getTextureShaderBindingIndex(i);
 
                 return { textureName, samplerName, width, height, channel, dimensions, interpolation,
-                         textureShaderBindingIndex, it.m_obj, i};
+                         textureShaderBindingIndex, it.m_obj->getTextureCacheID(i), it.m_obj, i};
             });
 
     clsTexture3D
@@ -333,6 +369,7 @@ void bindPyGpuShaderDesc(py::module & m)
         .def_readonly("edgeLen", &Texture3D::m_edgelen)
         .def_readonly("interpolation", &Texture3D::m_interpolation)
         .def_readonly("textureShaderBindingIndex", &Texture3D::m_textureShaderBindingIndex)
+        .def_readonly("cacheID", &Texture3D::m_cacheID)
         .def("getValues", [](Texture3D & self)
             {
                 py::gil_scoped_release release;
@@ -346,7 +383,16 @@ void bindPyGpuShaderDesc(py::module & m)
                                  { self.m_edgelen * self.m_edgelen * self.m_edgelen * 3 },
                                  { sizeof(float) }, 
                                  values);
-            }, DOC(GpuShaderDesc, get3DTextureValues));
+            }, DOC(GpuShaderDesc, get3DTextureValues))
+        .def("getData", [](Texture3D & self)
+            {
+                BitDepth bitDepth = BIT_DEPTH_F32;
+                const void * data = nullptr;
+                self.m_shaderDesc->get3DTextureData(self.m_index, bitDepth, data);
+
+                return GetTextureData(bitDepth, data,
+                                      self.m_edgelen * self.m_edgelen * self.m_edgelen * 3);
+            }, DOC(GpuShaderDesc, get3DTextureData));
 
     clsTexture3DIterator
         .def("__len__", [](Texture3DIterator & it) 
@@ -364,7 +410,7 @@ void bindPyGpuShaderDesc(py::module & m)
                 unsigned textureShaderBindingIndex = it.m_obj->get3DTextureShaderBindingIndex(i);
 
                 return { textureName, samplerName, edgelen, interpolation, textureShaderBindingIndex,
-                         it.m_obj, i };
+                         it.m_obj->get3DTextureCacheID(i), it.m_obj, i };
             })
         .def("__iter__", [](Texture3DIterator & it) -> Texture3DIterator & 
             { 
@@ -382,7 +428,7 @@ void bindPyGpuShaderDesc(py::module & m)
                 unsigned textureShaderBindingIndex = it.m_obj->get3DTextureShaderBindingIndex(i);
 
                 return { textureName, samplerName, edgelen, interpolation, textureShaderBindingIndex,
-                         it.m_obj, i };
+                         it.m_obj->get3DTextureCacheID(i), it.m_obj, i };
             });
 }
 
@@ -0,0 +1,41 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <sstream>
+
+#include "PyOpenColorIO.h"
+#include "PyUtils.h"
+
+namespace OCIO_NAMESPACE
+{
+
+void bindPyMemoryUsage(py::module & m)
+{
+    auto clsMemoryUsage = 
+        py::class_<MemoryUsage, MemoryUsageRcPtr>(
+            m.attr("MemoryUsage"));
+
+    clsMemoryUsage
+        .def(py::init(&MemoryUsage::Create),
+             DOC(MemoryUsage, Create))
+
+        .def("getTotalSize", &MemoryUsage::getTotalSize,
+             DOC(MemoryUsage, getTotalSize))
+        .def("getNumEntries", &MemoryUsage::getNumEntries,
+             DOC(MemoryUsage, getNumEntries))
+        .def("getEntryName", &MemoryUsage::getEntryName, "index"_a,
+             DOC(MemoryUsage, getEntryName))
+        .def("getEntrySize", &MemoryUsage::getEntrySize, "index"_a,
+             DOC(MemoryUsage, getEntrySize))
+        .def("addEntry", &MemoryUsage::addEntry, "name"_a, "size"_a,
+             DOC(MemoryUsage, addEntry))
+
+        .def("__str__", [](MemoryUsageRcPtr & self)
+            {
+                std::ostringstream os;
+                os << *self;
+                return os.str();
+            });
+}
+
+} // namespace OCIO_NAMESPACE
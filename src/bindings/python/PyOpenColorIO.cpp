@@ -40,6 +40,8 @@ PYBIND11_MODULE(PyOpenColorIO, m)
     // Global functions
     m.def("ClearAllCaches", &ClearAllCaches,
           DOC(PyOpenColorIO, ClearAllCaches));
+    m.def("GetCachesMemoryUsage", &GetCachesMemoryUsage,
+          DOC(PyOpenColorIO, GetCachesMemoryUsage));
     m.def("GetVersion", &GetVersion,
           DOC(PyOpenColorIO, GetVersion));
     m.def("GetVersionHex", &GetVersionHex,
@@ -84,6 +86,8 @@ PYBIND11_MODULE(PyOpenColorIO, m)
     bindPyNamedTransform(m);
     bindPyProcessor(m);
     bindPyProcessorMetadata(m);
+    bindPyOptimizationReport(m);
+    bindPyMemoryUsage(m);
     bindPySystemMonitors(m);
     bindPyViewingRules(m);
     bindPyViewTransform(m);
@@ -42,6 +42,8 @@ void bindPyImageDesc(py::module & m);
 void bindPyLook(py::module & m);
 void bindPyNamedTransform(py::module & m);
 void bindPyProcessor(py::module & m);
+void bindPyOptimizationReport(py::module & m);
+void bindPyMemoryUsage(py::module & m);
 void bindPyProcessorMetadata(py::module & m);
 void bindPySystemMonitors(py::module & m);
 void bindPyViewingRules(py::module & m);
@@ -0,0 +1,56 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <sstream>
+
+#include "PyOpenColorIO.h"
+#include "PyUtils.h"
+
+namespace OCIO_NAMESPACE
+{
+
+void bindPyOptimizationReport(py::module & m)
+{
+    auto clsOptimizationReport = 
+        py::class_<OptimizationReport, OptimizationReportRcPtr>(
+            m.attr("OptimizationReport"));
+
+    clsOptimizationReport
+        .def("getNumPasses", &OptimizationReport::getNumPasses,
+             DOC(OptimizationReport, getNumPasses))
+        .def("isFromCache", &OptimizationReport::isFromCache,
+             DOC(OptimizationReport, isFromCache))
+        .def("getOptimizationTime", &OptimizationReport::getOptimizationTime,
+             DOC(OptimizationReport, getOptimizationTime))
+        .def("getNumRules", &OptimizationReport::getNumRules,
+             DOC(OptimizationReport, getNumRules))
+        .def("getRuleName", &OptimizationReport::getRuleName, "index"_a,
+             DOC(OptimizationReport, getRuleName))
+        .def("getRuleCount", &OptimizationReport::getRuleCount, "index"_a,
+             DOC(OptimizationReport, getRuleCount))
+        .def("getRuleTime", &OptimizationReport::getRuleTime, "index"_a,
+             DOC(OptimizationReport, getRuleTime))
+        .def("getNumOpsBefore", &OptimizationReport::getNumOpsBefore,
+             DOC(OptimizationReport, getNumOpsBefore))
+        .def("getOpBefore", &OptimizationReport::getOpBefore, "index"_a,
+             DOC(OptimizationReport, getOpBefore))
+        .def("getNumOpsAfter", &OptimizationReport::getNumOpsAfter,
+             DOC(OptimizationReport, getNumOpsAfter))
+        .def("getOpAfter", &OptimizationReport::getOpAfter, "index"_a,
+             DOC(OptimizationReport, getOpAfter))
+        .def("getNumRenderers", &OptimizationReport::getNumRenderers,
+             DOC(OptimizationReport, getNumRenderers))
+        .def("getRendererName", &OptimizationReport::getRendererName, "index"_a,
+             DOC(OptimizationReport, getRendererName))
+        .def("getRendererTime", &OptimizationReport::getRendererTime, "index"_a,
+             DOC(OptimizationReport, getRendererTime))
+
+        .def("__str__", [](OptimizationReportRcPtr & self)
+            {
+                std::ostringstream os;
+                os << *self;
+                return os.str();
+            });
+}
+
+} // namespace OCIO_NAMESPACE
@@ -1,6 +1,8 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <fstream>
+
 #include "PyDynamicProperty.h"
 #include "PyOpenColorIO.h"
 #include "PyUtils.h"
@@ -39,6 +41,10 @@ void bindPyProcessor(py::module & m)
              DOC(Processor, getCacheID))
         .def("getProcessorMetadata", &Processor::getProcessorMetadata,
              DOC(Processor, getProcessorMetadata))
+        .def("getOptimizationReport", &Processor::getOptimizationReport,
+             DOC(Processor, getOptimizationReport))
+        .def("getMemoryUsage", &Processor::getMemoryUsage,
+             DOC(Processor, getMemoryUsage))
         .def("getFormatMetadata", &Processor::getFormatMetadata,
              py::return_value_policy::reference_internal,
              DOC(Processor, getFormatMetadata))
@@ -48,6 +54,19 @@ void bindPyProcessor(py::module & m)
             })
         .def("createGroupTransform", &Processor::createGroupTransform,
              DOC(Processor, createGroupTransform))
+        .def("serialize", [](ProcessorRcPtr & self,
+                             const std::string & fileName,
+                             const std::string & fingerprint)
+            {
+                std::ofstream f(fileName, std::ofstream::out | std::ofstream::binary);
+                self->serialize(f, fingerprint.c_str());
+                f.close();
+            },
+             "fileName"_a, "fingerprint"_a = "",
+             DOC(Processor, serialize))
+        .def_static("CreateFromSerializedFile", &Processor::CreateFromSerializedFile,
+                    "fileName"_a, "fingerprint"_a = "",
+                    DOC(Processor, CreateFromSerializedFile))
         .def("getDynamicProperty", [](ProcessorRcPtr & self, DynamicPropertyType type)
             {
                 return PyDynamicProperty(self->getDynamicProperty(type));
@@ -89,7 +108,13 @@ void bindPyProcessor(py::module & m)
              (ConstCPUProcessorRcPtr (Processor::*)(BitDepth, BitDepth, OptimizationFlags) const) 
              &Processor::getOptimizedCPUProcessor, 
              "inBitDepth"_a, "outBitDepth"_a, "oFlags"_a,
-             DOC(Processor, getOptimizedCPUProcessor));
+             DOC(Processor, getOptimizedCPUProcessor))
+        .def("getOptimizedCPUProcessor", 
+             (ConstCPUProcessorRcPtr (Processor::*)(BitDepth, BitDepth, OptimizationFlags, 
+                                                    float) const) 
+             &Processor::getOptimizedCPUProcessor, 
+             "inBitDepth"_a, "outBitDepth"_a, "oFlags"_a, "bakeTolerance"_a,
+             DOC(Processor, getOptimizedCPUProcessor, 2));
 
     clsTransformFormatMetadataIterator
         .def("__len__", [](TransformFormatMetadataIterator & it) 
@@ -86,6 +86,14 @@ void bindPyTypes(py::module & m)
         m, "ProcessorMetadata",
         DOC(ProcessorMetadata));
 
+    py::class_<OptimizationReport, OptimizationReportRcPtr /* holder */>(
+        m, "OptimizationReport",
+        DOC(OptimizationReport));
+
+    py::class_<MemoryUsage, MemoryUsageRcPtr /* holder */>(
+        m, "MemoryUsage",
+        DOC(MemoryUsage));
+
     py::class_<PySystemMonitors>(
         m, "SystemMonitors", 
         DOC(SystemMonitors));
@@ -831,6 +839,8 @@ void bindPyTypes(py::module & m)
                DOC(PyOpenColorIO, OptimizationFlags, OPTIMIZATION_SIMPLIFY_OPS))
         .value("OPTIMIZATION_NO_DYNAMIC_PROPERTIES", OPTIMIZATION_NO_DYNAMIC_PROPERTIES, 
                DOC(PyOpenColorIO, OptimizationFlags, OPTIMIZATION_NO_DYNAMIC_PROPERTIES))
+        .value("OPTIMIZATION_REPORT", OPTIMIZATION_REPORT, 
+               DOC(PyOpenColorIO, OptimizationFlags, OPTIMIZATION_REPORT))
         .value("OPTIMIZATION_ALL", OPTIMIZATION_ALL, 
                DOC(PyOpenColorIO, OptimizationFlags, OPTIMIZATION_ALL))
         .value("OPTIMIZATION_LOSSLESS", OPTIMIZATION_LOSSLESS, 
@@ -946,6 +956,11 @@ void bindPyTypes(py::module & m)
     m.attr("OCIO_INACTIVE_COLORSPACES_ENVVAR") = OCIO_INACTIVE_COLORSPACES_ENVVAR;
     m.attr("OCIO_OPTIMIZATION_FLAGS_ENVVAR") = OCIO_OPTIMIZATION_FLAGS_ENVVAR;
     m.attr("OCIO_USER_CATEGORIES_ENVVAR") = OCIO_USER_CATEGORIES_ENVVAR;
+    m.attr("OCIO_LAZY_TRANSFORMS_ENVVAR") = OCIO_LAZY_TRANSFORMS_ENVVAR;
+    m.attr("OCIO_SEARCH_PATH_INDEX_ENVVAR") = OCIO_SEARCH_PATH_INDEX_ENVVAR;
+    m.attr("OCIO_TRACE_FILE_ENVVAR") = OCIO_TRACE_FILE_ENVVAR;
+    m.attr("OCIO_CPU_SIMD_ENVVAR") = OCIO_CPU_SIMD_ENVVAR;
+    m.attr("OCIO_NUM_THREADS_ENVVAR") = OCIO_NUM_THREADS_ENVVAR;
 
     // Roles
     m.attr("ROLE_DEFAULT") = ROLE_DEFAULT;
@@ -1,7 +1,14 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <queue>
 #include <sstream>
+#include <thread>
 
 #include "imageio.h"
 
@@ -80,6 +87,85 @@ unsigned GetChannelSizeInBytes(BitDepth bitdepth)
     }
 }
 
+std::string GetImageDescStr(long width, long height, BitDepth bitdepth, ChannelOrdering chanOrder)
+{
+    std::ostringstream ss;
+
+    ss << std::endl;
+    ss << "Image: [" << width << "x" << height << "] " << BitDepthToString(bitdepth) << " ";
+
+    const std::vector<std::string> chanNames = GetChannelNames(chanOrder);
+    for (size_t i = 0; i < chanNames.size(); ++i)
+    {
+        ss << chanNames[i];
+
+        if (i < (chanNames.size() - 1))
+        {
+            ss << ", ";
+        }
+    }
+    ss << std::endl;
+
+    return ss.str();
+}
+
+// Block of scanlines flowing through the StreamImage() pipeline.
+struct ScanlineBlock
+{
+    long m_yBegin = 0;
+    long m_yEnd   = 0;
+
+    std::vector<uint8_t> m_src;
+    // Unused when the block is processed in place.
+    std::vector<uint8_t> m_dst;
+};
+
+// Blocking queue of blocks between two stages of the pipeline. The queue is bounded by the
+// number of allocated blocks.
+class BlockQueue
+{
+public:
+    void push(ScanlineBlock * block)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_blocks.push(block);
+        }
+        m_cond.notify_one();
+    }
+
+    // Wait for a block. Returns null once the queue is closed and empty.
+    ScanlineBlock * pop()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cond.wait(lock, [this]() { return !m_blocks.empty() || m_closed; });
+
+        if (m_blocks.empty())
+        {
+            return nullptr;
+        }
+
+        ScanlineBlock * block = m_blocks.front();
+        m_blocks.pop();
+        return block;
+    }
+
+    void close()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_closed = true;
+        }
+        m_cond.notify_all();
+    }
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+    std::queue<ScanlineBlock *> m_blocks;
+    bool m_closed = false;
+};
+
 } // anonymous namespace
 
 } // OCIO_NAMESPACE
@@ -228,4 +314,282 @@ void ImageIO::write(const std::string & filename, BitDepth bitdepth) const
 }
 
 
+ImageReader::ImageReader(const std::string & filename, BitDepth bitdepth)
+: m_impl(new ImageReader::Impl(filename, bitdepth))
+{
+
+}
+
+ImageReader::~ImageReader()
+{
+    delete m_impl;
+    m_impl = nullptr;
+}
+
+std::string ImageReader::getImageDescStr() const
+{
+    return GetImageDescStr(getWidth(), getHeight(), getBitDepth(), getChannelOrder());
+}
+
+long ImageReader::getWidth() const
+{
+    return m_impl->getWidth();
+}
+
+long ImageReader::getHeight() const
+{
+    return m_impl->getHeight();
+}
+
+BitDepth ImageReader::getBitDepth() const
+{
+    return m_impl->getBitDepth();
+}
+
+long ImageReader::getNumChannels() const
+{
+    return m_impl->getNumChannels();
+}
+
+ChannelOrdering ImageReader::getChannelOrder() const
+{
+    return m_impl->getChannelOrder();
+}
+
+ptrdiff_t ImageReader::getXStrideBytes() const
+{
+    return getNumChannels() * GetChannelSizeInBytes(getBitDepth());
+}
+
+ptrdiff_t ImageReader::getYStrideBytes() const
+{
+    return getWidth() * getXStrideBytes();
+}
+
+void ImageReader::readScanlines(long yBegin, long yEnd, uint8_t * data)
+{
+    if (yBegin < 0 || yEnd > getHeight() || yBegin >= yEnd)
+    {
+        std::stringstream ss;
+        ss << "Error: Invalid scanline range [" << yBegin << ", " << yEnd << "[.";
+        throw Exception(ss.str().c_str());
+    }
+
+    m_impl->readScanlines(yBegin, yEnd, data);
+}
+
+ImageWriter::ImageWriter(const ImageReader & src, BitDepth bitDepth, BitDepth fileBitDepth)
+: m_impl(new ImageWriter::Impl(*src.m_impl, bitDepth, fileBitDepth))
+{
+
+}
+
+ImageWriter::~ImageWriter()
+{
+    delete m_impl;
+    m_impl = nullptr;
+}
+
+std::string ImageWriter::getImageDescStr() const
+{
+    return GetImageDescStr(m_impl->getWidth(), m_impl->getHeight(),
+                           m_impl->getFileBitDepth(), m_impl->getChannelOrder());
+}
+
+BitDepth ImageWriter::getBitDepth() const
+{
+    return m_impl->getBitDepth();
+}
+
+ptrdiff_t ImageWriter::getXStrideBytes() const
+{
+    return m_impl->getNumChannels() * GetChannelSizeInBytes(getBitDepth());
+}
+
+ptrdiff_t ImageWriter::getYStrideBytes() const
+{
+    return m_impl->getWidth() * getXStrideBytes();
+}
+
+void ImageWriter::attribute(const std::string & name, const std::string & value)
+{
+    m_impl->attribute(name, value);
+}
+
+void ImageWriter::attribute(const std::string & name, float value)
+{
+    m_impl->attribute(name, value);
+}
+
+void ImageWriter::attribute(const std::string & name, int value)
+{
+    m_impl->attribute(name, value);
+}
+
+void ImageWriter::open(const std::string & filename)
+{
+    m_impl->open(filename);
+}
+
+void ImageWriter::writeScanlines(long yBegin, long yEnd, const uint8_t * data)
+{
+    if (yBegin < 0 || yEnd > m_impl->getHeight() || yBegin >= yEnd)
+    {
+        std::stringstream ss;
+        ss << "Error: Invalid scanline range [" << yBegin << ", " << yEnd << "[.";
+        throw Exception(ss.str().c_str());
+    }
+
+    m_impl->writeScanlines(yBegin, yEnd, data);
+}
+
+void ImageWriter::close()
+{
+    m_impl->close();
+}
+
+void StreamImage(ImageReader & reader,
+                 ImageWriter & writer,
+                 const ScanlineBlockProcessor & process,
+                 long blockHeight,
+                 unsigned numBlocks)
+{
+    if (blockHeight <= 0 || numBlocks == 0)
+    {
+        throw Exception("Error: The block height and the number of blocks must be positive.");
+    }
+
+    const long height     = reader.getHeight();
+    const bool inPlace    = reader.getBitDepth() == writer.getBitDepth();
+    const size_t srcBytes = (size_t)(blockHeight * reader.getYStrideBytes());
+    const size_t dstBytes = (size_t)(blockHeight * writer.getYStrideBytes());
+
+    // The blocks cycle through the free -> read -> processed queues.
+    std::vector<ScanlineBlock> blocks(numBlocks);
+
+    BlockQueue freeBlocks;
+    BlockQueue readBlocks;
+    BlockQueue processedBlocks;
+
+    for (auto & block : blocks)
+    {
+        freeBlocks.push(&block);
+    }
+
+    // The first error stops all the stages.
+    std::atomic<bool> failed{ false };
+    std::exception_ptr error;
+    std::mutex errorMutex;
+
+    auto fail = [&]()
+    {
+        {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!error)
+            {
+                error = std::current_exception();
+            }
+        }
+        failed = true;
+
+        freeBlocks.close();
+        readBlocks.close();
+        processedBlocks.close();
+    };
+
+    std::thread readThread([&]()
+    {
+        try
+        {
+            for (long y = 0; y < height; y += blockHeight)
+            {
+                ScanlineBlock * block = freeBlocks.pop();
+                if (!block || failed)
+                {
+                    break;
+                }
+
+                block->m_yBegin = y;
+                block->m_yEnd   = std::min(y + blockHeight, height);
+
+                // Buffers are only allocated the first time a block is used.
+                block->m_src.resize(srcBytes);
+                if (!inPlace)
+                {
+                    block->m_dst.resize(dstBytes);
+                }
+
+                reader.readScanlines(block->m_yBegin, block->m_yEnd, block->m_src.data());
+                readBlocks.push(block);
+            }
+        }
+        catch (...)
+        {
+            fail();
+        }
+        readBlocks.close();
+    });
+
+    std::thread processThread([&]()
+    {
+        try
+        {
+            while (ScanlineBlock * block = readBlocks.pop())
+            {
+                if (failed)
+                {
+                    break;
+                }
+
+                if (process)
+                {
+                    uint8_t * src = block->m_src.data();
+                    process(block->m_yBegin, block->m_yEnd, src, inPlace ? src : block->m_dst.data());
+                }
+                else if (!inPlace)
+                {
+                    throw Exception("Error: A processor is needed to change the bitdepth.");
+                }
+
+                processedBlocks.push(block);
+            }
+        }
+        catch (...)
+        {
+            fail();
+        }
+        processedBlocks.close();
+    });
+
+    // The blocks are written from the calling thread.
+    try
+    {
+        while (ScanlineBlock * block = processedBlocks.pop())
+        {
+            if (failed)
+            {
+                break;
+            }
+
+            writer.writeScanlines(block->m_yBegin,
+                                  block->m_yEnd,
+                                  inPlace ? block->m_src.data() : block->m_dst.data());
+            freeBlocks.push(block);
+        }
+    }
+    catch (...)
+    {
+        fail();
+    }
+
+    readThread.join();
+    processThread.join();
+
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+
 } // namespace OCIO_NAMESPACE
@@ -5,6 +5,7 @@
 #define INCLUDED_OCIO_IMAGEIO_H
 
 #include <cstddef>
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -79,6 +80,118 @@ private:
     const Impl * getImpl() const { return m_impl; }
 };
 
+/**
+ * ImageReader reads an image by blocks of scanlines so that the whole image never needs to be
+ * in memory. The scanlines are packed i.e. a block of n scanlines holds n * getYStrideBytes()
+ * bytes. Like ImageIO, only the RGB or RGBA channels are read.
+ */
+class ImageReader
+{
+public:
+    // Open the image, the scanlines are converted to the specified bitdepth or kept in the
+    // file bitdepth.
+    explicit ImageReader(const std::string & filename, BitDepth bitdepth = BIT_DEPTH_UNKNOWN);
+
+    ImageReader(const ImageReader &) = delete;
+    ImageReader(ImageReader &&) = delete;
+
+    ImageReader & operator = (const ImageReader &) = delete;
+    ImageReader & operator = (ImageReader &&) = delete;
+
+    ~ImageReader();
+
+    // Returns printable information about the image.
+    std::string getImageDescStr() const;
+
+    long getWidth() const;
+    long getHeight() const;
+
+    BitDepth getBitDepth() const;
+
+    long getNumChannels() const;
+    ChannelOrdering getChannelOrder() const;
+
+    ptrdiff_t getXStrideBytes() const;
+    ptrdiff_t getYStrideBytes() const;
+
+    // Read the scanlines [yBegin, yEnd[ (relative to the top of the image) into data.
+    void readScanlines(long yBegin, long yEnd, uint8_t * data);
+
+private:
+    class Impl;
+    Impl * m_impl;
+    Impl * getImpl() { return m_impl; }
+    const Impl * getImpl() const { return m_impl; }
+
+    friend class ImageWriter;
+};
+
+/**
+ * ImageWriter writes an image by blocks of scanlines, in increasing order. The image has the size,
+ * channels and attributes of the source image. Attributes must be set before calling open().
+ */
+class ImageWriter
+{
+public:
+    // The scanlines given to writeScanlines() are in the bitDepth bitdepth, and they are written
+    // to the file using the fileBitDepth bitdepth (defaults to bitDepth).
+    ImageWriter(const ImageReader & src, BitDepth bitDepth, BitDepth fileBitDepth = BIT_DEPTH_UNKNOWN);
+
+    ImageWriter(const ImageWriter &) = delete;
+    ImageWriter(ImageWriter &&) = delete;
+
+    ImageWriter & operator = (const ImageWriter &) = delete;
+    ImageWriter & operator = (ImageWriter &&) = delete;
+
+    ~ImageWriter();
+
+    // Returns printable information about the image.
+    std::string getImageDescStr() const;
+
+    BitDepth getBitDepth() const;
+
+    ptrdiff_t getXStrideBytes() const;
+    ptrdiff_t getYStrideBytes() const;
+
+    // Set metadata attributes on the image, depends on format.
+    void attribute(const std::string & name, const std::string & value);
+    void attribute(const std::string & name, float value);
+    void attribute(const std::string & name, int value);
+
+    void open(const std::string & filename);
+
+    // Write the scanlines [yBegin, yEnd[ (relative to the top of the image). Blocks must be
+    // written in increasing order.
+    void writeScanlines(long yBegin, long yEnd, const uint8_t * data);
+
+    // Flush and close the file. It is also closed by the destructor, but only close() reports
+    // errors.
+    void close();
+
+private:
+    class Impl;
+    Impl * m_impl;
+    Impl * getImpl() { return m_impl; }
+    const Impl * getImpl() const { return m_impl; }
+};
+
+// Process the scanlines [yBegin, yEnd[. The source and destination buffers are packed, and are
+// the same buffer when the reader and the writer bitdepths are identical.
+typedef std::function<void(long yBegin, long yEnd, uint8_t * src, uint8_t * dst)>
+    ScanlineBlockProcessor;
+
+/**
+ * Stream an image from the reader to the writer by blocks of blockHeight scanlines. The blocks
+ * flow through a bounded read -> process -> write pipeline where each stage runs on its own
+ * thread, so I/O and processing overlap and at most numBlocks blocks are allocated at any time.
+ * The writer must be opened. The first error raised by any of the stages is rethrown.
+ */
+void StreamImage(ImageReader & reader,
+                 ImageWriter & writer,
+                 const ScanlineBlockProcessor & process,
+                 long blockHeight = 64,
+                 unsigned numBlocks = 4);
+
 } // namespace OCIO_NAMESPACE
 
 #endif // INCLUDED_OCIO_IMAGEIO_H
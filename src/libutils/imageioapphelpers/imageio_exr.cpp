@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <memory>
 #include <sstream>
 
 #include <ImfArray.h>
@@ -10,6 +11,7 @@
 #include <ImfHeader.h>
 #include <ImfInputFile.h>
 #include <ImfOutputFile.h>
+#include <ImfPartType.h>
 #include <ImfFloatAttribute.h>
 #include <ImfIntAttribute.h>
 #include <ImfMatrixAttribute.h>
@@ -413,4 +415,266 @@ public:
 
 };
 
+class ImageReader::Impl
+{
+public:
+    Imf::InputFile m_file;
+    // Header of the scanlines i.e. the file header with the RGB or RGBA channels of the
+    // requested pixel type.
+    Imf::Header m_header;
+    ChannelOrdering m_chanOrder = CHANNEL_ORDERING_RGB;
+    Imf::PixelType m_pixelType = Imf::HALF;
+
+    Impl(const std::string & filename, BitDepth bitdepth)
+        :   m_file(filename.c_str())
+    {
+        // Same channel and pixel type detection as ImageIO::Impl::read().
+        const Imf::ChannelList & chanList = m_file.header().channels();
+
+        if (chanList.findChannel(RgbaChans[3]))
+        {
+            m_chanOrder = CHANNEL_ORDERING_RGBA;
+        }
+
+        if (bitdepth != BIT_DEPTH_UNKNOWN)
+        {
+            m_pixelType = BitDepthToPixelType(bitdepth);
+        }
+        else
+        {
+            for (const auto & name : RgbaChans)
+            {
+                auto chan = chanList.findChannel(name);
+                if (chan && chan->type == Imf::FLOAT)
+                {
+                    m_pixelType = Imf::FLOAT;
+                    break;
+                }
+            }
+        }
+
+        m_header = m_file.header();
+        m_header.channels() = Imf::ChannelList();
+        for (auto name : GetChannelNames(m_chanOrder))
+        {
+            m_header.channels().insert(name, Imf::Channel(m_pixelType));
+        }
+    }
+
+    Impl(const Impl &) = delete;
+    Impl(Impl &&) = delete;
+
+    Impl& operator= (const Impl & rhs) = delete;
+    Impl& operator= (Impl && rhs) = delete;
+
+    ~Impl() = default;
+
+    long getWidth() const
+    {
+        const Imath::Box2i & dw = m_header.dataWindow();
+        return (long)(dw.max.x - dw.min.x + 1);
+    }
+
+    long getHeight() const
+    {
+        const Imath::Box2i & dw = m_header.dataWindow();
+        return (long)(dw.max.y - dw.min.y + 1);
+    }
+
+    BitDepth getBitDepth() const
+    {
+        return BitDepthFromPixelType(m_pixelType);
+    }
+
+    long getNumChannels() const
+    {
+        return (long)GetNumChannels(m_chanOrder);
+    }
+
+    ChannelOrdering getChannelOrder() const
+    {
+        return m_chanOrder;
+    }
+
+    void readScanlines(long yBegin, long yEnd, uint8_t * data)
+    {
+        const Imath::Box2i & dw = m_header.dataWindow();
+        const size_t x          = (size_t)dw.min.x;
+        const size_t y          = (size_t)(dw.min.y + yBegin);
+        const size_t chanStride = GetChannelSizeInBytes(getBitDepth());
+        const size_t xStride    = getNumChannels() * chanStride;
+        const size_t yStride    = getWidth() * xStride;
+
+        // The slices are relative to the first scanline of the block.
+        Imf::FrameBuffer frameBuffer;
+
+        const std::vector<std::string> chanNames = GetChannelNames(m_chanOrder);
+        for (size_t i = 0; i < chanNames.size(); i++)
+        {
+            frameBuffer.insert(
+                chanNames[i],
+                Imf::Slice(
+                    m_pixelType,
+                    (char *)(data - x*xStride - y*yStride + i*chanStride),
+                    xStride, yStride,
+                    1, 1,
+                    // RGB default to 0.0, A default to 1.0
+                    (i == 3 ? 1.0 : 0.0)
+                )
+            );
+        }
+
+        m_file.setFrameBuffer(frameBuffer);
+        m_file.readPixels(dw.min.y + (int)yBegin, dw.min.y + (int)yEnd - 1);
+    }
+};
+
+class ImageWriter::Impl
+{
+public:
+    Imf::Header m_header;
+    std::unique_ptr<Imf::OutputFile> m_file;
+    ChannelOrdering m_chanOrder = CHANNEL_ORDERING_RGB;
+    // Pixel type of the scanlines, the file channels could have a different one.
+    Imf::PixelType m_pixelType = Imf::HALF;
+
+    Impl(const ImageReader::Impl & src, BitDepth bitDepth, BitDepth fileBitDepth)
+        :   m_header(src.m_header)
+        ,   m_chanOrder(src.m_chanOrder)
+        ,   m_pixelType(BitDepthToPixelType(bitDepth))
+    {
+        const Imf::PixelType filePixelType
+            = fileBitDepth != BIT_DEPTH_UNKNOWN ? BitDepthToPixelType(fileBitDepth) : m_pixelType;
+
+        m_header.channels() = Imf::ChannelList();
+        for (auto name : GetChannelNames(m_chanOrder))
+        {
+            m_header.channels().insert(name, Imf::Channel(filePixelType));
+        }
+
+        // Blocks of scanlines are written so the output is never tiled.
+        if (m_header.hasTileDescription())
+        {
+            m_header.erase("tiles");
+        }
+        if (m_header.hasType())
+        {
+            m_header.setType(Imf::SCANLINEIMAGE);
+        }
+
+        // Blocks of scanlines are always written from top to bottom.
+        m_header.lineOrder() = Imf::INCREASING_Y;
+
+        // Do not propagate colorInteropID.
+        m_header.insert("colorInteropID", Imf::StringAttribute("unknown"));
+    }
+
+    Impl(const Impl &) = delete;
+    Impl(Impl &&) = delete;
+
+    Impl& operator= (const Impl & rhs) = delete;
+    Impl& operator= (Impl && rhs) = delete;
+
+    ~Impl() = default;
+
+    BitDepth getFileBitDepth() const
+    {
+        return BitDepthFromPixelType(m_header.channels().begin().channel().type);
+    }
+
+    long getWidth() const
+    {
+        const Imath::Box2i & dw = m_header.dataWindow();
+        return (long)(dw.max.x - dw.min.x + 1);
+    }
+
+    long getHeight() const
+    {
+        const Imath::Box2i & dw = m_header.dataWindow();
+        return (long)(dw.max.y - dw.min.y + 1);
+    }
+
+    BitDepth getBitDepth() const
+    {
+        return BitDepthFromPixelType(m_pixelType);
+    }
+
+    long getNumChannels() const
+    {
+        return (long)GetNumChannels(m_chanOrder);
+    }
+
+    ChannelOrdering getChannelOrder() const
+    {
+        return m_chanOrder;
+    }
+
+    void attribute(const std::string & name, const std::string & value)
+    {
+        m_header.insert(name, Imf::StringAttribute(value));
+    }
+
+    void attribute(const std::string & name, float value)
+    {
+        m_header.insert(name, Imf::FloatAttribute(value));
+    }
+
+    void attribute(const std::string & name, int value)
+    {
+        m_header.insert(name, Imf::IntAttribute(value));
+    }
+
+    void open(const std::string & filename)
+    {
+        m_file.reset(new Imf::OutputFile(filename.c_str(), m_header));
+    }
+
+    void writeScanlines(long yBegin, long yEnd, const uint8_t * data)
+    {
+        if (!m_file)
+        {
+            throw Exception("Error: The image must be opened before writing scanlines.");
+        }
+
+        const Imath::Box2i & dw = m_header.dataWindow();
+        if (m_file->currentScanLine() != dw.min.y + (int)yBegin)
+        {
+            throw Exception("Error: Scanlines must be written in increasing order.");
+        }
+
+        const size_t x          = (size_t)dw.min.x;
+        const size_t y          = (size_t)(dw.min.y + yBegin);
+        const size_t chanStride = GetChannelSizeInBytes(getBitDepth());
+        const size_t xStride    = getNumChannels() * chanStride;
+        const size_t yStride    = getWidth() * xStride;
+
+        Imf::FrameBuffer frameBuffer;
+
+        const std::vector<std::string> chanNames = GetChannelNames(m_chanOrder);
+        for (size_t i = 0; i < chanNames.size(); i++)
+        {
+            frameBuffer.insert(
+                chanNames[i],
+                Imf::Slice(
+                    m_pixelType,
+                    (char *)(data - x*xStride - y*yStride + i*chanStride),
+                    xStride, yStride,
+                    1, 1,
+                    // RGB default to 0.0, A default to 1.0
+                    (i == 3 ? 1.0 : 0.0)
+                )
+            );
+        }
+
+        m_file->setFrameBuffer(frameBuffer);
+        m_file->writePixels((int)(yEnd - yBegin));
+    }
+
+    void close()
+    {
+        // The scanlines are flushed when the file is destroyed.
+        m_file.reset();
+    }
+};
+
 } // namespace OCIO_NAMESPACE
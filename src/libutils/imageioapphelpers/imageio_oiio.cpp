@@ -1,10 +1,12 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <memory>
 #include <sstream>
 
 #include <OpenImageIO/imagebuf.h>
 #include <OpenImageIO/imagebufalgo.h>
+#include <OpenImageIO/imageio.h>
 
 
 namespace OCIO_NAMESPACE
@@ -267,4 +269,226 @@ public:
 
 };
 
+class ImageReader::Impl
+{
+public:
+    std::unique_ptr<OIIO::ImageInput> m_input;
+    // Spec of the scanlines i.e. the file spec limited to the RGB or RGBA channels of the
+    // requested type.
+    OIIO::ImageSpec m_spec;
+
+    Impl(const std::string & filename, BitDepth bitdepth)
+    {
+        m_input = OIIO::ImageInput::open(filename);
+        if (!m_input)
+        {
+            std::stringstream ss;
+            ss << "Error: Could not open image: " << OIIO::geterror();
+            throw Exception(ss.str().c_str());
+        }
+
+        m_spec = m_input->spec();
+
+        if (m_spec.nchannels < 3)
+        {
+            std::stringstream ss;
+            ss << "Error: Unsupported number of channels: " << m_spec.nchannels;
+            throw Exception(ss.str().c_str());
+        }
+
+        // Like ImageIO, only the RGB or RGBA channels are processed.
+        m_spec.nchannels = m_spec.nchannels >= 4 ? 4 : 3;
+        m_spec.channelnames.resize(m_spec.nchannels);
+        m_spec.channelformats.clear();
+
+        if (bitdepth != BIT_DEPTH_UNKNOWN)
+        {
+            m_spec.format = BitDepthToTypeDesc(bitdepth);
+        }
+
+        // Throw for unsupported types.
+        BitDepthFromTypeDesc(m_spec.format);
+    }
+
+    Impl(const Impl &) = delete;
+    Impl(Impl &&) = delete;
+
+    Impl& operator= (const Impl & rhs) = delete;
+    Impl& operator= (Impl && rhs) = delete;
+
+    ~Impl() = default;
+
+    long getWidth() const
+    {
+        return m_spec.width;
+    }
+
+    long getHeight() const
+    {
+        return m_spec.height;
+    }
+
+    BitDepth getBitDepth() const
+    {
+        return BitDepthFromTypeDesc(m_spec.format);
+    }
+
+    long getNumChannels() const
+    {
+        return m_spec.nchannels;
+    }
+
+    ChannelOrdering getChannelOrder() const
+    {
+        return getNumChannels() == 4 ? CHANNEL_ORDERING_RGBA : CHANNEL_ORDERING_RGB;
+    }
+
+    void readScanlines(long yBegin, long yEnd, uint8_t * data)
+    {
+        if (!m_input->read_scanlines(
+                0,                          // subimage
+                0,                          // miplevel
+                m_spec.y + (int)yBegin,
+                m_spec.y + (int)yEnd,
+                m_spec.z,
+                0,                          // chbegin
+                m_spec.nchannels,           // chend
+                m_spec.format,              // convert to type
+                data
+        ))
+        {
+            std::stringstream ss;
+            ss << "Error: Could not read image: " << m_input->geterror();
+            throw Exception(ss.str().c_str());
+        }
+    }
+};
+
+class ImageWriter::Impl
+{
+public:
+    std::unique_ptr<OIIO::ImageOutput> m_output;
+    // Spec of the file.
+    OIIO::ImageSpec m_spec;
+    // Type of the scanlines, the file could have a different one.
+    OIIO::TypeDesc m_format;
+
+    Impl(const ImageReader::Impl & src, BitDepth bitDepth, BitDepth fileBitDepth)
+        :   m_spec(src.m_spec)
+        ,   m_format(BitDepthToTypeDesc(bitDepth))
+    {
+        m_spec.format = fileBitDepth != BIT_DEPTH_UNKNOWN ? BitDepthToTypeDesc(fileBitDepth)
+                                                          : m_format;
+
+        // Blocks of scanlines are written so the output is never tiled.
+        m_spec.tile_width  = 0;
+        m_spec.tile_height = 0;
+        m_spec.tile_depth  = 1;
+
+        // Do not propagate colorInteropID.
+        m_spec.attribute("colorInteropID", "unknown");
+    }
+
+    Impl(const Impl &) = delete;
+    Impl(Impl &&) = delete;
+
+    Impl& operator= (const Impl & rhs) = delete;
+    Impl& operator= (Impl && rhs) = delete;
+
+    ~Impl() = default;
+
+    BitDepth getFileBitDepth() const
+    {
+        return BitDepthFromTypeDesc(m_spec.format);
+    }
+
+    long getWidth() const
+    {
+        return m_spec.width;
+    }
+
+    long getHeight() const
+    {
+        return m_spec.height;
+    }
+
+    BitDepth getBitDepth() const
+    {
+        return BitDepthFromTypeDesc(m_format);
+    }
+
+    long getNumChannels() const
+    {
+        return m_spec.nchannels;
+    }
+
+    ChannelOrdering getChannelOrder() const
+    {
+        return getNumChannels() == 4 ? CHANNEL_ORDERING_RGBA : CHANNEL_ORDERING_RGB;
+    }
+
+    void attribute(const std::string & name, const std::string & value)
+    {
+        m_spec.attribute(name, value);
+    }
+
+    void attribute(const std::string & name, float value)
+    {
+        m_spec.attribute(name, value);
+    }
+
+    void attribute(const std::string & name, int value)
+    {
+        m_spec.attribute(name, value);
+    }
+
+    void open(const std::string & filename)
+    {
+        m_output = OIIO::ImageOutput::create(filename);
+        if (!m_output || !m_output->open(filename, m_spec))
+        {
+            std::stringstream ss;
+            ss << "Error: Could not open image: "
+               << (m_output ? m_output->geterror() : OIIO::geterror());
+            throw Exception(ss.str().c_str());
+        }
+    }
+
+    void writeScanlines(long yBegin, long yEnd, const uint8_t * data)
+    {
+        if (!m_output)
+        {
+            throw Exception("Error: The image must be opened before writing scanlines.");
+        }
+
+        if (!m_output->write_scanlines(m_spec.y + (int)yBegin,
+                                       m_spec.y + (int)yEnd,
+                                       m_spec.z,
+                                       m_format,
+                                       data))
+        {
+            std::stringstream ss;
+            ss << "Error: Could not write image: " << m_output->geterror();
+            throw Exception(ss.str().c_str());
+        }
+    }
+
+    void close()
+    {
+        if (m_output)
+        {
+            const bool closed = m_output->close();
+            const std::string error = closed ? std::string() : m_output->geterror();
+            m_output.reset();
+
+            if (!closed)
+            {
+                std::stringstream ss;
+                ss << "Error: Could not write image: " << error;
+                throw Exception(ss.str().c_str());
+            }
+        }
+    }
+};
+
 } // namespace OCIO_NAMESPACE
@@ -830,59 +830,9 @@ void DxApp::redisplay()
         {
             memset(m_cbMappedData, 0, m_cbufferAlignedSize);
 
-            const unsigned numUniforms = m_currentShaderDesc->getNumUniforms();
-            for (unsigned i = 0; i < numUniforms; ++i)
-            {
-                GpuShaderDesc::UniformData data;
-                m_currentShaderDesc->getUniform(i, data);
-                UINT8* dst = m_cbMappedData + data.m_bufferOffset;
-
-                switch (data.m_type)
-                {
-                case UNIFORM_DOUBLE:
-                    if (data.m_getDouble)
-                    {
-                        const float val = static_cast<float>(data.m_getDouble());
-                        memcpy(dst, &val, sizeof(float));
-                    }
-                    break;
-                case UNIFORM_BOOL:
-                    if (data.m_getBool)
-                    {
-                        const int val = data.m_getBool() ? 1 : 0;
-                        memcpy(dst, &val, sizeof(int));
-                    }
-                    break;
-                case UNIFORM_FLOAT3:
-                    if (data.m_getFloat3)
-                    {
-                        const Float3& f3 = data.m_getFloat3();
-                        memcpy(dst, f3.data(), 3 * sizeof(float));
-                    }
-                    break;
-                // HLSL constant-buffer array entries (float or int) occupy a full float4 (16-byte) slot.
-                case UNIFORM_VECTOR_FLOAT:
-                    if (data.m_vectorFloat.m_getSize && data.m_vectorFloat.m_getVector)
-                    {
-                        const int sz = data.m_vectorFloat.m_getSize();
-                        const float* vals = data.m_vectorFloat.m_getVector();
-                        for (int j = 0; j < sz; ++j)
-                            memcpy(dst + j * 16, &vals[j], sizeof(float));
-                    }
-                    break;
-                case UNIFORM_VECTOR_INT:
-                    if (data.m_vectorInt.m_getSize && data.m_vectorInt.m_getVector)
-                    {
-                        const int sz = data.m_vectorInt.m_getSize();
-                        const int* vals = data.m_vectorInt.m_getVector();
-                        for (int j = 0; j < sz; ++j)
-                            memcpy(dst + j * 16, &vals[j], sizeof(int));
-                    }
-                    break;
-                default:
-                    break;
-                }
-            }
+            // HLSL constant-buffer array entries (float or int) occupy a full float4 (16-byte)
+            // slot, which matches the std140 layout used by OCIO.
+            m_currentShaderDesc->fillUniformBuffer(m_cbMappedData, m_cbufferAlignedSize);
 
             m_commandList->SetGraphicsRootConstantBufferView(
                 1, m_constantBuffer->GetGPUVirtualAddress());
@@ -75,15 +75,50 @@ void SetTextureParameters(GLenum textureType, Interpolation interpolation)
     glTexParameteri(textureType, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
 }
 
+// Get the OpenGL formats corresponding to the bit-depth of the texture values.
+void GetTextureFormats(BitDepth bitDepth, bool redChannel,
+                       GLint & internalformat, GLenum & format, GLenum & type)
+{
+    format = redChannel ? GL_RED : GL_RGB;
+
+    switch (bitDepth)
+    {
+    case BIT_DEPTH_F16:
+        internalformat = redChannel ? GL_R16F : GL_RGB16F_ARB;
+        type           = GL_HALF_FLOAT_ARB;
+        break;
+
+    case BIT_DEPTH_UINT16:
+        // Normalized integers i.e. the shader samples values in [0, 1].
+        internalformat = redChannel ? GL_R16 : GL_RGB16;
+        type           = GL_UNSIGNED_SHORT;
+        break;
+
+    case BIT_DEPTH_F32:
+        internalformat = redChannel ? GL_R32F : GL_RGB32F_ARB;
+        type           = GL_FLOAT;
+        break;
+
+    default:
+        throw Exception("Unsupported texture bit-depth.");
+    }
+}
+
 void AllocateTexture3D(unsigned index, unsigned & texId, 
                         Interpolation interpolation,
-                        unsigned edgelen, const float * values)
+                        unsigned edgelen,
+                        BitDepth bitDepth, const void * values)
 {
     if(values==0x0)
     {
         throw Exception("Missing texture data");
     }
 
+    GLint internalformat = GL_RGB32F_ARB;
+    GLenum format        = GL_RGB;
+    GLenum type          = GL_FLOAT;
+    GetTextureFormats(bitDepth, false, internalformat, format, type);
+
     glGenTextures(1, &texId);
 
     glActiveTexture(GL_TEXTURE0 + index);
@@ -92,8 +127,13 @@ void AllocateTexture3D(unsigned index, unsigned & texId,
 
     SetTextureParameters(GL_TEXTURE_3D, interpolation);
 
-    glTexImage3D(GL_TEXTURE_3D, 0, GL_RGB32F_ARB,
-                    edgelen, edgelen, edgelen, 0, GL_RGB, GL_FLOAT, values);
+    // Rows of 16-bit RGB values are not always 4-byte aligned.
+    glPixelStorei(GL_UNPACK_ALIGNMENT, type == GL_FLOAT ? 4 : 2);
+
+    glTexImage3D(GL_TEXTURE_3D, 0, internalformat,
+                    edgelen, edgelen, edgelen, 0, format, type, values);
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
 }
 
 void AllocateTexture(unsigned index, unsigned & texId,
@@ -101,7 +141,8 @@ void AllocateTexture(unsigned index, unsigned & texId,
                        GpuShaderDesc::TextureType channel,
                        GpuShaderDesc::TextureDimensions dimensions,
                        Interpolation interpolation,
-                       const float * values)
+                       BitDepth bitDepth,
+                       const void * values)
 {
     if (values == nullptr)
     {
@@ -110,17 +151,17 @@ void AllocateTexture(unsigned index, unsigned & texId,
 
     GLint internalformat = GL_RGB32F_ARB;
     GLenum format        = GL_RGB;
-
-    if (channel == GpuShaderCreator::TEXTURE_RED_CHANNEL)
-    {
-        internalformat = GL_R32F;
-        format         = GL_RED;
-    }
+    GLenum type          = GL_FLOAT;
+    GetTextureFormats(bitDepth, channel == GpuShaderCreator::TEXTURE_RED_CHANNEL,
+                      internalformat, format, type);
 
     glGenTextures(1, &texId);
 
     glActiveTexture(GL_TEXTURE0 + index);
 
+    // Rows of 16-bit values are not always 4-byte aligned.
+    glPixelStorei(GL_UNPACK_ALIGNMENT, type == GL_FLOAT ? 4 : 2);
+
     switch (dimensions)
     {
     case GpuShaderCreator::TEXTURE_1D:
@@ -128,7 +169,7 @@ void AllocateTexture(unsigned index, unsigned & texId,
         
         SetTextureParameters(GL_TEXTURE_1D, interpolation);
 
-        glTexImage1D(GL_TEXTURE_1D, 0, internalformat, width, 0, format, GL_FLOAT, values);
+        glTexImage1D(GL_TEXTURE_1D, 0, internalformat, width, 0, format, type, values);
         break;
 
     case GpuShaderCreator::TEXTURE_2D:
@@ -136,13 +177,16 @@ void AllocateTexture(unsigned index, unsigned & texId,
 
         SetTextureParameters(GL_TEXTURE_2D, interpolation);
 
-        glTexImage2D(GL_TEXTURE_2D, 0, internalformat, width, height, 0, format, GL_FLOAT, values);    
+        glTexImage2D(GL_TEXTURE_2D, 0, internalformat, width, height, 0, format, type, values);
         break;
 
     default:
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
         throw Exception("Invalid 1D LUT texture dimensions");
         break;
     }
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
 }
 
 GLuint CompileShaderText(GLenum shaderType, const char * text)
@@ -277,6 +321,7 @@ OpenGLBuilderRcPtr OpenGLBuilder::Create(const GpuShaderDescRcPtr & shaderDesc)
 OpenGLBuilder::OpenGLBuilder(const GpuShaderDescRcPtr & shaderDesc)
     :   m_shaderDesc(shaderDesc)
     ,   m_startIndex(0)
+    ,   m_uniformBuffer(0)
     ,   m_fragShader(0)
     ,   m_program(glCreateProgram())
     ,   m_verbose(false)
@@ -286,6 +331,7 @@ OpenGLBuilder::OpenGLBuilder(const GpuShaderDescRcPtr & shaderDesc)
 OpenGLBuilder::~OpenGLBuilder()
 {
     deleteAllTextures();
+    deleteAllUniforms();
 
     if(m_fragShader)
     {
@@ -329,8 +375,9 @@ void OpenGLBuilder::allocateAllTextures(unsigned startIndex)
             throw Exception("The texture data is corrupted");
         }
 
-        const float * values = nullptr;
-        m_shaderDesc->get3DTextureValues(idx, values);
+        BitDepth bitDepth = BIT_DEPTH_F32;
+        const void * values = nullptr;
+        m_shaderDesc->get3DTextureData(idx, bitDepth, values);
         if(!values)
         {
             throw Exception("The texture values are missing");
@@ -339,7 +386,7 @@ void OpenGLBuilder::allocateAllTextures(unsigned startIndex)
         // 2. Allocate the 3D LUT.
 
         unsigned texId = 0;
-        AllocateTexture3D(currIndex, texId, interpolation, edgelen, values);
+        AllocateTexture3D(currIndex, texId, interpolation, edgelen, bitDepth, values);
 
         // 3. Keep the texture id & name for the later enabling.
 
@@ -371,8 +418,9 @@ void OpenGLBuilder::allocateAllTextures(unsigned startIndex)
             throw Exception("The texture data is corrupted");
         }
 
-        const float * values = 0x0;
-        m_shaderDesc->getTextureValues(idx, values);
+        BitDepth bitDepth = BIT_DEPTH_F32;
+        const void * values = 0x0;
+        m_shaderDesc->getTextureData(idx, bitDepth, values);
         if(!values)
         {
             throw Exception("The texture values are missing");
@@ -381,7 +429,8 @@ void OpenGLBuilder::allocateAllTextures(unsigned startIndex)
         // 2. Allocate the 1D LUT (a 1D or 2D texture is needed to hold large LUTs).
 
         unsigned texId = 0;
-        AllocateTexture(currIndex, texId, width, height, channel, dimensions, interpolation, values);
+        AllocateTexture(currIndex, texId, width, height, channel, dimensions, interpolation,
+                        bitDepth, values);
 
         // 3. Keep the texture id & name for the later enabling.
 
@@ -433,24 +482,88 @@ void OpenGLBuilder::linkAllUniforms()
         }
         // Transfer uniform.
         m_uniforms.emplace_back(name, data);
-        // Connect uniform with program.
-        m_uniforms.back().setUp(m_program);
+        if (!useUniformBlock())
+        {
+            // Connect uniform with program.
+            m_uniforms.back().setUp(m_program);
+        }
+    }
+
+    if (useUniformBlock() && maxUniforms > 0)
+    {
+#ifdef GL_UNIFORM_BUFFER
+        // All the uniforms are members of a single std140 uniform block, connect the block with
+        // the binding point 0 and allocate its buffer.
+        const std::string blockName = std::string(m_shaderDesc->getFunctionName()) + "_Parameters";
+        const GLuint blockIndex = glGetUniformBlockIndex(m_program, blockName.c_str());
+        if (blockIndex == GL_INVALID_INDEX)
+        {
+            std::string err("Shader uniform block ");
+            err += blockName;
+            err += " not found.";
+            throw Exception(err.c_str());
+        }
+        glUniformBlockBinding(m_program, blockIndex, 0);
+
+        // The size of a std140 uniform block is rounded up to a multiple of 16 bytes.
+        const size_t bufferSize = (m_shaderDesc->getUniformBufferSize() + 15) & ~size_t(15);
+        m_uniformBufferData.resize(bufferSize);
+
+        glGenBuffers(1, &m_uniformBuffer);
+        glBindBuffer(GL_UNIFORM_BUFFER, m_uniformBuffer);
+        glBufferData(GL_UNIFORM_BUFFER, (GLsizeiptr)m_uniformBufferData.size(), nullptr,
+                     GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+#else
+        throw Exception("Uniform blocks are not supported.");
+#endif
     }
 }
 
 void OpenGLBuilder::deleteAllUniforms()
 {
     m_uniforms.clear();
+
+#ifdef GL_UNIFORM_BUFFER
+    if (m_uniformBuffer)
+    {
+        glDeleteBuffers(1, &m_uniformBuffer);
+        m_uniformBuffer = 0;
+    }
+#endif
+    m_uniformBufferData.clear();
 }
 
 void OpenGLBuilder::useAllUniforms()
 {
+#ifdef GL_UNIFORM_BUFFER
+    if (m_uniformBuffer)
+    {
+        // Update all the uniforms with a single buffer upload.
+        m_shaderDesc->fillUniformBuffer(m_uniformBufferData.data(), m_uniformBufferData.size());
+
+        glBindBuffer(GL_UNIFORM_BUFFER, m_uniformBuffer);
+        glBufferSubData(GL_UNIFORM_BUFFER, 0, (GLsizeiptr)m_uniformBufferData.size(),
+                        m_uniformBufferData.data());
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+        glBindBufferBase(GL_UNIFORM_BUFFER, 0, m_uniformBuffer);
+        return;
+    }
+#endif
+
     for (auto uniform : m_uniforms)
     {
         uniform.use();
     }
 }
 
+bool OpenGLBuilder::useUniformBlock() const
+{
+    const GpuLanguage lang = m_shaderDesc->getLanguage();
+    return m_shaderDesc->getUseUniformBlock()
+           && (lang == GPU_LANGUAGE_GLSL_4_0 || lang == GPU_LANGUAGE_GLSL_ES_3_0);
+}
+
 std::string OpenGLBuilder::getGLSLVersionString()
 {
     switch (m_shaderDesc->getLanguage())
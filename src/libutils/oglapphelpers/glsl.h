@@ -96,6 +96,9 @@ protected:
     void deleteAllTextures();
     void deleteAllUniforms();
 
+    // True when all the uniforms are members of a single uniform block.
+    bool useUniformBlock() const;
+
     // To add the version to the fragment shader program (so that GLSL does not use the default
     // of 1.10 when the minimum version for OCIO is 1.20).
     std::string getGLSLVersionString();
@@ -109,6 +112,8 @@ private:
     unsigned m_startIndex;                 // Starting index for texture allocations
     TextureIds m_textureIds;               // Texture ids of all needed textures
     Uniforms m_uniforms;                   // Vector of dynamic parameters
+    unsigned m_uniformBuffer;              // Uniform buffer object when using a uniform block
+    std::vector<char> m_uniformBufferData; // Values of the uniform block
     unsigned m_fragShader;                 // Fragment shader identifier
     unsigned m_program;                    // Program identifier
     std::string m_shaderCacheID;           // Current shader program key
@@ -986,55 +986,9 @@ void VulkanBuilder::updateUniforms()
     void * data;
     vkMapMemory(m_device, m_uniformBufferMemory, 0, m_uniformBufferSize, 0, &data);
     
-    // Zero-initialize the buffer first to ensure clean state
-    memset(data, 0, m_uniformBufferSize);
-
     // Query uniform values directly from shader description (callbacks may have updated)
-    const unsigned numUniforms = m_shaderDesc->getNumUniforms();
-    for (unsigned idx = 0; idx < numUniforms && idx < m_uniforms.size(); ++idx)
-    {
-        GpuShaderDesc::UniformData uniformData;
-        m_shaderDesc->getUniform(idx, uniformData);
-        
-        char * dest = static_cast<char*>(data) + m_uniforms[idx].offset;
-        
-        if (uniformData.m_getDouble)
-        {
-            float val = static_cast<float>(uniformData.m_getDouble());
-            memcpy(dest, &val, sizeof(float));
-        }
-        else if (uniformData.m_getBool)
-        {
-            int val = uniformData.m_getBool() ? 1 : 0;
-            memcpy(dest, &val, sizeof(int));
-        }
-        else if (uniformData.m_getFloat3)
-        {
-            // vec3 in std140: write 3 floats (12 bytes), padded to 16 bytes
-            auto vals = uniformData.m_getFloat3();
-            memcpy(dest, vals.data(), 3 * sizeof(float));
-        }
-        else if (uniformData.m_vectorFloat.m_getSize && uniformData.m_vectorFloat.m_getVector)
-        {
-            // In std140, each array element is padded to 16 bytes
-            const float * vals = uniformData.m_vectorFloat.m_getVector();
-            size_t count = uniformData.m_vectorFloat.m_getSize();
-            for (size_t i = 0; i < count; ++i)
-            {
-                memcpy(dest + i * 16, &vals[i], sizeof(float));
-            }
-        }
-        else if (uniformData.m_vectorInt.m_getSize && uniformData.m_vectorInt.m_getVector)
-        {
-            // In std140, each array element is padded to 16 bytes
-            const int * vals = uniformData.m_vectorInt.m_getVector();
-            size_t count = uniformData.m_vectorInt.m_getSize();
-            for (size_t i = 0; i < count; ++i)
-            {
-                memcpy(dest + i * 16, &vals[i], sizeof(int));
-            }
-        }
-    }
+    // and write them using the std140 layout of the uniform block.
+    m_shaderDesc->fillUniformBuffer(data, m_uniformBufferSize);
 
     vkUnmapMemory(m_device, m_uniformBufferMemory);
 }
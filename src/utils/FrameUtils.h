@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_FRAMEUTILS_H
+#define INCLUDED_FRAMEUTILS_H
+
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+// Helpers for the image sequences i.e. file names where a run of '#' characters stands for the
+// zero-padded frame number (e.g. 'shot.####.exr').
+
+namespace FrameUtils
+{
+
+// Parse a whole string as a decimal integer, return false on any extra character.
+inline bool ParseFrame(int & frame, const std::string & str)
+{
+    if (str.empty())
+    {
+        return false;
+    }
+
+    const char * begin = str.c_str();
+    char * end = nullptr;
+
+    errno = 0;
+    const long value = std::strtol(begin, &end, 10);
+    if (errno != 0 || end != begin + str.size() || value < INT_MIN || value > INT_MAX)
+    {
+        return false;
+    }
+
+    frame = static_cast<int>(value);
+    return true;
+}
+
+// Parse a "first-last" frame range or a single frame, return false if the range is invalid.
+// Note that the first frame could be negative (e.g. "-5-5") but not the last one.
+inline bool ParseFrameRange(std::vector<int> & frames, const std::string & input)
+{
+    int first = 0;
+    int last  = 0;
+
+    // Skip the first character so that a negative first frame is not seen as a separator.
+    const std::string::size_type pos = input.find('-', 1);
+    if (pos == std::string::npos)
+    {
+        if (!ParseFrame(first, input))
+        {
+            return false;
+        }
+        last = first;
+    }
+    else if (!ParseFrame(first, input.substr(0, pos))
+             || !ParseFrame(last, input.substr(pos + 1)))
+    {
+        return false;
+    }
+
+    if (last < first)
+    {
+        return false;
+    }
+
+    frames.clear();
+    for (long frame = first; frame <= last; ++frame)
+    {
+        frames.push_back(static_cast<int>(frame));
+    }
+    return true;
+}
+
+// Replace the first run of '#' characters by the frame number, zero-padded to the length of
+// the run (the sign of a negative frame is part of the padding). Return false if the pattern
+// has no '#' character.
+inline bool ExpandFramePattern(std::string & name, const std::string & pattern, int frame)
+{
+    const std::string::size_type first = pattern.find('#');
+    if (first == std::string::npos)
+    {
+        return false;
+    }
+
+    std::string::size_type last = pattern.find_first_not_of('#', first);
+    if (last == std::string::npos)
+    {
+        last = pattern.size();
+    }
+
+    std::ostringstream oss;
+    oss << std::setfill('0') << std::internal << std::setw(int(last - first)) << frame;
+
+    name = pattern.substr(0, first) + oss.str() + pattern.substr(last);
+    return true;
+}
+
+} // namespace FrameUtils
+
+
+#endif // INCLUDED_FRAMEUTILS_H
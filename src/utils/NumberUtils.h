@@ -26,6 +26,7 @@
 #define really_inline inline __attribute__((always_inline))
 #endif
 
+#include <cstdio>
 #include <cstdlib>
 #ifdef __APPLE__
 #include <xlocale.h>
@@ -68,6 +69,12 @@ struct from_chars_result
     std::errc ec;
 };
 
+struct to_chars_result
+{
+    char *ptr;
+    std::errc ec;
+};
+
 static const Locale loc;
 
 #ifdef USE_CHARCONV_FROM_CHARS
@@ -254,6 +261,40 @@ really_inline from_chars_result from_chars(const char *first, const char *last,
     }
 #endif
 }
+
+// Write the value in the general format with the given number of significant digits (i.e. the
+// same characters as printf with "%.*g") whatever the current locale is.
+really_inline to_chars_result to_chars(char *first, char *last, double value, int precision) noexcept
+{
+    if (!first || !last || first == last)
+    {
+        return {last, std::errc::value_too_large};
+    }
+
+#ifdef USE_CHARCONV_FROM_CHARS
+    std::to_chars_result res = std::to_chars(first, last, value, std::chars_format::general, precision);
+    return to_chars_result{ res.ptr, res.ec };
+#else
+
+    const size_t size = static_cast<size_t>(last - first);
+
+#ifdef _WIN32
+    const int len = _snprintf_l(first, size, "%.*g", loc.local, precision, value);
+#else
+    const locale_t prevLocale = ::uselocale(loc.local);
+    const int len = ::snprintf(first, size, "%.*g", precision, value);
+    ::uselocale(prevLocale);
+#endif
+
+    if (len < 0 || static_cast<size_t>(len) >= size)
+    {
+        return {last, std::errc::value_too_large};
+    }
+
+    return {first + len, {}};
+#endif
+}
+
 } // namespace NumberUtils
 } // namespace OCIO_NAMESPACE
 #endif // INCLUDED_NUMBERUTILS_H
@@ -5,7 +5,11 @@
 #include "CPUInfo.h"
 #if OCIO_USE_AVX
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <sstream>
+#include <vector>
 
 #include <OpenColorIO/OpenColorIO.h>
 
@@ -13,6 +17,7 @@
 #include "MathUtils.h"
 #include "BitDepthUtils.h"
 #include "AVX.h"
+#include "ops/lut3d/Lut3DOpCPU_AVX.h"
 #include "testutils/UnitTest.h"
 
 namespace OCIO = OCIO_NAMESPACE;
@@ -459,4 +464,88 @@ DEFINE_SIMD_TEST(packed_all_test)
     }
 }
 
+DEFINE_SIMD_TEST(lut3d_trilinear_test)
+{
+    // The LUT is stored as expected by the renderers i.e. 4 floats per entry (RGB and an
+    // unused alpha) with the blue coordinate changing fastest.
+    constexpr int dim = 17;
+    const float maxIdx = static_cast<float>(dim - 1);
+
+    std::vector<float> lut(dim * dim * dim * 4, 0.0f);
+    for (int r = 0; r < dim; ++r)
+    {
+        for (int g = 0; g < dim; ++g)
+        {
+            for (int b = 0; b < dim; ++b)
+            {
+                const float rv = static_cast<float>(r) / maxIdx;
+                const float gv = static_cast<float>(g) / maxIdx;
+                const float bv = static_cast<float>(b) / maxIdx;
+
+                const int idx = 4 * (b + dim * (g + dim * r));
+                lut[idx + 0] = rv * rv + 0.1f * bv;
+                lut[idx + 1] = gv * bv - 0.2f * rv;
+                lut[idx + 2] = std::sqrt(bv) + 0.3f * gv * rv;
+            }
+        }
+    }
+
+    // Use a number of pixels which is not a multiple of the SIMD width to also cover the
+    // leftover pixels, with some values outside of the LUT domain and a NaN.
+    constexpr int numPixels = 1027;
+    std::vector<float> inImage(numPixels * 4);
+    for (int i = 0; i < numPixels; ++i)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            inImage[4 * i + c] = -0.1f + 1.2f * static_cast<float>((i * 37 + c * 101) % 1000) / 999.0f;
+        }
+        inImage[4 * i + 3] = static_cast<float>(i) / static_cast<float>(numPixels);
+    }
+    inImage[4 * 5 + 1] = std::numeric_limits<float>::quiet_NaN();
+
+    std::vector<float> outImage(numPixels * 4);
+    OCIO::applyTrilinearAVX(lut.data(), dim, inImage.data(), outImage.data(), numPixels);
+
+    auto lerp = [](float x, float y, float t) { return x + (y - x) * t; };
+
+    for (int i = 0; i < numPixels; ++i)
+    {
+        int prev[3], next[3];
+        float delta[3];
+        for (int c = 0; c < 3; ++c)
+        {
+            float v = inImage[4 * i + c] * maxIdx;
+            // NaNs become 0.
+            v = std::isnan(v) ? 0.0f : std::min(std::max(v, 0.0f), maxIdx);
+
+            prev[c]  = static_cast<int>(std::floor(v));
+            next[c]  = std::min(prev[c] + 1, dim - 1);
+            delta[c] = v - static_cast<float>(prev[c]);
+        }
+
+        auto sample = [&](int r, int g, int b, int c)
+        {
+            return lut[4 * (b + dim * (g + dim * r)) + c];
+        };
+
+        for (int c = 0; c < 3; ++c)
+        {
+            const float c00 = lerp(sample(prev[0], prev[1], prev[2], c), sample(prev[0], prev[1], next[2], c), delta[2]);
+            const float c01 = lerp(sample(prev[0], next[1], prev[2], c), sample(prev[0], next[1], next[2], c), delta[2]);
+            const float c10 = lerp(sample(next[0], prev[1], prev[2], c), sample(next[0], prev[1], next[2], c), delta[2]);
+            const float c11 = lerp(sample(next[0], next[1], prev[2], c), sample(next[0], next[1], next[2], c), delta[2]);
+
+            const float expected = lerp(lerp(c00, c01, delta[1]), lerp(c10, c11, delta[1]), delta[0]);
+            const float actual   = outImage[4 * i + c];
+
+            OCIO_CHECK_ASSERT_MESSAGE(std::fabs(expected - actual) <= 1e-5f,
+                                      GetErrorMessage(expected, actual,
+                                                      OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32));
+        }
+
+        OCIO_CHECK_EQUAL(outImage[4 * i + 3], inImage[4 * i + 3]);
+    }
+}
+
 #endif // OCIO_USE_AVX
\ No newline at end of file
@@ -1946,6 +1946,104 @@ OCIO_ADD_TEST(CPUProcessor, scanline_packed_tile)
 
 }
 
+OCIO_ADD_TEST(CPUProcessor, scanline_reuse)
+{
+    // The scanline helpers (and their buffers) are reused by the apply calls, and several lines
+    // of the small images are processed at once. Process images of various sizes, line paddings
+    // and channel orders, one after the other, and compare to the single pixel processing.
+
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    const double m44[16] = { 0.9, 0.1, 0.0, 0.0,
+                             0.2, 0.7, 0.1, 0.0,
+                             0.0, 0.3, 0.6, 0.1,
+                             0.0, 0.0, 0.0, 1.0 };
+    const double offset[4] = { 0.1, 0.2, 0.3, 0.4 };
+    matrix->setMatrix(m44);
+    matrix->setOffset(offset);
+
+    OCIO::ConstConfigRcPtr config = OCIO::Config::CreateRaw();
+    OCIO::ConstCPUProcessorRcPtr cpuProcessor;
+    OCIO_CHECK_NO_THROW(cpuProcessor = config->getProcessor(matrix)->getDefaultCPUProcessor());
+
+    struct ImageSize
+    {
+        long m_width;
+        long m_height;
+        long m_padding; // Number of floats at the end of each line.
+        OCIO::ChannelOrdering m_order;
+    };
+
+    const ImageSize sizes[] = { {   64,   64, 0, OCIO::CHANNEL_ORDERING_RGBA },
+                                {    3,    2, 0, OCIO::CHANNEL_ORDERING_RGB  },
+                                { 5000,    2, 0, OCIO::CHANNEL_ORDERING_RGBA },
+                                {   64,   64, 3, OCIO::CHANNEL_ORDERING_RGBA },
+                                {    7, 1000, 0, OCIO::CHANNEL_ORDERING_BGRA },
+                                {   64,   64, 2, OCIO::CHANNEL_ORDERING_RGB  },
+                                {    1,    1, 0, OCIO::CHANNEL_ORDERING_RGBA } };
+
+    for (const auto & size : sizes)
+    {
+        const long numChannels = size.m_order == OCIO::CHANNEL_ORDERING_RGB ? 3 : 4;
+        const long lineSize = size.m_width * numChannels + size.m_padding;
+
+        std::vector<float> inImg(lineSize * size.m_height);
+        for (size_t idx = 0; idx < inImg.size(); ++idx)
+        {
+            inImg[idx] = float(idx % 1031) / 1030.f;
+        }
+
+        // The padding must be left untouched.
+        std::vector<float> outImg(inImg.size(), -1.f);
+
+        OCIO::PackedImageDesc srcImgDesc(&inImg[0], size.m_width, size.m_height, size.m_order,
+                                         OCIO::BIT_DEPTH_F32, OCIO::AutoStride, OCIO::AutoStride,
+                                         lineSize * sizeof(float));
+        OCIO::PackedImageDesc dstImgDesc(&outImg[0], size.m_width, size.m_height, size.m_order,
+                                         OCIO::BIT_DEPTH_F32, OCIO::AutoStride, OCIO::AutoStride,
+                                         lineSize * sizeof(float));
+
+        OCIO_CHECK_NO_THROW(cpuProcessor->apply(srcImgDesc, dstImgDesc));
+
+        // In-place processing.
+        std::vector<float> inPlaceImg(inImg);
+        OCIO::PackedImageDesc inPlaceImgDesc(&inPlaceImg[0], size.m_width, size.m_height,
+                                             size.m_order, OCIO::BIT_DEPTH_F32,
+                                             OCIO::AutoStride, OCIO::AutoStride,
+                                             lineSize * sizeof(float));
+
+        OCIO_CHECK_NO_THROW(cpuProcessor->apply(inPlaceImgDesc));
+
+        const bool bgra = size.m_order == OCIO::CHANNEL_ORDERING_BGRA;
+        for (long y = 0; y < size.m_height; ++y)
+        {
+            for (long x = 0; x < size.m_width; ++x)
+            {
+                const long idx = y * lineSize + x * numChannels;
+
+                float pixel[4] = { inImg[idx + (bgra ? 2 : 0)],
+                                   inImg[idx + 1],
+                                   inImg[idx + (bgra ? 0 : 2)],
+                                   numChannels == 4 ? inImg[idx + 3] : 1.f };
+                cpuProcessor->applyRGBA(pixel);
+
+                const float expected[4] = { pixel[bgra ? 2 : 0], pixel[1], pixel[bgra ? 0 : 2],
+                                            pixel[3] };
+
+                for (long c = 0; c < numChannels; ++c)
+                {
+                    OCIO_CHECK_CLOSE(outImg[idx + c], expected[c], 1e-6f);
+                    OCIO_CHECK_CLOSE(inPlaceImg[idx + c], expected[c], 1e-6f);
+                }
+            }
+
+            for (long p = 0; p < size.m_padding; ++p)
+            {
+                OCIO_CHECK_EQUAL(outImg[(y + 1) * lineSize - 1 - p], -1.f);
+            }
+        }
+    }
+}
+
 OCIO_ADD_TEST(CPUProcessor, scanline_packed_custom)
 {
     // Cases testing custom xStrideInBytes and yStrideInBytes values.
@@ -2718,6 +2816,171 @@ OCIO_ADD_TEST(CPUProcessor, one_pixel)
     }
 }
 
+OCIO_ADD_TEST(CPUProcessor, pixel_arrays)
+{
+    // Use ops with a vectorized path and a gamma so that the alpha channel and the channel
+    // crosstalk are exercised.
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    constexpr double m44[16] = { 0.9, 0.1, 0.0, 0.0,
+                                 0.2, 0.7, 0.1, 0.0,
+                                 0.0, 0.3, 0.6, 0.1,
+                                 0.0, 0.0, 0.0, 0.5 };
+    constexpr double offset4[4] = { 0.01, 0.02, 0.03, 0.25 };
+    matrix->setMatrix(m44);
+    matrix->setOffset(offset4);
+    group->appendTransform(matrix);
+
+    OCIO::ExponentTransformRcPtr exponent = OCIO::ExponentTransform::Create();
+    constexpr double gamma[4] = { 2.2, 2.4, 2.6, 1.0 };
+    exponent->setValue(gamma);
+    group->appendTransform(exponent);
+
+    OCIO::ConstCPUProcessorRcPtr cpuProcessor;
+    OCIO_CHECK_NO_THROW(cpuProcessor = config->getProcessor(group)->getDefaultCPUProcessor());
+
+    // More pixels than a batch, and not a multiple of the batch size.
+    constexpr long numPixels = 3 * OCIO::PixelBatchSize + 7;
+
+    std::vector<float> inValues(4 * numPixels);
+    for (size_t idx = 0; idx < inValues.size(); ++idx)
+    {
+        inValues[idx] = float(idx % 101) / 100.0f;
+    }
+
+    // The expected values are computed one pixel at a time.
+    std::vector<float> expectedRGBA(inValues);
+    std::vector<float> expectedRGB(inValues);
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        cpuProcessor->applyRGBA(&expectedRGBA[4 * idx]);
+        cpuProcessor->applyRGB(&expectedRGB[4 * idx]);
+    }
+
+    {
+        // Packed RGBA pixels.
+        std::vector<float> pixels(inValues);
+        OCIO_CHECK_NO_THROW(cpuProcessor->applyRGBA(pixels.data(), numPixels, OCIO::AutoStride));
+        OCIO_CHECK_ASSERT(pixels == expectedRGBA);
+    }
+
+    {
+        // Packed RGB pixels.
+        std::vector<float> pixels(3 * numPixels);
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            std::copy_n(&inValues[4 * idx], 3, &pixels[3 * idx]);
+        }
+
+        OCIO_CHECK_NO_THROW(cpuProcessor->applyRGB(pixels.data(), numPixels, OCIO::AutoStride));
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            OCIO_CHECK_EQUAL(pixels[3 * idx + 0], expectedRGB[4 * idx + 0]);
+            OCIO_CHECK_EQUAL(pixels[3 * idx + 1], expectedRGB[4 * idx + 1]);
+            OCIO_CHECK_EQUAL(pixels[3 * idx + 2], expectedRGB[4 * idx + 2]);
+        }
+    }
+
+    {
+        // Pixels in an array of structures with other members.
+        struct Point
+        {
+            float m_position[3];
+            float m_color[4];
+            int m_id;
+        };
+
+        std::vector<Point> points(numPixels);
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            points[idx].m_position[0] = -1.0f;
+            std::copy_n(&inValues[4 * idx], 4, points[idx].m_color);
+            points[idx].m_id = int(idx);
+        }
+
+        std::vector<Point> pointsRGB(points);
+
+        OCIO_CHECK_NO_THROW(cpuProcessor->applyRGBA(points[0].m_color, numPixels, sizeof(Point)));
+        OCIO_CHECK_NO_THROW(cpuProcessor->applyRGB(pointsRGB[0].m_color, numPixels, sizeof(Point)));
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            OCIO_CHECK_EQUAL(points[idx].m_position[0], -1.0f);
+            OCIO_CHECK_EQUAL(points[idx].m_id, idx);
+            for (long c = 0; c < 4; ++c)
+            {
+                OCIO_CHECK_EQUAL(points[idx].m_color[c], expectedRGBA[4 * idx + c]);
+            }
+
+            OCIO_CHECK_EQUAL(pointsRGB[idx].m_id, idx);
+            for (long c = 0; c < 3; ++c)
+            {
+                OCIO_CHECK_EQUAL(pointsRGB[idx].m_color[c], expectedRGB[4 * idx + c]);
+            }
+            // The alpha channel is left unchanged.
+            OCIO_CHECK_EQUAL(pointsRGB[idx].m_color[3], inValues[4 * idx + 3]);
+        }
+    }
+
+    {
+        // One array per channel.
+        std::vector<float> red(numPixels), green(numPixels), blue(numPixels), alpha(numPixels);
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            red[idx]   = inValues[4 * idx + 0];
+            green[idx] = inValues[4 * idx + 1];
+            blue[idx]  = inValues[4 * idx + 2];
+            alpha[idx] = inValues[4 * idx + 3];
+        }
+
+        std::vector<float> redRGB(red), greenRGB(green), blueRGB(blue);
+
+        OCIO_CHECK_NO_THROW(cpuProcessor->applyRGBA(red.data(), green.data(), blue.data(),
+                                                    alpha.data(), numPixels));
+        OCIO_CHECK_NO_THROW(cpuProcessor->applyRGB(redRGB.data(), greenRGB.data(),
+                                                   blueRGB.data(), numPixels));
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            OCIO_CHECK_EQUAL(red[idx],   expectedRGBA[4 * idx + 0]);
+            OCIO_CHECK_EQUAL(green[idx], expectedRGBA[4 * idx + 1]);
+            OCIO_CHECK_EQUAL(blue[idx],  expectedRGBA[4 * idx + 2]);
+            OCIO_CHECK_EQUAL(alpha[idx], expectedRGBA[4 * idx + 3]);
+
+            OCIO_CHECK_EQUAL(redRGB[idx],   expectedRGB[4 * idx + 0]);
+            OCIO_CHECK_EQUAL(greenRGB[idx], expectedRGB[4 * idx + 1]);
+            OCIO_CHECK_EQUAL(blueRGB[idx],  expectedRGB[4 * idx + 2]);
+        }
+    }
+
+    // Empty arrays.
+    OCIO_CHECK_NO_THROW(cpuProcessor->applyRGBA(nullptr, 0, OCIO::AutoStride));
+    OCIO_CHECK_NO_THROW(cpuProcessor->applyRGB(nullptr, nullptr, nullptr, 0));
+
+    // Wrong arguments.
+    float pixels[8]{};
+    OCIO_CHECK_THROW_WHAT(cpuProcessor->applyRGBA(pixels, -1, OCIO::AutoStride),
+                          OCIO::Exception,
+                          "the number of pixels must not be negative");
+    OCIO_CHECK_THROW_WHAT(cpuProcessor->applyRGBA(nullptr, 2, OCIO::AutoStride),
+                          OCIO::Exception,
+                          "the pixel array must not be null");
+    OCIO_CHECK_THROW_WHAT(cpuProcessor->applyRGB(pixels, 2, 8),
+                          OCIO::Exception,
+                          "the pixel stride of 8 bytes must be a multiple of 4 bytes and must "
+                          "not be smaller than the pixel size of 12 bytes");
+    OCIO_CHECK_THROW_WHAT(cpuProcessor->applyRGBA(pixels, 1, 18),
+                          OCIO::Exception,
+                          "the pixel stride of 18 bytes must be a multiple of 4 bytes");
+    OCIO_CHECK_THROW_WHAT(cpuProcessor->applyRGB(pixels, pixels, nullptr, 1),
+                          OCIO::Exception,
+                          "the channel arrays must not be null");
+}
+
 namespace
 {
 
@@ -3,6 +3,7 @@
 
 
 #include <sys/stat.h>
+#include <thread>
 
 #include <pystring.h>
 
@@ -379,7 +380,6 @@ OCIO_ADD_TEST(Config, required_roles_for_version_2_2)
         OCIO_CHECK_ASSERT(OCIO::checkAndMuteAcesInterchangeRoleError(logGuard));
         OCIO_CHECK_ASSERT(OCIO::checkAndMuteDisplayInterchangeRoleError(logGuard));
         // If there are any unexpected log messages, print them to the shell.
-        logGuard.print();
     }
     
     // Set colorspace for all required roles.
@@ -8136,6 +8136,144 @@ colorspaces:
     }
 }
 
+OCIO_ADD_TEST(Config, processor_cache_requests)
+{
+    // Validation of the fast path used by the name based getProcessor() methods.
+
+    constexpr const char * CONFIG_CUSTOM {
+R"(ocio_profile_version: 2
+
+environment: { VAR: cs1 }
+
+search_path: ""
+strictparsing: true
+luma: [0.2126, 0.7152, 0.0722]
+
+roles:
+  default: ref
+
+file_rules:
+  - !<Rule> {name: Default, colorspace: default}
+
+displays:
+  Disp1:
+    - !<View> {name: View1, colorspace: cs1}
+
+colorspaces:
+  - !<ColorSpace>
+    name: ref
+
+  - !<ColorSpace>
+    name: cs1
+    from_scene_reference: !<MatrixTransform> {offset: [0.1, 0.2, 0.3, 0]}
+
+  - !<ColorSpace>
+    name: cs2
+    from_scene_reference: !<ColorSpaceTransform> {src: ref, dst: $VAR}
+
+named_transforms:
+  - !<NamedTransform>
+    name: nt1
+    transform: !<MatrixTransform> {offset: [0.4, 0.5, 0.6, 0]}
+)"};
+
+    std::istringstream iss;
+    iss.str(CONFIG_CUSTOM);
+
+    OCIO::ConfigRcPtr cfg;
+    OCIO_CHECK_NO_THROW(cfg = OCIO::Config::CreateFromStream(iss)->createEditableCopy());
+    OCIO_CHECK_NO_THROW(cfg->validate());
+
+    // Repeated requests return the same instance.
+
+    OCIO::ConstProcessorRcPtr proc = cfg->getProcessor("ref", "cs2");
+    OCIO_CHECK_EQUAL(proc.get(), cfg->getProcessor("ref", "cs2").get());
+    OCIO_CHECK_EQUAL(proc.get(), cfg->getProcessor(cfg->getColorSpace("ref"),
+                                                   cfg->getColorSpace("cs2")).get());
+    // The role resolves to the same color space.
+    OCIO_CHECK_EQUAL(proc.get(), cfg->getProcessor("default", "cs2").get());
+
+    OCIO::ConstProcessorRcPtr dvProc
+        = cfg->getProcessor("ref", "Disp1", "View1", OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO_CHECK_EQUAL(dvProc.get(),
+        cfg->getProcessor("ref", "Disp1", "View1", OCIO::TRANSFORM_DIR_FORWARD).get());
+    OCIO_CHECK_NE(dvProc.get(),
+        cfg->getProcessor("ref", "Disp1", "View1", OCIO::TRANSFORM_DIR_INVERSE).get());
+
+    OCIO::ConstProcessorRcPtr ntProc = cfg->getProcessor("nt1", OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO_CHECK_EQUAL(ntProc.get(), cfg->getProcessor("nt1", OCIO::TRANSFORM_DIR_FORWARD).get());
+    OCIO_CHECK_NE(ntProc.get(), cfg->getProcessor("nt1", OCIO::TRANSFORM_DIR_INVERSE).get());
+
+    // Failing requests are not remembered.
+
+    OCIO_CHECK_THROW_WHAT(cfg->getProcessor("ref", "Disp1", "",
+                                            OCIO::TRANSFORM_DIR_FORWARD),
+                          OCIO::Exception,
+                          "empty view name");
+    OCIO_CHECK_THROW_WHAT(cfg->getProcessor("ref", "Disp1", "",
+                                            OCIO::TRANSFORM_DIR_FORWARD),
+                          OCIO::Exception,
+                          "empty view name");
+
+    // A different but identical context instance hits the same entries.
+
+    OCIO::ContextRcPtr ctx = cfg->getCurrentContext()->createEditableCopy();
+    OCIO_CHECK_EQUAL(proc.get(), cfg->getProcessor(ctx, "ref", "cs2").get());
+
+    // Changing the context changes the request but the processor cache still detects
+    // the identical processor.
+
+    ctx->setStringVar("VAR", "cs1");
+    OCIO_CHECK_EQUAL(proc.get(), cfg->getProcessor(ctx, "ref", "cs2").get());
+
+    ctx->setStringVar("VAR", "ref");
+    OCIO::ConstProcessorRcPtr ctxProc = cfg->getProcessor(ctx, "ref", "cs2");
+    OCIO_CHECK_NE(proc.get(), ctxProc.get());
+    OCIO_CHECK_ASSERT(ctxProc->isNoOp());
+    OCIO_CHECK_EQUAL(ctxProc.get(), cfg->getProcessor(ctx, "ref", "cs2").get());
+
+    // Any config change flushes the requests.
+
+    OCIO_CHECK_NO_THROW(cfg->addEnvironmentVar("VAR", "ref"));
+    OCIO::ConstProcessorRcPtr editedProc = cfg->getProcessor("ref", "cs2");
+    OCIO_CHECK_NE(proc.get(), editedProc.get());
+    OCIO_CHECK_ASSERT(editedProc->isNoOp());
+
+    // Disabling the processor cache disables the fast path.
+
+    cfg->setProcessorCacheFlags(OCIO::PROCESSOR_CACHE_OFF);
+    OCIO_CHECK_NE(cfg->getProcessor("ref", "cs1").get(), cfg->getProcessor("ref", "cs1").get());
+    cfg->setProcessorCacheFlags(OCIO::PROCESSOR_CACHE_DEFAULT);
+
+    // Concurrent requests all get the same instance.
+
+    OCIO::ConstConfigRcPtr config = cfg;
+    OCIO::ConstProcessorRcPtr ref = config->getProcessor("ref", "cs1");
+
+    constexpr int numThreads = 8;
+    std::vector<const OCIO::Processor *> results(numThreads, nullptr);
+    std::vector<std::thread> threads;
+    for (int idx = 0; idx < numThreads; ++idx)
+    {
+        threads.emplace_back([&config, &results, idx]()
+        {
+            for (int iter = 0; iter < 100; ++iter)
+            {
+                results[idx] = config->getProcessor("ref", "cs1").get();
+            }
+        });
+    }
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    for (const auto result : results)
+    {
+        OCIO_CHECK_EQUAL(result, ref.get());
+    }
+}
+
 OCIO_ADD_TEST(Config, context_variables_typical_use_cases)
 {
     // Case 1 - No context variables used in the config.
@@ -10416,3 +10554,143 @@ view_transforms:
     }
 }
 
+
+OCIO_ADD_TEST(Config, lazy_transforms)
+{
+    // Validate the lazy loading of the color space transforms.
+
+    constexpr char CONFIG[] =
+        "ocio_profile_version: 2\n"
+        "\n"
+        "environment:\n"
+        "  {}\n"
+        "search_path: \"\"\n"
+        "strictparsing: true\n"
+        "luma: [0.2126, 0.7152, 0.0722]\n"
+        "\n"
+        "roles:\n"
+        "  default: raw\n"
+        "  scene_linear: lin\n"
+        "\n"
+        "file_rules:\n"
+        "  - !<Rule> {name: Default, colorspace: default}\n"
+        "\n"
+        "displays:\n"
+        "  sRGB:\n"
+        "    - !<View> {name: Raw, colorspace: raw}\n"
+        "\n"
+        "active_displays: []\n"
+        "active_views: []\n"
+        "\n"
+        "colorspaces:\n"
+        "  - !<ColorSpace>\n"
+        "    name: raw\n"
+        "    family: \"\"\n"
+        "    equalitygroup: \"\"\n"
+        "    bitdepth: unknown\n"
+        "    isdata: true\n"
+        "    allocation: uniform\n"
+        "\n"
+        "  - !<ColorSpace>\n"
+        "    name: lin\n"
+        "    family: \"\"\n"
+        "    equalitygroup: \"\"\n"
+        "    bitdepth: unknown\n"
+        "    isdata: false\n"
+        "    allocation: uniform\n"
+        "\n"
+        "  - !<ColorSpace>\n"
+        "    name: log\n"
+        "    aliases: [logarithmic]\n"
+        "    family: Log\n"
+        "    equalitygroup: \"\"\n"
+        "    bitdepth: unknown\n"
+        "    isdata: false\n"
+        "    categories: [working-space]\n"
+        "    allocation: uniform\n"
+        "    to_scene_reference: !<GroupTransform>\n"
+        "      children:\n"
+        "        - !<LogTransform> {base: 10, direction: inverse}\n"
+        "        - !<MatrixTransform> {offset: [0.1, 0.2, 0.3, 0]}\n"
+        "    from_scene_reference: !<ExponentTransform> {value: [2.2, 2.2, 2.2, 1]}\n";
+
+    std::string eagerSerialization;
+    {
+        std::istringstream is(CONFIG);
+        OCIO::ConstConfigRcPtr config;
+        OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromStream(is));
+
+        std::ostringstream oss;
+        OCIO_CHECK_NO_THROW(config->serialize(oss));
+        eagerSerialization = oss.str();
+    }
+
+    OCIO::EnvironmentVariableGuard guard(OCIO::OCIO_LAZY_TRANSFORMS_ENVVAR, "1");
+
+    {
+        std::istringstream is(CONFIG);
+        OCIO::ConstConfigRcPtr config;
+        OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromStream(is));
+
+        // The catalog data is available without creating the transforms.
+        OCIO::ConstColorSpaceRcPtr cs = config->getColorSpace("logarithmic");
+        OCIO_REQUIRE_ASSERT(cs);
+        OCIO_CHECK_EQUAL(std::string(cs->getName()), "log");
+        OCIO_CHECK_EQUAL(std::string(cs->getFamily()), "Log");
+        OCIO_CHECK_ASSERT(cs->hasCategory("working-space"));
+        OCIO_CHECK_ASSERT(OCIO::ColorSpaceLazyTransforms::IsPending(*cs));
+
+        // The transforms are created on first access.
+        OCIO::ConstTransformRcPtr tr = cs->getTransform(OCIO::COLORSPACE_DIR_TO_REFERENCE);
+        OCIO_REQUIRE_ASSERT(tr);
+        OCIO::ConstGroupTransformRcPtr grp = OCIO::DynamicPtrCast<const OCIO::GroupTransform>(tr);
+        OCIO_REQUIRE_ASSERT(grp);
+        OCIO_CHECK_EQUAL(grp->getNumTransforms(), 2);
+        OCIO_CHECK_ASSERT(OCIO::ColorSpaceLazyTransforms::IsPending(*cs));
+        OCIO_CHECK_ASSERT(cs->getTransform(OCIO::COLORSPACE_DIR_FROM_REFERENCE));
+        OCIO_CHECK_ASSERT(!OCIO::ColorSpaceLazyTransforms::IsPending(*cs));
+
+        OCIO_CHECK_NO_THROW(config->getProcessor("lin", "log"));
+        OCIO_CHECK_NO_THROW(config->validate());
+
+        // The config is identical to the eagerly loaded one.
+        std::ostringstream oss;
+        OCIO_CHECK_NO_THROW(config->serialize(oss));
+        OCIO_CHECK_EQUAL(oss.str(), eagerSerialization);
+
+        // An editable copy keeps the pending transforms.
+        std::istringstream is2(CONFIG);
+        OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromStream(is2));
+        OCIO::ConfigRcPtr copy = config->createEditableCopy();
+        OCIO_CHECK_ASSERT(OCIO::ColorSpaceLazyTransforms::IsPending(*copy->getColorSpace("log")));
+        OCIO_CHECK_NO_THROW(copy->getProcessor("log", "lin"));
+    }
+
+    // Errors are only reported when the transform is used.
+
+    std::string badConfig{ CONFIG };
+    const std::string exponent{ "!<ExponentTransform> {value: [2.2, 2.2, 2.2, 1]}" };
+    badConfig.replace(badConfig.find(exponent), exponent.size(), "!<UnknownTransform> {}");
+
+    {
+        std::istringstream is(badConfig);
+        OCIO::ConstConfigRcPtr config;
+        OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromStream(is));
+        OCIO_REQUIRE_ASSERT(config->getColorSpace("log"));
+
+        OCIO::LogGuard logGuard;
+        OCIO_CHECK_THROW_WHAT(config->getProcessor("log", "lin"), OCIO::Exception,
+                              "The transform of the color space 'log' could not be loaded: "
+                              "At line 53, 'UnknownTransform' parsing failed: Unsupported "
+                              "transform type !<UnknownTransform> in OCIO profile.");
+        logGuard.print();
+        OCIO_CHECK_ASSERT(logGuard.findAndRemove("[OpenColorIO Error]: Lazy transform loading "
+                                                 "failed: At line 53, 'UnknownTransform' parsing "
+                                                 "failed: Unsupported transform type "
+                                                 "!<UnknownTransform> in OCIO profile."));
+
+        OCIO_CHECK_THROW_WHAT(config->validate(), OCIO::Exception,
+                              "Config failed color space validation. The transform of the color "
+                              "space 'log' could not be loaded");
+    }
+}
@@ -137,3 +137,47 @@ OCIO_ADD_TEST(ContextVariableUtils, env_expand)
     }
 }
 
+
+OCIO_ADD_TEST(ContextVariableUtils, env_expand_large_env)
+{
+    // Test the resolution of the context variables with a lot of (unused) variables, as the
+    // environment of a render farm could have hundreds of them.
+
+    OCIO::EnvMap env_map;
+    for (int idx = 0; idx < 1000; ++idx)
+    {
+        const std::string name = "VAR_" + std::to_string(idx);
+        env_map.insert(OCIO::EnvMap::value_type(name, "value" + std::to_string(idx)));
+    }
+
+    env_map.insert(OCIO::EnvMap::value_type("SHOW", "show"));
+    env_map.insert(OCIO::EnvMap::value_type("SHOT", "${SEQ}_010"));
+    env_map.insert(OCIO::EnvMap::value_type("SEQ", "ab"));
+
+    OCIO::UsedEnvs usedEnvs;
+
+    // The longest variable name wins for the '$VAR' syntax i.e. '$VAR_10' is not '$VAR_1' + '0'.
+    OCIO_CHECK_EQUAL(OCIO::ResolveContextVariables("/$SHOW/${SHOT}/%VAR_999%/$VAR_10/$VAR_1x",
+                                                   env_map, usedEnvs),
+                     "/show/ab_010/value999/value10/value1x");
+
+    OCIO_REQUIRE_EQUAL(6, usedEnvs.size());
+    OCIO_CHECK_EQUAL(usedEnvs["SEQ"], "ab");
+    OCIO_CHECK_EQUAL(usedEnvs["SHOT"], "${SEQ}_010");
+    OCIO_CHECK_EQUAL(usedEnvs["SHOW"], "show");
+    OCIO_CHECK_EQUAL(usedEnvs["VAR_1"], "value1");
+    OCIO_CHECK_EQUAL(usedEnvs["VAR_10"], "value10");
+    OCIO_CHECK_EQUAL(usedEnvs["VAR_999"], "value999");
+
+    // Unknown variables and isolated reserved tokens are preserved.
+    usedEnvs.clear();
+    OCIO_CHECK_EQUAL(OCIO::ResolveContextVariables("$ 100% ${} %% $UNKNOWN %VAR_2",
+                                                   env_map, usedEnvs),
+                     "$ 100% ${} %% $UNKNOWN %VAR_2");
+    OCIO_CHECK_EQUAL(0, usedEnvs.size());
+
+    // A cyclic reference stops.
+    env_map.insert(OCIO::EnvMap::value_type("LOOP", "$LOOP"));
+    OCIO_CHECK_EQUAL(OCIO::ResolveContextVariables("$LOOP", env_map, usedEnvs), "$LOOP");
+    OCIO_CHECK_EQUAL(usedEnvs["LOOP"], "$LOOP");
+}
@@ -11,6 +11,7 @@
 #include "PathUtils.h"
 #include "Platform.h"
 #include "testutils/UnitTest.h"
+#include "UnitTestUtils.h"
 
 namespace OCIO = OCIO_NAMESPACE;
 
@@ -147,6 +148,34 @@ OCIO_ADD_TEST(Context, use_searchpaths_workingdir)
                              SanitizePath(res2.c_str()).c_str()) == 0);
 }
 
+OCIO_ADD_TEST(Context, use_searchpaths_directory_index)
+{
+    // The search path directory index gives the same results.
+
+    OCIO::EnvironmentVariableGuard guard(OCIO::OCIO_SEARCH_PATH_INDEX_ENVVAR, "");
+    OCIO::ClearPathCaches();
+
+    OCIO::ContextRcPtr context = OCIO::Context::Create();
+
+    const std::string searchPath1 = ociodir + "/src/OpenColorIO";
+    const std::string searchPath2 = ociodir + "/missing_directory";
+    const std::string searchPath3 = ociodir + "/tests/gpu";
+    context->addSearchPath(searchPath1.c_str());
+    context->addSearchPath(searchPath2.c_str());
+    context->addSearchPath(searchPath3.c_str());
+
+    std::string resolvedSource;
+    OCIO_CHECK_NO_THROW(resolvedSource = context->resolveFileLocation("GPUUnitTest.h"));
+    const std::string res = searchPath3 + "/GPUUnitTest.h";
+    OCIO_CHECK_EQUAL(SanitizePath(resolvedSource.c_str()), SanitizePath(res.c_str()));
+
+    OCIO_CHECK_THROW_WHAT(context->resolveFileLocation("missing_file.h"),
+                          OCIO::ExceptionMissingFile,
+                          "The specified file reference 'missing_file.h' could not be located.");
+
+    OCIO::ClearPathCaches();
+}
+
 OCIO_ADD_TEST(Context, string_vars)
 {
     // Test Context::addStringVars().
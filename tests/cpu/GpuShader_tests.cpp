@@ -252,6 +252,459 @@ OCIO_ADD_TEST(GpuShader, generic_shader)
     }
 }
 
+OCIO_ADD_TEST(GpuShader, texture_cache_id)
+{
+    const float values[12] = { 0.1f, 0.2f, 0.3f,  0.4f, 0.5f, 0.6f,
+                               0.7f, 0.8f, 0.9f,  1.0f, 1.1f, 1.2f };
+    float otherValues[12];
+    std::memcpy(otherValues, values, sizeof(values));
+    otherValues[11] = 1.3f;
+
+    OCIO::GpuShaderDescRcPtr shaderDesc1 = OCIO::GenericGpuShaderDesc::Create();
+    OCIO::GpuShaderDescRcPtr shaderDesc2 = OCIO::GenericGpuShaderDesc::Create();
+
+    OCIO_CHECK_NO_THROW(shaderDesc1->addTexture("lut1", "lut1Sampler", 4, 1,
+                                                OCIO::GpuShaderDesc::TEXTURE_RGB_CHANNEL,
+                                                OCIO::GpuShaderDesc::TEXTURE_1D,
+                                                OCIO::INTERP_LINEAR, values));
+    // Same content, different names & interpolation.
+    OCIO_CHECK_NO_THROW(shaderDesc2->addTexture("lut2", "lut2Sampler", 4, 1,
+                                                OCIO::GpuShaderDesc::TEXTURE_RGB_CHANNEL,
+                                                OCIO::GpuShaderDesc::TEXTURE_1D,
+                                                OCIO::INTERP_NEAREST, values));
+    // Same values, different layout.
+    OCIO_CHECK_NO_THROW(shaderDesc2->addTexture("lut3", "lut3Sampler", 12, 1,
+                                                OCIO::GpuShaderDesc::TEXTURE_RED_CHANNEL,
+                                                OCIO::GpuShaderDesc::TEXTURE_1D,
+                                                OCIO::INTERP_LINEAR, values));
+    // Different values.
+    OCIO_CHECK_NO_THROW(shaderDesc2->addTexture("lut4", "lut4Sampler", 4, 1,
+                                                OCIO::GpuShaderDesc::TEXTURE_RGB_CHANNEL,
+                                                OCIO::GpuShaderDesc::TEXTURE_1D,
+                                                OCIO::INTERP_LINEAR, otherValues));
+
+    const std::string id1 = shaderDesc1->getTextureCacheID(0);
+    OCIO_CHECK_ASSERT(!id1.empty());
+    OCIO_CHECK_EQUAL(id1, std::string(shaderDesc2->getTextureCacheID(0)));
+    OCIO_CHECK_NE(id1, std::string(shaderDesc2->getTextureCacheID(1)));
+    OCIO_CHECK_NE(id1, std::string(shaderDesc2->getTextureCacheID(2)));
+    OCIO_CHECK_THROW_WHAT(shaderDesc1->getTextureCacheID(1),
+                          OCIO::Exception,
+                          "1D LUT access error");
+
+    // Identical textures share the same values.
+    const float * vals1 = nullptr;
+    const float * vals2 = nullptr;
+    OCIO_CHECK_NO_THROW(shaderDesc1->getTextureValues(0, vals1));
+    OCIO_CHECK_NO_THROW(shaderDesc2->getTextureValues(0, vals2));
+    OCIO_CHECK_EQUAL(vals1, vals2);
+    OCIO_CHECK_NO_THROW(shaderDesc2->getTextureValues(2, vals2));
+    OCIO_CHECK_NE(vals1, vals2);
+    for (unsigned idx = 0; idx < 12; ++idx)
+    {
+        OCIO_CHECK_EQUAL(vals1[idx], values[idx]);
+    }
+
+    // The values are still valid once the other shaders are gone.
+    shaderDesc1.reset();
+    OCIO_CHECK_NO_THROW(shaderDesc2->getTextureValues(0, vals2));
+    OCIO_CHECK_EQUAL(vals2[11], values[11]);
+
+    // 3D textures.
+
+    float values3D[2*2*2*3];
+    for (unsigned idx = 0; idx < 2*2*2*3; ++idx)
+    {
+        values3D[idx] = float(idx) / 23.0f;
+    }
+
+    OCIO_CHECK_NO_THROW(shaderDesc2->add3DTexture("lut3d1", "lut3d1Sampler", 2,
+                                                  OCIO::INTERP_TETRAHEDRAL, values3D));
+    OCIO_CHECK_NO_THROW(shaderDesc2->add3DTexture("lut3d2", "lut3d2Sampler", 2,
+                                                  OCIO::INTERP_LINEAR, values3D));
+    OCIO_CHECK_EQUAL(std::string(shaderDesc2->get3DTextureCacheID(0)),
+                     std::string(shaderDesc2->get3DTextureCacheID(1)));
+    OCIO_CHECK_THROW_WHAT(shaderDesc2->get3DTextureCacheID(2),
+                          OCIO::Exception,
+                          "3D LUT access error");
+
+    // The default implementations, used by the shader descs not computing the hash, return an
+    // empty cache ID i.e. the texture must not be shared.
+    OCIO_CHECK_EQUAL(std::string(shaderDesc2->OCIO::GpuShaderDesc::getTextureCacheID(0)), "");
+    OCIO_CHECK_EQUAL(std::string(shaderDesc2->OCIO::GpuShaderDesc::get3DTextureCacheID(0)), "");
+}
+
+OCIO_ADD_TEST(GpuShader, texture_bit_depth)
+{
+    OCIO::GpuShaderDescRcPtr shaderDesc = OCIO::GenericGpuShaderDesc::Create();
+    OCIO_CHECK_EQUAL(shaderDesc->getTextureBitDepth(), OCIO::BIT_DEPTH_F32);
+    OCIO_CHECK_THROW_WHAT(shaderDesc->setTextureBitDepth(OCIO::BIT_DEPTH_UINT8),
+                          OCIO::Exception,
+                          "Unsupported texture bit-depth: 8ui.");
+
+    const std::string defaultID(shaderDesc->getCacheID());
+
+    const float unitValues[6] = { 0.0f, 0.1f, 0.25f, 0.5f, 0.999f, 1.0f };
+    const float largeValues[6] = { -2.0f, 0.1f, 1.5f, 100.0f, 1.0e6f, std::nanf("") };
+
+    // 32-bit float values.
+
+    OCIO_CHECK_NO_THROW(shaderDesc->addTexture("lut1", "lut1Sampler", 6, 1,
+                                               OCIO::GpuShaderDesc::TEXTURE_RED_CHANNEL,
+                                               OCIO::GpuShaderDesc::TEXTURE_1D,
+                                               OCIO::INTERP_LINEAR, unitValues));
+
+    OCIO::BitDepth bitDepth = OCIO::BIT_DEPTH_UNKNOWN;
+    const void * data = nullptr;
+    const float * values = nullptr;
+    OCIO_CHECK_NO_THROW(shaderDesc->getTextureData(0, bitDepth, data));
+    OCIO_CHECK_NO_THROW(shaderDesc->getTextureValues(0, values));
+    OCIO_CHECK_EQUAL(bitDepth, OCIO::BIT_DEPTH_F32);
+    OCIO_CHECK_EQUAL(data, static_cast<const void *>(values));
+
+    // Half-float values.
+
+    OCIO_CHECK_NO_THROW(shaderDesc->setTextureBitDepth(OCIO::BIT_DEPTH_F16));
+    OCIO_CHECK_NE(defaultID, std::string(shaderDesc->getCacheID()));
+
+    OCIO_CHECK_NO_THROW(shaderDesc->addTexture("lut2", "lut2Sampler", 6, 1,
+                                               OCIO::GpuShaderDesc::TEXTURE_RED_CHANNEL,
+                                               OCIO::GpuShaderDesc::TEXTURE_1D,
+                                               OCIO::INTERP_LINEAR, largeValues));
+    OCIO_CHECK_NO_THROW(shaderDesc->getTextureData(1, bitDepth, data));
+    OCIO_CHECK_EQUAL(bitDepth, OCIO::BIT_DEPTH_F16);
+    {
+        const half * h = static_cast<const half *>(data);
+        for (unsigned idx = 0; idx < 3; ++idx)
+        {
+            OCIO_CHECK_CLOSE(float(h[idx]), largeValues[idx], 1.0f / 2048.0f);
+        }
+        OCIO_CHECK_EQUAL(float(h[3]), 100.0f);
+        // Large values are clamped instead of becoming infinities.
+        OCIO_CHECK_EQUAL(float(h[4]), HALF_MAX);
+        OCIO_CHECK_ASSERT(h[5].isNan());
+    }
+
+    // The original values are still available.
+    OCIO_CHECK_NO_THROW(shaderDesc->getTextureValues(1, values));
+    OCIO_CHECK_EQUAL(values[4], 1.0e6f);
+
+    // Normalized integer values, only when all the values are in [0, 1].
+
+    OCIO_CHECK_NO_THROW(shaderDesc->setTextureBitDepth(OCIO::BIT_DEPTH_UINT16));
+
+    OCIO_CHECK_NO_THROW(shaderDesc->addTexture("lut3", "lut3Sampler", 6, 1,
+                                               OCIO::GpuShaderDesc::TEXTURE_RED_CHANNEL,
+                                               OCIO::GpuShaderDesc::TEXTURE_1D,
+                                               OCIO::INTERP_LINEAR, unitValues));
+    OCIO_CHECK_NO_THROW(shaderDesc->getTextureData(2, bitDepth, data));
+    OCIO_CHECK_EQUAL(bitDepth, OCIO::BIT_DEPTH_UINT16);
+    {
+        const uint16_t * u = static_cast<const uint16_t *>(data);
+        OCIO_CHECK_EQUAL(u[0], 0);
+        OCIO_CHECK_EQUAL(u[5], 65535);
+        for (unsigned idx = 0; idx < 6; ++idx)
+        {
+            OCIO_CHECK_ASSERT(std::abs(u[idx] / 65535.0f - unitValues[idx]) <= 0.5f / 65535.0f);
+        }
+    }
+
+    OCIO_CHECK_NO_THROW(shaderDesc->addTexture("lut4", "lut4Sampler", 6, 1,
+                                               OCIO::GpuShaderDesc::TEXTURE_RED_CHANNEL,
+                                               OCIO::GpuShaderDesc::TEXTURE_1D,
+                                               OCIO::INTERP_LINEAR, largeValues));
+    OCIO_CHECK_NO_THROW(shaderDesc->getTextureData(3, bitDepth, data));
+    OCIO_CHECK_EQUAL(bitDepth, OCIO::BIT_DEPTH_F16);
+
+    OCIO_CHECK_THROW_WHAT(shaderDesc->getTextureData(4, bitDepth, data),
+                          OCIO::Exception,
+                          "1D LUT access error");
+    OCIO_CHECK_THROW_WHAT(shaderDesc->get3DTextureData(0, bitDepth, data),
+                          OCIO::Exception,
+                          "3D LUT access error");
+
+    // The default implementations return the float values.
+    OCIO_CHECK_NO_THROW(shaderDesc->OCIO::GpuShaderDesc::getTextureData(1, bitDepth, data));
+    OCIO_CHECK_NO_THROW(shaderDesc->getTextureValues(1, values));
+    OCIO_CHECK_EQUAL(bitDepth, OCIO::BIT_DEPTH_F32);
+    OCIO_CHECK_EQUAL(data, static_cast<const void *>(values));
+    OCIO_CHECK_THROW_WHAT(shaderDesc->OCIO::GpuShaderDesc::get3DTextureData(0, bitDepth, data),
+                          OCIO::Exception,
+                          "3D LUT access error");
+}
+
+OCIO_ADD_TEST(GpuShader, texture_bit_depth_precision)
+{
+    // Compare the half-float 3D texture from a processor with the 32-bit float one.
+
+    constexpr unsigned gridSize = 33;
+    OCIO::Lut3DTransformRcPtr lut = OCIO::Lut3DTransform::Create(gridSize);
+    for (unsigned r = 0; r < gridSize; ++r)
+    {
+        for (unsigned g = 0; g < gridSize; ++g)
+        {
+            for (unsigned b = 0; b < gridSize; ++b)
+            {
+                const float rv = float(r) / (gridSize - 1);
+                const float gv = float(g) / (gridSize - 1);
+                const float bv = float(b) / (gridSize - 1);
+                lut->setValue(r, g, b, 4.0f * rv * rv, std::sqrt(gv), 0.001f + 0.5f * bv);
+            }
+        }
+    }
+
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+    OCIO::ConstGPUProcessorRcPtr gpu;
+    OCIO_CHECK_NO_THROW(gpu = config->getProcessor(lut)->getDefaultGPUProcessor());
+
+    OCIO::GpuShaderDescRcPtr descF32 = OCIO::GpuShaderDesc::CreateShaderDesc();
+    OCIO_CHECK_NO_THROW(gpu->extractGpuShaderInfo(descF32));
+
+    OCIO::GpuShaderDescRcPtr descF16 = OCIO::GpuShaderDesc::CreateShaderDesc();
+    descF16->setTextureBitDepth(OCIO::BIT_DEPTH_F16);
+    OCIO_CHECK_NO_THROW(gpu->extractGpuShaderInfo(descF16));
+
+    // The shader program does not depend on the texture bit-depth.
+    OCIO_CHECK_EQUAL(std::string(descF32->getShaderText()),
+                     std::string(descF16->getShaderText()));
+
+    const float * values = nullptr;
+    OCIO_CHECK_NO_THROW(descF32->get3DTextureValues(0, values));
+
+    OCIO::BitDepth bitDepth = OCIO::BIT_DEPTH_UNKNOWN;
+    const void * data = nullptr;
+    OCIO_CHECK_NO_THROW(descF16->get3DTextureData(0, bitDepth, data));
+    OCIO_CHECK_EQUAL(bitDepth, OCIO::BIT_DEPTH_F16);
+
+    // Half-floats have 11 bits of precision so the relative error is at most 2^-11.
+    const half * h = static_cast<const half *>(data);
+    float maxRelError = 0.0f;
+    for (unsigned idx = 0; idx < gridSize * gridSize * gridSize * 3; ++idx)
+    {
+        if (values[idx] != 0.0f)
+        {
+            const float relError = std::abs(float(h[idx]) - values[idx]) / std::abs(values[idx]);
+            maxRelError = std::max(maxRelError, relError);
+        }
+        else
+        {
+            OCIO_CHECK_EQUAL(float(h[idx]), 0.0f);
+        }
+    }
+    OCIO_CHECK_LE(maxRelError, 1.0f / 2048.0f);
+}
+
+OCIO_ADD_TEST(GpuShader, shader_info_cache)
+{
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+
+    OCIO::ExposureContrastTransformRcPtr ec = OCIO::ExposureContrastTransform::Create();
+    ec->makeExposureDynamic();
+    group->appendTransform(ec);
+
+    OCIO::Lut3DTransformRcPtr lut = OCIO::Lut3DTransform::Create(5);
+    lut->setValue(1, 2, 3, 0.1f, 0.2f, 0.3f);
+    group->appendTransform(lut);
+
+    OCIO::ConstProcessorRcPtr proc;
+    OCIO_CHECK_NO_THROW(proc = config->getProcessor(group));
+    OCIO::ConstGPUProcessorRcPtr gpu;
+    OCIO_CHECK_NO_THROW(gpu = proc->getDefaultGPUProcessor());
+
+    OCIO::GpuShaderDescRcPtr shaderDesc1 = OCIO::GpuShaderDesc::CreateShaderDesc();
+    OCIO_CHECK_NO_THROW(gpu->extractGpuShaderInfo(shaderDesc1));
+
+    // The second extraction with the same settings reuses the first one.
+    OCIO::GpuShaderDescRcPtr shaderDesc2 = OCIO::GpuShaderDesc::CreateShaderDesc();
+    OCIO_CHECK_NO_THROW(gpu->extractGpuShaderInfo(shaderDesc2));
+
+    OCIO_CHECK_EQUAL(std::string(shaderDesc1->getShaderText()),
+                     std::string(shaderDesc2->getShaderText()));
+    OCIO_CHECK_EQUAL(std::string(shaderDesc1->getCacheID()),
+                     std::string(shaderDesc2->getCacheID()));
+    OCIO_CHECK_EQUAL(shaderDesc2->getNum3DTextures(), 1U);
+    OCIO_CHECK_EQUAL(shaderDesc2->getNumUniforms(), shaderDesc1->getNumUniforms());
+    OCIO_CHECK_EQUAL(shaderDesc2->getUniformBufferSize(), shaderDesc1->getUniformBufferSize());
+
+    const float * vals1 = nullptr;
+    const float * vals2 = nullptr;
+    OCIO_CHECK_NO_THROW(shaderDesc1->get3DTextureValues(0, vals1));
+    OCIO_CHECK_NO_THROW(shaderDesc2->get3DTextureValues(0, vals2));
+    OCIO_CHECK_EQUAL(vals1, vals2);
+
+    // The dynamic property is shared.
+    OCIO::DynamicPropertyRcPtr dp1, dp2;
+    OCIO_CHECK_NO_THROW(dp1 = shaderDesc1->getDynamicProperty(OCIO::DYNAMIC_PROPERTY_EXPOSURE));
+    OCIO_CHECK_NO_THROW(dp2 = shaderDesc2->getDynamicProperty(OCIO::DYNAMIC_PROPERTY_EXPOSURE));
+    OCIO_CHECK_EQUAL(dp1, dp2);
+
+    OCIO::DynamicPropertyDoubleRcPtr exposure = OCIO::DynamicPropertyValue::AsDouble(dp2);
+    exposure->setValue(1.5);
+    OCIO::GpuShaderDesc::UniformData data;
+    for (unsigned idx = 0; idx < shaderDesc2->getNumUniforms(); ++idx)
+    {
+        const std::string name(shaderDesc2->getUniform(idx, data));
+        if (name.find("exposureVal") != std::string::npos)
+        {
+            OCIO_CHECK_EQUAL(data.m_getDouble(), 1.5);
+        }
+    }
+
+    // Different settings produce a different shader.
+    OCIO::GpuShaderDescRcPtr shaderDesc3 = OCIO::GpuShaderDesc::CreateShaderDesc();
+    shaderDesc3->setResourcePrefix("other");
+    OCIO_CHECK_NO_THROW(gpu->extractGpuShaderInfo(shaderDesc3));
+    OCIO_CHECK_NE(std::string(shaderDesc1->getShaderText()),
+                  std::string(shaderDesc3->getShaderText()));
+    OCIO_CHECK_NE(std::string(shaderDesc3->getShaderText()).find("other_lut3d_"),
+                  std::string::npos);
+
+    // A shader description which is not empty is never replaced by the cached one.
+    OCIO::GpuShaderDescRcPtr shaderDesc4 = OCIO::GpuShaderDesc::CreateShaderDesc();
+    shaderDesc4->addToHelperShaderCode("// client helper\n");
+    OCIO_CHECK_NO_THROW(gpu->extractGpuShaderInfo(shaderDesc4));
+    OCIO_CHECK_NE(std::string(shaderDesc4->getShaderText()).find("// client helper"),
+                  std::string::npos);
+    OCIO_CHECK_EQUAL(shaderDesc4->getNum3DTextures(), 1U);
+}
+
+OCIO_ADD_TEST(GpuShader, uniform_block)
+{
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+
+    OCIO::ExposureContrastTransformRcPtr ec = OCIO::ExposureContrastTransform::Create();
+    ec->setExposure(0.5);
+    ec->makeExposureDynamic();
+    group->appendTransform(ec);
+
+    OCIO::GradingRGBCurveTransformRcPtr curve
+        = OCIO::GradingRGBCurveTransform::Create(OCIO::GRADING_LOG);
+    curve->makeDynamic();
+    group->appendTransform(curve);
+
+    OCIO::ConstProcessorRcPtr proc;
+    OCIO_CHECK_NO_THROW(proc = config->getProcessor(group));
+    OCIO::ConstGPUProcessorRcPtr gpu;
+    OCIO_CHECK_NO_THROW(gpu = proc->getDefaultGPUProcessor());
+
+    // Individual uniforms by default.
+    OCIO::GpuShaderDescRcPtr shaderDesc = OCIO::GpuShaderDesc::CreateShaderDesc();
+    shaderDesc->setLanguage(OCIO::GPU_LANGUAGE_GLSL_4_0);
+    OCIO_CHECK_ASSERT(!shaderDesc->getUseUniformBlock());
+    OCIO_CHECK_NO_THROW(gpu->extractGpuShaderInfo(shaderDesc));
+
+    std::string text(shaderDesc->getShaderText());
+    OCIO_CHECK_EQUAL(text.find("_Parameters"), std::string::npos);
+    OCIO_CHECK_NE(text.find("uniform float ocio_exposure_contrast_exposureVal;"),
+                  std::string::npos);
+
+    // All the uniforms are members of a std140 uniform block.
+    OCIO::GpuShaderDescRcPtr blockDesc = OCIO::GpuShaderDesc::CreateShaderDesc();
+    blockDesc->setLanguage(OCIO::GPU_LANGUAGE_GLSL_4_0);
+    blockDesc->setUseUniformBlock(true);
+    OCIO_CHECK_ASSERT(blockDesc->getUseUniformBlock());
+    OCIO_CHECK_NE(std::string(blockDesc->getCacheID()), std::string(shaderDesc->getCacheID()));
+    OCIO_CHECK_NO_THROW(gpu->extractGpuShaderInfo(blockDesc));
+
+    text = blockDesc->getShaderText();
+    OCIO_CHECK_NE(text.find("layout (std140) uniform OCIOMain_Parameters\n{\n"),
+                  std::string::npos);
+    OCIO_CHECK_EQUAL(text.find("uniform float ocio_exposure_contrast_exposureVal;"),
+                     std::string::npos);
+    OCIO_CHECK_NE(text.find("float ocio_exposure_contrast_exposureVal;"), std::string::npos);
+    OCIO_CHECK_NE(text.find("bool ocio_grading_rgbcurve_localBypass;"), std::string::npos);
+
+    OCIO_CHECK_EQUAL(blockDesc->getNumUniforms(), shaderDesc->getNumUniforms());
+    OCIO_CHECK_EQUAL(blockDesc->getUniformBufferSize(), shaderDesc->getUniformBufferSize());
+
+    // Fill the buffer with the current values.
+    OCIO::DynamicPropertyRcPtr dp;
+    OCIO_CHECK_NO_THROW(dp = blockDesc->getDynamicProperty(OCIO::DYNAMIC_PROPERTY_EXPOSURE));
+    OCIO::DynamicPropertyValue::AsDouble(dp)->setValue(1.25);
+
+    const size_t bufferSize = blockDesc->getUniformBufferSize();
+    std::vector<char> buffer(bufferSize, 'x');
+    OCIO_CHECK_NO_THROW(blockDesc->fillUniformBuffer(buffer.data(), bufferSize));
+
+    for (unsigned idx = 0; idx < blockDesc->getNumUniforms(); ++idx)
+    {
+        OCIO::GpuShaderDesc::UniformData data;
+        blockDesc->getUniform(idx, data);
+        const char * ptr = buffer.data() + data.m_bufferOffset;
+
+        switch (data.m_type)
+        {
+            case OCIO::UNIFORM_DOUBLE:
+            {
+                float value = 0.f;
+                std::memcpy(&value, ptr, sizeof(float));
+                OCIO_CHECK_EQUAL(value, (float)data.m_getDouble());
+                break;
+            }
+            case OCIO::UNIFORM_BOOL:
+            {
+                int value = -1;
+                std::memcpy(&value, ptr, sizeof(int));
+                OCIO_CHECK_EQUAL(value, data.m_getBool() ? 1 : 0);
+                break;
+            }
+            case OCIO::UNIFORM_VECTOR_FLOAT:
+            {
+                const float * values = data.m_vectorFloat.m_getVector();
+                for (int i = 0; i < data.m_vectorFloat.m_getSize(); ++i)
+                {
+                    float value = 0.f;
+                    std::memcpy(&value, ptr + 16 * i, sizeof(float));
+                    OCIO_CHECK_EQUAL(value, values[i]);
+                }
+                break;
+            }
+            case OCIO::UNIFORM_VECTOR_INT:
+            {
+                const int * values = data.m_vectorInt.m_getVector();
+                for (int i = 0; i < data.m_vectorInt.m_getSize(); ++i)
+                {
+                    int value = -1;
+                    std::memcpy(&value, ptr + 16 * i, sizeof(int));
+                    OCIO_CHECK_EQUAL(value, values[i]);
+                }
+                break;
+            }
+            case OCIO::UNIFORM_FLOAT3:
+            case OCIO::UNIFORM_UNKNOWN:
+                OCIO_CHECK_ASSERT(false);
+                break;
+        }
+    }
+
+    float exposure = 0.f;
+    OCIO::GpuShaderDesc::UniformData data;
+    blockDesc->getUniform(0, data);
+    OCIO_REQUIRE_EQUAL(data.m_type, OCIO::UNIFORM_DOUBLE);
+    std::memcpy(&exposure, buffer.data() + data.m_bufferOffset, sizeof(float));
+    OCIO_CHECK_EQUAL(exposure, 1.25f);
+
+    OCIO_CHECK_THROW_WHAT(blockDesc->fillUniformBuffer(buffer.data(), bufferSize - 1),
+                          OCIO::Exception, "is smaller than the expected size");
+    OCIO_CHECK_THROW_WHAT(blockDesc->fillUniformBuffer(nullptr, bufferSize),
+                          OCIO::Exception, "The uniform buffer is null");
+
+    // The setting is ignored by the languages not supporting uniform blocks.
+    OCIO::GpuShaderDescRcPtr legacyDesc = OCIO::GpuShaderDesc::CreateShaderDesc();
+    legacyDesc->setLanguage(OCIO::GPU_LANGUAGE_GLSL_1_2);
+    legacyDesc->setUseUniformBlock(true);
+    OCIO_CHECK_NO_THROW(gpu->extractGpuShaderInfo(legacyDesc));
+
+    text = legacyDesc->getShaderText();
+    OCIO_CHECK_EQUAL(text.find("_Parameters"), std::string::npos);
+    OCIO_CHECK_NE(text.find("uniform float ocio_exposure_contrast_exposureVal;"),
+                  std::string::npos);
+}
+
 OCIO_ADD_TEST(GpuShader, MetalLutTest)
 {
     static constexpr char sFromSpace[] = "ACEScg";
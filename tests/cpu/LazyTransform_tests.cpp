@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include "LazyTransform.cpp"
+
+#include "testutils/UnitTest.h"
+#include "UnitTestLogUtils.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+OCIO_ADD_TEST(LazyTransform, load_on_first_access)
+{
+    int numCalls = 0;
+
+    OCIO::LazyTransform lazy;
+    OCIO_CHECK_ASSERT(!lazy.isPending());
+    OCIO_CHECK_ASSERT(!lazy.get());
+
+    lazy.setLoader([&numCalls]()
+    {
+        ++numCalls;
+        OCIO::MatrixTransformRcPtr mat = OCIO::MatrixTransform::Create();
+        const double offset[4]{ 0.1, 0.2, 0.3, 0. };
+        mat->setOffset(offset);
+        return mat;
+    });
+    OCIO_CHECK_ASSERT(lazy.isPending());
+    OCIO_CHECK_EQUAL(numCalls, 0);
+
+    // A copy keeps the loader.
+    OCIO::LazyTransform copy(lazy);
+    OCIO_CHECK_ASSERT(copy.isPending());
+
+    OCIO::ConstTransformRcPtr tr = lazy.get();
+    OCIO_REQUIRE_ASSERT(tr);
+    OCIO_CHECK_ASSERT(!lazy.isPending());
+    OCIO_CHECK_EQUAL(numCalls, 1);
+    OCIO_CHECK_ASSERT(OCIO::DynamicPtrCast<const OCIO::MatrixTransform>(tr));
+
+    // The loader is only called once.
+    OCIO_CHECK_EQUAL(lazy.get(), tr);
+    OCIO_CHECK_NO_THROW(lazy.materialize());
+    OCIO_CHECK_EQUAL(numCalls, 1);
+
+    OCIO_CHECK_ASSERT(copy.get());
+    OCIO_CHECK_EQUAL(numCalls, 2);
+
+    // A copy of a created transform is a deep copy.
+    OCIO::LazyTransform copy2;
+    copy2 = lazy;
+    OCIO_CHECK_ASSERT(!copy2.isPending());
+    OCIO_REQUIRE_ASSERT(copy2.get());
+    OCIO_CHECK_NE(copy2.get(), tr);
+
+    // Setting a transform discards the loader.
+    lazy.setLoader([&numCalls]() { ++numCalls; return OCIO::MatrixTransform::Create(); });
+    lazy.set(OCIO::ExponentTransform::Create());
+    OCIO_CHECK_ASSERT(!lazy.isPending());
+    OCIO_CHECK_ASSERT(OCIO::DynamicPtrCast<const OCIO::ExponentTransform>(lazy.get()));
+    OCIO_CHECK_EQUAL(numCalls, 2);
+}
+
+OCIO_ADD_TEST(LazyTransform, loader_failure)
+{
+    OCIO::LazyTransform lazy;
+    lazy.setLoader([]() -> OCIO::TransformRcPtr
+    {
+        throw OCIO::Exception("Unknown transform.");
+    });
+
+    {
+        OCIO::LogGuard guard;
+        OCIO_CHECK_ASSERT(!lazy.get());
+        OCIO_CHECK_ASSERT(guard.findAndRemove("Lazy transform loading failed: "
+                                              "Unknown transform."));
+    }
+
+    // The error is kept.
+    OCIO_CHECK_ASSERT(!lazy.isPending());
+    OCIO_CHECK_THROW_WHAT(lazy.materialize(), OCIO::Exception, "Unknown transform.");
+
+    OCIO::LazyTransform copy(lazy);
+    OCIO_CHECK_THROW_WHAT(copy.materialize(), OCIO::Exception, "Unknown transform.");
+
+    lazy.set(OCIO::MatrixTransform::Create());
+    OCIO_CHECK_NO_THROW(lazy.materialize());
+}
@@ -1,10 +1,20 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <atomic>
+#include <thread>
+
 #include "OpenColorIO/OpenColorIO.h"
+#include "OCIOZArchive.h"
 #include "testutils/UnitTest.h"
 #include "UnitTestUtils.h"
 
+#include "mz.h"
+#include "mz_strm.h"
+#include "mz_strm_mem.h"
+#include "mz_zip.h"
+#include "mz_zip_rw.h"
+
 namespace OCIO = OCIO_NAMESPACE;
 
 namespace
@@ -640,4 +650,122 @@ OCIO_ADD_TEST(OCIOZArchive, extract_config_and_compare_to_original)
             streamToConfigFromExtractedArchive.str()
         );
     }
-}
\ No newline at end of file
+}
+OCIO_ADD_TEST(OCIOZArchive, indexed_entries)
+{
+    // Build an archive holding stored (i.e. uncompressed) and compressed files.
+    struct ArchiveFile
+    {
+        std::string m_name;
+        std::string m_content;
+        uint16_t m_method;
+    };
+
+    std::string largeContent;
+    for (int idx = 0; idx < 5000; ++idx)
+    {
+        largeContent += std::to_string(idx * 0.001) + " 0.5 0.25\n";
+    }
+
+    const std::vector<ArchiveFile> files = {
+        { "config.ocio",        "ocio_profile_version: 2\n", MZ_COMPRESS_METHOD_DEFLATE },
+        { "luts/stored.spi1d",  largeContent,                MZ_COMPRESS_METHOD_STORE   },
+        { "luts/deflated.cube", largeContent + "end",        MZ_COMPRESS_METHOD_DEFLATE },
+        { "luts/Sub/Mixed.CLF", "<ProcessList/>",            MZ_COMPRESS_METHOD_STORE   },
+    };
+
+    void * memStream = nullptr;
+    void * writer = nullptr;
+#if MZ_VERSION_BUILD >= 040000
+    memStream = mz_stream_mem_create();
+    writer = mz_zip_writer_create();
+#else
+    mz_stream_mem_create(&memStream);
+    mz_zip_writer_create(&writer);
+#endif
+    mz_stream_open(memStream, NULL, MZ_OPEN_MODE_CREATE);
+    OCIO_REQUIRE_EQUAL(mz_zip_writer_open(writer, memStream, 0), MZ_OK);
+
+    for (const auto & file : files)
+    {
+        mz_zip_file info;
+        memset(&info, 0, sizeof(info));
+        info.filename = file.m_name.c_str();
+        info.modified_date = time(NULL);
+        info.version_madeby = MZ_VERSION_MADEBY;
+        info.compression_method = file.m_method;
+        info.flag = MZ_ZIP_FLAG_UTF8;
+        info.uncompressed_size = (int64_t)file.m_content.size();
+
+        OCIO_REQUIRE_EQUAL(mz_zip_writer_entry_open(writer, &info), MZ_OK);
+        mz_zip_writer_entry_write(writer, file.m_content.c_str(), (int32_t)file.m_content.size());
+        mz_zip_writer_entry_close(writer);
+    }
+    mz_zip_writer_close(writer);
+    mz_zip_writer_delete(&writer);
+
+    const uint8_t * bufferPtr = nullptr;
+    mz_stream_mem_get_buffer(memStream, (const void **)&bufferPtr);
+    mz_stream_mem_seek(memStream, 0, MZ_SEEK_END);
+    const int64_t bufferSize = mz_stream_mem_tell(memStream);
+
+    FileCreationGuard fGuard(__LINE__);
+    {
+        std::ofstream ofs(fGuard.m_filename, std::ios_base::out | std::ios_base::binary);
+        ofs.write((const char *)bufferPtr, bufferSize);
+    }
+
+    mz_stream_mem_close(memStream);
+    mz_stream_mem_delete(&memStream);
+
+    OCIO::CIOPOciozArchive ciop;
+    ciop.setArchiveAbsPath(fGuard.m_filename);
+    OCIO_CHECK_NO_THROW(ciop.buildEntries());
+
+    OCIO_CHECK_EQUAL(ciop.getConfigData(), files[0].m_content);
+
+    for (const auto & file : files)
+    {
+        const std::vector<uint8_t> data = ciop.getLutData(file.m_name.c_str());
+        OCIO_CHECK_EQUAL(std::string(data.begin(), data.end()), file.m_content);
+        OCIO_CHECK_NE(ciop.getFastLutFileHash(file.m_name.c_str()), std::string(""));
+    }
+
+    // The path lookup ignores the case and the slash differences.
+    {
+        const std::vector<uint8_t> data = ciop.getLutData("LUTS\\sub/mixed.clf");
+        OCIO_CHECK_EQUAL(std::string(data.begin(), data.end()), files[3].m_content);
+        OCIO_CHECK_EQUAL(ciop.getFastLutFileHash("luts/./sub/../Sub/mixed.clf"),
+                         ciop.getFastLutFileHash(files[3].m_name.c_str()));
+    }
+
+    // Missing files.
+    OCIO_CHECK_ASSERT(ciop.getLutData("luts/missing.cube").empty());
+    OCIO_CHECK_EQUAL(ciop.getFastLutFileHash("luts/missing.cube"), std::string(""));
+
+    // Concurrent reads of stored and compressed files.
+    std::atomic<int> numErrors{ 0 };
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t)
+    {
+        threads.emplace_back([&ciop, &files, &numErrors]()
+        {
+            for (int iter = 0; iter < 10; ++iter)
+            {
+                for (const auto & file : files)
+                {
+                    const std::vector<uint8_t> data = ciop.getLutData(file.m_name.c_str());
+                    if (std::string(data.begin(), data.end()) != file.m_content)
+                    {
+                        ++numErrors;
+                    }
+                }
+            }
+        });
+    }
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+    OCIO_CHECK_EQUAL(numErrors.load(), 0);
+}
@@ -1683,3 +1683,119 @@ OCIO_ADD_TEST(OpOptimizers, replace_ops)
     oData = o->data();
     OCIO_CHECK_EQUAL(oData->getType(), OCIO::OpData::CDLType);
 }
+
+OCIO_ADD_TEST(OpOptimizers, optimized_ops_cache)
+{
+    OCIO::ClearOptimizedOpsCache();
+
+    auto AddLut = [](OCIO::OpRcPtrVec & ops, float gamma, const char * desc = nullptr)
+    {
+        auto lut = std::make_shared<OCIO::Lut1DOpData>(32);
+        for (unsigned long idx = 0; idx < 32; ++idx)
+        {
+            const float val = std::pow(float(idx) / 31.0f, gamma);
+            lut->getArray()[3 * idx + 0] = val;
+            lut->getArray()[3 * idx + 1] = val;
+            lut->getArray()[3 * idx + 2] = val;
+        }
+        if (desc)
+        {
+            lut->getFormatMetadata().addChildElement(OCIO::METADATA_DESCRIPTION, desc);
+        }
+        OCIO::CreateLut1DOp(ops, lut, OCIO::TRANSFORM_DIR_FORWARD);
+    };
+
+    OCIO::OpRcPtrVec ops1;
+    AddLut(ops1, 2.2f);
+    AddLut(ops1, 0.6f);
+    OCIO_CHECK_NO_THROW(ops1.finalize());
+    OCIO_CHECK_NO_THROW(ops1.optimize(OCIO::OPTIMIZATION_DEFAULT));
+    OCIO_REQUIRE_EQUAL(ops1.size(), 1);
+
+    // One entry for the LUT composition and one for the whole list.
+    OCIO_CHECK_EQUAL(OCIO::GetOptimizedOpsCache().size(), 2);
+
+    // An identical list (i.e. with different op instances) reuses the optimized ops.
+    OCIO::OpRcPtrVec ops2;
+    AddLut(ops2, 2.2f);
+    AddLut(ops2, 0.6f);
+    OCIO_CHECK_NO_THROW(ops2.finalize());
+    OCIO_CHECK_NO_THROW(ops2.optimize(OCIO::OPTIMIZATION_DEFAULT));
+    OCIO_REQUIRE_EQUAL(ops2.size(), 1);
+    OCIO_CHECK_EQUAL(ops2[0].get(), ops1[0].get());
+    OCIO_CHECK_EQUAL(OCIO::GetOptimizedOpsCache().size(), 2);
+
+    // A list containing the same LUTs reuses the LUT composition.
+    OCIO::OpRcPtrVec ops3;
+    OCIO::MatrixOpDataRcPtr matrix = std::make_shared<OCIO::MatrixOpData>();
+    matrix->setArrayValue(1, 0.2);
+    OCIO_CHECK_NO_THROW(OCIO::CreateMatrixOp(ops3, matrix, OCIO::TRANSFORM_DIR_FORWARD));
+    AddLut(ops3, 2.2f);
+    AddLut(ops3, 0.6f);
+    OCIO_CHECK_NO_THROW(ops3.finalize());
+    OCIO_CHECK_NO_THROW(ops3.optimize(OCIO::OPTIMIZATION_DEFAULT));
+    OCIO_REQUIRE_EQUAL(ops3.size(), 2);
+    OCIO_CHECK_EQUAL(ops3[1].get(), ops1[0].get());
+    OCIO_CHECK_EQUAL(OCIO::GetOptimizedOpsCache().size(), 3);
+
+    // The optimization flags are part of the key.
+    OCIO::OpRcPtrVec ops4;
+    AddLut(ops4, 2.2f);
+    AddLut(ops4, 0.6f);
+    OCIO_CHECK_NO_THROW(ops4.finalize());
+    OCIO_CHECK_NO_THROW(ops4.optimize(OCIO::OPTIMIZATION_LOSSLESS));
+    OCIO_CHECK_EQUAL(ops4.size(), 2);
+    OCIO_CHECK_EQUAL(OCIO::GetOptimizedOpsCache().size(), 4);
+
+    // The metadata is part of the key, as the optimized ops keep it (e.g. to export them).
+    auto AddDescribedLuts = [&AddLut](OCIO::OpRcPtrVec & ops, const char * desc)
+    {
+        AddLut(ops, 2.2f, desc);
+        AddLut(ops, 0.6f);
+        ops.finalize();
+        ops.optimize(OCIO::OPTIMIZATION_DEFAULT);
+    };
+
+    OCIO::OpRcPtrVec ops6;
+    OCIO_CHECK_NO_THROW(AddDescribedLuts(ops6, "First file"));
+    OCIO_REQUIRE_EQUAL(ops6.size(), 1);
+    OCIO_CHECK_NE(ops6[0].get(), ops1[0].get());
+    OCIO_CHECK_EQUAL(OCIO::GetOptimizedOpsCache().size(), 6);
+
+    OCIO::OpRcPtrVec ops7;
+    OCIO_CHECK_NO_THROW(AddDescribedLuts(ops7, "Second file"));
+    OCIO_REQUIRE_EQUAL(ops7.size(), 1);
+    OCIO_CHECK_NE(ops7[0].get(), ops6[0].get());
+    OCIO_CHECK_EQUAL(OCIO::GetOptimizedOpsCache().size(), 8);
+
+    OCIO::ConstOpRcPtr op7 = ops7[0];
+    const OCIO::FormatMetadataImpl & metadata7 = op7->data()->getFormatMetadata();
+    OCIO_REQUIRE_EQUAL(metadata7.getNumChildrenElements(), 1);
+    OCIO_CHECK_EQUAL(std::string(metadata7.getChildElement(0).getElementValue()), "Second file");
+
+    OCIO::OpRcPtrVec ops8;
+    OCIO_CHECK_NO_THROW(AddDescribedLuts(ops8, "First file"));
+    OCIO_REQUIRE_EQUAL(ops8.size(), 1);
+    OCIO_CHECK_EQUAL(ops8[0].get(), ops6[0].get());
+    OCIO_CHECK_EQUAL(OCIO::GetOptimizedOpsCache().size(), 8);
+
+    // A list with dynamic properties is not cached but its LUT composition is.
+    OCIO::ClearOptimizedOpsCache();
+    OCIO_CHECK_EQUAL(OCIO::GetOptimizedOpsCache().size(), 0);
+
+    OCIO::OpRcPtrVec ops5;
+    auto exposure = std::make_shared<OCIO::ExposureContrastOpData>();
+    exposure->setExposure(0.5);
+    exposure->getExposureProperty()->makeDynamic();
+    OCIO_CHECK_NO_THROW(OCIO::CreateExposureContrastOp(ops5, exposure,
+                                                       OCIO::TRANSFORM_DIR_FORWARD));
+    AddLut(ops5, 2.2f);
+    AddLut(ops5, 0.6f);
+    OCIO_CHECK_NO_THROW(ops5.finalize());
+    OCIO_CHECK_NO_THROW(ops5.optimize(OCIO::OPTIMIZATION_DEFAULT));
+    OCIO_REQUIRE_EQUAL(ops5.size(), 2);
+    OCIO_CHECK_EQUAL(OCIO::GetOptimizedOpsCache().size(), 1);
+
+    OCIO::ClearAllCaches();
+    OCIO_CHECK_EQUAL(OCIO::GetOptimizedOpsCache().size(), 0);
+}
@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "ParallelUtils.h"
+
+#include "testutils/UnitTest.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+OCIO_ADD_TEST(ParallelUtils, num_threads)
+{
+    OCIO_CHECK_ASSERT(OCIO::GetMaxNumThreads() >= 1);
+
+    // Jobs smaller than the minimum work size are not split.
+    OCIO_CHECK_EQUAL(OCIO::GetNumThreads(0, 4096), 1u);
+    OCIO_CHECK_EQUAL(OCIO::GetNumThreads(4096, 4096), 1u);
+    OCIO_CHECK_EQUAL(OCIO::GetNumThreads(8191, 4096), 1u);
+
+    // Large jobs never use more than the maximum number of threads.
+    OCIO_CHECK_ASSERT(OCIO::GetNumThreads(1000000, 1) <= OCIO::GetMaxNumThreads());
+    OCIO_CHECK_ASSERT(OCIO::GetNumThreads(1000000, 1) >= 1u);
+}
+
+OCIO_ADD_TEST(ParallelUtils, parallel_for)
+{
+    constexpr long numItems = 100003;
+    std::vector<int> counts(numItems, 0);
+    std::atomic<long> numCalls{ 0 };
+
+    OCIO::ParallelFor(numItems, 1000, [&](long begin, long end)
+    {
+        ++numCalls;
+        for (long idx = begin; idx < end; ++idx)
+        {
+            ++counts[idx];
+        }
+    });
+
+    // Each item is processed exactly once.
+    for (long idx = 0; idx < numItems; ++idx)
+    {
+        OCIO_REQUIRE_EQUAL(counts[idx], 1);
+    }
+    OCIO_CHECK_ASSERT(numCalls >= 1);
+    OCIO_CHECK_ASSERT(numCalls <= (long)OCIO::GetMaxNumThreads());
+
+    // Nothing to do.
+    OCIO::ParallelFor(0, 1000, [&](long, long) { ++numCalls; });
+    OCIO::ParallelFor(-1, 1000, [&](long, long) { ++numCalls; });
+    OCIO_CHECK_ASSERT(numCalls <= (long)OCIO::GetMaxNumThreads());
+
+    // An exception thrown by any chunk is rethrown once all the chunks are done.
+    OCIO_CHECK_THROW_WHAT(OCIO::ParallelFor(numItems, 1000, [](long begin, long end)
+                          {
+                              if (begin <= numItems - 1 && numItems - 1 < end)
+                              {
+                                  throw OCIO::Exception("Last chunk failed.");
+                              }
+                          }),
+                          OCIO::Exception, "Last chunk failed.");
+}
@@ -1,6 +1,9 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <fstream>
+#include <thread>
+
 #include "PathUtils.cpp"
 
 #include "testutils/UnitTest.h"
@@ -86,3 +89,60 @@ OCIO_ADD_TEST(PathUtils, compute_hash)
     OCIO_CHECK_NE(result4, OCIO::g_hashFunction(file2));
 
 }
+
+OCIO_ADD_TEST(PathUtils, directory_index)
+{
+    OCIO::ContextRcPtr context = OCIO::Context::Create();
+
+    const std::string dir  = OCIO::CreateTemporaryDirectory("ocio_directory_index");
+    const std::string file = pystring::os::path::join(dir, "lut.spi1d");
+
+    // The index is disabled by default i.e. all the files must be checked.
+    OCIO_CHECK_ASSERT(OCIO::IsFileListed(file, *context));
+    OCIO_CHECK_ASSERT(OCIO::IsFileListed(dir + "/missing/lut.spi1d", *context));
+
+    {
+        OCIO::EnvironmentVariableGuard guard(OCIO::OCIO_SEARCH_PATH_INDEX_ENVVAR, "");
+        OCIO::ClearPathCaches();
+
+        OCIO_CHECK_ASSERT(!OCIO::IsFileListed(file, *context));
+        OCIO_CHECK_ASSERT(!OCIO::IsFileListed(dir + "/missing/lut.spi1d", *context));
+        OCIO_CHECK_ASSERT(OCIO::IsFileListed(OCIO::GetTestFilesDir() + "/lut1d_4.spi1d",
+                                             *context));
+
+        {
+            std::ofstream ofs(file);
+            ofs << "Dummy content";
+        }
+
+        // The listing is kept until the caches are cleared.
+        OCIO_CHECK_ASSERT(!OCIO::IsFileListed(file, *context));
+        OCIO::ClearPathCaches();
+        OCIO_CHECK_ASSERT(OCIO::IsFileListed(file, *context));
+        OCIO_CHECK_ASSERT(OCIO::IsFileListed(dir + "/subdir/../lut.spi1d", *context));
+
+        // The index only knows about the file system.
+        {
+            OCIO::ComputeHashGuard hashGuard;
+            OCIO_CHECK_ASSERT(OCIO::IsFileListed(dir + "/other.spi1d", *context));
+        }
+    }
+
+    {
+        // The listing expires with a time to live.
+        OCIO::EnvironmentVariableGuard guard(OCIO::OCIO_SEARCH_PATH_INDEX_ENVVAR, "0.01");
+        OCIO::ClearPathCaches();
+
+        const std::string file2 = pystring::os::path::join(dir, "lut2.spi1d");
+        OCIO_CHECK_ASSERT(!OCIO::IsFileListed(file2, *context));
+        {
+            std::ofstream ofs(file2);
+            ofs << "Dummy content";
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        OCIO_CHECK_ASSERT(OCIO::IsFileListed(file2, *context));
+    }
+
+    OCIO::ClearPathCaches();
+    OCIO::RemoveTemporaryDirectory(dir);
+}
@@ -3,6 +3,7 @@
 
 
 #include <cstring>
+#include <fstream>
 #include <set>
 
 #include "Platform.cpp"
@@ -206,6 +207,38 @@ OCIO_ADD_TEST(Platform, create_temp_filename)
     OCIO_CHECK_EQUAL(uids.size(), TestMax);
 }
 
+OCIO_ADD_TEST(Platform, mapped_file)
+{
+    const std::string filename = OCIO::Platform::CreateTempFilename(".txt");
+    const std::string content = "Content of the mapped file.";
+    {
+        std::ofstream ofs(filename, std::ios_base::out | std::ios_base::binary);
+        ofs << content;
+    }
+
+    {
+        OCIO::Platform::MappedFile file(filename);
+        OCIO_REQUIRE_EQUAL(file.size(), content.size());
+        OCIO_REQUIRE_ASSERT(file.data());
+        OCIO_CHECK_EQUAL(std::string((const char *)file.data(), file.size()), content);
+    }
+
+    // An empty file has no data.
+    {
+        std::ofstream ofs(filename, std::ios_base::out | std::ios_base::trunc);
+    }
+    {
+        OCIO::Platform::MappedFile file(filename);
+        OCIO_CHECK_EQUAL(file.size(), 0U);
+        OCIO_CHECK_ASSERT(!file.data());
+    }
+
+    std::remove(filename.c_str());
+
+    OCIO_CHECK_THROW_WHAT(OCIO::Platform::MappedFile file(filename),
+                          OCIO::Exception, "the file could not be opened");
+}
+
 OCIO_ADD_TEST(Platform, utf8_utf16_convert)
 {
 #ifdef _WIN32
@@ -0,0 +1,344 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <cstdio>
+#include <fstream>
+
+#include "ProcessorSerialization.cpp"
+
+#include "testutils/UnitTest.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+namespace
+{
+
+OCIO::GroupTransformRcPtr CreateTestGroup()
+{
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+
+    auto matrix = OCIO::MatrixTransform::Create();
+    const double m44[16] { 1.1, 0.1, 0.0, 0.0,
+                           0.0, 0.9, 0.2, 0.0,
+                           0.1, 0.0, 1.2, 0.0,
+                           0.0, 0.0, 0.0, 1.0 };
+    const double offset4[4] { 0.01, 0.02, 0.03, 0.0 };
+    matrix->setMatrix(m44);
+    matrix->setOffset(offset4);
+    group->appendTransform(matrix);
+
+    auto range = OCIO::RangeTransform::Create();
+    range->setMinInValue(0.0);
+    range->setMaxInValue(1.5);
+    range->setMinOutValue(0.0);
+    range->setMaxOutValue(1.0);
+    group->appendTransform(range);
+
+    auto lut1d = OCIO::Lut1DTransform::Create(4, false);
+    lut1d->setValue(0, 0.00f, 0.01f, 0.02f);
+    lut1d->setValue(1, 0.30f, 0.31f, 0.32f);
+    lut1d->setValue(2, 0.60f, 0.62f, 0.64f);
+    lut1d->setValue(3, 0.90f, 0.95f, 1.00f);
+    group->appendTransform(lut1d);
+
+    auto lut3d = OCIO::Lut3DTransform::Create(3);
+    for (unsigned long r = 0; r < 3; ++r)
+    {
+        for (unsigned long g = 0; g < 3; ++g)
+        {
+            for (unsigned long b = 0; b < 3; ++b)
+            {
+                lut3d->setValue(r, g, b, 0.5f * r * 0.9f, 0.5f * g + 0.05f * b, 0.5f * b * 0.8f);
+            }
+        }
+    }
+    group->appendTransform(lut3d);
+
+    auto log = OCIO::LogTransform::Create();
+    log->setBase(10.0);
+    group->appendTransform(log);
+    auto logInv = OCIO::LogTransform::Create();
+    logInv->setBase(10.0);
+    logInv->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+    group->appendTransform(logInv);
+
+    auto gamma = OCIO::ExponentWithLinearTransform::Create();
+    gamma->setGamma({ 2.4, 2.4, 2.4, 1.0 });
+    gamma->setOffset({ 0.055, 0.055, 0.055, 0.0 });
+    group->appendTransform(gamma);
+
+    auto cdl = OCIO::CDLTransform::Create();
+    const double slope[3] { 1.1, 1.0, 0.9 };
+    cdl->setSlope(slope);
+    cdl->setSat(1.1);
+    group->appendTransform(cdl);
+
+    auto exponent = OCIO::ExponentTransform::Create();
+    exponent->setValue({ 1.1, 1.2, 1.3, 1.0 });
+    group->appendTransform(exponent);
+
+    group->appendTransform(OCIO::FixedFunctionTransform::Create(OCIO::FIXED_FUNCTION_RGB_TO_HSV));
+    group->appendTransform(OCIO::FixedFunctionTransform::Create(OCIO::FIXED_FUNCTION_RGB_TO_HSV,
+                                                                nullptr, 0));
+    group->getTransform(group->getNumTransforms() - 1)->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+
+    // The following ops are stored using the CTF format.
+
+    auto ec = OCIO::ExposureContrastTransform::Create();
+    ec->setExposure(0.5);
+    ec->makeExposureDynamic();
+    group->appendTransform(ec);
+
+    OCIO::GradingPrimary gp(OCIO::GRADING_LOG);
+    gp.m_saturation = 1.2;
+    auto primary = OCIO::GradingPrimaryTransform::Create(OCIO::GRADING_LOG);
+    primary->setValue(gp);
+    group->appendTransform(primary);
+
+    return group;
+}
+
+template<typename T>
+bool AreEqual(const OCIO::ConstTransformRcPtr & t1, const OCIO::ConstTransformRcPtr & t2)
+{
+    auto lhs = OCIO::DynamicPtrCast<const T>(t1);
+    auto rhs = OCIO::DynamicPtrCast<const T>(t2);
+    return lhs && rhs && lhs->equals(*rhs);
+}
+
+bool AreEqual(const OCIO::ConstTransformRcPtr & t1, const OCIO::ConstTransformRcPtr & t2)
+{
+    switch (t1->getTransformType())
+    {
+    case OCIO::TRANSFORM_TYPE_CDL:
+        return AreEqual<OCIO::CDLTransform>(t1, t2);
+    case OCIO::TRANSFORM_TYPE_EXPONENT:
+        return AreEqual<OCIO::ExponentTransform>(t1, t2);
+    case OCIO::TRANSFORM_TYPE_EXPONENT_WITH_LINEAR:
+        return AreEqual<OCIO::ExponentWithLinearTransform>(t1, t2);
+    case OCIO::TRANSFORM_TYPE_EXPOSURE_CONTRAST:
+        return AreEqual<OCIO::ExposureContrastTransform>(t1, t2);
+    case OCIO::TRANSFORM_TYPE_FIXED_FUNCTION:
+        return AreEqual<OCIO::FixedFunctionTransform>(t1, t2);
+    case OCIO::TRANSFORM_TYPE_GRADING_HUE_CURVE:
+        return AreEqual<OCIO::GradingHueCurveTransform>(t1, t2);
+    case OCIO::TRANSFORM_TYPE_GRADING_PRIMARY:
+        return AreEqual<OCIO::GradingPrimaryTransform>(t1, t2);
+    case OCIO::TRANSFORM_TYPE_GRADING_RGB_CURVE:
+        return AreEqual<OCIO::GradingRGBCurveTransform>(t1, t2);
+    case OCIO::TRANSFORM_TYPE_GRADING_TONE:
+        return AreEqual<OCIO::GradingToneTransform>(t1, t2);
+    case OCIO::TRANSFORM_TYPE_LOG:
+        return AreEqual<OCIO::LogTransform>(t1, t2);
+    case OCIO::TRANSFORM_TYPE_LOG_AFFINE:
+        return AreEqual<OCIO::LogAffineTransform>(t1, t2);
+    case OCIO::TRANSFORM_TYPE_LOG_CAMERA:
+        return AreEqual<OCIO::LogCameraTransform>(t1, t2);
+    case OCIO::TRANSFORM_TYPE_LUT1D:
+        return AreEqual<OCIO::Lut1DTransform>(t1, t2);
+    case OCIO::TRANSFORM_TYPE_LUT3D:
+        return AreEqual<OCIO::Lut3DTransform>(t1, t2);
+    case OCIO::TRANSFORM_TYPE_MATRIX:
+        return AreEqual<OCIO::MatrixTransform>(t1, t2);
+    case OCIO::TRANSFORM_TYPE_RANGE:
+        return AreEqual<OCIO::RangeTransform>(t1, t2);
+    case OCIO::TRANSFORM_TYPE_ALLOCATION:
+    case OCIO::TRANSFORM_TYPE_BUILTIN:
+    case OCIO::TRANSFORM_TYPE_COLORSPACE:
+    case OCIO::TRANSFORM_TYPE_DISPLAY_VIEW:
+    case OCIO::TRANSFORM_TYPE_FILE:
+    case OCIO::TRANSFORM_TYPE_GROUP:
+    case OCIO::TRANSFORM_TYPE_LOOK:
+        // Not created from the ops of a processor.
+        return false;
+    }
+    return false;
+}
+
+} // anon.
+
+OCIO_ADD_TEST(ProcessorSerialization, round_trip)
+{
+    OCIO::ConstConfigRcPtr config = OCIO::Config::CreateRaw();
+
+    OCIO::ConstProcessorRcPtr proc;
+    OCIO_CHECK_NO_THROW(proc = config->getProcessor(CreateTestGroup())
+                                     ->getOptimizedProcessor(OCIO::OPTIMIZATION_NONE));
+    OCIO_REQUIRE_EQUAL(proc->getNumTransforms(), 13);
+
+    const std::string filename = OCIO::Platform::CreateTempFilename(".ocioproc");
+    {
+        std::ofstream ofs(filename, std::ios_base::out | std::ios_base::binary);
+        OCIO_CHECK_NO_THROW(proc->serialize(ofs, "fingerprint"));
+    }
+
+    OCIO::ConstProcessorRcPtr loaded;
+    OCIO_CHECK_NO_THROW(loaded = OCIO::Processor::CreateFromSerializedFile(filename.c_str(),
+                                                                           "fingerprint"));
+    OCIO_REQUIRE_ASSERT(loaded);
+
+    // An empty fingerprint skips the check.
+    OCIO_CHECK_NO_THROW(OCIO::Processor::CreateFromSerializedFile(filename.c_str(), nullptr));
+    OCIO_CHECK_NO_THROW(OCIO::Processor::CreateFromSerializedFile(filename.c_str(), ""));
+
+    OCIO_CHECK_THROW_WHAT(OCIO::Processor::CreateFromSerializedFile(filename.c_str(), "other"),
+                          OCIO::Exception,
+                          "the dependency fingerprint does not match");
+
+    OCIO_CHECK_EQUAL(std::string(loaded->getCacheID()), std::string(proc->getCacheID()));
+    OCIO_CHECK_EQUAL(loaded->getNumTransforms(), proc->getNumTransforms());
+    OCIO_CHECK_ASSERT(loaded->isDynamic());
+    OCIO_CHECK_ASSERT(loaded->hasDynamicProperty(OCIO::DYNAMIC_PROPERTY_EXPOSURE));
+
+    // All the ops, except the ones stored as CTF, are exactly restored.
+    OCIO::GroupTransformRcPtr group = proc->createGroupTransform();
+    OCIO::GroupTransformRcPtr loadedGroup = loaded->createGroupTransform();
+    for (int idx = 0; idx < group->getNumTransforms(); ++idx)
+    {
+        OCIO::ConstTransformRcPtr t = group->getTransform(idx);
+        OCIO::ConstTransformRcPtr loadedT = loadedGroup->getTransform(idx);
+        OCIO_CHECK_EQUAL(t->getTransformType(), loadedT->getTransformType());
+        if (idx < 11)
+        {
+            OCIO_CHECK_ASSERT(AreEqual(t, loadedT));
+        }
+    }
+
+    OCIO::ConstCPUProcessorRcPtr cpu = proc->getDefaultCPUProcessor();
+    OCIO::ConstCPUProcessorRcPtr loadedCpu = loaded->getDefaultCPUProcessor();
+
+    const float src[12] { 0.1f, 0.2f, 0.3f, 1.0f,
+                          0.5f, 0.4f, 0.3f, 0.5f,
+                          0.9f, 0.8f, 0.7f, 0.0f };
+    float res[12], loadedRes[12];
+    std::memcpy(res, src, sizeof(src));
+    std::memcpy(loadedRes, src, sizeof(src));
+
+    cpu->apply(OCIO::PackedImageDesc(res, 3, 1, 4));
+    loadedCpu->apply(OCIO::PackedImageDesc(loadedRes, 3, 1, 4));
+
+    for (size_t idx = 0; idx < 12; ++idx)
+    {
+        OCIO_CHECK_CLOSE(res[idx], loadedRes[idx], 1e-6f);
+    }
+
+    // The dynamic property of the loaded processor is still dynamic.
+    auto dp = loadedCpu->getDynamicProperty(OCIO::DYNAMIC_PROPERTY_EXPOSURE);
+    OCIO::DynamicPropertyDoubleRcPtr exposure = OCIO::DynamicPropertyValue::AsDouble(dp);
+    OCIO_CHECK_EQUAL(exposure->getValue(), 0.5);
+
+    std::remove(filename.c_str());
+}
+
+OCIO_ADD_TEST(ProcessorSerialization, metadata_and_alignment)
+{
+    OCIO::OpRcPtrVec ops;
+    OCIO::CreateRangeOp(ops, 0.0, 1.0, 0.1, 0.9, OCIO::TRANSFORM_DIR_FORWARD);
+
+    auto lut = std::make_shared<OCIO::Lut3DOpData>(OCIO::INTERP_TETRAHEDRAL, 2);
+    lut->getArray()[5] = 0.25f;
+    OCIO::CreateLut3DOp(ops, lut, OCIO::TRANSFORM_DIR_FORWARD);
+
+    OCIO::ProcessorMetadataRcPtr metadata = OCIO::ProcessorMetadata::Create();
+    metadata->addFile("lut.clf");
+    metadata->addLook("look1");
+
+    std::ostringstream oss;
+    OCIO_CHECK_NO_THROW(OCIO::SerializeProcessor(oss, ops, *metadata, "cacheID", "fp"));
+
+    // The Lut3D values are aligned from the start of the data.
+    const std::string data = oss.str();
+    const size_t lutSize = 2 * 2 * 2 * 3 * sizeof(float);
+    OCIO_REQUIRE_ASSERT(data.size() > lutSize);
+    OCIO_CHECK_EQUAL((data.size() - lutSize) % OCIO::BINARY_ALIGNMENT, 0U);
+
+    const std::string filename = OCIO::Platform::CreateTempFilename(".ocioproc");
+    {
+        std::ofstream ofs(filename, std::ios_base::out | std::ios_base::binary);
+        ofs << data;
+    }
+
+    OCIO::OpRcPtrVec loadedOps;
+    OCIO::ProcessorMetadataRcPtr loadedMetadata;
+    std::string cacheID;
+    OCIO_CHECK_NO_THROW(OCIO::DeserializeProcessor(filename, "fp", loadedOps,
+                                                   loadedMetadata, cacheID));
+    OCIO_CHECK_EQUAL(cacheID, "cacheID");
+    OCIO_REQUIRE_EQUAL(loadedMetadata->getNumFiles(), 1);
+    OCIO_CHECK_EQUAL(std::string(loadedMetadata->getFile(0)), "lut.clf");
+    OCIO_REQUIRE_EQUAL(loadedMetadata->getNumLooks(), 1);
+    OCIO_CHECK_EQUAL(std::string(loadedMetadata->getLook(0)), "look1");
+
+    OCIO_REQUIRE_EQUAL(loadedOps.size(), 2);
+    OCIO::ConstOpRcPtr loadedOp = loadedOps[1];
+    auto loadedLut = OCIO_DYNAMIC_POINTER_CAST<const OCIO::Lut3DOpData>(loadedOp->data());
+    OCIO_REQUIRE_ASSERT(loadedLut);
+    OCIO_CHECK_EQUAL(loadedLut->getInterpolation(), OCIO::INTERP_TETRAHEDRAL);
+    OCIO_CHECK_ASSERT(loadedLut->getArray() == lut->getArray());
+
+    std::remove(filename.c_str());
+}
+
+OCIO_ADD_TEST(ProcessorSerialization, errors)
+{
+    OCIO::OpRcPtrVec ops;
+    OCIO::CreateRangeOp(ops, 0.0, 1.0, 0.1, 0.9, OCIO::TRANSFORM_DIR_FORWARD);
+
+    std::ostringstream oss;
+    OCIO::SerializeProcessor(oss, ops, *OCIO::ProcessorMetadata::Create(), "cacheID", "");
+    const std::string data = oss.str();
+
+    const std::string filename = OCIO::Platform::CreateTempFilename(".ocioproc");
+
+    auto writeFile = [&filename](const std::string & content)
+    {
+        std::ofstream ofs(filename, std::ios_base::out | std::ios_base::binary);
+        ofs << content;
+    };
+
+    // Truncated file.
+    writeFile(data.substr(0, data.size() - 4));
+    OCIO_CHECK_THROW_WHAT(OCIO::Processor::CreateFromSerializedFile(filename.c_str(), nullptr),
+                          OCIO::Exception,
+                          "the data is truncated");
+
+    // Extra data.
+    writeFile(data + "extra");
+    OCIO_CHECK_THROW_WHAT(OCIO::Processor::CreateFromSerializedFile(filename.c_str(), nullptr),
+                          OCIO::Exception,
+                          "unexpected data after the last op");
+
+    // Not a binary processor file.
+    writeFile("<?xml version=\"1.0\" encoding=\"UTF-8\"?>");
+    OCIO_CHECK_THROW_WHAT(OCIO::Processor::CreateFromSerializedFile(filename.c_str(), nullptr),
+                          OCIO::Exception,
+                          "this is not a binary processor file");
+
+    // Unsupported version.
+    std::string badVersion = data;
+    badVersion[8] = char(99);
+    writeFile(badVersion);
+    OCIO_CHECK_THROW_WHAT(OCIO::Processor::CreateFromSerializedFile(filename.c_str(), nullptr),
+                          OCIO::Exception,
+                          "unsupported version 99");
+
+    // Out of range enum: the range direction is stored just before its four doubles.
+    std::string badDirection = data;
+    badDirection[data.size() - 4 * sizeof(double) - sizeof(uint32_t)] = char(7);
+    writeFile(badDirection);
+    OCIO_CHECK_THROW_WHAT(OCIO::Processor::CreateFromSerializedFile(filename.c_str(), nullptr),
+                          OCIO::Exception,
+                          "invalid direction value 7");
+
+    std::remove(filename.c_str());
+
+    OCIO_CHECK_THROW_WHAT(OCIO::Processor::CreateFromSerializedFile(filename.c_str(), nullptr),
+                          OCIO::Exception,
+                          "the file could not be opened");
+
+    OCIO_CHECK_THROW_WHAT(OCIO::Processor::CreateFromSerializedFile("", nullptr),
+                          OCIO::Exception,
+                          "the file path is empty");
+}
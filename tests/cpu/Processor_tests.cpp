@@ -2,12 +2,16 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 
+#include <algorithm>
+#include <thread>
+
 #include "Processor.cpp"
 
 #include "ops/exposurecontrast/ExposureContrastOp.h"
 #include "testutils/UnitTest.h"
 #include "UnitTestLogUtils.h"
 #include "UnitTestOptimFlags.h"
+#include "UnitTestUtils.h"
 
 namespace OCIO = OCIO_NAMESPACE;
 
@@ -297,6 +301,14 @@ OCIO_ADD_TEST(Processor, optimization_env_override_basic)
 
     OCIO::SetEnvVariable(OCIO::OCIO_OPTIMIZATION_FLAGS_ENVVAR, "0xFFC3FC3");
     OCIO_CHECK_EQUAL(OCIO::OPTIMIZATION_GOOD, OCIO::EnvironmentOverride(testFlag));
+
+    // The report is only requested by the caller.
+    const OCIO::OptimizationFlags reportFlag
+        = OCIO::OptimizationFlags(OCIO::OPTIMIZATION_DEFAULT | OCIO::OPTIMIZATION_REPORT);
+    OCIO::SetEnvVariable(OCIO::OCIO_OPTIMIZATION_FLAGS_ENVVAR, "0xFFFFFFFF");
+    OCIO_CHECK_EQUAL(OCIO::OPTIMIZATION_ALL, OCIO::EnvironmentOverride(testFlag));
+    OCIO_CHECK_EQUAL(OCIO::OPTIMIZATION_ALL | OCIO::OPTIMIZATION_REPORT,
+                     OCIO::EnvironmentOverride(reportFlag));
 }
 
 OCIO_ADD_TEST(Processor, cache_optimized_processors)
@@ -519,3 +531,585 @@ OCIO_ADD_TEST(Processor, cache_gpu_processors)
     OCIO_CHECK_EQUAL(proc1->getOptimizedGPUProcessor(OCIO::OPTIMIZATION_DEFAULT).get(),
                      proc1->getOptimizedGPUProcessor(OCIO::OPTIMIZATION_DEFAULT).get());
 }
+
+OCIO_ADD_TEST(Processor, bake_cpu_processor)
+{
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+
+    auto IsBaked = [](const OCIO::ConstCPUProcessorRcPtr & cpu)
+    {
+        const std::string id = cpu->getCacheID();
+        return id.find("<Lut1D") != std::string::npos || id.find("<Lut3D") != std::string::npos;
+    };
+
+    // The Lut1D maps the NaNs to zero so a color processing keeping them is not baked for a
+    // float input bit-depth.
+
+    auto exponent = OCIO::ExponentTransform::Create();
+    exponent->setValue({ 2.2, 2.2, 2.2, 1.0 });
+    exponent->setNegativeStyle(OCIO::NEGATIVE_PASS_THRU);
+
+    OCIO::ConstProcessorRcPtr proc = config->getProcessor(exponent);
+
+    OCIO::ConstCPUProcessorRcPtr baked;
+    OCIO_CHECK_NO_THROW(baked = proc->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_F32,
+                                                               OCIO::BIT_DEPTH_F32,
+                                                               OCIO::OPTIMIZATION_DEFAULT,
+                                                               1e-3f));
+    OCIO_CHECK_ASSERT(!IsBaked(baked));
+
+    // Once the values are clamped, a color processing without channel crosstalk is baked into
+    // a Lut1D.
+
+    auto range = OCIO::RangeTransform::Create();
+    range->setMinInValue(0.);
+    range->setMinOutValue(0.);
+    range->setMaxInValue(256.);
+    range->setMaxOutValue(256.);
+
+    auto clampedExponent = OCIO::GroupTransform::Create();
+    clampedExponent->appendTransform(range);
+    clampedExponent->appendTransform(exponent);
+
+    proc = config->getProcessor(clampedExponent);
+
+    OCIO::ConstCPUProcessorRcPtr exact = proc->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_F32,
+                                                                        OCIO::BIT_DEPTH_F32,
+                                                                        OCIO::OPTIMIZATION_DEFAULT);
+    OCIO_CHECK_ASSERT(!IsBaked(exact));
+
+    // A tolerance of zero disables the bake.
+    OCIO_CHECK_EQUAL(proc->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32,
+                                                    OCIO::OPTIMIZATION_DEFAULT, 0.0f).get(),
+                     exact.get());
+
+    OCIO_CHECK_NO_THROW(baked = proc->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_F32,
+                                                               OCIO::BIT_DEPTH_F32,
+                                                               OCIO::OPTIMIZATION_DEFAULT,
+                                                               1e-3f));
+    OCIO_CHECK_ASSERT(IsBaked(baked));
+    OCIO_CHECK_NE(std::string(baked->getCacheID()).find("<Lut1D"), std::string::npos);
+    OCIO_CHECK_ASSERT(!baked->hasChannelCrosstalk());
+
+    // The baked processor is cached.
+    OCIO_CHECK_EQUAL(proc->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32,
+                                                    OCIO::OPTIMIZATION_DEFAULT, 1e-3f).get(),
+                     baked.get());
+
+    // A close tolerance does not share the cached processor.
+    OCIO_CHECK_NE(proc->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32,
+                                                 OCIO::OPTIMIZATION_DEFAULT, 1.000001e-3f).get(),
+                  baked.get());
+
+    float exactPixel[4] { 0.18f, 0.5f, 4.0f, 0.5f };
+    float bakedPixel[4] { 0.18f, 0.5f, 4.0f, 0.5f };
+    exact->applyRGBA(exactPixel);
+    baked->applyRGBA(bakedPixel);
+    for (size_t idx = 0; idx < 4; ++idx)
+    {
+        OCIO_CHECK_CLOSE(bakedPixel[idx], exactPixel[idx], 1e-3f);
+    }
+
+    // A color processing with channel crosstalk is baked into a Lut3D. For an integer input
+    // bit-depth, the domain is [0, 1] so no shaper is needed.
+
+    auto group = OCIO::GroupTransform::Create();
+    group->appendTransform(exponent);
+    auto cdl = OCIO::CDLTransform::Create();
+    cdl->setSat(1.3);
+    group->appendTransform(cdl);
+    auto matrix = OCIO::MatrixTransform::Create();
+    const double m44[16] { 0.8, 0.1, 0.1, 0.0,
+                           0.2, 0.7, 0.1, 0.0,
+                           0.1, 0.2, 0.7, 0.0,
+                           0.0, 0.0, 0.0, 1.0 };
+    matrix->setMatrix(m44);
+    group->appendTransform(matrix);
+
+    proc = config->getProcessor(group);
+
+    OCIO_CHECK_NO_THROW(baked = proc->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_UINT8,
+                                                               OCIO::BIT_DEPTH_F32,
+                                                               OCIO::OPTIMIZATION_DEFAULT,
+                                                               1e-2f));
+    OCIO_CHECK_ASSERT(IsBaked(baked));
+    OCIO_CHECK_EQUAL(std::string(baked->getCacheID()).find("<Lut1D"), std::string::npos);
+    OCIO_CHECK_ASSERT(baked->hasChannelCrosstalk());
+
+    exact = proc->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_UINT8,
+                                           OCIO::BIT_DEPTH_F32,
+                                           OCIO::OPTIMIZATION_DEFAULT);
+
+    uint8_t src[8] { 0, 64, 128, 255, 250, 10, 200, 128 };
+    float exactRes[8], bakedRes[8];
+    const OCIO::PackedImageDesc srcImg(src, 2, 1, 4, OCIO::BIT_DEPTH_UINT8, 1, 4, 8);
+    OCIO::PackedImageDesc exactImg(exactRes, 2, 1, 4);
+    OCIO::PackedImageDesc bakedImg(bakedRes, 2, 1, 4);
+    exact->apply(srcImg, exactImg);
+    baked->apply(srcImg, bakedImg);
+    for (size_t idx = 0; idx < 8; ++idx)
+    {
+        OCIO_CHECK_CLOSE(bakedRes[idx], exactRes[idx], 1e-2f);
+    }
+
+    // For a float input bit-depth, the negative, NaN and large values are not clamped by the
+    // color processing so the Lut3D is not accurate enough.
+
+    OCIO_CHECK_NO_THROW(baked = proc->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_F32,
+                                                               OCIO::BIT_DEPTH_F32,
+                                                               OCIO::OPTIMIZATION_DEFAULT,
+                                                               1e-1f));
+    OCIO_CHECK_ASSERT(!IsBaked(baked));
+
+    // Once the values are clamped to the domain, the log shaper is needed.
+
+    group->prependTransform(range);
+
+    proc = config->getProcessor(group);
+
+    OCIO_CHECK_NO_THROW(baked = proc->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_F32,
+                                                               OCIO::BIT_DEPTH_F32,
+                                                               OCIO::OPTIMIZATION_DEFAULT,
+                                                               1e-1f));
+    OCIO_CHECK_ASSERT(IsBaked(baked));
+    OCIO_CHECK_NE(std::string(baked->getCacheID()).find("<Lut1D"), std::string::npos);
+    OCIO_CHECK_NE(std::string(baked->getCacheID()).find("<Lut3D"), std::string::npos);
+
+    exact = proc->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_F32,
+                                           OCIO::BIT_DEPTH_F32,
+                                           OCIO::OPTIMIZATION_DEFAULT);
+
+    float outside[8] { -1.0f, std::numeric_limits<float>::quiet_NaN(), 1000.0f, 1.0f,
+                       0.18f, 0.5f, 4.0f, 1.0f };
+    float exactOutside[8], bakedOutside[8];
+    const OCIO::PackedImageDesc outsideImg(outside, 2, 1, 4);
+    OCIO::PackedImageDesc exactOutsideImg(exactOutside, 2, 1, 4);
+    OCIO::PackedImageDesc bakedOutsideImg(bakedOutside, 2, 1, 4);
+    exact->apply(outsideImg, exactOutsideImg);
+    baked->apply(outsideImg, bakedOutsideImg);
+    // The error is relative to the largest color component of the pixel.
+    for (size_t idx = 0; idx < 8; ++idx)
+    {
+        const float * pixel = &exactOutside[idx / 4 * 4];
+        const float scale
+            = std::max({ 1.0f, std::abs(pixel[0]), std::abs(pixel[1]), std::abs(pixel[2]) });
+        OCIO_CHECK_CLOSE(bakedOutside[idx] / scale, exactOutside[idx] / scale, 1e-1f);
+    }
+
+    // No candidate is accurate enough.
+
+    OCIO_CHECK_NO_THROW(baked = proc->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_F32,
+                                                               OCIO::BIT_DEPTH_F32,
+                                                               OCIO::OPTIMIZATION_DEFAULT,
+                                                               1e-7f));
+    OCIO_CHECK_ASSERT(!IsBaked(baked));
+
+    // The dynamic properties are never frozen unless requested. The exposure keeps the NaNs so
+    // an integer input bit-depth is used.
+
+    auto ec = OCIO::ExposureContrastTransform::Create();
+    ec->setStyle(OCIO::EXPOSURE_CONTRAST_LINEAR);
+    ec->setExposure(0.5);
+    ec->makeExposureDynamic();
+
+    proc = config->getProcessor(ec);
+
+    OCIO_CHECK_NO_THROW(baked = proc->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_UINT16,
+                                                               OCIO::BIT_DEPTH_F32,
+                                                               OCIO::OPTIMIZATION_DEFAULT,
+                                                               1e-1f));
+    OCIO_CHECK_ASSERT(!IsBaked(baked));
+    OCIO_CHECK_ASSERT(baked->isDynamic());
+
+    const OCIO::OptimizationFlags flags
+        = OCIO::OptimizationFlags(OCIO::OPTIMIZATION_DEFAULT | OCIO::OPTIMIZATION_NO_DYNAMIC_PROPERTIES);
+    OCIO_CHECK_NO_THROW(baked = proc->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_UINT16,
+                                                               OCIO::BIT_DEPTH_F32,
+                                                               flags,
+                                                               1e-1f));
+    OCIO_CHECK_ASSERT(IsBaked(baked));
+    OCIO_CHECK_ASSERT(!baked->isDynamic());
+}
+
+OCIO_ADD_TEST(Processor, optimization_report)
+{
+    OCIO::ClearAllCaches();
+
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+    config->setProcessorCacheFlags(OCIO::PROCESSOR_CACHE_OFF);
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+
+    auto mat = OCIO::MatrixTransform::Create();
+    double offset[4]{ 0.1, 0.2, 0.3, 0.4 };
+    mat->setOffset(offset);
+    group->appendTransform(mat);
+    group->appendTransform(mat);
+
+    auto exp = OCIO::ExponentTransform::Create();
+    double value[4]{ 2.2, 2.2, 2.2, 1. };
+    exp->setValue(value);
+    group->appendTransform(exp);
+
+    auto processor = config->getProcessor(group);
+
+    // An unoptimized processor has an empty report.
+    OCIO::ConstOptimizationReportRcPtr report = processor->getOptimizationReport();
+    OCIO_REQUIRE_ASSERT(report);
+    OCIO_CHECK_EQUAL(report->getNumOpsBefore(), 0);
+    OCIO_CHECK_EQUAL(report->getNumRules(), 0);
+
+    const OCIO::OptimizationFlags flags
+        = OCIO::OptimizationFlags(OCIO::OPTIMIZATION_DEFAULT | OCIO::OPTIMIZATION_REPORT);
+
+    auto optProcessor = processor->getOptimizedProcessor(flags);
+    report = optProcessor->getOptimizationReport();
+    OCIO_REQUIRE_ASSERT(report);
+
+    OCIO_CHECK_ASSERT(!report->isFromCache());
+    OCIO_CHECK_EQUAL(report->getNumPasses(), 1);
+    OCIO_CHECK_ASSERT(report->getOptimizationTime() >= 0.);
+
+    OCIO_REQUIRE_EQUAL(report->getNumOpsBefore(), 3);
+    OCIO_CHECK_EQUAL(std::string(report->getOpBefore(0)), "<MatrixOffsetOp>");
+    OCIO_CHECK_EQUAL(std::string(report->getOpBefore(1)), "<MatrixOffsetOp>");
+    OCIO_CHECK_EQUAL(std::string(report->getOpBefore(2)), "<GammaOp>");
+    OCIO_CHECK_EQUAL(std::string(report->getOpBefore(3)), "");
+
+    OCIO_REQUIRE_EQUAL(report->getNumOpsAfter(), 2);
+    OCIO_CHECK_EQUAL(std::string(report->getOpAfter(0)), "<MatrixOffsetOp>");
+    OCIO_CHECK_EQUAL(std::string(report->getOpAfter(1)), "<GammaOp>");
+
+    // The two matrices are combined.
+    bool foundCombine = false;
+    for (int idx = 0; idx < report->getNumRules(); ++idx)
+    {
+        OCIO_CHECK_ASSERT(report->getRuleTime(idx) >= 0.);
+        if (std::string(report->getRuleName(idx)) == "CombineOps")
+        {
+            foundCombine = true;
+            OCIO_CHECK_EQUAL(report->getRuleCount(idx), 1);
+        }
+    }
+    OCIO_CHECK_ASSERT(foundCombine);
+
+    // Only a CPU processor has renderers.
+    OCIO_CHECK_EQUAL(report->getNumRenderers(), 0);
+
+    auto cpuProcessor = optProcessor->getOptimizedCPUProcessor(flags);
+    report = cpuProcessor->getOptimizationReport();
+    OCIO_REQUIRE_ASSERT(report);
+
+    OCIO_CHECK_EQUAL(report->getNumOpsBefore(), 2);
+    OCIO_CHECK_EQUAL(report->getNumOpsAfter(), 2);
+    OCIO_REQUIRE_EQUAL(report->getNumRenderers(), 2);
+    OCIO_CHECK_EQUAL(std::string(report->getRendererName(0)), "<MatrixOffsetOp>");
+    OCIO_CHECK_EQUAL(std::string(report->getRendererName(1)), "<GammaOp>");
+    OCIO_CHECK_ASSERT(report->getRendererTime(0) >= 0.);
+
+    // A processor with identical ops reuses the cached optimization result.
+    auto processor2 = config->getProcessor(group);
+    OCIO_CHECK_NE(processor2.get(), processor.get());
+    report = processor2->getOptimizedProcessor(flags)->getOptimizationReport();
+    OCIO_CHECK_ASSERT(report->isFromCache());
+    OCIO_CHECK_EQUAL(report->getNumOpsAfter(), 2);
+
+    std::ostringstream oss;
+    oss << *cpuProcessor->getOptimizationReport();
+    OCIO_CHECK_NE(oss.str().find("CPU renderers:"), std::string::npos);
+    OCIO_CHECK_NE(oss.str().find("Ops after (2): <MatrixOffsetOp> <GammaOp>"), std::string::npos);
+
+    // The report is only filled on request.
+    optProcessor = processor->getOptimizedProcessor(OCIO::OPTIMIZATION_DEFAULT);
+    report = optProcessor->getOptimizationReport();
+    OCIO_REQUIRE_ASSERT(report);
+    OCIO_CHECK_EQUAL(report->getNumPasses(), 0);
+    OCIO_CHECK_EQUAL(report->getNumOpsBefore(), 0);
+    OCIO_CHECK_EQUAL(report->getNumRules(), 0);
+
+    report = optProcessor->getOptimizedCPUProcessor(OCIO::OPTIMIZATION_DEFAULT)->getOptimizationReport();
+    OCIO_REQUIRE_ASSERT(report);
+    OCIO_CHECK_EQUAL(report->getNumOpsAfter(), 0);
+    OCIO_CHECK_EQUAL(report->getNumRenderers(), 0);
+
+    // Even when all the optimizations are requested.
+    OCIO_CHECK_ASSERT(!OCIO::HasFlag(OCIO::OPTIMIZATION_ALL, OCIO::OPTIMIZATION_REPORT));
+    OCIO_CHECK_ASSERT(!OCIO::HasFlag(OCIO::OPTIMIZATION_DRAFT, OCIO::OPTIMIZATION_REPORT));
+
+    report = processor->getOptimizedCPUProcessor(OCIO::OPTIMIZATION_ALL)->getOptimizationReport();
+    OCIO_REQUIRE_ASSERT(report);
+    OCIO_CHECK_EQUAL(report->getNumPasses(), 0);
+    OCIO_CHECK_EQUAL(report->getNumRenderers(), 0);
+}
+
+OCIO_ADD_TEST(Processor, memory_usage)
+{
+    OCIO::ClearAllCaches();
+
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+    config->setSearchPath(OCIO::GetTestFilesDir().c_str());
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+
+    auto lut3d = OCIO::Lut3DTransform::Create(33);
+    lut3d->setValue(0, 0, 0, 0.1f, 0.2f, 0.3f);
+    group->appendTransform(lut3d);
+
+    auto lut1d = OCIO::Lut1DTransform::Create(1024, false);
+    lut1d->setValue(0, 0.1f, 0.2f, 0.3f);
+    group->appendTransform(lut1d);
+
+    auto mat = OCIO::MatrixTransform::Create();
+    double offset[4]{ 0.1, 0.2, 0.3, 0.4 };
+    mat->setOffset(offset);
+    group->appendTransform(mat);
+
+    constexpr size_t lut3dSize = 33 * 33 * 33 * 3 * sizeof(float);
+    constexpr size_t lut1dSize = 1024 * 3 * sizeof(float);
+
+    auto processor = config->getProcessor(group);
+
+    // One entry per op.
+    OCIO::ConstMemoryUsageRcPtr memoryUsage = processor->getMemoryUsage();
+    OCIO_REQUIRE_ASSERT(memoryUsage);
+    OCIO_REQUIRE_EQUAL(memoryUsage->getNumEntries(), 3);
+    OCIO_CHECK_EQUAL(std::string(memoryUsage->getEntryName(0)), "<Lut3DOp>");
+    OCIO_CHECK_EQUAL(memoryUsage->getEntrySize(0), lut3dSize);
+    OCIO_CHECK_EQUAL(std::string(memoryUsage->getEntryName(1)), "<Lut1DOp>");
+    OCIO_CHECK_EQUAL(memoryUsage->getEntrySize(1), lut1dSize);
+    OCIO_CHECK_EQUAL(std::string(memoryUsage->getEntryName(2)), "<MatrixOffsetOp>");
+    OCIO_CHECK_EQUAL(memoryUsage->getEntrySize(2), 0);
+    OCIO_CHECK_EQUAL(memoryUsage->getTotalSize(), lut3dSize + lut1dSize);
+    OCIO_CHECK_EQUAL(std::string(memoryUsage->getEntryName(3)), "");
+    OCIO_CHECK_EQUAL(memoryUsage->getEntrySize(3), 0);
+
+    // The CPU renderers hold their own tables.
+    auto cpuProcessor = processor->getOptimizedCPUProcessor(OCIO::OPTIMIZATION_NONE);
+    memoryUsage = cpuProcessor->getMemoryUsage();
+    OCIO_REQUIRE_ASSERT(memoryUsage);
+    OCIO_REQUIRE_EQUAL(memoryUsage->getNumEntries(), 3);
+    OCIO_CHECK_EQUAL(std::string(memoryUsage->getEntryName(0)), "LUT3D");
+    OCIO_CHECK_ASSERT(memoryUsage->getEntrySize(0) >= lut3dSize);
+    OCIO_CHECK_EQUAL(std::string(memoryUsage->getEntryName(1)), "LUT1D");
+    OCIO_CHECK_EQUAL(memoryUsage->getEntrySize(1), lut1dSize);
+    OCIO_CHECK_EQUAL(std::string(memoryUsage->getEntryName(2)), "Matrix");
+    OCIO_CHECK_EQUAL(memoryUsage->getEntrySize(2), 0);
+
+    // With integer bit-depths, the bit-depth conversions are part of the first & last entries.
+    memoryUsage = processor->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_UINT8, OCIO::BIT_DEPTH_UINT16,
+                                                      OCIO::OPTIMIZATION_NONE)->getMemoryUsage();
+    OCIO_REQUIRE_EQUAL(memoryUsage->getNumEntries(), 3);
+    OCIO_CHECK_EQUAL(std::string(memoryUsage->getEntryName(0)), "LUT3D");
+    OCIO_CHECK_ASSERT(memoryUsage->getEntrySize(0) >= lut3dSize);
+    OCIO_CHECK_EQUAL(std::string(memoryUsage->getEntryName(2)), "Matrix");
+
+    // The inverse 3D LUT renderer holds the extrapolated LUT and the range tree.
+    auto invProcessor = config->getProcessor(lut3d, OCIO::TRANSFORM_DIR_INVERSE);
+    memoryUsage = invProcessor->getOptimizedCPUProcessor(OCIO::OPTIMIZATION_NONE)->getMemoryUsage();
+    OCIO_REQUIRE_EQUAL(memoryUsage->getNumEntries(), 1);
+    OCIO_CHECK_ASSERT(memoryUsage->getEntrySize(0) > 35 * 35 * 35 * 3 * sizeof(float));
+
+    // The GPU processor also reports the cached shader information.
+    auto gpuProcessor = processor->getOptimizedGPUProcessor(OCIO::OPTIMIZATION_NONE);
+    memoryUsage = gpuProcessor->getMemoryUsage();
+    OCIO_REQUIRE_EQUAL(memoryUsage->getNumEntries(), 4);
+    OCIO_CHECK_EQUAL(memoryUsage->getEntrySize(0), lut3dSize);
+    OCIO_CHECK_EQUAL(std::string(memoryUsage->getEntryName(3)), "Shader cache");
+    OCIO_CHECK_EQUAL(memoryUsage->getEntrySize(3), 0);
+
+    OCIO::GpuShaderDescRcPtr shaderDesc = OCIO::GpuShaderDesc::CreateShaderDesc();
+    gpuProcessor->extractGpuShaderInfo(shaderDesc);
+    memoryUsage = gpuProcessor->getMemoryUsage();
+    OCIO_CHECK_ASSERT(memoryUsage->getEntrySize(3) > lut3dSize + lut1dSize);
+
+    // The config caches the processors.
+    OCIO_CHECK_EQUAL(config->getProcessor(group), processor);
+    memoryUsage = config->getProcessorCacheMemoryUsage();
+    OCIO_REQUIRE_EQUAL(memoryUsage->getNumEntries(), 2);
+    OCIO_CHECK_EQUAL(memoryUsage->getTotalSize(),
+                     processor->getMemoryUsage()->getTotalSize()
+                     + invProcessor->getMemoryUsage()->getTotalSize());
+
+    config->clearProcessorCache();
+    OCIO_CHECK_EQUAL(config->getProcessorCacheMemoryUsage()->getNumEntries(), 0);
+
+    // The global caches.
+    memoryUsage = OCIO::GetCachesMemoryUsage();
+    OCIO_REQUIRE_EQUAL(memoryUsage->getNumEntries(), 2);
+    OCIO_CHECK_EQUAL(std::string(memoryUsage->getEntryName(0)), "File cache");
+    OCIO_CHECK_EQUAL(memoryUsage->getEntrySize(0), 0);
+    OCIO_CHECK_EQUAL(std::string(memoryUsage->getEntryName(1)), "Optimized ops cache");
+
+    auto file = OCIO::FileTransform::Create();
+    file->setSrc("lut1d_1.spi1d");
+    OCIO_CHECK_NO_THROW(config->getProcessor(file));
+    OCIO_CHECK_ASSERT(OCIO::GetCachesMemoryUsage()->getEntrySize(0) > 0);
+
+    OCIO::ClearAllCaches();
+    memoryUsage = OCIO::GetCachesMemoryUsage();
+    OCIO_CHECK_EQUAL(memoryUsage->getTotalSize(), 0);
+
+    std::ostringstream oss;
+    oss << *processor->getMemoryUsage();
+    OCIO_CHECK_NE(oss.str().find("Memory usage: "), std::string::npos);
+    OCIO_CHECK_NE(oss.str().find("    <Lut1DOp>: 12288 bytes"), std::string::npos);
+}
+
+OCIO_ADD_TEST(Processor, concurrent_creation_inverse_lut1d)
+{
+    // The ops of a processor are shared by the CPU and GPU processors created from it, and are
+    // finalized again by each creation. Check that concurrent creations from the same processor
+    // neither modify nor copy the shared values of an inverse 1D LUT (which are made monotonic
+    // by the finalization).
+
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+    config->setProcessorCacheFlags(OCIO::PROCESSOR_CACHE_OFF);
+
+    constexpr unsigned long length = 4096;
+    auto lut = OCIO::Lut1DTransform::Create(length, false);
+    for (unsigned long idx = 0; idx < length; ++idx)
+    {
+        const float x = (float)idx / (float)(length - 1);
+        // Add a few reversals so that the values need to be flattened.
+        const float y = (idx % 512 == 511) ? x - 0.01f : x * x;
+        lut->setValue(idx, y, 0.5f * y, y * y);
+    }
+    lut->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+
+    OCIO::ConstProcessorRcPtr processor = config->getProcessor(lut);
+
+    constexpr long numPixels = 64;
+    std::vector<float> input(numPixels * 4);
+    for (long idx = 0; idx < numPixels * 4; ++idx)
+    {
+        input[idx] = (float)idx / (float)(numPixels * 4);
+    }
+
+    std::vector<float> expected = input;
+    processor->getOptimizedCPUProcessor(OCIO::OPTIMIZATION_NONE)->apply(
+        OCIO::PackedImageDesc(expected.data(), numPixels, 1, 4));
+
+    constexpr int numThreads = 8;
+    std::vector<std::vector<float>> results(numThreads);
+    std::vector<std::string> errors(numThreads);
+    std::vector<std::thread> threads;
+    for (int idx = 0; idx < numThreads; ++idx)
+    {
+        threads.emplace_back([&, idx]()
+        {
+            try
+            {
+                for (int iter = 0; iter < 20; ++iter)
+                {
+                    OCIO::ConstCPUProcessorRcPtr cpu;
+                    switch ((idx + iter) % 3)
+                    {
+                        case 0:
+                            cpu = processor->getDefaultCPUProcessor();
+                            break;
+                        case 1:
+                            cpu = processor->getOptimizedCPUProcessor(OCIO::OPTIMIZATION_NONE);
+                            break;
+                        default:
+                            OCIO::GpuShaderDescRcPtr shaderDesc
+                                = OCIO::GpuShaderDesc::CreateShaderDesc();
+                            processor->getDefaultGPUProcessor()->extractGpuShaderInfo(shaderDesc);
+                            cpu = processor->getOptimizedCPUProcessor(OCIO::OPTIMIZATION_NONE);
+                            break;
+                    }
+
+                    results[idx] = input;
+                    cpu->apply(OCIO::PackedImageDesc(results[idx].data(), numPixels, 1, 4));
+                }
+            }
+            catch (const std::exception & ex)
+            {
+                errors[idx] = ex.what();
+            }
+        });
+    }
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    for (int idx = 0; idx < numThreads; ++idx)
+    {
+        OCIO_CHECK_EQUAL(errors[idx], std::string());
+        OCIO_REQUIRE_EQUAL(results[idx].size(), expected.size());
+        for (size_t i = 0; i < expected.size(); ++i)
+        {
+            // The default CPU processor uses a faster but approximate inverse.
+            OCIO_CHECK_CLOSE(results[idx][i], expected[i], 1e-3f);
+        }
+    }
+}
+
+OCIO_ADD_TEST(Processor, concurrent_creation_lut_file)
+{
+    // The LUTs read from a file are shared through the file cache by all the processors using
+    // that file. Check that concurrent creations from the same files neither race on the LUTs
+    // nor give different results.
+
+    const std::string files[] = { "iridas_3d.cube", "resolve_1d3d.cube",
+                                  "clf/lut1d_lut3d_lut1d.clf" };
+
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+    config->setProcessorCacheFlags(OCIO::PROCESSOR_CACHE_OFF);
+
+    constexpr long numPixels = 64;
+    std::vector<float> input(numPixels * 4);
+    for (long idx = 0; idx < numPixels * 4; ++idx)
+    {
+        input[idx] = (float)idx / (float)(numPixels * 4);
+    }
+
+    for (const auto & file : files)
+    {
+        OCIO::ClearAllCaches();
+
+        auto fileTransform = OCIO::FileTransform::Create();
+        fileTransform->setSrc((OCIO::GetTestFilesDir() + "/" + file).c_str());
+        fileTransform->setInterpolation(OCIO::INTERP_LINEAR);
+
+        constexpr int numThreads = 8;
+        std::vector<std::string> cacheIDs(numThreads);
+        std::vector<std::vector<float>> results(numThreads);
+        std::vector<std::string> errors(numThreads);
+        std::vector<std::thread> threads;
+        for (int idx = 0; idx < numThreads; ++idx)
+        {
+            threads.emplace_back([&, idx]()
+            {
+                try
+                {
+                    for (int iter = 0; iter < 10; ++iter)
+                    {
+                        OCIO::ConstProcessorRcPtr processor = config->getProcessor(fileTransform);
+                        cacheIDs[idx] = processor->getCacheID();
+
+                        results[idx] = input;
+                        processor->getDefaultCPUProcessor()->apply(
+                            OCIO::PackedImageDesc(results[idx].data(), numPixels, 1, 4));
+                    }
+                }
+                catch (const std::exception & ex)
+                {
+                    errors[idx] = ex.what();
+                }
+            });
+        }
+        for (auto & thread : threads)
+        {
+            thread.join();
+        }
+
+        for (int idx = 0; idx < numThreads; ++idx)
+        {
+            OCIO_CHECK_EQUAL(errors[idx], std::string());
+            OCIO_CHECK_EQUAL(cacheIDs[idx], cacheIDs[0]);
+            OCIO_CHECK_ASSERT(results[idx] == results[0]);
+        }
+        OCIO_CHECK_ASSERT(results[0] != input);
+    }
+}
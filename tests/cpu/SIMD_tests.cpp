@@ -23,6 +23,8 @@ OCIO_ADD_TEST_SSE2(packed_uint16_to_f32_test)
 OCIO_ADD_TEST_SSE2(packed_f16_to_f32_test)
 OCIO_ADD_TEST_SSE2(packed_nan_inf_test)
 OCIO_ADD_TEST_SSE2(packed_all_test)
+OCIO_ADD_TEST_SSE2(lut3d_trilinear_test)
+OCIO_ADD_TEST_SSE2(fast_log_exp_pow_test)
 
 #endif
 
@@ -48,6 +50,7 @@ OCIO_ADD_TEST_AVX(packed_uint16_to_f32_test)
 #endif
 OCIO_ADD_TEST_AVX(packed_nan_inf_test)
 OCIO_ADD_TEST_AVX(packed_all_test)
+OCIO_ADD_TEST_AVX(lut3d_trilinear_test)
 
 #endif
 
@@ -73,6 +76,8 @@ OCIO_ADD_TEST_AVX2(packed_uint16_to_f32_test)
 #endif
 OCIO_ADD_TEST_AVX2(packed_nan_inf_test)
 OCIO_ADD_TEST_AVX2(packed_all_test)
+OCIO_ADD_TEST_AVX2(lut3d_trilinear_test)
+OCIO_ADD_TEST_AVX2(fast_log_exp_pow_test)
 
 #endif
 
@@ -96,5 +101,7 @@ OCIO_ADD_TEST_AVX512(packed_uint16_to_f32_test)
 OCIO_ADD_TEST_AVX512(packed_f16_to_f32_test)
 OCIO_ADD_TEST_AVX512(packed_nan_inf_test)
 OCIO_ADD_TEST_AVX512(packed_all_test)
+OCIO_ADD_TEST_AVX512(lut3d_trilinear_test)
+OCIO_ADD_TEST_AVX512(fast_log_exp_pow_test)
 
 #endif
\ No newline at end of file
@@ -5,13 +5,19 @@
 #include "CPUInfo.h"
 #if OCIO_USE_SSE2
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <sstream>
+#include <vector>
 
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "MathUtils.h"
 #include "BitDepthUtils.h"
+#include "FastLogExpPowCPU.h"
 #include "SSE2.h"
+#include "ops/lut3d/Lut3DOpCPU_SSE2.h"
 #include "testutils/UnitTest.h"
 
 namespace OCIO = OCIO_NAMESPACE;
@@ -454,4 +460,193 @@ DEFINE_SIMD_TEST(packed_all_test)
     }
 }
 
+DEFINE_SIMD_TEST(lut3d_trilinear_test)
+{
+    // The LUT is stored as expected by the renderers i.e. 4 floats per entry (RGB and an
+    // unused alpha) with the blue coordinate changing fastest.
+    constexpr int dim = 17;
+    const float maxIdx = static_cast<float>(dim - 1);
+
+    std::vector<float> lut(dim * dim * dim * 4, 0.0f);
+    for (int r = 0; r < dim; ++r)
+    {
+        for (int g = 0; g < dim; ++g)
+        {
+            for (int b = 0; b < dim; ++b)
+            {
+                const float rv = static_cast<float>(r) / maxIdx;
+                const float gv = static_cast<float>(g) / maxIdx;
+                const float bv = static_cast<float>(b) / maxIdx;
+
+                const int idx = 4 * (b + dim * (g + dim * r));
+                lut[idx + 0] = rv * rv + 0.1f * bv;
+                lut[idx + 1] = gv * bv - 0.2f * rv;
+                lut[idx + 2] = std::sqrt(bv) + 0.3f * gv * rv;
+            }
+        }
+    }
+
+    // Use a number of pixels which is not a multiple of the SIMD width to also cover the
+    // leftover pixels, with some values outside of the LUT domain and a NaN.
+    constexpr int numPixels = 1027;
+    std::vector<float> inImage(numPixels * 4);
+    for (int i = 0; i < numPixels; ++i)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            inImage[4 * i + c] = -0.1f + 1.2f * static_cast<float>((i * 37 + c * 101) % 1000) / 999.0f;
+        }
+        inImage[4 * i + 3] = static_cast<float>(i) / static_cast<float>(numPixels);
+    }
+    inImage[4 * 5 + 1] = std::numeric_limits<float>::quiet_NaN();
+
+    std::vector<float> outImage(numPixels * 4);
+    OCIO::applyTrilinearSSE2(lut.data(), dim, inImage.data(), outImage.data(), numPixels);
+
+    auto lerp = [](float x, float y, float t) { return x + (y - x) * t; };
+
+    for (int i = 0; i < numPixels; ++i)
+    {
+        int prev[3], next[3];
+        float delta[3];
+        for (int c = 0; c < 3; ++c)
+        {
+            float v = inImage[4 * i + c] * maxIdx;
+            // NaNs become 0.
+            v = std::isnan(v) ? 0.0f : std::min(std::max(v, 0.0f), maxIdx);
+
+            prev[c]  = static_cast<int>(std::floor(v));
+            next[c]  = std::min(prev[c] + 1, dim - 1);
+            delta[c] = v - static_cast<float>(prev[c]);
+        }
+
+        auto sample = [&](int r, int g, int b, int c)
+        {
+            return lut[4 * (b + dim * (g + dim * r)) + c];
+        };
+
+        for (int c = 0; c < 3; ++c)
+        {
+            const float c00 = lerp(sample(prev[0], prev[1], prev[2], c), sample(prev[0], prev[1], next[2], c), delta[2]);
+            const float c01 = lerp(sample(prev[0], next[1], prev[2], c), sample(prev[0], next[1], next[2], c), delta[2]);
+            const float c10 = lerp(sample(next[0], prev[1], prev[2], c), sample(next[0], prev[1], next[2], c), delta[2]);
+            const float c11 = lerp(sample(next[0], next[1], prev[2], c), sample(next[0], next[1], next[2], c), delta[2]);
+
+            const float expected = lerp(lerp(c00, c01, delta[1]), lerp(c10, c11, delta[1]), delta[0]);
+            const float actual   = outImage[4 * i + c];
+
+            OCIO_CHECK_ASSERT_MESSAGE(std::fabs(expected - actual) <= 1e-5f,
+                                      GetErrorMessage(expected, actual,
+                                                      OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32));
+        }
+
+        OCIO_CHECK_EQUAL(outImage[4 * i + 3], inImage[4 * i + 3]);
+    }
+}
+
+DEFINE_SIMD_TEST(fast_log_exp_pow_test)
+{
+    // Use a number of pixels which is not a multiple of the SIMD width to also cover the
+    // leftover pixels.
+    constexpr long numPixels = 1027;
+
+    struct Case
+    {
+        OCIO::FastLogExpPowKernel m_kernel;
+        float m_minValue;
+        float m_maxValue;
+        bool m_keepAlpha;
+    };
+
+    const Case cases[] = {
+        { OCIO::FAST_LOG2,            1e-4f, 100.0f, true  },
+        { OCIO::FAST_LOG2,            1e-4f, 100.0f, false },
+        { OCIO::FAST_EXP2,           -20.0f,  20.0f, true  },
+        { OCIO::FAST_POWER,           -0.5f,   4.0f, false },
+        { OCIO::FAST_POWER_MIRROR,    -4.0f,   4.0f, false },
+        { OCIO::FAST_POWER_PASS_THRU, -4.0f,   4.0f, true  },
+    };
+
+    for (const auto & test : cases)
+    {
+        OCIO::FastLogExpPowParams params;
+        const float exponents[4] = { 2.2f, 0.45f, 1.7f, 1.0f };
+        for (int c = 0; c < 4; ++c)
+        {
+            params.m_inScale[c]   = 0.5f + 0.25f * c;
+            params.m_inOffset[c]  = 0.01f * c;
+            params.m_exponent[c]  = exponents[c];
+            params.m_outScale[c]  = 1.5f - 0.25f * c;
+            params.m_outOffset[c] = -0.1f * c;
+        }
+        params.m_keepAlpha = test.m_keepAlpha;
+
+        std::vector<float> inImage(numPixels * 4);
+        for (long i = 0; i < numPixels * 4; ++i)
+        {
+            inImage[i] = test.m_minValue + (test.m_maxValue - test.m_minValue)
+                                           * static_cast<float>((i * 37) % 1000) / 999.0f;
+        }
+
+        std::vector<float> outImage(numPixels * 4);
+        OCIO::SSE2GetFastLogExpPowFunc(test.m_kernel)(params, inImage.data(), outImage.data(),
+                                                      numPixels);
+
+        for (long i = 0; i < numPixels * 4; ++i)
+        {
+            const int c = static_cast<int>(i % 4);
+            if (c == 3 && test.m_keepAlpha)
+            {
+                OCIO_CHECK_EQUAL(outImage[i], inImage[i]);
+                continue;
+            }
+
+            const double t = static_cast<double>(inImage[i]) * params.m_inScale[c]
+                             + params.m_inOffset[c];
+            const double y = params.m_exponent[c];
+
+            // The expected value and the error bound (see FastLogExpPowCPU.h) before the output
+            // scale and offset.
+            double value = 0.0;
+            double error = 0.0;
+            switch (test.m_kernel)
+            {
+                case OCIO::FAST_LOG2:
+                    value = std::log2(t);
+                    error = 2e-5;
+                    break;
+                case OCIO::FAST_EXP2:
+                    value = std::exp2(t);
+                    error = 3e-6 * value;
+                    break;
+                case OCIO::FAST_POWER:
+                case OCIO::FAST_POWER_MIRROR:
+                case OCIO::FAST_POWER_PASS_THRU:
+                {
+                    const double x = test.m_kernel == OCIO::FAST_POWER_MIRROR ? std::fabs(t) : t;
+                    if (x > 0.0)
+                    {
+                        value = std::copysign(std::pow(x, y), t);
+                        error = 5e-5 * std::pow(x, y) * (1.0 + std::fabs(y * std::log2(x)));
+                    }
+                    break;
+                }
+            }
+
+            const double expected
+                = (test.m_kernel == OCIO::FAST_POWER_PASS_THRU && t <= 0.0)
+                      ? t
+                      : value * params.m_outScale[c] + params.m_outOffset[c];
+            error *= params.m_outScale[c];
+
+            // Also allow for the rounding of the float computations.
+            const double actual = outImage[i];
+            OCIO_CHECK_ASSERT_MESSAGE(std::fabs(expected - actual)
+                                        <= error + 1e-6 * (1.0 + std::fabs(expected)),
+                                      GetErrorMessage(static_cast<float>(expected), outImage[i],
+                                                      OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32));
+        }
+    }
+}
+
 #endif // OCIO_USE_SSE2
\ No newline at end of file
@@ -0,0 +1,241 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "Trace.cpp"
+
+#include "testutils/UnitTest.h"
+#include "UnitTestUtils.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+#ifndef OCIO_DISABLE_TRACING
+
+namespace
+{
+
+struct Event
+{
+    std::string m_name;
+    std::string m_category;
+    std::string m_detail;
+    double m_start = 0.;
+    double m_duration = 0.;
+    unsigned long long m_threadID = 0;
+    unsigned m_depth = 0;
+};
+
+// Collect the trace events for the lifetime of the object.
+class TraceGuard
+{
+public:
+    TraceGuard()
+    {
+        OCIO::SetTraceFunction([this](const OCIO::TraceEvent & event)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_events.push_back({ event.name, event.category, event.detail,
+                                 event.start, event.duration, event.threadID, event.depth });
+        });
+    }
+
+    ~TraceGuard()
+    {
+        OCIO::ResetTraceFunction();
+    }
+
+    std::vector<Event> events() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_events;
+    }
+
+    const Event * find(const std::string & name) const
+    {
+        for (const auto & event : m_events)
+        {
+            if (event.m_name == name)
+            {
+                return &event;
+            }
+        }
+        return nullptr;
+    }
+
+private:
+    mutable std::mutex m_mutex;
+    std::vector<Event> m_events;
+};
+
+} // anon.
+
+OCIO_ADD_TEST(Trace, trace_function)
+{
+    OCIO_CHECK_ASSERT(!OCIO::IsTracingEnabled());
+    OCIO_CHECK_THROW_WHAT(OCIO::SetTraceFunction(nullptr), OCIO::Exception,
+                          "traceFunction must not be null");
+
+    {
+        // Spans are ignored when no sink is active.
+        OCIO_TRACE_SCOPE("test", "ignored");
+    }
+
+    std::vector<Event> events;
+    {
+        TraceGuard guard;
+        OCIO_CHECK_ASSERT(OCIO::IsTracingEnabled());
+
+        {
+            OCIO_TRACE_SCOPE("test", "outer");
+            {
+                OCIO_TRACE_SCOPE_DETAIL("test", "inner", std::string("file.clf"));
+            }
+            {
+                OCIO_TRACE_SCOPE_DETAIL("test", "inner2", "other.clf");
+            }
+        }
+        events = guard.events();
+    }
+    OCIO_CHECK_ASSERT(!OCIO::IsTracingEnabled());
+
+    {
+        OCIO_TRACE_SCOPE("test", "ignored");
+    }
+
+    // The events are sent when the spans complete.
+    OCIO_REQUIRE_EQUAL(events.size(), 3);
+
+    const Event & inner  = events[0];
+    const Event & inner2 = events[1];
+    const Event & outer  = events[2];
+
+    OCIO_CHECK_EQUAL(inner.m_name, "inner");
+    OCIO_CHECK_EQUAL(inner.m_category, "test");
+    OCIO_CHECK_EQUAL(inner.m_detail, "file.clf");
+    OCIO_CHECK_EQUAL(inner.m_depth, 1);
+    OCIO_CHECK_EQUAL(inner2.m_detail, "other.clf");
+    OCIO_CHECK_EQUAL(inner2.m_depth, 1);
+    OCIO_CHECK_EQUAL(outer.m_name, "outer");
+    OCIO_CHECK_EQUAL(outer.m_detail, "");
+    OCIO_CHECK_EQUAL(outer.m_depth, 0);
+
+    OCIO_CHECK_NE(outer.m_threadID, 0);
+    OCIO_CHECK_EQUAL(inner.m_threadID, outer.m_threadID);
+
+    // The inner spans are within the outer span.
+    OCIO_CHECK_ASSERT(outer.m_start <= inner.m_start);
+    OCIO_CHECK_ASSERT(inner.m_start + inner.m_duration <= inner2.m_start);
+    OCIO_CHECK_ASSERT(inner2.m_start + inner2.m_duration <= outer.m_start + outer.m_duration);
+}
+
+OCIO_ADD_TEST(Trace, threads)
+{
+    TraceGuard guard;
+
+    auto func = []()
+    {
+        OCIO_TRACE_SCOPE("test", "thread");
+    };
+
+    std::thread thread1(func);
+    std::thread thread2(func);
+    thread1.join();
+    thread2.join();
+
+    const std::vector<Event> events = guard.events();
+    OCIO_REQUIRE_EQUAL(events.size(), 2);
+    OCIO_CHECK_EQUAL(events[0].m_depth, 0);
+    OCIO_CHECK_EQUAL(events[1].m_depth, 0);
+    OCIO_CHECK_NE(events[0].m_threadID, events[1].m_threadID);
+}
+
+OCIO_ADD_TEST(Trace, trace_file)
+{
+    const std::string filename = OCIO::Platform::CreateTempFilename(".json");
+
+    OCIO::SetTraceFile(filename);
+    OCIO_CHECK_ASSERT(OCIO::IsTracingEnabled());
+    {
+        OCIO_TRACE_SCOPE("test", "outer");
+        {
+            OCIO_TRACE_SCOPE_DETAIL("test", "inner", "C:\\luts\\a \"b\".cube");
+        }
+    }
+    OCIO::SetTraceFile("");
+    OCIO_CHECK_ASSERT(!OCIO::IsTracingEnabled());
+
+    std::ifstream stream(filename);
+    std::stringstream ss;
+    ss << stream.rdbuf();
+    stream.close();
+    std::remove(filename.c_str());
+
+    const std::string json = ss.str();
+
+    OCIO_CHECK_EQUAL(json.front(), '[');
+    OCIO_CHECK_EQUAL(json.substr(json.size() - 4), "}\n]\n");
+    OCIO_CHECK_NE(json.find("{\"name\":\"inner\",\"cat\":\"test\",\"ph\":\"X\",\"ts\":"),
+                  std::string::npos);
+    OCIO_CHECK_NE(json.find("\"args\":{\"depth\":1,\"detail\":\"C:\\\\luts\\\\a \\\"b\\\".cube\"}}"),
+                  std::string::npos);
+    OCIO_CHECK_NE(json.find("},\n{\"name\":\"outer\""), std::string::npos);
+    OCIO_CHECK_NE(json.find("\"args\":{\"depth\":0}}\n]"), std::string::npos);
+}
+
+OCIO_ADD_TEST(Trace, processor_creation)
+{
+    OCIO::ClearAllCaches();
+
+    TraceGuard guard;
+
+    std::istringstream is(R"(ocio_profile_version: 2
+
+roles:
+  default: raw
+
+colorspaces:
+  - !<ColorSpace>
+    name: raw
+
+  - !<ColorSpace>
+    name: lut
+    from_scene_reference: !<FileTransform> {src: lut1d_1.spi1d}
+)");
+
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateFromStream(is)->createEditableCopy();
+    config->setSearchPath(OCIO::GetTestFilesDir().c_str());
+
+    OCIO::ConstProcessorRcPtr proc;
+    OCIO_CHECK_NO_THROW(proc = config->getProcessor("raw", "lut"));
+    OCIO_CHECK_NO_THROW(proc->getDefaultCPUProcessor());
+
+    OCIO::GpuShaderDescRcPtr shaderDesc = OCIO::GpuShaderDesc::CreateShaderDesc();
+    OCIO_CHECK_NO_THROW(proc->getDefaultGPUProcessor()->extractGpuShaderInfo(shaderDesc));
+
+    const Event * event = guard.find("Config::Read");
+    OCIO_REQUIRE_ASSERT(event);
+    OCIO_CHECK_EQUAL(event->m_category, "config");
+
+    event = guard.find("GetCachedFileAndFormat");
+    OCIO_REQUIRE_ASSERT(event);
+    OCIO_CHECK_EQUAL(event->m_category, "file");
+    OCIO_CHECK_NE(event->m_detail.find("lut1d_1.spi1d"), std::string::npos);
+
+    // The file is read during the processor creation.
+    const Event * procEvent = guard.find("Config::getProcessor");
+    OCIO_REQUIRE_ASSERT(procEvent);
+    OCIO_CHECK_ASSERT(procEvent->m_depth < event->m_depth);
+
+    OCIO_CHECK_ASSERT(guard.find("OpRcPtrVec::optimize"));
+    OCIO_CHECK_ASSERT(guard.find("CreateCPUEngine"));
+    OCIO_CHECK_ASSERT(guard.find("GPUProcessor::extractGpuShaderInfo"));
+}
+
+#endif // OCIO_DISABLE_TRACING
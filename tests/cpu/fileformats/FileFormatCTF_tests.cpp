@@ -1659,9 +1659,9 @@ OCIO_ADD_TEST(FileFormatCTF, difficult_syntax)
     OCIO_CHECK_NO_THROW(cachedFile = LoadCLFFile(ctfFile));
     OCIO_REQUIRE_ASSERT((bool)cachedFile);
 
-    // Check the expected warning.
+    // Check the expected warning (i.e. the line where the element starts).
     static constexpr char Warning[1024] = 
-        "difficult_syntax.clf(41): Unrecognized attribute 'unknown' of 'LUT1D'.";
+        "difficult_syntax.clf(36): Unrecognized attribute 'unknown' of 'LUT1D'.";
     OCIO_CHECK_NE(std::string::npos, 
                   StringUtils::Find( StringUtils::RightTrim(guard.output()), Warning ));
 
@@ -5859,6 +5859,95 @@ OCIO_ADD_TEST(CTFTransform, save_lut_3d)
     OCIO_CHECK_ASSERT(result.find(expected) != std::string::npos);
 }
 
+OCIO_ADD_TEST(CTFTransform, save_load_large_lut_3d)
+{
+    // The file is larger than the blocks read from the stream so a read ends in the middle of a
+    // line, which is then carried over to the next block fed to the parser.
+    static constexpr unsigned long gridSize = 33;
+
+    OCIO::Lut3DTransformRcPtr lut = OCIO::Lut3DTransform::Create(gridSize);
+    for (unsigned long r = 0; r < gridSize; ++r)
+    {
+        for (unsigned long g = 0; g < gridSize; ++g)
+        {
+            for (unsigned long b = 0; b < gridSize; ++b)
+            {
+                lut->setValue(r, g, b, r / 3.1f, -g / 7.3f, (b + 1) * 1.3e-5f);
+            }
+        }
+    }
+
+    OCIO::LocalCachedFileRcPtr cachedFile = WriteRead(lut);
+    const OCIO::ConstOpDataVec & fileOps = cachedFile->m_transform->getOpDataVec();
+    OCIO_REQUIRE_EQUAL(fileOps.size(), 1);
+    auto lutData = OCIO::DynamicPtrCast<const OCIO::Lut3DOpData>(fileOps[0]);
+    OCIO_REQUIRE_ASSERT(lutData);
+    OCIO_REQUIRE_EQUAL(lutData->getGridSize(), static_cast<long>(gridSize));
+
+    const OCIO::Array::Values & values = lutData->getArray().getValues();
+    OCIO_REQUIRE_EQUAL(values.size(), gridSize * gridSize * gridSize * 3);
+
+    for (unsigned long r = 0; r < gridSize; ++r)
+    {
+        for (unsigned long g = 0; g < gridSize; ++g)
+        {
+            for (unsigned long b = 0; b < gridSize; ++b)
+            {
+                float rv = 0.f, gv = 0.f, bv = 0.f;
+                lut->getValue(r, g, b, rv, gv, bv);
+
+                // The values are written with 8 significant digits.
+                const size_t idx = 3 * ((r * gridSize + g) * gridSize + b);
+                OCIO_CHECK_CLOSE(values[idx + 0], rv, 1e-7f * std::max(1.f, std::fabs(rv)));
+                OCIO_CHECK_CLOSE(values[idx + 1], gv, 1e-7f * std::max(1.f, std::fabs(gv)));
+                OCIO_CHECK_CLOSE(values[idx + 2], bv, 1e-7f);
+            }
+        }
+    }
+}
+
+OCIO_ADD_TEST(CTFTransform, load_large_lut_3d_single_line)
+{
+    // All the values are on one line which is longer than the blocks read from the stream, so
+    // the line (and a number) crosses the block boundaries.
+    static constexpr unsigned long gridSize = 33;
+    static constexpr unsigned long numValues = gridSize * gridSize * gridSize * 3;
+
+    std::ostringstream clf;
+    clf << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+    clf << "<ProcessList compCLFversion=\"3\" id=\"UIDLUT42\">\n";
+    clf << "    <LUT3D id=\"lut01\" inBitDepth=\"32f\" outBitDepth=\"32f\">\n";
+    clf << "        <Array dim=\"33 33 33 3\">";
+    for (unsigned long i = 0; i < numValues; ++i)
+    {
+        // Values from 0.10000000 to 0.10000999 so that every number has 8 decimals.
+        clf << " 0." << (10000000 + i % 1000);
+    }
+    clf << "</Array>\n";
+    clf << "    </LUT3D>\n";
+    clf << "</ProcessList>\n";
+
+    const std::string str = clf.str();
+    OCIO_REQUIRE_ASSERT(str.size() > 1024 * 1024);
+
+    OCIO::LocalCachedFileRcPtr cachedFile;
+    OCIO_CHECK_NO_THROW(cachedFile = ParseString(str));
+    OCIO_REQUIRE_ASSERT(cachedFile);
+    const OCIO::ConstOpDataVec & fileOps = cachedFile->m_transform->getOpDataVec();
+    OCIO_REQUIRE_EQUAL(fileOps.size(), 1);
+    auto lutData = OCIO::DynamicPtrCast<const OCIO::Lut3DOpData>(fileOps[0]);
+    OCIO_REQUIRE_ASSERT(lutData);
+
+    const OCIO::Array::Values & values = lutData->getArray().getValues();
+    OCIO_REQUIRE_EQUAL(values.size(), numValues);
+
+    for (unsigned long i = 0; i < numValues; ++i)
+    {
+        const float expected = 0.1f + (i % 1000) * 1e-8f;
+        OCIO_CHECK_CLOSE(values[i], expected, 1e-7f);
+    }
+}
+
 OCIO_ADD_TEST(CTFTransform, save_range)
 {
     OCIO::RangeTransformRcPtr rangeT = OCIO::RangeTransform::Create();
@@ -138,6 +138,39 @@ OCIO_ADD_TEST(XMLReaderHelper, get_numbers)
                           "followed by unexpected characters");
 }
 
+OCIO_ADD_TEST(XMLReaderHelper, append_numbers)
+{
+    std::vector<double> values{ -1. };
+
+    // The string is not null terminated.
+    const char str[] = ",  1.0 , 2.0\n \t 3.0,0.1e+1 inf -nan 0x42 4";
+    OCIO_CHECK_NO_THROW(OCIO::AppendNumbers(str, strlen(str) - 2, values));
+    OCIO_REQUIRE_EQUAL(values.size(), 8);
+    OCIO_CHECK_EQUAL(values[0], -1.);
+    OCIO_CHECK_EQUAL(values[1], 1.);
+    OCIO_CHECK_EQUAL(values[2], 2.);
+    OCIO_CHECK_EQUAL(values[3], 3.);
+    OCIO_CHECK_EQUAL(values[4], 1.);
+    OCIO_CHECK_ASSERT(std::isinf(values[5]));
+    OCIO_CHECK_ASSERT(OCIO::IsNan(values[6]));
+    OCIO_CHECK_EQUAL(values[7], 66.);           // i.e. 0x42
+
+    // Only delimiters.
+    values.clear();
+    OCIO_CHECK_NO_THROW(OCIO::AppendNumbers(" , \n", 4, values));
+    OCIO_CHECK_ASSERT(values.empty());
+
+    // Error: text is not a number.
+    OCIO_CHECK_THROW_WHAT(OCIO::AppendNumbers("0 error 2.0", 11, values),
+                          OCIO::Exception,
+                          "'error' can not be parsed");
+
+    // Error: number is not separated from text.
+    OCIO_CHECK_THROW_WHAT(OCIO::AppendNumbers("0 1.0error 2.0", 14, values),
+                          OCIO::Exception,
+                          "'1.0error' can not be parsed");
+}
+
 OCIO_ADD_TEST(XMLReaderHelper, trim)
 {
     const std::string original1("    some text    ");
@@ -55,11 +55,34 @@ void ApplyGamma(const OCIO::OpRcPtr & op,
 constexpr float qnan = std::numeric_limits<float>::quiet_NaN();
 constexpr float inf = std::numeric_limits<float>::infinity();
 
+// The expected values of the basic styles are the results of the SSE2 power approximation
+// but the AVX2 and AVX-512 ones slightly differ (i.e. they use fused multiply-adds).
+float GetBasicErrorThreshold()
+{
+#if OCIO_USE_AVX512
+    if (OCIO::CPUInfo::instance().hasAVX512())
+    {
+        return 2e-6f;
+    }
+#endif
+
+#if OCIO_USE_AVX2
+    if (OCIO::CPUInfo::instance().hasAVX2())
+    {
+        return 2e-6f;
+    }
+#endif
+
+    return 1e-7f;
+}
+
+const float basicErrorThreshold = GetBasicErrorThreshold();
+
 };
 
 OCIO_ADD_TEST(GammaOpCPU, apply_basic_style_fwd)
 {
-    const float errorThreshold = 1e-7f;
+    const float errorThreshold = basicErrorThreshold;
     const long numPixels = 7;
 
     float input_32f[numPixels*4] = {
@@ -125,7 +148,7 @@ OCIO_ADD_TEST(GammaOpCPU, apply_basic_style_fwd)
 
 OCIO_ADD_TEST(GammaOpCPU, apply_basic_style_rev)
 {
-    const float errorThreshold = 1e-7f;
+    const float errorThreshold = basicErrorThreshold;
     const long numPixels = 7;
 
     float input_32f[numPixels*4] = {
@@ -189,7 +212,7 @@ OCIO_ADD_TEST(GammaOpCPU, apply_basic_style_rev)
 
 OCIO_ADD_TEST(GammaOpCPU, apply_basic_mirror_style_fwd)
 {
-    const float errorThreshold = 1e-7f;
+    const float errorThreshold = basicErrorThreshold;
     const long numPixels = 9;
 
     float input_32f[numPixels * 4] = {
@@ -281,7 +304,7 @@ OCIO_ADD_TEST(GammaOpCPU, apply_basic_mirror_style_fwd)
 
 OCIO_ADD_TEST(GammaOpCPU, apply_basic_mirror_style_rev)
 {
-    const float errorThreshold = 1e-7f;
+    const float errorThreshold = basicErrorThreshold;
     const long numPixels = 9;
 
     float input_32f[numPixels * 4] = {
@@ -372,7 +395,7 @@ OCIO_ADD_TEST(GammaOpCPU, apply_basic_mirror_style_rev)
 
 OCIO_ADD_TEST(GammaOpCPU, apply_basic_pass_thru_style_fwd)
 {
-    const float errorThreshold = 1e-7f;
+    const float errorThreshold = basicErrorThreshold;
     const long numPixels = 9;
 
     float input_32f[numPixels * 4] = {
@@ -451,7 +474,7 @@ OCIO_ADD_TEST(GammaOpCPU, apply_basic_pass_thru_style_fwd)
 
 OCIO_ADD_TEST(GammaOpCPU, apply_basic_pass_thru_style_rev)
 {
-    const float errorThreshold = 1e-7f;
+    const float errorThreshold = basicErrorThreshold;
     const long numPixels = 9;
 
     float input_32f[numPixels * 4] = {
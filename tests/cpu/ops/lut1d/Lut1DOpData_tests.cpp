@@ -2,6 +2,8 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 
+#include <cstring>
+
 #include "ops/lut1d/Lut1DOpData.cpp"
 
 #include "testutils/UnitTest.h"
@@ -883,6 +885,45 @@ OCIO_ADD_TEST(Lut1DOpData, inverse_half_domain)
     OCIO_CHECK_ASSERT(invValues[0 + 2] >= invValues[32768 * 3 + 2]);
 }
 
+OCIO_ADD_TEST(Lut1DOpData, inverse_finalize_shared_values)
+{
+    // The ops are finalized again by each CPU or GPU processor created from a processor so,
+    // once the reversals are flattened, the finalization must neither modify nor copy the
+    // (possibly shared) values of an inverse LUT.
+
+    for (const auto halfFlags : { OCIO::Lut1DOpData::LUT_STANDARD,
+                                  OCIO::Lut1DOpData::LUT_INPUT_HALF_CODE })
+    {
+        auto lut = std::make_shared<OCIO::Lut1DOpData>(halfFlags, 65536, false);
+        SetLutArrayHalf(lut, 3u);
+        lut->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+
+        const OCIO::Array & array = static_cast<const OCIO::Lut1DOpData &>(*lut).getArray();
+        const float * values = array.getValues().data();
+
+        // The first finalization flattens the reversals.
+        OCIO_CHECK_NO_THROW(lut->finalize());
+        const std::vector<float> flattened = array.getValues();
+        values = array.getValues().data();
+
+        OCIO::Lut1DOpDataRcPtr clone = lut->clone();
+        const OCIO::Array & cloneArray
+            = static_cast<const OCIO::Lut1DOpData &>(*clone).getArray();
+        OCIO_CHECK_EQUAL(cloneArray.getValues().data(), values);
+
+        OCIO_CHECK_NO_THROW(lut->finalize());
+        OCIO_CHECK_NO_THROW(clone->finalize());
+        OCIO_CHECK_EQUAL(array.getValues().data(), values);
+        OCIO_CHECK_EQUAL(cloneArray.getValues().data(), values);
+        // Note that the half domain LUT has NaNs so the bits are compared.
+        OCIO_CHECK_EQUAL(std::memcmp(array.getValues().data(), flattened.data(),
+                                     flattened.size() * sizeof(float)), 0);
+        OCIO_CHECK_ASSERT(clone->getRedProperties().isIncreasing
+                          == lut->getRedProperties().isIncreasing);
+        OCIO_CHECK_EQUAL(clone->getRedProperties().endDomain, lut->getRedProperties().endDomain);
+    }
+}
+
 OCIO_ADD_TEST(Lut1DOpData, make_fast_from_inverse_gpu_extented_domain)
 {
     const std::string ctfFile("lut1d_inverse_gpu.ctf");
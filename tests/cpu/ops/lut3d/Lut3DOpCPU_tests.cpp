@@ -55,3 +55,74 @@ OCIO_ADD_TEST(Lut3DRenderer, nan_tetra_test)
     Lut3DRendererNaNTest(OCIO::INTERP_TETRAHEDRAL);
 }
 
+
+OCIO_ADD_TEST(InvLut3DRenderer, large_lut_round_trip)
+{
+    // A LUT large enough to have a deep range tree and to process the range tree levels and
+    // the fast LUT baking in several chunks.
+
+    static constexpr long dim = 33;
+    OCIO::Lut3DOpDataRcPtr lut = std::make_shared<OCIO::Lut3DOpData>(OCIO::INTERP_TETRAHEDRAL, dim);
+
+    // Make a non-linear LUT with some cross-talk between the channels.
+    OCIO::Array::Values & values = lut->getArray().getValues();
+    for (size_t idx = 0; idx < values.size(); idx += 3)
+    {
+        const float r = values[idx + 0];
+        const float g = values[idx + 1];
+        const float b = values[idx + 2];
+        values[idx + 0] = 0.9f * std::pow(r, 0.7f) + 0.1f * g;
+        values[idx + 1] = 0.9f * std::pow(g, 0.8f) + 0.1f * b;
+        values[idx + 2] = 0.9f * std::pow(b, 0.6f) + 0.1f * r;
+    }
+
+    OCIO::ConstLut3DOpDataRcPtr fwdLut = lut;
+    OCIO::ConstOpCPURcPtr fwdRenderer = OCIO::GetLut3DRenderer(fwdLut);
+
+    OCIO::ConstLut3DOpDataRcPtr invLut = lut->inverse();
+    OCIO::ConstOpCPURcPtr invRenderer;
+    OCIO_CHECK_NO_THROW(invRenderer = OCIO::GetLut3DRenderer(invLut));
+
+    // Sample colors inside the forward LUT domain.
+    static constexpr long steps = 21;
+    static constexpr long numPixels = steps * steps * steps;
+    std::vector<float> source(numPixels * 4);
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        source[4 * idx + 0] = float((idx / steps / steps) % steps) / float(steps - 1);
+        source[4 * idx + 1] = float((idx / steps) % steps) / float(steps - 1);
+        source[4 * idx + 2] = float(idx % steps) / float(steps - 1);
+        source[4 * idx + 3] = 0.5f;
+    }
+
+    std::vector<float> fwd(numPixels * 4);
+    fwdRenderer->apply(source.data(), fwd.data(), numPixels);
+
+    std::vector<float> inv(numPixels * 4);
+    invRenderer->apply(fwd.data(), inv.data(), numPixels);
+
+    // Need to do another forward apply since the inverse is not unique where the LUT is
+    // nearly flat (see the Lut3DOp cpu_renderer_inverse test).
+    std::vector<float> roundTrip(numPixels * 4);
+    fwdRenderer->apply(inv.data(), roundTrip.data(), numPixels);
+
+    for (long idx = 0; idx < numPixels * 4; ++idx)
+    {
+        OCIO_CHECK_CLOSE(roundTrip[idx], fwd[idx], 1e-5f);
+    }
+
+    // The fast inverse is baked by evaluating the exact inverse.
+    OCIO::Lut3DOpDataRcPtr fastLut;
+    OCIO_CHECK_NO_THROW(fastLut = OCIO::MakeFastLut3DFromInverse(invLut));
+    OCIO_REQUIRE_ASSERT(fastLut);
+    OCIO::ConstLut3DOpDataRcPtr fastLutConst = fastLut;
+    OCIO::ConstOpCPURcPtr fastRenderer = OCIO::GetLut3DRenderer(fastLutConst);
+
+    std::vector<float> fastInv(numPixels * 4);
+    fastRenderer->apply(fwd.data(), fastInv.data(), numPixels);
+
+    for (long idx = 0; idx < numPixels * 4; ++idx)
+    {
+        OCIO_CHECK_CLOSE(fastInv[idx], inv[idx], 0.02f);
+    }
+}
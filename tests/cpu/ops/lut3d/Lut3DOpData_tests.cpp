@@ -65,6 +65,46 @@ OCIO_ADD_TEST(Lut3DOpData, clone)
     OCIO_CHECK_ASSERT(pClone->getArray()==ref.getArray());
 }
 
+OCIO_ADD_TEST(Lut3DOpData, shared_values)
+{
+    OCIO::Lut3DOpData lut(17);
+    lut.getArray()[1] = 0.1f;
+    const OCIO::Array & array = static_cast<const OCIO::Lut3DOpData &>(lut).getArray();
+
+    // A clone shares the values until one of them is modified.
+    OCIO::Lut3DOpDataRcPtr pClone = lut.clone();
+    const OCIO::Array & cloneArray = static_cast<const OCIO::Lut3DOpData &>(*pClone).getArray();
+    OCIO_CHECK_EQUAL(cloneArray.getValues().data(), array.getValues().data());
+
+    pClone->getArray()[1] = 0.2f;
+    OCIO_CHECK_NE(cloneArray.getValues().data(), array.getValues().data());
+    OCIO_CHECK_EQUAL(array[1], 0.1f);
+    OCIO_CHECK_EQUAL(cloneArray[1], 0.2f);
+
+    // Finalized LUTs with the same content share the values.
+    OCIO::Lut3DOpData lut2(17);
+    lut2.getArray()[1] = 0.1f;
+    const OCIO::Array & array2 = static_cast<const OCIO::Lut3DOpData &>(lut2).getArray();
+    OCIO_CHECK_NE(array2.getValues().data(), array.getValues().data());
+
+    const std::string cacheID = lut.getCacheID();
+    lut.finalize();
+    lut2.finalize();
+    OCIO_CHECK_EQUAL(array2.getValues().data(), array.getValues().data());
+    OCIO_CHECK_EQUAL(lut.getCacheID(), cacheID);
+    OCIO_CHECK_EQUAL(lut2.getCacheID(), cacheID);
+
+    // The shared values are copied on modification.
+    lut2.getArray()[1] = 0.3f;
+    OCIO_CHECK_NE(array2.getValues().data(), array.getValues().data());
+    OCIO_CHECK_EQUAL(array[1], 0.1f);
+    OCIO_CHECK_NE(lut2.getCacheID(), cacheID);
+
+    pClone->finalize();
+    OCIO_CHECK_NE(cloneArray.getValues().data(), array.getValues().data());
+    OCIO_CHECK_NE(pClone->getCacheID(), cacheID);
+}
+
 OCIO_ADD_TEST(Lut3DOpData, not_supported_length)
 {
     OCIO_CHECK_NO_THROW(OCIO::Lut3DOpData{ OCIO::Max3DLUTLength });
@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <cmath>
 #include <stdio.h>
 #include <sstream>
 #include <string>
@@ -248,3 +249,51 @@ OCIO_ADD_GPU_TEST(Lut3DOp, 3dlut_biggest_supported)
 
     test.setErrorThreshold(1e-4f);
 }
+
+namespace
+{
+OCIO::Lut3DTransformRcPtr CreateLut3D(float scale)
+{
+    constexpr unsigned gridSize = 33;
+    OCIO::Lut3DTransformRcPtr lut = OCIO::Lut3DTransform::Create(gridSize);
+    for (unsigned r = 0; r < gridSize; ++r)
+    {
+        for (unsigned g = 0; g < gridSize; ++g)
+        {
+            for (unsigned b = 0; b < gridSize; ++b)
+            {
+                const float rv = float(r) / (gridSize - 1);
+                const float gv = float(g) / (gridSize - 1);
+                const float bv = float(b) / (gridSize - 1);
+                lut->setValue(r, g, b,
+                              scale * std::pow(0.8f * rv + 0.2f * gv, 0.45f),
+                              scale * std::pow(gv, 0.45f),
+                              scale * std::pow(0.9f * bv + 0.1f * rv, 0.45f));
+            }
+        }
+    }
+    return lut;
+}
+}
+
+OCIO_ADD_GPU_TEST(Lut3DOp, 3dlut_half_float_texture)
+{
+    // Values above 1 so the texture values are half-floats.
+    OCIO::Lut3DTransformRcPtr lut = CreateLut3D(1.5f);
+
+    test.getShaderDesc()->setTextureBitDepth(OCIO::BIT_DEPTH_F16);
+    test.setProcessor(lut);
+
+    // The half-float quantization step is 2^-10 for values in [1, 2).
+    test.setErrorThreshold(1e-3f);
+}
+
+OCIO_ADD_GPU_TEST(Lut3DOp, 3dlut_normalized_uint16_texture)
+{
+    OCIO::Lut3DTransformRcPtr lut = CreateLut3D(1.0f);
+
+    test.getShaderDesc()->setTextureBitDepth(OCIO::BIT_DEPTH_UINT16);
+    test.setProcessor(lut);
+
+    test.setErrorThreshold(1e-4f);
+}
@@ -0,0 +1,185 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "imageio.h"
+#include "testutils/UnitTest.h"
+#include "utils/FrameUtils.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+namespace
+{
+
+// The height is not a multiple of the block heights used by the tests.
+constexpr long Width  = 19;
+constexpr long Height = 37;
+
+std::string GetImagePath(const std::string & name)
+{
+    return std::string(OCIO::GetEnvVariable("TMP_IMAGES_DIR")) + "/" + name;
+}
+
+// All the values are unique and exactly represented in 32-bit float, even when scaled by two.
+float GetTestValue(long idx, float offset)
+{
+    return offset + float(idx) / 1024.0f;
+}
+
+void WriteTestImage(const std::string & filename, float offset)
+{
+    OCIO::ImageIO img(Width, Height, OCIO::CHANNEL_ORDERING_RGBA, OCIO::BIT_DEPTH_F32);
+
+    float * values = reinterpret_cast<float *>(img.getData());
+    for (long idx = 0; idx < Width * Height * 4; ++idx)
+    {
+        values[idx] = GetTestValue(idx, offset);
+    }
+
+    img.write(filename);
+}
+
+void CheckTestImage(const std::string & filename, float offset, const float (&scale)[4],
+                    unsigned line)
+{
+    const OCIO::ImageIO img(filename);
+
+    OCIO_REQUIRE_EQUAL_FROM(img.getWidth(), Width, line);
+    OCIO_REQUIRE_EQUAL_FROM(img.getHeight(), Height, line);
+    OCIO_REQUIRE_EQUAL_FROM(img.getBitDepth(), OCIO::BIT_DEPTH_F32, line);
+    OCIO_REQUIRE_EQUAL_FROM(img.getChannelOrder(), OCIO::CHANNEL_ORDERING_RGBA, line);
+
+    const float * values = reinterpret_cast<const float *>(img.getData());
+    for (long idx = 0; idx < Width * Height * 4; ++idx)
+    {
+        OCIO_CHECK_EQUAL_FROM(values[idx], GetTestValue(idx, offset) * scale[idx % 4], line);
+    }
+}
+
+} // anon.
+
+OCIO_ADD_TEST(ImageIO, stream_image)
+{
+    const std::string inputName  = GetImagePath("stream_input.exr");
+    const std::string outputName = GetImagePath("stream_output.exr");
+
+    WriteTestImage(inputName, 0.5f);
+
+    OCIO::ImageReader reader(inputName);
+    OCIO_REQUIRE_EQUAL(reader.getWidth(), Width);
+    OCIO_REQUIRE_EQUAL(reader.getHeight(), Height);
+    OCIO_REQUIRE_EQUAL(reader.getBitDepth(), OCIO::BIT_DEPTH_F32);
+    OCIO_REQUIRE_EQUAL(reader.getChannelOrder(), OCIO::CHANNEL_ORDERING_RGBA);
+
+    OCIO::ImageWriter writer(reader, OCIO::BIT_DEPTH_F32);
+    OCIO_CHECK_NO_THROW(writer.open(outputName));
+
+    // The processing stage runs on its own thread so the checks are done afterwards.
+    std::vector<std::pair<long, long>> blocks;
+    bool sameBuffers = true;
+
+    const OCIO::ScanlineBlockProcessor process
+        = [&blocks, &sameBuffers](long yBegin, long yEnd, uint8_t * src, uint8_t * dst)
+    {
+        blocks.emplace_back(yBegin, yEnd);
+        sameBuffers = sameBuffers && src == dst;
+
+        float * values = reinterpret_cast<float *>(dst);
+        for (long idx = 0; idx < (yEnd - yBegin) * Width * 4; ++idx)
+        {
+            values[idx] *= 2.0f;
+        }
+    };
+
+    OCIO_CHECK_NO_THROW(OCIO::StreamImage(reader, writer, process, 5, 3));
+    OCIO_CHECK_NO_THROW(writer.close());
+
+    // The blocks are processed in order and the last one is partial.
+    OCIO_CHECK_ASSERT(sameBuffers);
+    OCIO_REQUIRE_EQUAL(blocks.size(), size_t(8));
+    for (size_t idx = 0; idx < blocks.size(); ++idx)
+    {
+        OCIO_CHECK_EQUAL(blocks[idx].first, long(idx) * 5);
+        OCIO_CHECK_EQUAL(blocks[idx].second, std::min(long(idx + 1) * 5, Height));
+    }
+
+    CheckTestImage(outputName, 0.5f, { 2.0f, 2.0f, 2.0f, 2.0f }, __LINE__);
+}
+
+OCIO_ADD_TEST(ImageIO, stream_image_errors)
+{
+    const std::string inputName = GetImagePath("stream_errors.exr");
+
+    WriteTestImage(inputName, 0.0f);
+
+    OCIO::ImageReader reader(inputName);
+    OCIO::ImageWriter writer(reader, OCIO::BIT_DEPTH_F32);
+    OCIO_CHECK_NO_THROW(writer.open(GetImagePath("stream_errors_output.exr")));
+
+    // The error of the processing stage is rethrown.
+    const OCIO::ScanlineBlockProcessor process = [](long yBegin, long, uint8_t *, uint8_t *)
+    {
+        if (yBegin >= 10)
+        {
+            throw OCIO::Exception("Processing error.");
+        }
+    };
+
+    OCIO_CHECK_THROW_WHAT(OCIO::StreamImage(reader, writer, process, 5, 2),
+                          OCIO::Exception,
+                          "Processing error.");
+}
+
+#ifdef OCIO_TEST_OCIOCONVERT
+
+OCIO_ADD_TEST(ImageIO, ocioconvert_stream_frames)
+{
+    // Convert a sequence of three frames with a scale matrix, by blocks of five scanlines.
+
+    for (int frame = 1; frame <= 3; ++frame)
+    {
+        std::string name;
+        OCIO_REQUIRE_ASSERT(FrameUtils::ExpandFramePattern(name, "frames_input.####.exr", frame));
+        WriteTestImage(GetImagePath(name), float(frame));
+    }
+
+    const std::string lutName = GetImagePath("frames_scale.clf");
+    {
+        std::ofstream lut(lutName);
+        lut << "<ProcessList compCLFversion=\"3\" id=\"scale\">\n"
+               "    <Matrix inBitDepth=\"32f\" outBitDepth=\"32f\">\n"
+               "        <Array dim=\"3 3\">\n"
+               "            2 0   0\n"
+               "            0 0.5 0\n"
+               "            0 0   1\n"
+               "        </Array>\n"
+               "    </Matrix>\n"
+               "</ProcessList>\n";
+    }
+
+    const std::string cmd = std::string("\"") + OCIO::GetEnvVariable("OCIOCONVERT") + "\""
+                          + " --lut --frames 1-3 --blockheight 5"
+                          + " \"" + lutName + "\""
+                          + " \"" + GetImagePath("frames_input.####.exr") + "\""
+                          + " \"" + GetImagePath("frames_output.####.exr") + "\"";
+
+    OCIO_REQUIRE_EQUAL(std::system(cmd.c_str()), 0);
+
+    for (int frame = 1; frame <= 3; ++frame)
+    {
+        std::string name;
+        OCIO_REQUIRE_ASSERT(FrameUtils::ExpandFramePattern(name, "frames_output.####.exr", frame));
+        CheckTestImage(GetImagePath(name), float(frame), { 2.0f, 0.5f, 1.0f, 1.0f }, __LINE__);
+    }
+}
+
+#endif // OCIO_TEST_OCIOCONVERT
@@ -0,0 +1,13 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include "testutils/UnitTest.h"
+
+
+int main(int argc, const char ** argv)
+{
+    std::cerr << "\n OpenColorIO_ImageIO_Unit_Tests \n\n";
+
+    return UnitTestMain(argc, argv);
+}
@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include "testutils/UnitTest.h"
+#include "utils/FrameUtils.h"
+
+
+OCIO_ADD_TEST(FrameUtils, parse_frame_range)
+{
+    std::vector<int> frames;
+
+    OCIO_CHECK_ASSERT(FrameUtils::ParseFrameRange(frames, "1-4"));
+    OCIO_CHECK_ASSERT((frames == std::vector<int>{ 1, 2, 3, 4 }));
+
+    OCIO_CHECK_ASSERT(FrameUtils::ParseFrameRange(frames, "12"));
+    OCIO_CHECK_ASSERT((frames == std::vector<int>{ 12 }));
+
+    OCIO_CHECK_ASSERT(FrameUtils::ParseFrameRange(frames, "7-7"));
+    OCIO_CHECK_ASSERT((frames == std::vector<int>{ 7 }));
+
+    // The first frame could be negative.
+    OCIO_CHECK_ASSERT(FrameUtils::ParseFrameRange(frames, "-2-1"));
+    OCIO_CHECK_ASSERT((frames == std::vector<int>{ -2, -1, 0, 1 }));
+
+    OCIO_CHECK_ASSERT(FrameUtils::ParseFrameRange(frames, "-3"));
+    OCIO_CHECK_ASSERT((frames == std::vector<int>{ -3 }));
+
+    // Invalid ranges leave the frames unchanged.
+
+    frames = { 5 };
+
+    OCIO_CHECK_ASSERT(!FrameUtils::ParseFrameRange(frames, ""));
+    OCIO_CHECK_ASSERT(!FrameUtils::ParseFrameRange(frames, "-"));
+    OCIO_CHECK_ASSERT(!FrameUtils::ParseFrameRange(frames, "4-1"));
+    OCIO_CHECK_ASSERT(!FrameUtils::ParseFrameRange(frames, "1-"));
+    OCIO_CHECK_ASSERT(!FrameUtils::ParseFrameRange(frames, "-1-"));
+    OCIO_CHECK_ASSERT(!FrameUtils::ParseFrameRange(frames, "1--2"));
+    OCIO_CHECK_ASSERT(!FrameUtils::ParseFrameRange(frames, "1-2-3"));
+    OCIO_CHECK_ASSERT(!FrameUtils::ParseFrameRange(frames, "1:4"));
+    OCIO_CHECK_ASSERT(!FrameUtils::ParseFrameRange(frames, "a-4"));
+    OCIO_CHECK_ASSERT(!FrameUtils::ParseFrameRange(frames, "1-4x"));
+    OCIO_CHECK_ASSERT(!FrameUtils::ParseFrameRange(frames, "1.5"));
+    OCIO_CHECK_ASSERT(!FrameUtils::ParseFrameRange(frames, "99999999999"));
+
+    OCIO_CHECK_ASSERT((frames == std::vector<int>{ 5 }));
+}
+
+OCIO_ADD_TEST(FrameUtils, expand_frame_pattern)
+{
+    std::string name;
+
+    OCIO_CHECK_ASSERT(FrameUtils::ExpandFramePattern(name, "shot.####.exr", 12));
+    OCIO_CHECK_EQUAL(name, "shot.0012.exr");
+
+    OCIO_CHECK_ASSERT(FrameUtils::ExpandFramePattern(name, "shot.#.exr", 12));
+    OCIO_CHECK_EQUAL(name, "shot.12.exr");
+
+    OCIO_CHECK_ASSERT(FrameUtils::ExpandFramePattern(name, "shot.##.exr", 12345));
+    OCIO_CHECK_EQUAL(name, "shot.12345.exr");
+
+    OCIO_CHECK_ASSERT(FrameUtils::ExpandFramePattern(name, "####", 0));
+    OCIO_CHECK_EQUAL(name, "0000");
+
+    // The sign is part of the padding.
+    OCIO_CHECK_ASSERT(FrameUtils::ExpandFramePattern(name, "shot.####.exr", -5));
+    OCIO_CHECK_EQUAL(name, "shot.-005.exr");
+
+    // Only the first run of '#' is replaced.
+    OCIO_CHECK_ASSERT(FrameUtils::ExpandFramePattern(name, "sh##/shot.###.exr", 3));
+    OCIO_CHECK_EQUAL(name, "sh03/shot.###.exr");
+
+    name = "unchanged";
+    OCIO_CHECK_ASSERT(!FrameUtils::ExpandFramePattern(name, "shot.exr", 3));
+    OCIO_CHECK_EQUAL(name, "unchanged");
+}
@@ -81,3 +81,33 @@ OCIO_ADD_TEST(NumberUtils, from_chars_float_failures)
 
 #undef TEST_FROM_CHARS
 }
+
+OCIO_ADD_TEST(NumberUtils, to_chars)
+{
+#define TEST_TO_CHARS(value, precision, text) \
+    res = OCIO::NumberUtils::to_chars(buffer, buffer + sizeof(buffer), value, precision); \
+    OCIO_CHECK_ASSERT(res.ec == std::errc()); \
+    OCIO_CHECK_EQUAL(std::string(buffer, res.ptr), text)
+
+    char buffer[32];
+    OCIO::NumberUtils::to_chars_result res;
+
+    // Same as printf with "%.*g".
+    TEST_TO_CHARS(0., 8, "0");
+    TEST_TO_CHARS(-7., 8, "-7");
+    TEST_TO_CHARS(0.5, 8, "0.5");
+    TEST_TO_CHARS(double(0.1f), 8, "0.1");
+    TEST_TO_CHARS(double(0.9f), 8, "0.89999998");
+    TEST_TO_CHARS(1023., 5, "1023");
+    TEST_TO_CHARS(123456., 5, "1.2346e+05");
+    TEST_TO_CHARS(0.00001, 8, "1e-05");
+    TEST_TO_CHARS(81.9, 15, "81.9");
+    TEST_TO_CHARS(1. / 3., 15, "0.333333333333333");
+    TEST_TO_CHARS(std::numeric_limits<double>::infinity(), 8, "inf");
+
+    // The buffer is too small.
+    res = OCIO::NumberUtils::to_chars(buffer, buffer + 4, 1. / 3., 8);
+    OCIO_CHECK_ASSERT(res.ec == std::errc::value_too_large);
+
+#undef TEST_TO_CHARS
+}